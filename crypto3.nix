@@ -38,6 +38,7 @@ in stdenv.mkDerivation {
       "-DCMAKE_EXPORT_COMPILE_COMMANDS=ON" # to allow VSCode navigation/completion/etc
       "-DCMAKE_CXX_STANDARD=23"
       "-DCMAKE_CXX_STANDARD_REQUIRED=ON"
+      "-DCRYPTO3_NATIVE_ARCH=ON" # the default, AVX2/AVX-512 field arithmetic where the build host has it
       "-G Ninja"
     ];
 
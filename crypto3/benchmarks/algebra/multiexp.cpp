@@ -36,11 +36,13 @@
 
 #include <nil/crypto3/algebra/multiexp/multiexp.hpp>
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/algebra/multiexp/pippenger.hpp>
 
 #include <nil/crypto3/algebra/curves/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/bls12.hpp>
 #include <nil/crypto3/algebra/curves/mnt4.hpp>
 #include <nil/crypto3/algebra/curves/mnt6.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
 #include <nil/crypto3/algebra/curves/params/multiexp/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/params/multiexp/bls12.hpp>
 #include <nil/crypto3/algebra/curves/params/multiexp/mnt4.hpp>
@@ -152,6 +154,71 @@ void print_performance_csv(size_t expn_start, std::size_t expn_end_fast, std::si
     }
 }
 
+template<typename GroupType, typename FieldType>
+void print_pippenger_performance_csv(std::size_t expn_start, std::size_t expn_end,
+                                     std::size_t expn_end_bdlo12, std::size_t expn_end_table) {
+    using value_type = typename GroupType::value_type;
+
+    // Distinct bases, so that buckets do not degenerate into doublings of a single point.
+    const std::size_t max_size = std::size_t(1) << expn_end;
+    std::vector<value_type> bases(max_size);
+    bases[0] = random_element<GroupType>();
+    const value_type step = random_element<GroupType>();
+    for (std::size_t i = 1; i < max_size; i++) {
+        bases[i] = bases[i - 1] + step;
+    }
+    std::vector<typename FieldType::value_type> scalars(max_size);
+    for (auto &s : scalars) {
+        s = random_element<FieldType>();
+    }
+
+    std::cout << "log2(size)\tpippenger, ns\tBDLO12, ns\ttable build, ns\ttable, ns" << std::endl;
+    for (std::size_t expn = expn_start; expn <= expn_end; expn++) {
+        const std::size_t size = std::size_t(1) << expn;
+        printf("%ld", expn);
+        fflush(stdout);
+
+        long long start_time = get_nsec_time();
+        value_type pippenger_result = multiexp<policies::multiexp_method_pippenger>(
+            bases.cbegin(), bases.cbegin() + size, scalars.cbegin(), scalars.cbegin() + size, 1);
+        printf("\t%lld", get_nsec_time() - start_time);
+        fflush(stdout);
+
+        if (expn <= expn_end_bdlo12) {
+            start_time = get_nsec_time();
+            value_type bdlo12_result = multiexp<policies::multiexp_method_BDLO12>(
+                bases.cbegin(), bases.cbegin() + size, scalars.cbegin(), scalars.cbegin() + size, 1);
+            printf("\t%lld", get_nsec_time() - start_time);
+            fflush(stdout);
+
+            if (bdlo12_result != pippenger_result) {
+                fprintf(stderr, "Answers NOT MATCHING (BDLO12 != pippenger)\n");
+            }
+        } else {
+            printf("\t-");
+        }
+
+        // Precomputed tables hold ~scalar_bits / c points per base, keep them to sizes that fit in memory.
+        if (expn <= expn_end_table) {
+            start_time = get_nsec_time();
+            multiexp_precomputed_table<value_type, FieldType> table(bases.cbegin(), bases.cbegin() + size);
+            printf("\t%lld", get_nsec_time() - start_time);
+            fflush(stdout);
+
+            start_time = get_nsec_time();
+            value_type table_result = table.process(scalars.cbegin(), scalars.cbegin() + size);
+            printf("\t%lld", get_nsec_time() - start_time);
+            fflush(stdout);
+
+            if (table_result != pippenger_result) {
+                fprintf(stderr, "Answers NOT MATCHING (table != pippenger)\n");
+            }
+        }
+
+        printf("\n");
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(multiexp_test_suite)
 
 BOOST_AUTO_TEST_CASE(multiexp_test_case) {
@@ -163,4 +230,18 @@ BOOST_AUTO_TEST_CASE(multiexp_test_case) {
     print_performance_csv<curves::bls12<381>::g2_type<>, curves::bls12<381>::scalar_field_type>(2, 12, 14, true);
 }
 
+BOOST_AUTO_TEST_CASE(pippenger_test_case) {
+
+    std::cout << "Pippenger BLS12-381 G1" << std::endl;
+    print_pippenger_performance_csv<curves::bls12<381>::g1_type<>, curves::bls12<381>::scalar_field_type>(
+        16, 22, 18, 18);
+
+    std::cout << "Pippenger ALT_BN128 G1" << std::endl;
+    print_pippenger_performance_csv<curves::alt_bn128<254>::g1_type<>, curves::alt_bn128<254>::scalar_field_type>(
+        16, 22, 18, 18);
+
+    std::cout << "Pippenger Pallas" << std::endl;
+    print_pippenger_performance_csv<curves::pallas::g1_type<>, curves::pallas::scalar_field_type>(16, 22, 18, 18);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
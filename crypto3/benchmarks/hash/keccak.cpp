@@ -0,0 +1,120 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE keccak_benchmark
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/multi_lane_hash.hpp>
+
+#include <nil/crypto3/bench/benchmark.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::bench;
+
+using hash_type = hashes::keccak_1600<256>;
+using multi_lane_type = hashes::multi_lane_hash<hash_type>;
+using hashes::detail::keccak_1600_backend;
+
+// Merkle tree nodes hash two 32-byte children, the long message shows the absorbing throughput
+constexpr std::size_t node_size = 64;
+constexpr std::size_t long_message_size = 1 << 14;
+
+const std::vector<std::pair<keccak_1600_backend, std::string>> backends = {
+    {keccak_1600_backend::portable, "portable"},
+    {keccak_1600_backend::x86_64, "  x86_64"},
+    {keccak_1600_backend::avx2, "    avx2"},
+    {keccak_1600_backend::avx512, "  avx512"},
+};
+
+template<typename F>
+void for_each_backend(const F &func) {
+    for (auto const &[backend, name] : backends) {
+        if (hashes::detail::set_keccak_1600_backend(backend)) {
+            func("[keccak_1600<256>][" + name + "]");
+        }
+    }
+    hashes::detail::set_keccak_1600_backend(hashes::detail::keccak_1600_best_backend());
+}
+
+std::vector<std::uint8_t> make_message(std::size_t size) {
+    std::vector<std::uint8_t> message(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        message[i] = static_cast<std::uint8_t>(i * 131 + 7);
+    }
+    return message;
+}
+
+BOOST_AUTO_TEST_SUITE(keccak_benchmark_suite)
+
+BOOST_AUTO_TEST_CASE(keccak_node_perf) {
+    auto message = make_message(node_size);
+    for_each_backend([&](const std::string &name) {
+        run_benchmark<>(name + " 64 byte message", [&]() {
+            typename hash_type::digest_type digest = hash<hash_type>(message.begin(), message.end());
+            message[0] = digest[0];
+            return message[0];
+        });
+    });
+}
+
+BOOST_AUTO_TEST_CASE(keccak_long_message_perf) {
+    auto message = make_message(long_message_size);
+    for_each_backend([&](const std::string &name) {
+        run_benchmark<>(name + " 16 KiB message", [&]() {
+            typename hash_type::digest_type digest = hash<hash_type>(message.begin(), message.end());
+            message[0] = digest[0];
+            return message[0];
+        });
+    });
+}
+
+BOOST_AUTO_TEST_CASE(keccak_multi_lane_perf) {
+    std::array<std::vector<std::uint8_t>, multi_lane_type::lanes> messages;
+    std::array<const std::uint8_t *, multi_lane_type::lanes> pointers;
+    for (std::size_t i = 0; i < multi_lane_type::lanes; ++i) {
+        messages[i] = make_message(node_size);
+        messages[i][1] = static_cast<std::uint8_t>(i);
+        pointers[i] = messages[i].data();
+    }
+    std::array<typename hash_type::digest_type, multi_lane_type::lanes> digests;
+    for_each_backend([&](const std::string &name) {
+        run_benchmark<>(name + " 64 byte message x" + std::to_string(multi_lane_type::lanes) + " multi-lane", [&]() {
+            multi_lane_type::hash(pointers.data(), node_size, multi_lane_type::lanes, digests.data());
+            messages[0][0] = digests[multi_lane_type::lanes - 1][0];
+            return messages[0][0];
+        });
+    });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
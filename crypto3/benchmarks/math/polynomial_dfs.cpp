@@ -42,7 +42,11 @@
 #include <boost/timer/progress_display.hpp>
 #include <boost/timer/timer.hpp>
 
+#include <nil/crypto3/algebra/fields/arithmetic_params/babybear.hpp>
 #include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/goldilocks.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+#include <nil/crypto3/math/domains/basic_radix2_domain.hpp>
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
 #include <nil/crypto3/random/algebraic_engine.hpp>
 
@@ -212,4 +216,32 @@ BENCHMARK_AUTO_TEST_CASE(polynomial_sum_real_test, 10) {
     BOOST_CHECK_EQUAL(naive_res, res);
 }
 
+template<typename Field>
+void fft_algorithms_benchmark(test_case_base& benchmark, const std::string& field_name, std::size_t log_size) {
+    nil::crypto3::random::algebraic_engine<Field> engine(1337);
+    std::vector<typename Field::value_type> values(1u << log_size);
+    for (auto& value : values) {
+        value = engine();
+    }
+    basic_radix2_domain<Field> domain(values.size());
+
+    for (auto algorithm : {fft_algorithm::radix2, fft_algorithm::cache_blocked}) {
+        const std::string flag = field_name + " 2^" + std::to_string(log_size) +
+            (algorithm == fft_algorithm::radix2 ? " radix2" : " cache_blocked");
+        auto data = values;
+        domain.algorithm = algorithm;
+        benchmark.timers[flag].start();
+        domain.fft(data);
+        benchmark.timers[flag].stop();
+    }
+}
+
+BENCHMARK_AUTO_TEST_CASE(fft_algorithms_test, 5) {
+    for (std::size_t log_size : {16, 20, 22}) {
+        fft_algorithms_benchmark<nil::crypto3::algebra::fields::babybear>(*this, "BabyBear", log_size);
+        fft_algorithms_benchmark<nil::crypto3::algebra::fields::goldilocks>(*this, "Goldilocks", log_size);
+        fft_algorithms_benchmark<nil::crypto3::algebra::fields::pallas_base_field>(*this, "Pallas", log_size);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -16,6 +16,8 @@
 #include <boost/test/data/test_case.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <tuple>
@@ -25,6 +27,7 @@
 #include <nil/crypto3/multiprecision/inverse.hpp>
 #include <nil/crypto3/multiprecision/literals.hpp>
 
+#include <nil/crypto3/multiprecision/detail/big_mod/packed_modular_ops.hpp>
 #include <nil/crypto3/multiprecision/detail/big_mod/test_support.hpp>
 
 using namespace nil::crypto3::multiprecision;
@@ -197,3 +200,75 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(pow_perf, Case, cases) {
         return x_raw_base;
     });
 }
+
+struct BabyBearPacked {
+    using ops_t = nil::crypto3::multiprecision::detail::babybear_modular_ops;
+    static constexpr auto name = "[    packed][    babybear]";
+};
+
+struct KoalaBearPacked {
+    using ops_t = nil::crypto3::multiprecision::detail::koalabear_modular_ops;
+    static constexpr auto name = "[    packed][   koalabear]";
+};
+
+struct Mersenne31Packed {
+    using ops_t = nil::crypto3::multiprecision::detail::mersenne31_modular_ops;
+    static constexpr auto name = "[    packed][  mersenne31]";
+};
+
+struct GoldilocksPacked {
+    using ops_t = nil::crypto3::multiprecision::detail::goldilocks_modular_ops;
+    static constexpr auto name = "[    packed][  goldilocks]";
+};
+
+using packed_cases = std::tuple<BabyBearPacked, KoalaBearPacked, Mersenne31Packed, GoldilocksPacked>;
+
+// Size of static_simd_vector chunks used by the expression evaluator.
+constexpr std::size_t PACKED_SIZE = 64;
+
+template<typename Case>
+auto packed_operands() {
+    using base_type = typename Case::ops_t::base_type;
+    const auto &ops = nil::crypto3::multiprecision::detail::modular_ops_storage_fixed_ct<
+        typename Case::ops_t>::ops();
+    std::array<base_type, PACKED_SIZE> x, y;
+    for (std::size_t i = 0; i < PACKED_SIZE; ++i) {
+        x[i] = static_cast<base_type>((x_64 + i * y_64) % ops.mod());
+        y[i] = static_cast<base_type>((y_64 + i * x_64) % ops.mod());
+    }
+    return std::make_pair(x, y);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(packed_mul_perf, Case, packed_cases) {
+    using packed_t = nil::crypto3::multiprecision::detail::packed_modular_ops<typename Case::ops_t>;
+    const auto &ops = nil::crypto3::multiprecision::detail::modular_ops_storage_fixed_ct<
+        typename Case::ops_t>::ops();
+    auto [x, y] = packed_operands<Case>();
+    run_benchmark<>(std::string(Case::name) + " packed mul x64", [&]() {
+        packed_t::mul(x, y);
+        return x[0];
+    });
+    run_benchmark<>(std::string(Case::name) + " scalar mul x64", [&]() {
+        for (std::size_t i = 0; i < PACKED_SIZE; ++i) {
+            ops.mul(x[i], y[i]);
+        }
+        return x[0];
+    });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(packed_add_perf, Case, packed_cases) {
+    using packed_t = nil::crypto3::multiprecision::detail::packed_modular_ops<typename Case::ops_t>;
+    const auto &ops = nil::crypto3::multiprecision::detail::modular_ops_storage_fixed_ct<
+        typename Case::ops_t>::ops();
+    auto [x, y] = packed_operands<Case>();
+    run_benchmark<>(std::string(Case::name) + " packed add x64", [&]() {
+        packed_t::add(x, y);
+        return x[0];
+    });
+    run_benchmark<>(std::string(Case::name) + " scalar add x64", [&]() {
+        for (std::size_t i = 0; i < PACKED_SIZE; ++i) {
+            ops.add(x[i], y[i]);
+        }
+        return x[0];
+    });
+}
@@ -0,0 +1,197 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE thread_pool_benchmark
+
+// Do it manually for all performance tests
+#define PROFILING_ENABLED
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/algorithms/calculate_domain_set.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+#include <nil/crypto3/zk/commitments/polynomial/lpc.hpp>
+#include <nil/crypto3/zk/commitments/polynomial/fri.hpp>
+
+#include <nil/crypto3/bench/scoped_profiler.hpp>
+
+using namespace nil::crypto3;
+
+// The two-level boost::asio pool which was used before the work-stealing scheduler, kept here as a baseline.
+class legacy_thread_pool {
+public:
+    enum class PoolLevel {
+        LOW,
+        HIGH
+    };
+
+    static legacy_thread_pool& get_instance(PoolLevel pool_id) {
+        static legacy_thread_pool instance_for_low_level(ThreadPool::core_count());
+        static legacy_thread_pool instance_for_high_level(ThreadPool::core_count());
+        return pool_id == PoolLevel::LOW ? instance_for_low_level : instance_for_high_level;
+    }
+
+    template<class ReturnType>
+    std::future<ReturnType> post(std::function<ReturnType()> task) {
+        auto packaged_task = std::make_shared<std::packaged_task<ReturnType()>>(std::move(task));
+        std::future<ReturnType> fut = packaged_task->get_future();
+        boost::asio::post(pool, [packaged_task]() -> void { (*packaged_task)(); });
+        return fut;
+    }
+
+    std::size_t get_pool_size() const {
+        return pool_size;
+    }
+
+    static void parallel_run_in_chunks(std::size_t elements_count,
+                                       std::function<void(std::size_t begin, std::size_t end)> func,
+                                       PoolLevel pool_id) {
+        auto& thread_pool = get_instance(pool_id);
+        std::vector<std::future<void>> fut;
+        std::size_t workers_to_use = std::max((size_t)1, std::min(elements_count, thread_pool.get_pool_size()));
+        static constexpr std::size_t POOL_0_MIN_CHUNK_SIZE = 1 << 12;
+        if (pool_id == PoolLevel::LOW && elements_count / workers_to_use < POOL_0_MIN_CHUNK_SIZE) {
+            workers_to_use = std::max((size_t)1, (elements_count + POOL_0_MIN_CHUNK_SIZE - 1) / POOL_0_MIN_CHUNK_SIZE);
+        }
+        std::size_t begin = 0;
+        for (std::size_t i = 0; i < workers_to_use; i++) {
+            auto end = begin + (elements_count - begin) / (workers_to_use - i);
+            fut.emplace_back(thread_pool.post<void>([begin, end, func]() { func(begin, end); }));
+            begin = end;
+        }
+        wait_for_all(std::move(fut));
+    }
+
+private:
+    legacy_thread_pool(std::size_t pool_size) : pool(pool_size), pool_size(pool_size) {
+    }
+
+    boost::asio::thread_pool pool;
+    const std::size_t pool_size;
+};
+
+using field_type = algebra::curves::bls12<381>::scalar_field_type;
+using value_type = typename field_type::value_type;
+
+// Mimics the shape of basic_fri::precommit: a HIGH level loop over the columns, where every column runs
+// 'log_size' LOW level passes over its values, each of them followed by a barrier, like the FFT stages do.
+template<typename RunInChunks>
+void column_passes(std::vector<std::vector<value_type>>& columns, const value_type& factor, RunInChunks run_in_chunks) {
+    run_in_chunks(columns.size(), [&columns, &factor, &run_in_chunks](std::size_t begin, std::size_t end) {
+        for (std::size_t c = begin; c < end; ++c) {
+            auto& column = columns[c];
+            for (std::size_t pass = 1; pass < column.size(); pass <<= 1) {
+                run_in_chunks(column.size(), [&column, &factor](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; ++i) {
+                        column[i] *= factor;
+                    }
+                }, ThreadPool::PoolLevel::LOW);
+            }
+        }
+    }, ThreadPool::PoolLevel::HIGH);
+}
+
+std::vector<std::vector<value_type>> make_columns(std::size_t columns_count, std::size_t log_size) {
+    std::vector<std::vector<value_type>> columns(columns_count, std::vector<value_type>(1 << log_size));
+    for (auto& column : columns) {
+        for (auto& value : column) {
+            value = algebra::random_element<field_type>();
+        }
+    }
+    return columns;
+}
+
+BOOST_AUTO_TEST_SUITE(thread_pool_performance_test_suite)
+
+BOOST_AUTO_TEST_CASE(nested_column_passes) {
+    const value_type factor = algebra::random_element<field_type>();
+
+    for (std::size_t log_size : {12, 16, 18}) {
+        auto columns = make_columns(64, log_size);
+
+        {
+            PROFILE_SCOPE("Two-level asio pools, 64 columns of 2^{}", log_size);
+            column_passes(columns, factor, [](std::size_t count, auto func, ThreadPool::PoolLevel level) {
+                legacy_thread_pool::parallel_run_in_chunks(count, func,
+                    level == ThreadPool::PoolLevel::LOW ? legacy_thread_pool::PoolLevel::LOW
+                                                        : legacy_thread_pool::PoolLevel::HIGH);
+            });
+        }
+
+        {
+            PROFILE_SCOPE("Work-stealing scheduler, 64 columns of 2^{}", log_size);
+            column_passes(columns, factor, [](std::size_t count, auto func, ThreadPool::PoolLevel level) {
+                wait_for_all(parallel_run_in_chunks<void>(count, func, level));
+            });
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(lpc_batch_precommit) {
+    // Per-polynomial resize runs on HIGH level and spawns the LOW level FFT, which is exactly the nesting
+    // that was only allowed in one direction with the two-level pools.
+    typedef hashes::keccak_1600<256> merkle_hash_type;
+    typedef hashes::keccak_1600<256> transcript_hash_type;
+
+    constexpr static const std::size_t lambda = 40;
+    constexpr static const std::size_t m = 2;
+    constexpr static const std::size_t log_size = 16;
+    constexpr static const std::size_t batch_size = 64;
+
+    typedef zk::commitments::fri<field_type, merkle_hash_type, transcript_hash_type, m> fri_type;
+    typedef zk::commitments::list_polynomial_commitment_params<merkle_hash_type, transcript_hash_type, m> lpc_params_type;
+    typedef zk::commitments::list_polynomial_commitment<field_type, lpc_params_type> lpc_type;
+    using lpc_scheme_type = zk::commitments::lpc_commitment_scheme<lpc_type, math::polynomial_dfs<value_type>>;
+
+    typename fri_type::params_type fri_params(1, log_size, lambda, 2 /* expand_factor */);
+    lpc_scheme_type lpc_scheme_prover(fri_params);
+
+    for (std::size_t i = 0; i < batch_size; ++i) {
+        std::vector<value_type> values(1 << log_size);
+        for (auto& value : values) {
+            value = algebra::random_element<field_type>();
+        }
+        lpc_scheme_prover.append_to_batch(0, math::polynomial_dfs<value_type>((1 << log_size) - 1, std::move(values)));
+    }
+
+    PROFILE_SCOPE("LPC commit of {} polynomials of 2^{}", batch_size, log_size);
+    lpc_scheme_prover.commit(0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,144 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE dag_expression_evaluator_benchmark
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include <boost/random.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/goldilocks.hpp>
+#include <nil/crypto3/random/algebraic_engine.hpp>
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/variable.hpp>
+#include <nil/crypto3/zk/math/cached_assignment_table.hpp>
+#include <nil/crypto3/zk/math/dag_expression.hpp>
+#include <nil/crypto3/zk/math/dag_expression_evaluator.hpp>
+#include <nil/crypto3/zk/math/dag_expression_program.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::zk::snark;
+
+// A gate set shaped like the zkEVM circuits: every constraint is a selector times a product of linear combinations
+// of the witnesses at rotations -1, 0, 1, so the columns and many products are shared between the constraints.
+template<typename FieldType>
+void dag_evaluator_benchmark(std::size_t log_rows, std::size_t witness_amount, std::size_t selector_amount,
+                             std::size_t constraints_amount, std::size_t max_degree) {
+    using value_type = typename FieldType::value_type;
+    using polynomial_dfs_type = math::polynomial_dfs<value_type>;
+    using var = plonk_variable<polynomial_dfs_type>;
+    using private_table_type = typename plonk_polynomial_dfs_table<FieldType>::private_table_type;
+    using public_table_type = typename plonk_polynomial_dfs_table<FieldType>::public_table_type;
+
+    boost::random::mt19937 random_engine(0x5eed);
+    random::algebraic_engine<FieldType> field_engine(random_engine);
+
+    const std::size_t rows = std::size_t(1) << log_rows;
+    auto random_column = [&]() {
+        polynomial_dfs_type column(rows - 1, rows);
+        for (auto& value : column) {
+            value = field_engine();
+        }
+        return column;
+    };
+    std::vector<polynomial_dfs_type> witnesses, selectors;
+    for (std::size_t i = 0; i < witness_amount; ++i) {
+        witnesses.push_back(random_column());
+    }
+    for (std::size_t i = 0; i < selector_amount; ++i) {
+        selectors.push_back(random_column());
+    }
+    auto table = std::make_shared<plonk_polynomial_dfs_table<FieldType>>(
+        std::make_shared<private_table_type>(witnesses),
+        std::make_shared<public_table_type>(std::vector<polynomial_dfs_type>(), std::vector<polynomial_dfs_type>(),
+                                            selectors));
+
+    auto random_index = [&](std::size_t n) {
+        return boost::random::uniform_int_distribution<std::size_t>(0, n - 1)(random_engine);
+    };
+    auto linear_combination = [&]() {
+        expression<var> result(polynomial_dfs_type(0, 1, field_engine()));
+        for (std::size_t i = 0, size = 1 + random_index(4); i < size; ++i) {
+            var w(random_index(witness_amount), static_cast<std::int32_t>(random_index(3)) - 1,
+                  var::column_type::witness);
+            result += expression<var>(polynomial_dfs_type(0, 1, field_engine())) * w;
+        }
+        return result;
+    };
+
+    std::set<var> variables;
+    expression_for_each_variable_visitor<var> variables_visitor(
+        [&variables](const var& v) { variables.insert(v); });
+    dag_expression_builder<var> builder;
+    for (std::size_t i = 0; i < constraints_amount; ++i) {
+        expression<var> constraint = linear_combination();
+        for (std::size_t degree = 1, target = 1 + random_index(max_degree - 1); degree < target; ++degree) {
+            constraint *= linear_combination();
+        }
+        constraint *= var(random_index(selector_amount), 0, var::column_type::selector);
+        variables_visitor.visit(constraint);
+        builder.add_expression(constraint);
+    }
+    dag_expression<var> dag = builder.build();
+
+    polynomial_dfs_type mask_assignment(rows - 1, rows, value_type::one());
+    polynomial_dfs_type lagrange_0(rows - 1, rows);
+    cached_assignment_table<FieldType> cache(table, mask_assignment, lagrange_0);
+    cache.ensure_cache(variables, rows * max_degree);
+
+    dag_expression_evaluator<FieldType> evaluator(dag, max_degree);
+    evaluator.evaluate(cache);
+
+    const std::size_t runs = 3;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < runs; ++i) {
+        evaluator.evaluate(cache);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    dag_expression_program<FieldType> program(dag);
+    std::cout << constraints_amount << " constraints over " << witness_amount << " witnesses, 2^" << log_rows
+              << " rows, " << dag.get_nodes_count() << " DAG nodes, " << program.get_instructions().size()
+              << " instructions on " << program.get_register_count()
+              << " registers: " << elapsed.count() / runs / 1000 << " ms per evaluation" << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE(dag_expression_evaluator_benchmark_suite)
+
+BOOST_AUTO_TEST_CASE(zkevm_like_pallas) {
+    dag_evaluator_benchmark<algebra::curves::pallas::base_field_type>(10, 140, 16, 400, 4);
+}
+
+BOOST_AUTO_TEST_CASE(zkevm_like_goldilocks) {
+    dag_evaluator_benchmark<algebra::fields::goldilocks>(12, 140, 16, 400, 4);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
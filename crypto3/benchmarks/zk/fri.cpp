@@ -0,0 +1,127 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE fri_benchmark
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/goldilocks.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+
+#include <nil/crypto3/zk/commitments/detail/polynomial/proof_of_work.hpp>
+#include <nil/crypto3/zk/commitments/polynomial/fri.hpp>
+
+using namespace nil::crypto3;
+
+// Peak resident set size of the process in KiB.
+std::size_t peak_rss_kib() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+// Precommits a batch of polynomials, reports the time and how much the peak RSS grew while committing.
+template<typename FieldType>
+void fri_precommit_benchmark(std::size_t log_size, std::size_t batch_size, std::size_t fri_step) {
+    typedef hashes::keccak_1600<256> merkle_hash_type;
+    typedef zk::commitments::fri<FieldType, merkle_hash_type, merkle_hash_type, 2> fri_type;
+    typedef math::polynomial_dfs<typename FieldType::value_type> polynomial_type;
+
+    const std::size_t size = std::size_t(1) << log_size;
+    auto D = math::make_evaluation_domain<FieldType>(size);
+
+    std::vector<polynomial_type> poly(batch_size, polynomial_type(size - 1, size));
+    for (auto &f : poly) {
+        for (std::size_t i = 0; i < size; i++) {
+            f[i] = algebra::random_element<FieldType>();
+        }
+    }
+
+    const std::size_t rss_before = peak_rss_kib();
+    auto start = std::chrono::steady_clock::now();
+    auto tree = zk::algorithms::precommit<fri_type>(poly, D, fri_step);
+    auto elapsed =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    const std::size_t rss_after = peak_rss_kib();
+
+    std::cout << "FRI precommit 2^" << log_size << " x " << batch_size << ", step " << fri_step << ": "
+              << elapsed.count() << " ms, peak RSS +" << (rss_after - rss_before) / 1024 << " MiB (total "
+              << rss_after / 1024 << " MiB)" << std::endl;
+    BOOST_CHECK(tree.leaves() == size >> fri_step);
+}
+
+// Grinds on a few transcripts from the seed 0, so that the nonces tried are known, and reports the hash rate.
+// Every nonce costs two hashes: absorbing it and drawing the challenge.
+template<typename HashType>
+void grinding_benchmark(std::size_t grinding_bits, std::size_t runs) {
+    typedef zk::commitments::proof_of_work<HashType> pow_type;
+
+    std::size_t nonces = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t run = 0; run < runs; run++) {
+        std::vector<std::uint8_t> init_blob{static_cast<std::uint8_t>(run)};
+        typename pow_type::transcript_type transcript(init_blob);
+        nonces += std::size_t(pow_type::generate(transcript, grinding_bits, 0)) + 1;
+    }
+    auto elapsed =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    std::cout << "Grinding " << grinding_bits << " bits: " << nonces << " nonces in " << elapsed.count() / 1000
+              << " ms, " << 2.0 * nonces / elapsed.count() << " Mhash/s" << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE(fri_benchmark_suite)
+
+BOOST_AUTO_TEST_CASE(precommit_bls12_381) {
+    fri_precommit_benchmark<algebra::curves::bls12<381>::scalar_field_type>(18, 16, 3);
+}
+
+BOOST_AUTO_TEST_CASE(precommit_goldilocks) {
+    fri_precommit_benchmark<algebra::fields::goldilocks>(20, 16, 3);
+}
+
+BOOST_AUTO_TEST_CASE(grinding_keccak) {
+    grinding_benchmark<hashes::keccak_1600<256>>(20, 8);
+}
+
+BOOST_AUTO_TEST_CASE(grinding_sha2) {
+    grinding_benchmark<hashes::sha2<256>>(20, 8);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
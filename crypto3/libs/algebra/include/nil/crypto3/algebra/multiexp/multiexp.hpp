@@ -32,6 +32,8 @@
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
 #include <nil/crypto3/algebra/curves/params.hpp>
 
+#include <nil/actor/core/parallelization_utils.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace algebra {
@@ -52,15 +54,22 @@ namespace nil {
 
                 const std::size_t one_chunk_size = total_size / chunks_count;
 
-                base_value_type result = base_value_type::zero();
+                std::vector<base_value_type> partial(chunks_count);
+                wait_for_all(parallel_run_in_chunks<void>(
+                    chunks_count,
+                    [&](std::size_t begin, std::size_t end) {
+                        for (std::size_t i = begin; i < end; ++i) {
+                            partial[i] = MultiexpMethod::process(
+                                vec_start + i * one_chunk_size,
+                                (i == chunks_count - 1 ? vec_end : vec_start + (i + 1) * one_chunk_size),
+                                scalar_start + i * one_chunk_size,
+                                (i == chunks_count - 1 ? scalar_end : scalar_start + (i + 1) * one_chunk_size));
+                        }
+                    }, ThreadPool::PoolLevel::HIGH));
 
-                for (std::size_t i = 0; i < chunks_count; ++i) {
-                    result +=
-                        MultiexpMethod::process(
-                            vec_start + i * one_chunk_size,
-                            (i == chunks_count - 1 ? vec_end : vec_start + (i + 1) * one_chunk_size),
-                            scalar_start + i * one_chunk_size,
-                            (i == chunks_count - 1 ? scalar_end : scalar_start + (i + 1) * one_chunk_size));
+                base_value_type result = base_value_type::zero();
+                for (const auto &p : partial) {
+                    result += p;
                 }
 
                 return result;
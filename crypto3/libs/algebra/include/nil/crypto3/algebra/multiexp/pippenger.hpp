@@ -0,0 +1,601 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_MULTIEXP_PIPPENGER_HPP
+#define CRYPTO3_ALGEBRA_MULTIEXP_PIPPENGER_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/multiprecision/big_uint.hpp>
+
+#include <nil/crypto3/algebra/curves/forms.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace policies {
+                namespace detail {
+
+                    // The affine conversion and the batch-affine additions below use short Weierstrass formulas.
+                    template<typename BaseValueType, typename = void>
+                    struct is_short_weierstrass_point : std::false_type { };
+
+                    template<typename BaseValueType>
+                    struct is_short_weierstrass_point<BaseValueType, std::void_t<typename BaseValueType::form>>
+                        : std::is_same<typename BaseValueType::form, curves::forms::short_weierstrass> { };
+
+                    template<typename BaseValueType>
+                    struct pippenger_types {
+                        static_assert(is_short_weierstrass_point<BaseValueType>::value,
+                                      "batch-affine Pippenger supports short Weierstrass curves only");
+
+                        using base_value_type = BaseValueType;
+                        using affine_type = std::remove_cvref_t<decltype(std::declval<base_value_type>().to_affine())>;
+                        using coordinate_type = std::remove_cvref_t<decltype(std::declval<affine_type>().X)>;
+
+                        // x = X / Z^2, y = Y / Z^3 rather than x = X / Z, y = Y / Z.
+                        static constexpr bool is_jacobian =
+                            std::is_same_v<typename base_value_type::coordinates, curves::coordinates::jacobian> ||
+                            std::is_same_v<typename base_value_type::coordinates, curves::coordinates::jacobian_with_a4_0> ||
+                            std::is_same_v<typename base_value_type::coordinates, curves::coordinates::jacobian_with_a4_minus_3>;
+
+                        static base_value_type from_affine(const affine_type &point) {
+                            if (point.is_zero()) {
+                                return base_value_type::zero();
+                            }
+                            return base_value_type(point.X, point.Y, coordinate_type::one());
+                        }
+                    };
+
+                    /**
+                     * Converts [begin, begin + count) to affine coordinates, sharing one field inversion
+                     * per worker chunk (Montgomery's trick). Points at infinity map to affine zero.
+                     */
+                    template<typename InputBaseIterator>
+                    std::vector<typename pippenger_types<
+                        typename std::iterator_traits<InputBaseIterator>::value_type>::affine_type>
+                        batch_to_affine(InputBaseIterator begin, std::size_t count) {
+
+                        using base_value_type = typename std::iterator_traits<InputBaseIterator>::value_type;
+                        using types = pippenger_types<base_value_type>;
+                        using affine_type = typename types::affine_type;
+                        using coordinate_type = typename types::coordinate_type;
+
+                        std::vector<affine_type> result(count);
+
+                        wait_for_all(parallel_run_in_chunks<void>(
+                            count,
+                            [&result, begin](std::size_t chunk_begin, std::size_t chunk_end) {
+                                std::vector<coordinate_type> prefix(chunk_end - chunk_begin);
+                                coordinate_type acc = coordinate_type::one();
+                                for (std::size_t i = chunk_begin; i < chunk_end; ++i) {
+                                    const base_value_type &point = begin[i];
+                                    prefix[i - chunk_begin] = acc;
+                                    if (!point.is_zero()) {
+                                        acc *= point.Z;
+                                    }
+                                }
+                                acc = acc.inversed();
+                                for (std::size_t i = chunk_end; i-- > chunk_begin;) {
+                                    const base_value_type &point = begin[i];
+                                    if (point.is_zero()) {
+                                        result[i] = affine_type::zero();
+                                        continue;
+                                    }
+                                    const coordinate_type z_inv = acc * prefix[i - chunk_begin];
+                                    acc *= point.Z;
+                                    if constexpr (types::is_jacobian) {
+                                        const coordinate_type z_inv_2 = z_inv.squared();
+                                        result[i] = affine_type(point.X * z_inv_2, point.Y * z_inv_2 * z_inv);
+                                    } else {
+                                        result[i] = affine_type(point.X * z_inv, point.Y * z_inv);
+                                    }
+                                }
+                            }));
+
+                        return result;
+                    }
+
+                    /**
+                     * Buckets of affine points, accumulated with batch-affine additions: pending additions
+                     * are queued until a batch is full and then share a single field inversion.
+                     * A bucket may take part in at most one queued addition at a time, further points for
+                     * a busy bucket are paired with each other and their sums are fed back later, so
+                     * inputs hitting the same bucket over and over still converge in a logarithmic number
+                     * of rounds.
+                     */
+                    template<typename BaseValueType>
+                    class batch_affine_buckets {
+                        using types = pippenger_types<BaseValueType>;
+                        using base_value_type = BaseValueType;
+                        using affine_type = typename types::affine_type;
+                        using coordinate_type = typename types::coordinate_type;
+
+                        // Queued addition lhs + rhs; targets below buckets_count are buckets, the ones above
+                        // are paired points which are fed back into bucket (target - buckets_count).
+                        struct pending_addition {
+                            affine_type lhs;
+                            affine_type rhs;
+                            std::size_t target;
+                        };
+
+                    public:
+                        static constexpr std::size_t max_batch_size = 1024;
+
+                        explicit batch_affine_buckets(std::size_t buckets_count) :
+                            buckets(buckets_count), spares(buckets_count),
+                            state(buckets_count, 0),
+                            batch_size(std::clamp<std::size_t>(buckets_count / 2, 1, max_batch_size)) {
+                            batch.reserve(batch_size);
+                            denominators.reserve(batch_size);
+                            prefix.reserve(batch_size);
+                        }
+
+                        void add(std::size_t bucket, const affine_type &point) {
+                            push(bucket, point);
+                            while (feedback.size() >= batch_size) {
+                                std::vector<std::pair<std::size_t, affine_type>> current;
+                                current.swap(feedback);
+                                for (const auto &[b, p] : current) {
+                                    push(b, p);
+                                }
+                            }
+                        }
+
+                        /// Drains all queued work and returns sum_b (b + 1) * bucket[b].
+                        base_value_type reduce() {
+                            for (;;) {
+                                flush();
+                                for (std::size_t b = 0; b < buckets.size(); ++b) {
+                                    if (state[b] & has_spare) {
+                                        state[b] &= ~has_spare;
+                                        feedback.emplace_back(b, spares[b]);
+                                    }
+                                }
+                                if (feedback.empty()) {
+                                    break;
+                                }
+                                std::vector<std::pair<std::size_t, affine_type>> current;
+                                current.swap(feedback);
+                                for (const auto &[b, p] : current) {
+                                    push(b, p);
+                                }
+                            }
+
+                            base_value_type running = base_value_type::zero();
+                            base_value_type total = base_value_type::zero();
+                            for (std::size_t b = buckets.size(); b-- > 0;) {
+                                if (state[b] & filled) {
+                                    running += types::from_affine(buckets[b]);
+                                }
+                                total += running;
+                            }
+                            return total;
+                        }
+
+                    private:
+                        static constexpr std::uint8_t filled = 1;
+                        static constexpr std::uint8_t busy = 2;
+                        static constexpr std::uint8_t has_spare = 4;
+
+                        void push(std::size_t b, const affine_type &point) {
+                            if (!(state[b] & filled)) {
+                                buckets[b] = point;
+                                state[b] |= filled;
+                                return;
+                            }
+                            if (!(state[b] & busy)) {
+                                batch.push_back({buckets[b], point, b});
+                                state[b] |= busy;
+                            } else if (!(state[b] & has_spare)) {
+                                spares[b] = point;
+                                state[b] |= has_spare;
+                                return;
+                            } else {
+                                batch.push_back({spares[b], point, buckets.size() + b});
+                                state[b] &= ~has_spare;
+                            }
+                            if (batch.size() == batch_size) {
+                                flush();
+                            }
+                        }
+
+                        void store(std::size_t target, const affine_type &point) {
+                            if (target < buckets.size()) {
+                                state[target] &= ~busy;
+                                if (point.is_zero()) {
+                                    state[target] &= ~filled;
+                                } else {
+                                    buckets[target] = point;
+                                }
+                            } else if (!point.is_zero()) {
+                                feedback.emplace_back(target - buckets.size(), point);
+                            }
+                        }
+
+                        void flush() {
+                            if (batch.empty()) {
+                                return;
+                            }
+
+                            denominators.resize(batch.size());
+                            prefix.resize(batch.size());
+
+                            coordinate_type acc = coordinate_type::one();
+                            for (std::size_t i = 0; i < batch.size(); ++i) {
+                                denominators[i] = batch[i].rhs.X - batch[i].lhs.X;
+                                prefix[i] = acc;
+                                if (!denominators[i].is_zero()) {
+                                    acc *= denominators[i];
+                                }
+                            }
+                            acc = acc.inversed();
+
+                            for (std::size_t i = batch.size(); i-- > 0;) {
+                                const pending_addition &op = batch[i];
+                                if (denominators[i].is_zero()) {
+                                    // Doubling or P + (-P), rare enough to go through projective formulas.
+                                    store(op.target,
+                                          (types::from_affine(op.lhs) + types::from_affine(op.rhs)).to_affine());
+                                    continue;
+                                }
+                                const coordinate_type inv = acc * prefix[i];
+                                acc *= denominators[i];
+
+                                const coordinate_type lambda = (op.rhs.Y - op.lhs.Y) * inv;
+                                const coordinate_type x = lambda.squared() - op.lhs.X - op.rhs.X;
+                                const coordinate_type y = lambda * (op.lhs.X - x) - op.lhs.Y;
+                                store(op.target, affine_type(x, y));
+                            }
+                            batch.clear();
+                        }
+
+                        std::vector<affine_type> buckets;
+                        std::vector<affine_type> spares;
+                        std::vector<std::uint8_t> state;
+                        std::size_t batch_size;
+
+                        std::vector<pending_addition> batch;
+                        std::vector<coordinate_type> denominators;
+                        std::vector<coordinate_type> prefix;
+                        std::vector<std::pair<std::size_t, affine_type>> feedback;
+                    };
+
+                    /**
+                     * Signed-digit recoding of scalars: with H = sum_k 2^(k * c + c - 1), the digits of
+                     * s + H in base 2^c, each shifted down by 2^(c - 1), lie in [-2^(c - 1), 2^(c - 1))
+                     * and sum up to s. This halves the number of buckets per window.
+                     */
+                    template<typename ScalarValueType>
+                    class signed_window_recoding {
+                        using field_type = typename ScalarValueType::field_type;
+                        using integral_type = typename field_type::integral_type;
+
+                    public:
+                        using wide_integral_type = nil::crypto3::multiprecision::big_uint<integral_type::Bits + 64>;
+
+                        static constexpr std::size_t scalar_bits = field_type::modulus_bits;
+
+                        explicit signed_window_recoding(std::size_t window_bits) :
+                            window_bits(window_bits),
+                            windows_count(windows_count_for(window_bits)) {
+                            BOOST_ASSERT(window_bits >= 2 && window_bits < 32);
+                            for (std::size_t k = 0; k < windows_count; ++k) {
+                                offset.bit_set(k * window_bits + window_bits - 1);
+                            }
+                        }
+
+                        // Two spare bits keep s + H below 2^(windows_count * c).
+                        static std::size_t windows_count_for(std::size_t window_bits) {
+                            return (scalar_bits + 2 + window_bits - 1) / window_bits;
+                        }
+
+                        wide_integral_type shift(const ScalarValueType &scalar) const {
+                            wide_integral_type result = scalar.to_integral();
+                            result += offset;
+                            return result;
+                        }
+
+                        std::int64_t digit(const wide_integral_type &shifted, std::size_t window) const {
+                            const std::size_t position = window * window_bits;
+                            std::int64_t value = 0;
+                            for (std::size_t j = window_bits; j-- > 0;) {
+                                value = (value << 1) | std::int64_t(shifted.bit_test(position + j));
+                            }
+                            return value - (std::int64_t(1) << (window_bits - 1));
+                        }
+
+                        const std::size_t window_bits;
+                        const std::size_t windows_count;
+
+                    private:
+                        wide_integral_type offset;
+                    };
+
+                    template<typename BaseValueType>
+                    void add_signed(batch_affine_buckets<BaseValueType> &buckets,
+                                    std::int64_t digit,
+                                    const typename pippenger_types<BaseValueType>::affine_type &point) {
+                        using affine_type = typename pippenger_types<BaseValueType>::affine_type;
+                        if (digit > 0) {
+                            buckets.add(digit - 1, point);
+                        } else if (digit < 0) {
+                            buckets.add(-digit - 1, affine_type(point.X, -point.Y));
+                        }
+                    }
+
+                    /// Rough cost model in field multiplications: batch-affine additions per input and
+                    /// two projective additions per bucket for the running-sum reduction.
+                    inline std::size_t pippenger_cost(std::size_t additions, std::size_t buckets_reductions,
+                                                      std::size_t window_bits) {
+                        return 6 * additions + 30 * buckets_reductions * (std::size_t(1) << (window_bits - 1));
+                    }
+
+                    template<typename ScalarValueType>
+                    std::size_t pippenger_window_bits(std::size_t size) {
+                        using recoding = signed_window_recoding<ScalarValueType>;
+                        std::size_t best = 2;
+                        std::size_t best_cost = std::numeric_limits<std::size_t>::max();
+                        for (std::size_t c = 2; c <= 22; ++c) {
+                            const std::size_t windows = recoding::windows_count_for(c);
+                            const std::size_t cost = pippenger_cost(windows * size, windows, c);
+                            if (cost < best_cost) {
+                                best_cost = cost;
+                                best = c;
+                            }
+                        }
+                        return best;
+                    }
+                }    // namespace detail
+
+                /**
+                 * Multi-threaded Pippenger (bucket) multi-exponentiation.
+                 * Scalars are recoded into signed windows, so every window needs 2^(c-1) buckets only.
+                 * Bases are converted to affine coordinates once, buckets are filled with batch-affine
+                 * additions sharing a single inversion per batch and reduced with running sums.
+                 * Windows (and, for large thread pools, slices of the input) are processed in parallel.
+                 * Curves in other forms fall back to BDLO12, which keeps its buckets in projective coordinates.
+                 */
+                struct multiexp_method_pippenger {
+                    template<typename InputBaseIterator, typename InputFieldIterator>
+                    static inline typename std::iterator_traits<InputBaseIterator>::value_type
+                        process(InputBaseIterator vec_start,
+                                InputBaseIterator vec_end,
+                                InputFieldIterator scalar_start,
+                                InputFieldIterator scalar_end) {
+
+                        typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+
+                        if constexpr (!detail::is_short_weierstrass_point<base_value_type>::value) {
+                            return multiexp_method_BDLO12::process(vec_start, vec_end, scalar_start, scalar_end);
+                        } else {
+                            return process_short_weierstrass(vec_start, vec_end, scalar_start, scalar_end);
+                        }
+                    }
+
+                private:
+                    template<typename InputBaseIterator, typename InputFieldIterator>
+                    static typename std::iterator_traits<InputBaseIterator>::value_type
+                        process_short_weierstrass(InputBaseIterator vec_start,
+                                                  InputBaseIterator vec_end,
+                                                  InputFieldIterator scalar_start,
+                                                  InputFieldIterator scalar_end) {
+
+                        typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+                        typedef typename std::iterator_traits<InputFieldIterator>::value_type field_value_type;
+                        using recoding_type = detail::signed_window_recoding<field_value_type>;
+                        using wide_integral_type = typename recoding_type::wide_integral_type;
+
+                        BOOST_ASSERT(std::distance(vec_start, vec_end) == std::distance(scalar_start, scalar_end));
+
+                        const std::size_t size = std::distance(vec_start, vec_end);
+                        if (size == 0) {
+                            return base_value_type::zero();
+                        }
+
+                        const recoding_type recoding(detail::pippenger_window_bits<field_value_type>(size));
+                        const auto bases = detail::batch_to_affine(vec_start, size);
+
+                        std::vector<wide_integral_type> shifted(size);
+                        wait_for_all(parallel_run_in_chunks<void>(
+                            size,
+                            [&shifted, &recoding, scalar_start](std::size_t begin, std::size_t end) {
+                                for (std::size_t i = begin; i < end; ++i) {
+                                    shifted[i] = recoding.shift(scalar_start[i]);
+                                }
+                            }));
+
+                        const std::size_t windows_count = recoding.windows_count;
+                        const std::size_t buckets_count = std::size_t(1) << (recoding.window_bits - 1);
+
+                        // Split the input into slices when there are more workers than windows.
+                        const std::size_t pool_size =
+                            ThreadPool::get_instance(ThreadPool::PoolLevel::HIGH).get_pool_size();
+                        const std::size_t slices_count = std::clamp<std::size_t>(
+                            (pool_size + windows_count - 1) / windows_count, 1, std::max<std::size_t>(1, size / buckets_count));
+
+                        std::vector<base_value_type> partial(windows_count * slices_count);
+                        wait_for_all(parallel_run_in_chunks<void>(
+                            partial.size(),
+                            [&](std::size_t begin, std::size_t end) {
+                                for (std::size_t task = begin; task < end; ++task) {
+                                    const std::size_t window = task / slices_count;
+                                    const std::size_t slice = task % slices_count;
+                                    const std::size_t from = size * slice / slices_count;
+                                    const std::size_t to = size * (slice + 1) / slices_count;
+
+                                    detail::batch_affine_buckets<base_value_type> buckets(buckets_count);
+                                    for (std::size_t i = from; i < to; ++i) {
+                                        if (!bases[i].is_zero()) {
+                                            detail::add_signed(buckets, recoding.digit(shifted[i], window), bases[i]);
+                                        }
+                                    }
+                                    partial[task] = buckets.reduce();
+                                }
+                            }, ThreadPool::PoolLevel::HIGH));
+
+                        base_value_type result = base_value_type::zero();
+                        for (std::size_t window = windows_count; window-- > 0;) {
+                            for (std::size_t j = 0; j < recoding.window_bits; ++j) {
+                                result.double_inplace();
+                            }
+                            for (std::size_t slice = 0; slice < slices_count; ++slice) {
+                                result += partial[window * slices_count + slice];
+                            }
+                        }
+                        return result;
+                    }
+                };
+            }    // namespace policies
+
+            /**
+             * Precomputed multiples 2^(k * c) * P_i of a fixed set of bases (e.g. an SRS) in affine form.
+             * A multi-exponentiation over the table needs no doublings and a single set of buckets:
+             * the digit of window k of scalar i selects a bucket for the precomputed point (i, k).
+             * The table holds windows_count points per base, which is traded for speed.
+             * Short Weierstrass curves only.
+             */
+            template<typename BaseValueType, typename ScalarFieldType>
+            class multiexp_precomputed_table {
+                using types = policies::detail::pippenger_types<BaseValueType>;
+                using recoding_type = policies::detail::signed_window_recoding<typename ScalarFieldType::value_type>;
+
+            public:
+                using base_value_type = BaseValueType;
+                using affine_type = typename types::affine_type;
+                using scalar_value_type = typename ScalarFieldType::value_type;
+
+                template<typename InputBaseIterator>
+                multiexp_precomputed_table(InputBaseIterator vec_start, InputBaseIterator vec_end,
+                                           std::size_t window_bits = 0) :
+                    bases_count(std::distance(vec_start, vec_end)),
+                    recoding(window_bits == 0 ? default_window_bits(bases_count) : window_bits) {
+
+                    const std::size_t windows_count = recoding.windows_count;
+                    std::vector<base_value_type> multiples(bases_count * windows_count);
+                    wait_for_all(parallel_run_in_chunks<void>(
+                        bases_count,
+                        [&](std::size_t begin, std::size_t end) {
+                            for (std::size_t i = begin; i < end; ++i) {
+                                base_value_type point = vec_start[i];
+                                for (std::size_t k = 0; k < windows_count; ++k) {
+                                    multiples[i * windows_count + k] = point;
+                                    for (std::size_t j = 0; j < recoding.window_bits; ++j) {
+                                        point.double_inplace();
+                                    }
+                                }
+                            }
+                        }));
+                    points = policies::detail::batch_to_affine(multiples.begin(), multiples.size());
+                }
+
+                /// Window width minimizing additions plus bucket reduction for a single bucket set.
+                static std::size_t default_window_bits(std::size_t size) {
+                    std::size_t best = 2;
+                    std::size_t best_cost = std::numeric_limits<std::size_t>::max();
+                    for (std::size_t c = 2; c <= 22; ++c) {
+                        const std::size_t cost =
+                            policies::detail::pippenger_cost(recoding_type::windows_count_for(c) * size, 1, c);
+                        if (cost < best_cost) {
+                            best_cost = cost;
+                            best = c;
+                        }
+                    }
+                    return best;
+                }
+
+                std::size_t size() const {
+                    return bases_count;
+                }
+
+                std::size_t window_bits() const {
+                    return recoding.window_bits;
+                }
+
+                /// Computes sum_i scalar_i * P_i over the first distance(scalar_start, scalar_end) bases.
+                template<typename InputFieldIterator>
+                base_value_type process(InputFieldIterator scalar_start, InputFieldIterator scalar_end) const {
+                    const std::size_t size = std::distance(scalar_start, scalar_end);
+                    BOOST_ASSERT(size <= bases_count);
+                    if (size == 0) {
+                        return base_value_type::zero();
+                    }
+
+                    const std::size_t windows_count = recoding.windows_count;
+                    const std::size_t buckets_count = std::size_t(1) << (recoding.window_bits - 1);
+                    const std::size_t slices_count = std::clamp<std::size_t>(
+                        ThreadPool::get_instance(ThreadPool::PoolLevel::HIGH).get_pool_size(), 1,
+                        std::max<std::size_t>(1, size * windows_count / buckets_count));
+
+                    std::vector<base_value_type> partial(slices_count);
+                    wait_for_all(parallel_run_in_chunks<void>(
+                        slices_count,
+                        [&](std::size_t begin, std::size_t end) {
+                            for (std::size_t slice = begin; slice < end; ++slice) {
+                                const std::size_t from = size * slice / slices_count;
+                                const std::size_t to = size * (slice + 1) / slices_count;
+
+                                policies::detail::batch_affine_buckets<base_value_type> buckets(buckets_count);
+                                for (std::size_t i = from; i < to; ++i) {
+                                    const auto shifted = recoding.shift(scalar_start[i]);
+                                    for (std::size_t k = 0; k < windows_count; ++k) {
+                                        const affine_type &point = points[i * windows_count + k];
+                                        if (!point.is_zero()) {
+                                            policies::detail::add_signed(buckets, recoding.digit(shifted, k), point);
+                                        }
+                                    }
+                                }
+                                partial[slice] = buckets.reduce();
+                            }
+                        }, ThreadPool::PoolLevel::HIGH));
+
+                    base_value_type result = base_value_type::zero();
+                    for (const auto &p : partial) {
+                        result += p;
+                    }
+                    return result;
+                }
+
+            private:
+                std::size_t bases_count;
+                recoding_type recoding;
+                std::vector<affine_type> points;
+            };
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MULTIEXP_PIPPENGER_HPP
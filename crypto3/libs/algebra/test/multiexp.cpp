@@ -32,12 +32,15 @@
 
 #include <nil/crypto3/algebra/curves/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/jubjub.hpp>
 #include <nil/crypto3/algebra/curves/mnt4.hpp>
 #include <nil/crypto3/algebra/curves/mnt6.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
 
 #include <nil/crypto3/algebra/random_element.hpp>
 
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/algebra/multiexp/pippenger.hpp>
 
 #include <nil/crypto3/algebra/curves/params/wnaf/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/params/wnaf/bls12.hpp>
@@ -88,10 +91,16 @@ class multiexp_runner {
                 scalars.begin(), scalars.end());
 
 
+        point pippenger_result = policies::multiexp_method_pippenger::process(
+                points.begin(), points.end(),
+                scalars.begin(), scalars.end());
+
         BOOST_CHECK_EQUAL(naive_result, bdlo12_result);
         BOOST_CHECK_EQUAL(naive_result, bos_coster_result);
+        BOOST_CHECK_EQUAL(naive_result, pippenger_result);
 
-        return (naive_result == bdlo12_result) && (naive_result == bos_coster_result);
+        return (naive_result == bdlo12_result) && (naive_result == bos_coster_result) &&
+               (naive_result == pippenger_result);
     }
 };
 
@@ -116,4 +125,93 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(multiexp_test, runner, multiexp_runners) {
     BOOST_CHECK(runner::run());
 }
 
+template<typename curve_group_type>
+class pippenger_runner {
+    public:
+    bool static run() {
+        using point = typename curve_group_type::value_type;
+        using scalar = typename curve_group_type::params_type::scalar_field_type;
+
+        std::size_t N = 3000;
+
+        std::vector<point> points(N);
+        std::vector<typename scalar::value_type> scalars(N);
+
+        for (std::size_t i = 0; i < N; ++i) {
+            points[i] = random_element<curve_group_type>();
+            scalars[i] = random_element<scalar>();
+        }
+        // Edge cases: points at infinity, zero and small scalars, repeated bases and opposite points,
+        // so that buckets see doublings and cancellations.
+        for (std::size_t i = 0; i < N; i += 7) {
+            points[i] = point::zero();
+        }
+        for (std::size_t i = 1; i < N; i += 11) {
+            scalars[i] = scalar::value_type::zero();
+        }
+        for (std::size_t i = 2; i < N; i += 5) {
+            points[i] = points[2];
+            scalars[i] = typename scalar::value_type(i % 3 + 1);
+        }
+        for (std::size_t i = 3; i < N; i += 13) {
+            points[i] = -points[4];
+            scalars[i] = scalars[4];
+        }
+        scalars[5] = -scalar::value_type::one();
+
+        point naive_result = policies::multiexp_method_naive_plain::process(
+                points.begin(), points.end(),
+                scalars.begin(), scalars.end());
+
+        point pippenger_result = policies::multiexp_method_pippenger::process(
+                points.begin(), points.end(),
+                scalars.begin(), scalars.end());
+
+        multiexp_precomputed_table<point, scalar> table(points.begin(), points.end());
+        point table_result = table.process(scalars.begin(), scalars.end());
+        point table_prefix_result = table.process(scalars.begin(), scalars.begin() + N / 2);
+        point naive_prefix_result = policies::multiexp_method_naive_plain::process(
+                points.begin(), points.begin() + N / 2,
+                scalars.begin(), scalars.begin() + N / 2);
+
+        BOOST_CHECK_EQUAL(naive_result, pippenger_result);
+        BOOST_CHECK_EQUAL(naive_result, table_result);
+        BOOST_CHECK_EQUAL(naive_prefix_result, table_prefix_result);
+
+        return (naive_result == pippenger_result) && (naive_result == table_result) &&
+               (naive_prefix_result == table_prefix_result);
+    }
+};
+
+using pippenger_runners = boost::mpl::list<
+    pippenger_runner<curves::alt_bn128_254::template g1_type<>>,
+    pippenger_runner<curves::bls12_381::template g1_type<>>,
+    pippenger_runner<curves::bls12_381::template g2_type<>>,
+    pippenger_runner<curves::pallas::template g1_type<>>
+    >;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(pippenger_test, runner, pippenger_runners) {
+    BOOST_CHECK(runner::run());
+}
+
+// Batch-affine buckets need short Weierstrass formulas, other forms take the projective fallback.
+BOOST_AUTO_TEST_CASE(pippenger_twisted_edwards_test) {
+    using curve_group_type = curves::jubjub::template g1_type<>;
+    using point = typename curve_group_type::value_type;
+    using scalar = typename curve_group_type::params_type::scalar_field_type;
+
+    std::size_t N = 300;
+
+    std::vector<point> points(N);
+    std::vector<typename scalar::value_type> scalars(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        points[i] = random_element<curve_group_type>();
+        scalars[i] = random_element<scalar>();
+    }
+
+    BOOST_CHECK_EQUAL(
+        policies::multiexp_method_naive_plain::process(points.begin(), points.end(), scalars.begin(), scalars.end()),
+        policies::multiexp_method_pippenger::process(points.begin(), points.end(), scalars.begin(), scalars.end()));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
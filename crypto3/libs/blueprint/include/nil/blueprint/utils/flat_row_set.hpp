@@ -0,0 +1,160 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace nil {
+    namespace blueprint {
+
+        /**
+         * A set of rows of the same width, e.g. the rows of a lookup table.
+         * The rows are stored one after another in a single vector and indexed by an open addressing hash table,
+         * every slot of which keeps the upper half of the row fingerprint, so a probe rarely compares the rows
+         * themselves. Rows can only be added, which keeps the indices of the stored rows stable.
+         */
+        template<typename ValueType>
+        class flat_row_set {
+        public:
+            using value_type = ValueType;
+
+            explicit flat_row_set(std::size_t width) : width_(width) {}
+
+            std::size_t width() const {
+                return width_;
+            }
+
+            std::size_t size() const {
+                return fingerprints_.size();
+            }
+
+            const value_type* row(std::size_t index) const {
+                return values_.data() + index * width_;
+            }
+
+            static std::uint64_t fingerprint(const value_type* row, std::size_t width) {
+                std::hash<value_type> hasher;
+                std::uint64_t result = 0x9e3779b97f4a7c15ull ^ width;
+                for (std::size_t i = 0; i < width; i++) {
+                    result = mix(result ^ hasher(row[i]));
+                }
+                return result;
+            }
+
+            void reserve(std::size_t rows) {
+                values_.reserve(rows * width_);
+                fingerprints_.reserve(rows);
+                if (2 * rows > slots_.size()) {
+                    rehash(2 * rows);
+                }
+            }
+
+            // Returns false if the row was already there.
+            bool insert(const value_type* row) {
+                const std::uint64_t hash = fingerprint(row, width_);
+                if (2 * (size() + 1) > slots_.size()) {
+                    rehash(2 * (size() + 1));
+                }
+                std::size_t position = find_slot(row, hash);
+                if (slots_[position].index != empty_slot) {
+                    return false;
+                }
+                slots_[position] = slot{static_cast<std::uint32_t>(size()), tag(hash)};
+                values_.insert(values_.end(), row, row + width_);
+                fingerprints_.push_back(hash);
+                return true;
+            }
+
+            bool contains(const value_type* row) const {
+                return contains(row, fingerprint(row, width_));
+            }
+
+            bool contains(const value_type* row, std::uint64_t hash) const {
+                return !slots_.empty() && slots_[find_slot(row, hash)].index != empty_slot;
+            }
+
+        private:
+            struct slot {
+                std::uint32_t index;
+                std::uint32_t tag;
+            };
+
+            static constexpr std::uint32_t empty_slot = ~std::uint32_t(0);
+
+            static std::uint64_t mix(std::uint64_t x) {
+                x ^= x >> 33;
+                x *= 0xff51afd7ed558ccdull;
+                x ^= x >> 33;
+                x *= 0xc4ceb9fe1a85ec53ull;
+                x ^= x >> 33;
+                return x;
+            }
+
+            static std::uint32_t tag(std::uint64_t hash) {
+                return static_cast<std::uint32_t>(hash >> 32);
+            }
+
+            // The slot holding the row, or the empty slot where it would be inserted.
+            std::size_t find_slot(const value_type* row, std::uint64_t hash) const {
+                const std::size_t mask = slots_.size() - 1;
+                for (std::size_t position = hash & mask;; position = (position + 1) & mask) {
+                    const slot& s = slots_[position];
+                    if (s.index == empty_slot) {
+                        return position;
+                    }
+                    if (s.tag == tag(hash) && fingerprints_[s.index] == hash &&
+                        std::equal(row, row + width_, this->row(s.index))) {
+                        return position;
+                    }
+                }
+            }
+
+            void rehash(std::size_t min_slots) {
+                std::size_t capacity = 16;
+                while (capacity < min_slots) {
+                    capacity *= 2;
+                }
+                slots_.assign(capacity, slot{empty_slot, 0});
+                const std::size_t mask = capacity - 1;
+                for (std::size_t i = 0; i < fingerprints_.size(); i++) {
+                    std::size_t position = fingerprints_[i] & mask;
+                    while (slots_[position].index != empty_slot) {
+                        position = (position + 1) & mask;
+                    }
+                    slots_[position] = slot{static_cast<std::uint32_t>(i), tag(fingerprints_[i])};
+                }
+            }
+
+            std::size_t width_;
+            std::vector<value_type> values_;
+            std::vector<std::uint64_t> fingerprints_;
+            std::vector<slot> slots_;
+        };
+    }    // namespace blueprint
+}    // namespace nil
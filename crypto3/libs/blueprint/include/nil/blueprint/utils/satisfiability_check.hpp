@@ -26,15 +26,25 @@
 #ifndef CRYPTO3_BLUEPRINT_UTILS_PLONK_SATISFIABILITY_CHECK_HPP
 #define CRYPTO3_BLUEPRINT_UTILS_PLONK_SATISFIABILITY_CHECK_HPP
 
+#include <algorithm>
 #include <atomic>
+#include <bit>
+#include <cstdint>
 #include <functional>
+#include <map>
 #include <mutex>
+#include <optional>
+#include <sstream>
 
 #include <boost/asio/thread_pool.hpp>
 #include <boost/asio/post.hpp>
 #include <boost/thread/thread_only.hpp>
 
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+#include <nil/crypto3/math/polynomial/static_simd_vector.hpp>
+
 #include <nil/blueprint/blueprint/plonk/circuit.hpp>
+#include <nil/blueprint/utils/flat_row_set.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/table_description.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint.hpp>
@@ -43,6 +53,9 @@
 #include <nil/crypto3/zk/snark/arithmetization/plonk/copy_constraint.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_constraint.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/variable.hpp>
+#include <nil/crypto3/zk/math/dag_expression.hpp>
+#include <nil/crypto3/zk/math/dag_expression_program.hpp>
+#include <nil/crypto3/zk/math/expression_visitors.hpp>
 
 namespace nil {
     namespace blueprint {
@@ -54,10 +67,32 @@ namespace nil {
             const std::map<uint32_t, std::vector<std::string>>* constraint_names{nullptr}; // non-owning
         };
 
+        /**
+         * Checks an assignment table against a circuit.
+         * The constraints of every gate, and the inputs of every lookup gate, are compiled once to a
+         * dag_expression_program and evaluated over blocks of 64 rows, one word of the selector bitset per block.
+         * The lookup tables of the lookup gates with selected rows are loaded once into flat_row_set's. The failing row is evaluated again constraint by
+         * constraint for the error report.
+         */
         template <typename FieldType>
         class satisfiability_checker {
 
         using Column = crypto3::zk::snark::plonk_column<FieldType>;
+        using value_type = typename FieldType::value_type;
+        using constraint_type = crypto3::zk::snark::plonk_constraint<FieldType>;
+        using variable_type = crypto3::zk::snark::plonk_variable<value_type>;
+        using polynomial_dfs_type = crypto3::math::polynomial_dfs<value_type>;
+        using polynomial_dfs_variable_type = crypto3::zk::snark::plonk_variable<polynomial_dfs_type>;
+        using program_type = crypto3::zk::snark::dag_expression_program<FieldType>;
+        using gate_type = crypto3::zk::snark::plonk_gate<FieldType, constraint_type>;
+        using lookup_gate_type =
+            crypto3::zk::snark::plonk_lookup_gate<FieldType, crypto3::zk::snark::plonk_lookup_constraint<FieldType>>;
+        using row_set_type = flat_row_set<value_type>;
+
+        static constexpr std::size_t block_rows = 64;
+        using block_type = crypto3::math::static_simd_vector<value_type, block_rows>;
+        // Bit i of word b is set if row 64 * b + i is selected.
+        using row_mask_type = std::vector<std::uint64_t>;
 
         public:
             static bool is_satisfied(
@@ -70,392 +105,557 @@ namespace nil {
             }
 
         private:
+            // A variable of a compiled program: the column it reads and the rotation.
+            struct column_reader {
+                const Column *column;
+                std::int64_t rotation;
+            };
+
+            struct compiled_expressions {
+                std::optional<program_type> program;
+                std::vector<column_reader> columns;
+                row_mask_type selected_rows;
+            };
+
+            struct compiled_lookup_gate : compiled_expressions {
+                // Inputs of constraint j are the roots [input_offsets[j], input_offsets[j + 1]).
+                std::vector<std::size_t> input_offsets;
+                std::vector<std::string> table_names;
+                std::vector<const row_set_type *> tables;
+            };
+
             satisfiability_checker(const satisfiability_check_options &options) : options_(options) {}
 
             bool check_assignments(
                 const circuit<crypto3::zk::snark::plonk_constraint_system<FieldType>>& bp,
                 const crypto3::zk::snark::plonk_assignment_table<FieldType> &assignments
             ) {
-                std::set<uint32_t> used_gates;
-                for (std::uint32_t i = 0; i < bp.gates().size(); i++) {
-                    used_gates.insert(i);
-                }
-
-                std::set<uint32_t> used_lookup_gates;
-                for (std::uint32_t i = 0; i < bp.lookup_gates().size(); i++) {
-                    used_lookup_gates.insert(i);
-                }
-
-                std::set<uint32_t> used_copy_constraints;
-                for (std::uint32_t i = 0; i < bp.copy_constraints().size(); i++) {
-                    used_copy_constraints.insert(i);
-                }
-
-                std::set<uint32_t> selector_rows;
-                for (std::uint32_t i = 0; i < assignments.rows_amount(); i++) {
-                    selector_rows.insert(i);
-                }
-
                 const auto &gates = bp.gates();
                 const auto &copy_constraints = bp.copy_constraints();
                 const auto &lookup_gates = bp.lookup_gates();
                 const auto verbose = options_.verbose;
+                const std::size_t blocks_amount = (assignments.rows_amount() + block_rows - 1) / block_rows;
 
-                // On MacOS stack size for new threads is too small, so we
-                // have to manually specify it to be big enough.
-                boost::thread::attributes worker_attrs;
-                worker_attrs.set_stack_size(8 << 20);
-
-                const size_t selector_range_per_thread = std::max<size_t>(
-                    100,
-                    selector_rows.size() / options_.thread_pool_size / options_.split_per_thread // not every batch takes the same time to process, so making it smaller
+                // Not every batch takes the same time to process, so making it smaller.
+                const std::size_t blocks_per_task = std::max<std::size_t>(
+                    2,
+                    blocks_amount / options_.thread_pool_size / options_.split_per_thread
                 );
 
                 if (verbose) BOOST_LOG_TRIVIAL(info) << "Satisfiability check. Check" << std::endl;
 
-                auto gate_check_fn = [
-                    &gates,
-                    &bp,
-                    &assignments,
-                    this,
-                    verbose
-                ] (std::size_t gate_idx, std::size_t start, std::size_t end) -> bool {
-                    Column selector;
-                    if (auto index = gates[gate_idx].selector_index;
-                            index <= crypto3::zk::snark::PLONK_MAX_SELECTOR_ID) {
-                        selector = assignments.selector(index);
-                    } else if (index == crypto3::zk::snark::PLONK_SPECIAL_SELECTOR_ALL_ROWS_SELECTED) {
-                        selector.resize(assignments.rows_amount(), 1);
-                    } else {
-                      assert(false);
-                    }
-                    end = std::min(end, selector.size());
-                    for (auto row = start; row < end; row++) {
-                        if (selector[row].is_zero()) continue;
-
-                        for (std::size_t j = 0; !check_state_.interrupted && j < gates[gate_idx].constraints.size(); j++) {
-                            typename FieldType::value_type constraint_result =
-                                gates[gate_idx].constraints[j].evaluate(row, assignments);
-
-                            if (!constraint_result.is_zero()) {
-                                BOOST_LOG_TRIVIAL(error) << "Constraint " << j << " from gate " << gate_idx << " on row " << row
-                                    << " is not satisfied." << std::endl;
-                                BOOST_LOG_TRIVIAL(error) << "Constraint result: " << std::hex << constraint_result << std::dec << std::endl;
-
-                                std::string constraint_name;
-                                if (options_.constraint_names) {
-                                    constraint_name = options_.constraint_names->at(gates[gate_idx].selector_index).at(j);
-                                }
-                                BOOST_LOG_TRIVIAL(error) << "Offending constraint name: " << constraint_name << std::endl;
-                                BOOST_LOG_TRIVIAL(error) << "Offending contraint: " << gates[gate_idx].constraints[j] << std::endl;
+                std::vector<compiled_expressions> compiled_gates(gates.size());
+                run_tasks(gates.size(), [&](std::size_t i) {
+                    compiled_gates[i] = compile(gates[i].constraints, assignments, gates[i].selector_index);
+                });
 
-                                return false;
-                            }
-                        }
+                std::size_t selected_rows = 0;
+                std::vector<std::tuple<std::size_t, std::size_t, std::size_t>> gate_tasks;
+                for (std::size_t i = 0; i < gates.size(); i++) {
+                    selected_rows += split_into_tasks(compiled_gates[i].selected_rows, i, blocks_per_task, gate_tasks);
+                }
+                if (verbose) {
+                    BOOST_LOG_TRIVIAL(info) << "\tCheck " << gates.size() << " gates on " << selected_rows
+                                            << " selected rows" << std::endl;
+                    progress_printer_.Reset(selected_rows);
+                }
 
-                        if (verbose) progress_printer_.Increment();
-                    }
-                    return true;
-                };
-
-                for (const auto& i : used_gates) {
-                    Column selector;
-                    if (auto index = gates[i].selector_index;
-                            index <= crypto3::zk::snark::PLONK_MAX_SELECTOR_ID) {
-                        selector = assignments.selector(gates[i].selector_index);
-                    } else if (index == crypto3::zk::snark::PLONK_SPECIAL_SELECTOR_ALL_ROWS_SELECTED) {
-                        selector.resize(assignments.rows_amount(), 1);
-                    } else {
-                      assert(false);
+                run_tasks(gate_tasks.size(), [&](std::size_t t) {
+                    const auto [i, first_block, last_block] = gate_tasks[t];
+                    if (!check_gate(gates[i], i, compiled_gates[i], assignments, first_block, last_block)) {
+                        check_state_.set_failed();
                     }
+                });
+                if (!check_state_.result) {
+                    return check_state_.result;
+                }
 
-                    // To use the attrs we have to create threads manually
-                    boost::asio::thread_pool gate_pool(0);
-                    std::vector<boost::thread> workers;
-                    for (size_t i = 0; i < options_.thread_pool_size; ++i) {
-                        workers.emplace_back(worker_attrs, [&gate_pool] () {
-                            gate_pool.attach();
-                        });
-                    }
+                if (verbose) {
+                    BOOST_LOG_TRIVIAL(info) << "Gates checked. Check lookups" << std::endl;
+                }
 
-                    if (verbose) {
-                        BOOST_LOG_TRIVIAL(info) << "\tCheck gate " << i << std::endl;
-                        progress_printer_.Reset(selector);
-                    }
+                std::vector<compiled_lookup_gate> compiled_lookup_gates(lookup_gates.size());
+                run_tasks(lookup_gates.size(), [&](std::size_t i) {
+                    compiled_lookup_gates[i] = compile_lookup_gate(lookup_gates[i], assignments);
+                });
 
-                    for (auto range_start = 0; range_start < selector.size(); range_start += selector_range_per_thread) {
-                        boost::asio::post(gate_pool, [=, &gate_check_fn, this] () {
-                            if (!gate_check_fn(i, range_start, range_start + selector_range_per_thread)) {
-                                check_state_.set_failed();
-                            }
-                        });
-                    }
-
-                    gate_pool.wait();
-                    for (auto &w : workers) w.join();
+                if (!load_lookup_tables(bp, assignments, compiled_lookup_gates)) {
+                    return false;
+                }
 
-                    if (!check_state_.result) {
-                        return check_state_.result;
-                    }
+                selected_rows = 0;
+                std::vector<std::tuple<std::size_t, std::size_t, std::size_t>> lookup_tasks;
+                for (std::size_t i = 0; i < lookup_gates.size(); i++) {
+                    selected_rows += split_into_tasks(
+                        compiled_lookup_gates[i].selected_rows, i, blocks_per_task, lookup_tasks);
+                }
+                if (verbose) {
+                    BOOST_LOG_TRIVIAL(info) << "\tCheck " << lookup_gates.size() << " lookup gates on "
+                                            << selected_rows << " selected rows" << std::endl;
+                    progress_printer_.Reset(selected_rows);
+                }
 
-                    if (verbose) {
-                        BOOST_LOG_TRIVIAL(info) << "\tGate " << i << " checked" << std::endl;
+                run_tasks(lookup_tasks.size(), [&](std::size_t t) {
+                    const auto [i, first_block, last_block] = lookup_tasks[t];
+                    if (!check_lookup_gate(lookup_gates[i], i, compiled_lookup_gates[i], assignments,
+                                           first_block, last_block)) {
+                        check_state_.set_failed();
                     }
+                });
+                if (!check_state_.result) {
+                    return check_state_.result;
                 }
 
                 if (verbose) {
-                    BOOST_LOG_TRIVIAL(info) << "Gates checked. Check lookups" << std::endl;
+                    BOOST_LOG_TRIVIAL(info) << "Lookups checked. Check copy constraints" << std::endl;
                 }
 
-                auto lookup_check_fn = [
-                    &lookup_gates,
-                    &assignments,
-                    &bp,
-                    verbose,
-                    this
-                ](size_t gate_idx, size_t start, size_t end) -> bool {
-                    Column selector;
-                    auto index = lookup_gates[gate_idx].tag_index;
-                    if ( index <= crypto3::zk::snark::PLONK_MAX_SELECTOR_ID) {
-                        selector = assignments.selector(index);
-                    } else if (index == crypto3::zk::snark::PLONK_SPECIAL_SELECTOR_ALL_ROWS_SELECTED) {
-                        selector.resize(assignments.rows_amount(), 1);
-                    } else {
-                        assert(false);
+                for (std::size_t i = 0; i < copy_constraints.size(); i++) {
+                    if (var_value(assignments, copy_constraints[i].first) !=
+                        var_value(assignments, copy_constraints[i].second)) {
+                        BOOST_LOG_TRIVIAL(error) << "Copy constraint number " << i << " is not satisfied."
+                                    << " First variable: " << copy_constraints[i].first
+                                    << " second variable: " << copy_constraints[i].second << std::endl;
+                        BOOST_LOG_TRIVIAL(error) << var_value(assignments, copy_constraints[i].first) << " != "
+                                    << var_value(assignments, copy_constraints[i].second) << std::endl;
+                        return false;
                     }
-                    end = std::min(end, selector.size());
-
-                    for (size_t row = start; row < end; ++row) {
-                        if (selector[row].is_zero()) continue;
+                }
 
-                        for (std::size_t j = 0; !check_state_.interrupted && j < lookup_gates[gate_idx].constraints.size(); j++) {
+                return true;
+            }
 
-                            std::vector<typename FieldType::value_type> input_values;
-                            input_values.reserve(lookup_gates[gate_idx].constraints[j].lookup_input.size());
-                            for (std::size_t k = 0; k < lookup_gates[gate_idx].constraints[j].lookup_input.size(); k++) {
-                                input_values.emplace_back(lookup_gates[gate_idx].constraints[j].lookup_input[k].evaluate(
-                                    row, assignments));
+            bool check_gate(
+                const gate_type &gate,
+                std::size_t gate_idx,
+                const compiled_expressions &compiled,
+                const crypto3::zk::snark::plonk_assignment_table<FieldType> &assignments,
+                std::size_t first_block,
+                std::size_t last_block
+            ) {
+                std::vector<block_type> registers(compiled.program->get_register_count());
+                for (std::size_t block = first_block; block < last_block && !check_state_.interrupted; block++) {
+                    const std::uint64_t selected = compiled.selected_rows[block];
+                    if (selected == 0) continue;
+
+                    std::uint64_t failed = 0;
+                    run_block(compiled, assignments, block, registers,
+                              [&failed, selected](std::size_t, const block_type &value) {
+                        for (std::uint64_t rows = selected; rows != 0; rows &= rows - 1) {
+                            const std::size_t lane = std::countr_zero(rows);
+                            if (!value[lane].is_zero()) {
+                                failed |= std::uint64_t(1) << lane;
                             }
-                            const auto table_name =
-                                bp.get_reserved_indices_right().at(lookup_gates[gate_idx].constraints[j].table_id);
-
-                            try {
-                                if(bp.get_reserved_dynamic_tables().find(table_name) != bp.get_reserved_dynamic_tables().end() ) {
-                                    auto dynamic_table = fetch_dynamic_table(bp, assignments, table_name, lookup_gates[gate_idx].constraints[j].table_id);
-                                    if (dynamic_table.find(input_values) == dynamic_table.end()) {
-                                        BOOST_LOG_TRIVIAL(error) << "Input values";
-                                        std::stringstream ss;
-                                        for (std::size_t k = 0; k < input_values.size(); k++) {
-                                            ss << std::hex << input_values[k] << std::dec << " ";
-                                        }
-                                        BOOST_LOG_TRIVIAL(error) << ss.str();
-                                        BOOST_LOG_TRIVIAL(error) << std::endl;
-                                        BOOST_LOG_TRIVIAL(error) << "Constraint " << j << " from lookup gate " << gate_idx << " from table "
-                                            << table_name << " on row " << row << " is not satisfied."
-                                            << std::endl;
-                                        BOOST_LOG_TRIVIAL(error) << "Offending Lookup Constraint: " << std::endl;
-                                        const auto &constraint = lookup_gates[gate_idx].constraints[j];
-                                        BOOST_LOG_TRIVIAL(error) << "Table id: " << constraint.table_id << std::endl;
-                                        for (auto &lookup_input : constraint.lookup_input) {
-                                            BOOST_LOG_TRIVIAL(debug) << lookup_input;
-                                        }
-                                        // Please not comment it next time, it is really useful for circuits debugging
-                                        BOOST_LOG_TRIVIAL(trace) << "Possible values: ";
-                                        for( const auto &row: dynamic_table ) {
-                                            std::stringstream ss;
-                                            for( const auto &value : row ) {
-                                                ss << std::hex << value << std::dec << " ";
-                                            }
-                                            BOOST_LOG_TRIVIAL(trace) << ss.str();
-                                        }
-
-                                        return false;
-                                    }
-                                    continue;
-                                }
-                                std::string main_table_name = table_name.substr(0, table_name.find("/"));
-                                std::string subtable_name = table_name.substr(table_name.find("/") + 1, table_name.size() - 1);
-
-                                const auto &table = bp.get_reserved_tables().at(main_table_name)->get_table();
-                                const auto &subtable = bp.get_reserved_tables().at(main_table_name)->subtables.at(subtable_name);
-
-                                std::size_t columns_number = subtable.column_indices.size();
-
-                                // Search the table for the input values
-                                // We can cache it with sorting, or use KMP, but I need a simple solution first
-                                bool found = false;
-                                BOOST_ASSERT(columns_number == input_values.size());
-                                for (std::size_t k = 0; k < table[0].size(); k++) {
-                                    bool match = true;
-                                    for (std::size_t l = 0; l < columns_number; l++) {
-                                        if (table[subtable.column_indices[l]][k] != input_values[l]) {
-                                            match = false;
-                                            break;
-                                        }
-                                    }
-                                    if (match) {
-                                        found = true;
-                                        break;
-                                    }
-                                }
-                                if (!found) {
-                                    BOOST_LOG_TRIVIAL(error) << "Input values:";
-                                    std::stringstream ss;
-                                    for (std::size_t k = 0; k < input_values.size(); k++) {
-                                        ss << std::hex << input_values[k] << std::dec <<  " ";
-                                    }
-                                    BOOST_LOG_TRIVIAL(error) << ss.str();
-                                    BOOST_LOG_TRIVIAL(error) << std::endl;
-                                    BOOST_LOG_TRIVIAL(error) << "Constraint " << j << " from lookup gate " << gate_idx << " from table "
-                                        << table_name << " on row " << row << " is not satisfied."
-                                        << std::endl;
-                                    BOOST_LOG_TRIVIAL(error) << "Offending Lookup Constraint: " << std::endl;
-                                    const auto &constraint = lookup_gates[gate_idx].constraints[j];
-                                    BOOST_LOG_TRIVIAL(error) << "Table id: " << constraint.table_id << std::endl;
-                                    for (auto &lookup_input : constraint.lookup_input) {
-                                        BOOST_LOG_TRIVIAL(error) << lookup_input << std::endl;
-                                    }
-                                    return false;
-                                }
-                            } catch (std::out_of_range &e) {
-                                BOOST_LOG_TRIVIAL(error) << "Lookup table " << table_name << " not found." << std::endl;
-                                BOOST_LOG_TRIVIAL(error) << "Table_id = " << lookup_gates[gate_idx].constraints[j].table_id << " table_name "
-                                            << table_name << std::endl;
+                        }
+                    });
 
+                    if (failed != 0) {
+                        const std::size_t row = block * block_rows + std::countr_zero(failed);
+                        for (std::size_t j = 0; j < gate.constraints.size(); j++) {
+                            value_type constraint_result = gate.constraints[j].evaluate(row, assignments);
+                            if (!constraint_result.is_zero()) {
+                                report_failed_constraint(gate, gate_idx, j, row, constraint_result);
                                 return false;
                             }
                         }
-
-                        if (verbose) progress_printer_.Increment();
-                    }
-                    return true;
-                };
-
-                for (const auto& i : used_lookup_gates) {
-                    Column selector;
-                    auto index = lookup_gates[i].tag_index;
-                    if ( index <= crypto3::zk::snark::PLONK_MAX_SELECTOR_ID) {
-                        selector = assignments.selector(index);
-                    } else if (index == crypto3::zk::snark::PLONK_SPECIAL_SELECTOR_ALL_ROWS_SELECTED) {
-                        selector.resize(assignments.rows_amount(), 1);
-                    } else {
-                        assert(false);
+                        BOOST_LOG_TRIVIAL(error) << "Gate " << gate_idx << " on row " << row << " is not satisfied."
+                            << std::endl;
+                        return false;
                     }
 
-                    // To use the attrs we have to create threads manually
-                    boost::asio::thread_pool lookup_pool(0);
-                    std::vector<boost::thread> workers;
-                    for (size_t i = 0; i < options_.thread_pool_size; ++i) {
-                        workers.emplace_back(worker_attrs, [&lookup_pool] () {
-                            lookup_pool.attach();
-                        });
-                    }
+                    if (options_.verbose) progress_printer_.Increment(std::popcount(selected));
+                }
+                return true;
+            }
 
-                    if (verbose) {
-                        BOOST_LOG_TRIVIAL(info) << "\tLookup gate " << i << std::endl;
-                        progress_printer_.Reset(selector);
-                    }
+            void report_failed_constraint(
+                const gate_type &gate,
+                std::size_t gate_idx,
+                std::size_t j,
+                std::size_t row,
+                const value_type &constraint_result
+            ) const {
+                BOOST_LOG_TRIVIAL(error) << "Constraint " << j << " from gate " << gate_idx << " on row " << row
+                    << " is not satisfied." << std::endl;
+                BOOST_LOG_TRIVIAL(error) << "Constraint result: " << std::hex << constraint_result << std::dec << std::endl;
+
+                std::string constraint_name;
+                if (options_.constraint_names) {
+                    constraint_name = options_.constraint_names->at(gate.selector_index).at(j);
+                }
+                BOOST_LOG_TRIVIAL(error) << "Offending constraint name: " << constraint_name << std::endl;
+                BOOST_LOG_TRIVIAL(error) << "Offending contraint: " << gate.constraints[j] << std::endl;
+            }
 
-                    for (auto range_start = 0; range_start < selector.size(); range_start += selector_range_per_thread) {
-                        boost::asio::post(lookup_pool, [=, &lookup_check_fn, this] () {
-                            if (!lookup_check_fn(i, range_start, range_start + selector_range_per_thread)) {
-                                check_state_.set_failed();
+            bool check_lookup_gate(
+                const lookup_gate_type &gate,
+                std::size_t gate_idx,
+                const compiled_lookup_gate &compiled,
+                const crypto3::zk::snark::plonk_assignment_table<FieldType> &assignments,
+                std::size_t first_block,
+                std::size_t last_block
+            ) {
+                std::vector<block_type> registers(compiled.program->get_register_count());
+                std::vector<block_type> inputs(compiled.input_offsets.back());
+                std::vector<value_type> input_values;
+                for (std::size_t block = first_block; block < last_block && !check_state_.interrupted; block++) {
+                    const std::uint64_t selected = compiled.selected_rows[block];
+                    if (selected == 0) continue;
+
+                    run_block(compiled, assignments, block, registers,
+                              [&inputs](std::size_t root, const block_type &value) {
+                        inputs[root] = value;
+                    });
+
+                    for (std::uint64_t rows = selected; rows != 0; rows &= rows - 1) {
+                        const std::size_t lane = std::countr_zero(rows);
+                        for (std::size_t j = 0; j < gate.constraints.size(); j++) {
+                            input_values.clear();
+                            for (std::size_t k = compiled.input_offsets[j]; k < compiled.input_offsets[j + 1]; k++) {
+                                input_values.push_back(inputs[k][lane]);
                             }
-                        });
+                            if (!compiled.tables[j]->contains(input_values.data())) {
+                                report_failed_lookup(gate, gate_idx, j, block * block_rows + lane,
+                                                     compiled.table_names[j], *compiled.tables[j], input_values);
+                                return false;
+                            }
+                        }
                     }
 
-                    lookup_pool.wait();
-                    for (auto &w : workers) w.join();
+                    if (options_.verbose) progress_printer_.Increment(std::popcount(selected));
+                }
+                return true;
+            }
 
-                    if (!check_state_.result) {
-                        return check_state_.result;
+            void report_failed_lookup(
+                const lookup_gate_type &gate,
+                std::size_t gate_idx,
+                std::size_t j,
+                std::size_t row,
+                const std::string &table_name,
+                const row_set_type &table,
+                const std::vector<value_type> &input_values
+            ) const {
+                BOOST_LOG_TRIVIAL(error) << "Input values:";
+                std::stringstream ss;
+                for (std::size_t k = 0; k < input_values.size(); k++) {
+                    ss << std::hex << input_values[k] << std::dec << " ";
+                }
+                BOOST_LOG_TRIVIAL(error) << ss.str();
+                BOOST_LOG_TRIVIAL(error) << std::endl;
+                BOOST_LOG_TRIVIAL(error) << "Constraint " << j << " from lookup gate " << gate_idx << " from table "
+                    << table_name << " on row " << row << " is not satisfied."
+                    << std::endl;
+                BOOST_LOG_TRIVIAL(error) << "Offending Lookup Constraint: " << std::endl;
+                const auto &constraint = gate.constraints[j];
+                BOOST_LOG_TRIVIAL(error) << "Table id: " << constraint.table_id << std::endl;
+                for (auto &lookup_input : constraint.lookup_input) {
+                    BOOST_LOG_TRIVIAL(error) << lookup_input << std::endl;
+                }
+                // Please not comment it next time, it is really useful for circuits debugging
+                BOOST_LOG_TRIVIAL(trace) << "Possible values: ";
+                for (std::size_t k = 0; k < table.size(); k++) {
+                    std::stringstream ss;
+                    for (std::size_t l = 0; l < table.width(); l++) {
+                        ss << std::hex << table.row(k)[l] << std::dec << " ";
                     }
+                    BOOST_LOG_TRIVIAL(trace) << ss.str();
+                }
+            }
 
-                    if (verbose) {
-                        BOOST_LOG_TRIVIAL(info) << "\tLookup gate " << i << " checked" << std::endl;
-                    }
+            // Evaluates the program on the rows of the block and hands every root to store.
+            template<typename Store>
+            static void run_block(
+                const compiled_expressions &compiled,
+                const crypto3::zk::snark::plonk_assignment_table<FieldType> &assignments,
+                std::size_t block,
+                std::vector<block_type> &registers,
+                const Store &store
+            ) {
+                const std::size_t rows_amount = assignments.rows_amount();
+                compiled.program->run(
+                    registers,
+                    [&compiled, rows_amount, block](std::size_t variable, block_type &dst) {
+                        load_block(compiled.columns[variable], rows_amount, block * block_rows, dst);
+                    },
+                    [](const polynomial_dfs_type &constant, block_type &dst) {
+                        // Constraints over the table have scalar coefficients only, which the program folds.
+                        BOOST_ASSERT(constant.degree() == 0);
+                        dst = block_type(constant[0]);
+                    },
+                    store);
+            }
+
+            // Loads the rows [first_row, first_row + 64) of a rotated column, wrapping around the table like
+            // plonk_constraint::evaluate. The rows missing from a short column are zeroes.
+            static void load_block(const column_reader &reader, std::size_t rows_amount, std::size_t first_row,
+                                   block_type &dst) {
+                const Column &column = *reader.column;
+                const std::int64_t start = std::int64_t(first_row) + reader.rotation;
+                if (start >= 0 && std::size_t(start) + block_rows <= std::min(column.size(), rows_amount)) {
+                    std::copy(column.begin() + start, column.begin() + start + block_rows, dst.begin());
+                    return;
+                }
+                const std::int64_t rows = rows_amount;
+                for (std::size_t i = 0; i < block_rows; i++) {
+                    const std::size_t row = ((start + std::int64_t(i)) % rows + rows) % rows;
+                    dst[i] = row < column.size() ? column[row] : value_type::zero();
                 }
+            }
 
-                for (const auto& i : used_copy_constraints) {
-                    if (var_value(assignments, copy_constraints[i].first) !=
-                        var_value(assignments, copy_constraints[i].second)) {
-                        BOOST_LOG_TRIVIAL(error) << "Copy constraint number " << i << " is not satisfied."
-                                    << " First variable: " << copy_constraints[i].first
-                                    << " second variable: " << copy_constraints[i].second << std::endl;
-                        BOOST_LOG_TRIVIAL(error) << var_value(assignments, copy_constraints[i].first) << " != "
-                                    << var_value(assignments, copy_constraints[i].second) << std::endl;
-                        return false;
+            template<typename VariableType>
+            static const Column &variable_column(
+                const crypto3::zk::snark::plonk_assignment_table<FieldType> &assignments,
+                const VariableType &var
+            ) {
+                switch (var.type) {
+                    case VariableType::column_type::witness:
+                        return assignments.witness(var.index);
+                    case VariableType::column_type::public_input:
+                        return assignments.public_input(var.index);
+                    case VariableType::column_type::constant:
+                        return assignments.constant(var.index);
+                    case VariableType::column_type::selector:
+                        return assignments.selector(var.index);
+                    default:
+                        throw std::invalid_argument("Invalid column type");
+                }
+            }
+
+            static row_mask_type selected_rows(
+                const crypto3::zk::snark::plonk_assignment_table<FieldType> &assignments,
+                std::size_t selector_index
+            ) {
+                const std::size_t rows_amount = assignments.rows_amount();
+                row_mask_type result((rows_amount + block_rows - 1) / block_rows, 0);
+                if (selector_index <= crypto3::zk::snark::PLONK_MAX_SELECTOR_ID) {
+                    const Column &selector = assignments.selector(selector_index);
+                    const std::size_t end = std::min(selector.size(), rows_amount);
+                    for (std::size_t row = 0; row < end; row++) {
+                        if (!selector[row].is_zero()) {
+                            result[row / block_rows] |= std::uint64_t(1) << (row % block_rows);
+                        }
+                    }
+                } else if (selector_index == crypto3::zk::snark::PLONK_SPECIAL_SELECTOR_ALL_ROWS_SELECTED) {
+                    for (std::size_t row = 0; row < rows_amount; row++) {
+                        result[row / block_rows] |= std::uint64_t(1) << (row % block_rows);
                     }
+                } else {
+                    assert(false);
                 }
+                return result;
+            }
 
-                return true;
+            static compiled_expressions compile(
+                const std::vector<constraint_type> &expressions,
+                const crypto3::zk::snark::plonk_assignment_table<FieldType> &assignments,
+                std::size_t selector_index
+            ) {
+                crypto3::zk::snark::expression_variable_type_converter<variable_type, polynomial_dfs_variable_type>
+                    converter([](const value_type &coeff) { return polynomial_dfs_type(0, 1, coeff); });
+                crypto3::zk::snark::dag_expression_builder<polynomial_dfs_variable_type> builder;
+                for (const auto &expression : expressions) {
+                    builder.add_expression(converter.convert(expression));
+                }
+
+                compiled_expressions result;
+                result.program.emplace(builder.build());
+                for (const auto &var : result.program->get_variables()) {
+                    result.columns.push_back({&variable_column(assignments, var), var.rotation});
+                }
+                result.selected_rows = selected_rows(assignments, selector_index);
+                return result;
             }
 
-            std::set<std::vector<typename FieldType::value_type>>
-            fetch_dynamic_table(
+            static compiled_lookup_gate compile_lookup_gate(
+                const lookup_gate_type &gate,
+                const crypto3::zk::snark::plonk_assignment_table<FieldType> &assignments
+            ) {
+                std::vector<constraint_type> inputs;
+                compiled_lookup_gate result;
+                result.input_offsets.push_back(0);
+                for (const auto &constraint : gate.constraints) {
+                    inputs.insert(inputs.end(), constraint.lookup_input.begin(), constraint.lookup_input.end());
+                    result.input_offsets.push_back(inputs.size());
+                }
+                static_cast<compiled_expressions &>(result) = compile(inputs, assignments, gate.tag_index);
+                return result;
+            }
+
+            // Loads the tables of the lookup gates with selected rows into row sets and points the gates at them.
+            // A gate which selects no row is not checked, so its tables don't have to be defined, as with the
+            // row by row check.
+            bool load_lookup_tables(
                 const circuit<crypto3::zk::snark::plonk_constraint_system<FieldType>> &bp,
                 const crypto3::zk::snark::plonk_assignment_table<FieldType> &assignments,
-                const std::string& table_name,
-                std::size_t table_id
+                std::vector<compiled_lookup_gate> &compiled_lookup_gates
             ) {
-                auto ret = used_dynamic_tables_.find(table_name);
-                if (ret != used_dynamic_tables_.end()) {
-                    return ret->second;
+                std::vector<std::function<void()>> loaders;
+                for (std::size_t i = 0; i < compiled_lookup_gates.size(); i++) {
+                    auto &compiled = compiled_lookup_gates[i];
+                    if (std::all_of(compiled.selected_rows.begin(), compiled.selected_rows.end(),
+                                    [](std::uint64_t selected) { return selected == 0; })) {
+                        continue;
+                    }
+                    for (const auto &constraint : bp.lookup_gates()[i].constraints) {
+                        std::string table_name;
+                        try {
+                            table_name = bp.get_reserved_indices_right().at(constraint.table_id);
+                            const auto found = lookup_tables_.find(table_name);
+                            if (found != lookup_tables_.end()) {
+                                compiled.table_names.push_back(table_name);
+                                compiled.tables.push_back(&found->second);
+                                continue;
+                            }
+                            if (bp.get_reserved_dynamic_tables().find(table_name) != bp.get_reserved_dynamic_tables().end()) {
+                                const auto &lookup_table = bp.lookup_tables()[constraint.table_id - 1];
+                                row_set_type *table = add_lookup_table(compiled, table_name, constraint.lookup_input.size());
+                                loaders.push_back([&lookup_table, &assignments, table] () {
+                                    load_dynamic_lookup(lookup_table, assignments, *table);
+                                });
+                                continue;
+                            }
+                            std::string main_table_name = table_name.substr(0, table_name.find("/"));
+                            std::string subtable_name = table_name.substr(table_name.find("/") + 1, table_name.size() - 1);
+
+                            const auto &table_definition = bp.get_reserved_tables().at(main_table_name);
+                            const auto &subtable = table_definition->subtables.at(subtable_name);
+                            row_set_type *table = add_lookup_table(compiled, table_name, constraint.lookup_input.size());
+                            BOOST_ASSERT(subtable.column_indices.size() == table->width());
+                            loaders.push_back([&table_definition, &subtable, table] () {
+                                load_static_lookup(table_definition->get_table(), subtable.column_indices, *table);
+                            });
+                        } catch (std::out_of_range &e) {
+                            BOOST_LOG_TRIVIAL(error) << "Lookup table " << table_name << " not found." << std::endl;
+                            BOOST_LOG_TRIVIAL(error) << "Table_id = " << constraint.table_id << " table_name "
+                                        << table_name << std::endl;
+
+                            return false;
+                        }
+                    }
                 }
+                run_tasks(loaders.size(), [&loaders](std::size_t i) {
+                    loaders[i]();
+                });
+                return true;
+            }
+
+            row_set_type *add_lookup_table(compiled_lookup_gate &compiled, const std::string &table_name,
+                                           std::size_t width) {
+                row_set_type *table = &lookup_tables_.emplace(table_name, row_set_type(width)).first->second;
+                compiled.table_names.push_back(table_name);
+                compiled.tables.push_back(table);
+                return table;
+            }
 
-                {
-                    std::lock_guard<std::mutex> lock(used_dynamic_tables_mutex_);
-                    ret = used_dynamic_tables_.find(table_name);
-                    if (ret != used_dynamic_tables_.end()) {
-                        return ret->second;
+            static void load_static_lookup(
+                const std::vector<std::vector<value_type>> &table,
+                const std::vector<std::size_t> &column_indices,
+                row_set_type &result
+            ) {
+                const std::size_t rows_amount = table.empty() ? 0 : table[0].size();
+                std::vector<value_type> item(column_indices.size());
+                result.reserve(rows_amount);
+                for (std::size_t k = 0; k < rows_amount; k++) {
+                    for (std::size_t l = 0; l < column_indices.size(); l++) {
+                        item[l] = table[column_indices[l]][k];
                     }
-                    used_dynamic_tables_[table_name] = load_dynamic_lookup(bp, assignments, table_id);
-                    return used_dynamic_tables_[table_name];
+                    result.insert(item.data());
                 }
-            };
+            }
 
-            std::set<std::vector<typename FieldType::value_type>>
-            load_dynamic_lookup(
-                const circuit<crypto3::zk::snark::plonk_constraint_system<FieldType>> &bp,
+            static void load_dynamic_lookup(
+                const crypto3::zk::snark::plonk_lookup_table<FieldType> &table,
                 const crypto3::zk::snark::plonk_assignment_table<FieldType> &assignments,
-                std::size_t table_id
+                row_set_type &result
             ) {
-                std::set<std::vector<typename FieldType::value_type>> result;
-                auto &table = bp.lookup_tables()[table_id-1];
-
-                crypto3::zk::snark::plonk_column<FieldType> selector = assignments.selector(table.tag_index);
-
-                for( std::size_t selector_row = 0; selector_row < assignments.rows_amount(); selector_row++ ){
-                    if( selector_row < selector.size() && !selector[selector_row].is_zero() ){
-                        for( std::size_t op = 0; op < table.lookup_options.size(); op++){
-                            std::vector<typename FieldType::value_type> item(table.lookup_options[op].size());
-                            for( std::size_t i = 0; i < table.lookup_options[op].size(); i++){
-                                crypto3::zk::snark::plonk_constraint<FieldType> expr = table.lookup_options[op][i];;
-                                item[i] = expr.evaluate(selector_row, assignments);
+                const row_mask_type selected = selected_rows(assignments, table.tag_index);
+                const std::size_t rows_amount = assignments.rows_amount();
+
+                std::vector<value_type> item(result.width());
+                for (std::size_t block = 0; block < selected.size(); block++) {
+                    for (std::uint64_t rows = selected[block]; rows != 0; rows &= rows - 1) {
+                        const std::size_t selector_row = block * block_rows + std::countr_zero(rows);
+                        for (const auto &option : table.lookup_options) {
+                            BOOST_ASSERT(option.size() == item.size());
+                            for (std::size_t i = 0; i < option.size(); i++) {
+                                const auto &column = variable_column(assignments, option[i]);
+                                const std::size_t row = (rows_amount + selector_row + option[i].rotation) % rows_amount;
+                                item[i] = row < column.size() ? column[row] : value_type::zero();
                             }
-                            result.insert(item);
+                            result.insert(item.data());
                         }
                     }
                 }
+            }
+
+            // Adds the tasks checking ranges of blocks_per_task blocks with selected rows, returns the number of
+            // the selected rows.
+            static std::size_t split_into_tasks(
+                const row_mask_type &selected,
+                std::size_t gate_idx,
+                std::size_t blocks_per_task,
+                std::vector<std::tuple<std::size_t, std::size_t, std::size_t>> &tasks
+            ) {
+                std::size_t result = 0;
+                for (std::size_t first = 0; first < selected.size(); first += blocks_per_task) {
+                    const std::size_t last = std::min(first + blocks_per_task, selected.size());
+                    std::size_t rows = 0;
+                    for (std::size_t block = first; block < last; block++) {
+                        rows += std::popcount(selected[block]);
+                    }
+                    if (rows != 0) {
+                        tasks.emplace_back(gate_idx, first, last);
+                        result += rows;
+                    }
+                }
                 return result;
             }
 
+            // Runs task(0), ..., task(count - 1) on options_.thread_pool_size threads.
+            template<typename Task>
+            void run_tasks(std::size_t count, const Task &task) const {
+                if (count == 0) {
+                    return;
+                }
+
+                // On MacOS stack size for new threads is too small, so we
+                // have to manually specify it to be big enough.
+                boost::thread::attributes worker_attrs;
+                worker_attrs.set_stack_size(8 << 20);
+
+                // To use the attrs we have to create threads manually
+                boost::asio::thread_pool pool(0);
+                std::vector<boost::thread> workers;
+                for (size_t i = 0; i < std::min(options_.thread_pool_size, count); ++i) {
+                    workers.emplace_back(worker_attrs, [&pool] () {
+                        pool.attach();
+                    });
+                }
+
+                for (std::size_t i = 0; i < count; i++) {
+                    boost::asio::post(pool, [&task, i] () {
+                        task(i);
+                    });
+                }
+
+                pool.wait();
+                for (auto &w : workers) w.join();
+            }
+
         private:
             class progress_printer {
                 public:
-                void Reset(const Column &c) {
-                    total_ = 0;
+                void Reset(std::size_t total) {
+                    total_ = total;
                     processed_ = 0;
                     progress_ = 0;
-
-                    for (const auto &s : c)
-                        if (!s.is_zero()) ++total_;
                 }
 
-                void Increment() {
-                    assert(processed_ < total_);
+                void Increment(std::size_t rows) {
+                    assert(processed_ + rows <= total_);
 
-                    auto processed = ++processed_;
+                    auto processed = processed_ += rows;
                     auto total = total_.load();
 
                     if (progress_.load() < kMaxProgress * processed / total) {
@@ -482,8 +682,8 @@ namespace nil {
             };
 
             struct check_state {
-                bool interrupted{false};
-                bool result{true};
+                std::atomic<bool> interrupted{false};
+                std::atomic<bool> result{true};
 
                 void set_failed() {
                     interrupted = true;
@@ -493,8 +693,7 @@ namespace nil {
 
         private:
             const satisfiability_check_options& options_;
-            std::mutex used_dynamic_tables_mutex_;
-            std::map<std::string, std::set<std::vector<typename FieldType::value_type>>> used_dynamic_tables_;
+            std::map<std::string, row_set_type> lookup_tables_;
             progress_printer progress_printer_;
             check_state check_state_;
         };
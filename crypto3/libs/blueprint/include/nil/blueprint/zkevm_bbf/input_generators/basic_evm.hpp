@@ -23,6 +23,9 @@
 //---------------------------------------------------------------------------//
 
 #pragma once
+#include <algorithm>
+#include <cstring>
+
 #include <nil/crypto3/hash/type_traits.hpp>
 #include <nil/crypto3/hash/algorithm/hash.hpp>
 #include <boost/property_tree/ptree.hpp>
@@ -85,9 +88,9 @@ namespace nil {
 
                 // Data preloaded data structures
                 std::set<zkevm_word_type>                               _existing_accounts;
-                std::map<zkevm_word_type, zkevm_account>                _block_initial_state;
-                std::map<zkevm_word_type, zkevm_account>                _accounts_initial_state; // Initial state; Update it after block.
-                std::map<zkevm_word_type, zkevm_account>                _accounts_current_state; // Initial state; Update it after block.
+                zkevm_accounts_type                                     _block_initial_state;
+                zkevm_accounts_type                                     _accounts_initial_state; // Initial state; Update it after block.
+                zkevm_accounts_type                                     _accounts_current_state; // Initial state; Update it after block.
                 std::vector<zkevm_call_context>                         _call_stack;
 
                 // Variables for current block
@@ -284,7 +287,6 @@ namespace nil {
                     while (!is_end_call){
                         zkevm_opcode op = (pc == bytecode.size())? zkevm_opcode::STOP: opcode_from_number(bytecode[pc]);
                         current_opcode = opcode_to_number(op);
-                        std::string opcode = opcode_to_string(op);
                         this->execute_opcode();
                         if( gas >= MAX_ZKEVM_GAS_ERROR_BOUND) gas_error();
                         if( !execution_status ) return;
@@ -314,8 +316,6 @@ namespace nil {
                     _call_stack.back().call_pc = pc;
                     _call_stack.back().before_call_gas = gas;
                     _call_stack.back().calldata = calldata;
-                    _call_stack.back().stack = stack;
-                    _call_stack.back().memory = memory;
                     _call_stack.back().caller = caller;
                     _call_stack.back().call_context_address = call_context_address;
                     _call_stack.back().was_accessed = _call_stack[_call_stack.size() - 2].was_accessed;
@@ -327,11 +327,15 @@ namespace nil {
                     _call_stack.back().state = _accounts_current_state;
 
                     calldata.clear();
-                    for( std::size_t i = 0; i < call_args_length; i++){
-                        calldata.push_back(memory[call_args_offset + i]);
-                    }
+                    if( call_args_length != 0 )
+                        calldata.assign(memory.begin() + call_args_offset, memory.begin() + call_args_offset + call_args_length);
                     _call_stack.back().calldata = calldata;
 
+                    // Caller stack and memory are not touched until the call returns,
+                    // so they are parked in the frame instead of being copied.
+                    _call_stack.back().stack = std::move(stack);
+                    _call_stack.back().memory = std::move(memory);
+
                     if( call_is_create || call_is_create2 ){
                         bytecode = calldata;
                         bytecode_hash = zkevm_keccak_hash(bytecode);
@@ -359,8 +363,8 @@ namespace nil {
                     call_gas = gas;
                     _call_stack.back().call_gas = call_gas;
 
-                    stack = {};
-                    memory = {};
+                    stack.clear();
+                    memory.clear();
                     returndata = {};
                     pc = 0;
                     depth++;
@@ -378,7 +382,6 @@ namespace nil {
                     while (!is_end_call){
                         zkevm_opcode op = (pc == bytecode.size())? zkevm_opcode::STOP: opcode_from_number(bytecode[pc]);
                         current_opcode = opcode_to_number(op);
-                        std::string opcode = opcode_to_string(op);
                         this->execute_opcode(); if( !execution_status ) return;
                         if( gas >= MAX_ZKEVM_GAS_ERROR_BOUND) gas_error();
                     }
@@ -402,8 +405,8 @@ namespace nil {
                     pc = _call_stack.back().call_pc + 1;
                     gas = _call_stack.back().before_call_gas - (call_gas - gas);
                     BOOST_LOG_TRIVIAL(trace) << "\tFinal gas = " << std::hex <<  gas << std::dec;
-                    memory = _call_stack.back().memory;
-                    stack = _call_stack.back().stack;
+                    memory = std::move(_call_stack.back().memory);
+                    stack = std::move(_call_stack.back().stack);
                     call_value = _call_stack.back().call_value;
                     if( call_value != 0 ) gas += 2300;
 
@@ -428,9 +431,8 @@ namespace nil {
                     is_end_call = false;
                     std::size_t real_length = std::min(returndata_length, returndata.size());
                     // Memory is resized before CALL
-                    for( std::size_t i = 0; i < real_length; i++){
-                        memory[returndata_offset + i] = returndata[i];
-                    }
+                    if( real_length != 0 )
+                        std::copy_n(returndata.begin(), real_length, memory.begin() + returndata_offset);
 
                     stack.push_back(call_status);
                     depth--;
@@ -440,156 +442,155 @@ namespace nil {
                     memory_size = memory.size();
                     stack_size = stack.size();
 
-                    std::string opcode = opcode_to_string(opcode_from_number(current_opcode));
-
-                    if(opcode == "STOP") { this->stop();}
-                    else if( opcode == "RETURN" ) { this->return_opcode();}
-                    else if( opcode == "REVERT" ) { this->revert();}
-                    else if( opcode == "INVALID" ) { this->invalid();}
-                    else if( opcode == "LT" ) this->lt();
-                    else if( opcode == "GT" ) this->gt();
-                    else if( opcode == "SLT" ) this->slt();
-                    else if( opcode == "SGT" ) this->sgt();
-                    else if( opcode == "SHL" ) this->shl();
-                    else if( opcode == "SHR" ) this->shr();
-                    else if( opcode == "SAR" ) this->sar();
-                    else if( opcode == "ADD" ) this->add();
-                    else if( opcode == "SUB" ) this->sub();
-                    else if( opcode == "MUL" ) this->mul();
-                    else if( opcode == "DIV" ) this->div();
-                    else if( opcode == "EXP" ) this->exp();
-                    else if( opcode == "SIGNEXTEND" ) this->signextend();
-                    else if( opcode == "MOD" ) this->mod();
-                    else if( opcode == "SDIV" ) this->sdiv();
-                    else if( opcode == "SMOD" ) this->smod();
-                    else if( opcode == "MULMOD" ) this->mulmod();
-                    else if( opcode == "ADDMOD" ) this->addmod();
-                    else if( opcode == "AND" ) this->and_opcode();
-                    else if( opcode == "OR" ) this->or_opcode();
-                    else if( opcode == "XOR" ) this->xor_opcode();
-                    else if( opcode == "BYTE" ) this->byte();
-                    else if( opcode == "EQ" ) this->eq();
-                    else if( opcode == "ISZERO" ) this->iszero();
-                    else if( opcode == "NOT" ) this->not_opcode();
-                    else if( opcode == "JUMP" ) this->jump();
-                    else if( opcode == "JUMPI" ) this->jumpi();
-                    else if( opcode == "JUMPDEST" ) this->jumpdest();
-                    else if( opcode == "MLOAD" ) this->mload();
-                    else if( opcode == "MSTORE" ) this->mstore();
-                    else if( opcode == "MSTORE8" ) this->mstore8();
-                    else if( opcode == "MCOPY" ) this->mcopy();
-                    else if( opcode == "SLOAD" ) this->sload();
-                    else if( opcode == "SSTORE" ) this->sstore();
-                    else if( opcode == "TLOAD" ) this->tload();
-                    else if( opcode == "TSTORE" ) this->tstore();
-                    else if( opcode == "KECCAK256" ) this->keccak();
-                    else if( opcode == "GAS" ) this->gas_opcode();
-                    else if( opcode == "PC" ) this->pc_opcode();
-                    else if( opcode == "MSIZE" ) this->msize_opcode();
-                    else if( opcode == "RETURNDATASIZE" ) this->returndatasize();
-                    else if( opcode == "RETURNDATACOPY" ) this->returndatacopy();
-                    else if( opcode == "CODESIZE" ) this->codesize();
-                    else if( opcode == "CODECOPY" ) this->codecopy();
-                    else if( opcode == "EXTCODESIZE" ) this->extcodesize();
-                    else if( opcode == "EXTCODEHASH" ) this->extcodehash();
-                    else if( opcode == "BLOCKHASH" ) this->blockhash();
-                    else if( opcode == "BLOBHASH" ) this->blobhash();
-                    else if( opcode == "BLOBBASEFEE" ) this->blobbasefee();
-                    else if( opcode == "COINBASE" ) this->coinbase();
-                    else if( opcode == "TIMESTAMP" ) this->timestamp();
-                    else if( opcode == "NUMBER" ) this->number();
-                    else if( opcode == "DIFFICULTY" ) this->difficulty();
-                    else if( opcode == "CHAINID" ) this->chainid();
-                    else if( opcode == "GASPRICE" ) this->gasprice();
-                    else if(opcode == "PUSH0") this->push_opcode(0);
-                    else if(opcode == "PUSH1") this->push_opcode(1);
-                    else if(opcode == "PUSH2") this->push_opcode(2);
-                    else if(opcode == "PUSH3") this->push_opcode(3);
-                    else if(opcode == "PUSH4") this->push_opcode(4);
-                    else if(opcode == "PUSH5") this->push_opcode(5);
-                    else if(opcode == "PUSH6") this->push_opcode(6);
-                    else if(opcode == "PUSH7") this->push_opcode(7);
-                    else if(opcode == "PUSH8") this->push_opcode(8);
-                    else if(opcode == "PUSH9") this->push_opcode(9);
-                    else if(opcode == "PUSH10") this->push_opcode(10);
-                    else if(opcode == "PUSH11") this->push_opcode(11);
-                    else if(opcode == "PUSH12") this->push_opcode(12);
-                    else if(opcode == "PUSH13") this->push_opcode(13);
-                    else if(opcode == "PUSH14") this->push_opcode(14);
-                    else if(opcode == "PUSH15") this->push_opcode(15);
-                    else if(opcode == "PUSH16") this->push_opcode(16);
-                    else if(opcode == "PUSH17") this->push_opcode(17);
-                    else if(opcode == "PUSH18") this->push_opcode(18);
-                    else if(opcode == "PUSH19") this->push_opcode(19);
-                    else if(opcode == "PUSH20") this->push_opcode(20);
-                    else if(opcode == "PUSH21") this->push_opcode(21);
-                    else if(opcode == "PUSH22") this->push_opcode(22);
-                    else if(opcode == "PUSH23") this->push_opcode(23);
-                    else if(opcode == "PUSH24") this->push_opcode(24);
-                    else if(opcode == "PUSH25") this->push_opcode(25);
-                    else if(opcode == "PUSH26") this->push_opcode(26);
-                    else if(opcode == "PUSH27") this->push_opcode(27);
-                    else if(opcode == "PUSH28") this->push_opcode(28);
-                    else if(opcode == "PUSH29") this->push_opcode(29);
-                    else if(opcode == "PUSH30") this->push_opcode(30);
-                    else if(opcode == "PUSH31") this->push_opcode(31);
-                    else if(opcode == "PUSH32") this->push_opcode(32);
-                    else if(opcode == "DUP1") this->dupx(1);
-                    else if(opcode == "DUP2") this->dupx(2);
-                    else if(opcode == "DUP3") this->dupx(3);
-                    else if(opcode == "DUP4") this->dupx(4);
-                    else if(opcode == "DUP5") this->dupx(5);
-                    else if(opcode == "DUP6") this->dupx(6);
-                    else if(opcode == "DUP7") this->dupx(7);
-                    else if(opcode == "DUP8") this->dupx(8);
-                    else if(opcode == "DUP9") this->dupx(9);
-                    else if(opcode == "DUP10") this->dupx(10);
-                    else if(opcode == "DUP11") this->dupx(11);
-                    else if(opcode == "DUP12") this->dupx(12);
-                    else if(opcode == "DUP13") this->dupx(13);
-                    else if(opcode == "DUP14") this->dupx(14);
-                    else if(opcode == "DUP15") this->dupx(15);
-                    else if(opcode == "DUP16") this->dupx(16);
-                    else if(opcode == "SWAP1") this->swapx(1);
-                    else if(opcode == "SWAP2") this->swapx(2);
-                    else if(opcode == "SWAP3") this->swapx(3);
-                    else if(opcode == "SWAP4") this->swapx(4);
-                    else if(opcode == "SWAP5") this->swapx(5);
-                    else if(opcode == "SWAP6") this->swapx(6);
-                    else if(opcode == "SWAP7") this->swapx(7);
-                    else if(opcode == "SWAP8") this->swapx(8);
-                    else if(opcode == "SWAP9") this->swapx(9);
-                    else if(opcode == "SWAP10") this->swapx(10);
-                    else if(opcode == "SWAP11") this->swapx(11);
-                    else if(opcode == "SWAP12") this->swapx(12);
-                    else if(opcode == "SWAP13") this->swapx(13);
-                    else if(opcode == "SWAP14") this->swapx(14);
-                    else if(opcode == "SWAP15") this->swapx(15);
-                    else if(opcode == "SWAP16") this->swapx(16);
-                    else if(opcode == "LOG0") logx(0);
-                    else if(opcode == "LOG1") logx(1);
-                    else if(opcode == "LOG2") logx(2);
-                    else if(opcode == "LOG3") logx(3);
-                    else if(opcode == "LOG4") logx(4);
-                    else if( opcode == "POP" ) this->pop();
-                    else if( opcode == "CALLDATALOAD" ) this->calldataload();
-                    else if( opcode == "CALLDATASIZE" ) this->calldatasize();
-                    else if( opcode == "CALLDATACOPY" ) this->calldatacopy();
-                    else if( opcode == "ADDRESS" )   this->address();
-                    else if( opcode == "BALANCE" )   this->balance();
-                    else if( opcode == "SELFBALANCE" )   this->selfbalance();
-                    else if( opcode == "BASEFEE" ) this->basefee();
-                    else if( opcode == "ORIGIN" )    this->origin();
-                    else if( opcode == "CALLER" )    this->caller_opcode();
-                    else if( opcode == "CALLVALUE" ) this->callvalue();
-                    else if( opcode == "DELEGATECALL" ) this->delegatecall();
-                    else if( opcode == "STATICCALL" ) this->staticcall();
-                    else if( opcode == "CALL" ) this->call();
-                    else if( opcode == "CREATE" ) this->create();
-                    else if( opcode == "CREATE2" ) this->create2();
-                    else if( opcode == "SELFDESTRUCT" ) selfdestruct();
-                    else{
-                        error_message = "Opcode " + opcode + " not supported";
+                    switch( opcode_from_number(current_opcode) ){
+                    case zkevm_opcode::STOP:           this->stop(); break;
+                    case zkevm_opcode::RETURN:         this->return_opcode(); break;
+                    case zkevm_opcode::REVERT:         this->revert(); break;
+                    case zkevm_opcode::INVALID:        this->invalid(); break;
+                    case zkevm_opcode::LT:             this->lt(); break;
+                    case zkevm_opcode::GT:             this->gt(); break;
+                    case zkevm_opcode::SLT:            this->slt(); break;
+                    case zkevm_opcode::SGT:            this->sgt(); break;
+                    case zkevm_opcode::SHL:            this->shl(); break;
+                    case zkevm_opcode::SHR:            this->shr(); break;
+                    case zkevm_opcode::SAR:            this->sar(); break;
+                    case zkevm_opcode::ADD:            this->add(); break;
+                    case zkevm_opcode::SUB:            this->sub(); break;
+                    case zkevm_opcode::MUL:            this->mul(); break;
+                    case zkevm_opcode::DIV:            this->div(); break;
+                    case zkevm_opcode::EXP:            this->exp(); break;
+                    case zkevm_opcode::SIGNEXTEND:     this->signextend(); break;
+                    case zkevm_opcode::MOD:            this->mod(); break;
+                    case zkevm_opcode::SDIV:           this->sdiv(); break;
+                    case zkevm_opcode::SMOD:           this->smod(); break;
+                    case zkevm_opcode::MULMOD:         this->mulmod(); break;
+                    case zkevm_opcode::ADDMOD:         this->addmod(); break;
+                    case zkevm_opcode::AND:            this->and_opcode(); break;
+                    case zkevm_opcode::OR:             this->or_opcode(); break;
+                    case zkevm_opcode::XOR:            this->xor_opcode(); break;
+                    case zkevm_opcode::BYTE:           this->byte(); break;
+                    case zkevm_opcode::EQ:             this->eq(); break;
+                    case zkevm_opcode::ISZERO:         this->iszero(); break;
+                    case zkevm_opcode::NOT:            this->not_opcode(); break;
+                    case zkevm_opcode::JUMP:           this->jump(); break;
+                    case zkevm_opcode::JUMPI:          this->jumpi(); break;
+                    case zkevm_opcode::JUMPDEST:       this->jumpdest(); break;
+                    case zkevm_opcode::MLOAD:          this->mload(); break;
+                    case zkevm_opcode::MSTORE:         this->mstore(); break;
+                    case zkevm_opcode::MSTORE8:        this->mstore8(); break;
+                    case zkevm_opcode::MCOPY:          this->mcopy(); break;
+                    case zkevm_opcode::SLOAD:          this->sload(); break;
+                    case zkevm_opcode::SSTORE:         this->sstore(); break;
+                    case zkevm_opcode::TLOAD:          this->tload(); break;
+                    case zkevm_opcode::TSTORE:         this->tstore(); break;
+                    case zkevm_opcode::KECCAK256:      this->keccak(); break;
+                    case zkevm_opcode::GAS:            this->gas_opcode(); break;
+                    case zkevm_opcode::PC:             this->pc_opcode(); break;
+                    case zkevm_opcode::MSIZE:          this->msize_opcode(); break;
+                    case zkevm_opcode::RETURNDATASIZE: this->returndatasize(); break;
+                    case zkevm_opcode::RETURNDATACOPY: this->returndatacopy(); break;
+                    case zkevm_opcode::CODESIZE:       this->codesize(); break;
+                    case zkevm_opcode::CODECOPY:       this->codecopy(); break;
+                    case zkevm_opcode::EXTCODESIZE:    this->extcodesize(); break;
+                    case zkevm_opcode::EXTCODEHASH:    this->extcodehash(); break;
+                    case zkevm_opcode::BLOCKHASH:      this->blockhash(); break;
+                    case zkevm_opcode::BLOBHASH:       this->blobhash(); break;
+                    case zkevm_opcode::BLOBBASEFEE:    this->blobbasefee(); break;
+                    case zkevm_opcode::COINBASE:       this->coinbase(); break;
+                    case zkevm_opcode::TIMESTAMP:      this->timestamp(); break;
+                    case zkevm_opcode::NUMBER:         this->number(); break;
+                    case zkevm_opcode::DIFFICULTY:     this->difficulty(); break;
+                    case zkevm_opcode::CHAINID:        this->chainid(); break;
+                    case zkevm_opcode::GASPRICE:       this->gasprice(); break;
+                    case zkevm_opcode::PUSH0:          this->push_opcode(0); break;
+                    case zkevm_opcode::PUSH1:          this->push_opcode(1); break;
+                    case zkevm_opcode::PUSH2:          this->push_opcode(2); break;
+                    case zkevm_opcode::PUSH3:          this->push_opcode(3); break;
+                    case zkevm_opcode::PUSH4:          this->push_opcode(4); break;
+                    case zkevm_opcode::PUSH5:          this->push_opcode(5); break;
+                    case zkevm_opcode::PUSH6:          this->push_opcode(6); break;
+                    case zkevm_opcode::PUSH7:          this->push_opcode(7); break;
+                    case zkevm_opcode::PUSH8:          this->push_opcode(8); break;
+                    case zkevm_opcode::PUSH9:          this->push_opcode(9); break;
+                    case zkevm_opcode::PUSH10:         this->push_opcode(10); break;
+                    case zkevm_opcode::PUSH11:         this->push_opcode(11); break;
+                    case zkevm_opcode::PUSH12:         this->push_opcode(12); break;
+                    case zkevm_opcode::PUSH13:         this->push_opcode(13); break;
+                    case zkevm_opcode::PUSH14:         this->push_opcode(14); break;
+                    case zkevm_opcode::PUSH15:         this->push_opcode(15); break;
+                    case zkevm_opcode::PUSH16:         this->push_opcode(16); break;
+                    case zkevm_opcode::PUSH17:         this->push_opcode(17); break;
+                    case zkevm_opcode::PUSH18:         this->push_opcode(18); break;
+                    case zkevm_opcode::PUSH19:         this->push_opcode(19); break;
+                    case zkevm_opcode::PUSH20:         this->push_opcode(20); break;
+                    case zkevm_opcode::PUSH21:         this->push_opcode(21); break;
+                    case zkevm_opcode::PUSH22:         this->push_opcode(22); break;
+                    case zkevm_opcode::PUSH23:         this->push_opcode(23); break;
+                    case zkevm_opcode::PUSH24:         this->push_opcode(24); break;
+                    case zkevm_opcode::PUSH25:         this->push_opcode(25); break;
+                    case zkevm_opcode::PUSH26:         this->push_opcode(26); break;
+                    case zkevm_opcode::PUSH27:         this->push_opcode(27); break;
+                    case zkevm_opcode::PUSH28:         this->push_opcode(28); break;
+                    case zkevm_opcode::PUSH29:         this->push_opcode(29); break;
+                    case zkevm_opcode::PUSH30:         this->push_opcode(30); break;
+                    case zkevm_opcode::PUSH31:         this->push_opcode(31); break;
+                    case zkevm_opcode::PUSH32:         this->push_opcode(32); break;
+                    case zkevm_opcode::DUP1:           this->dupx(1); break;
+                    case zkevm_opcode::DUP2:           this->dupx(2); break;
+                    case zkevm_opcode::DUP3:           this->dupx(3); break;
+                    case zkevm_opcode::DUP4:           this->dupx(4); break;
+                    case zkevm_opcode::DUP5:           this->dupx(5); break;
+                    case zkevm_opcode::DUP6:           this->dupx(6); break;
+                    case zkevm_opcode::DUP7:           this->dupx(7); break;
+                    case zkevm_opcode::DUP8:           this->dupx(8); break;
+                    case zkevm_opcode::DUP9:           this->dupx(9); break;
+                    case zkevm_opcode::DUP10:          this->dupx(10); break;
+                    case zkevm_opcode::DUP11:          this->dupx(11); break;
+                    case zkevm_opcode::DUP12:          this->dupx(12); break;
+                    case zkevm_opcode::DUP13:          this->dupx(13); break;
+                    case zkevm_opcode::DUP14:          this->dupx(14); break;
+                    case zkevm_opcode::DUP15:          this->dupx(15); break;
+                    case zkevm_opcode::DUP16:          this->dupx(16); break;
+                    case zkevm_opcode::SWAP1:          this->swapx(1); break;
+                    case zkevm_opcode::SWAP2:          this->swapx(2); break;
+                    case zkevm_opcode::SWAP3:          this->swapx(3); break;
+                    case zkevm_opcode::SWAP4:          this->swapx(4); break;
+                    case zkevm_opcode::SWAP5:          this->swapx(5); break;
+                    case zkevm_opcode::SWAP6:          this->swapx(6); break;
+                    case zkevm_opcode::SWAP7:          this->swapx(7); break;
+                    case zkevm_opcode::SWAP8:          this->swapx(8); break;
+                    case zkevm_opcode::SWAP9:          this->swapx(9); break;
+                    case zkevm_opcode::SWAP10:         this->swapx(10); break;
+                    case zkevm_opcode::SWAP11:         this->swapx(11); break;
+                    case zkevm_opcode::SWAP12:         this->swapx(12); break;
+                    case zkevm_opcode::SWAP13:         this->swapx(13); break;
+                    case zkevm_opcode::SWAP14:         this->swapx(14); break;
+                    case zkevm_opcode::SWAP15:         this->swapx(15); break;
+                    case zkevm_opcode::SWAP16:         this->swapx(16); break;
+                    case zkevm_opcode::LOG0:           this->logx(0); break;
+                    case zkevm_opcode::LOG1:           this->logx(1); break;
+                    case zkevm_opcode::LOG2:           this->logx(2); break;
+                    case zkevm_opcode::LOG3:           this->logx(3); break;
+                    case zkevm_opcode::LOG4:           this->logx(4); break;
+                    case zkevm_opcode::POP:            this->pop(); break;
+                    case zkevm_opcode::CALLDATALOAD:   this->calldataload(); break;
+                    case zkevm_opcode::CALLDATASIZE:   this->calldatasize(); break;
+                    case zkevm_opcode::CALLDATACOPY:   this->calldatacopy(); break;
+                    case zkevm_opcode::ADDRESS:        this->address(); break;
+                    case zkevm_opcode::BALANCE:        this->balance(); break;
+                    case zkevm_opcode::SELFBALANCE:    this->selfbalance(); break;
+                    case zkevm_opcode::BASEFEE:        this->basefee(); break;
+                    case zkevm_opcode::ORIGIN:         this->origin(); break;
+                    case zkevm_opcode::CALLER:         this->caller_opcode(); break;
+                    case zkevm_opcode::CALLVALUE:      this->callvalue(); break;
+                    case zkevm_opcode::DELEGATECALL:   this->delegatecall(); break;
+                    case zkevm_opcode::STATICCALL:     this->staticcall(); break;
+                    case zkevm_opcode::CALL:           this->call(); break;
+                    case zkevm_opcode::CREATE:         this->create(); break;
+                    case zkevm_opcode::CREATE2:        this->create2(); break;
+                    case zkevm_opcode::SELFDESTRUCT:   this->selfdestruct(); break;
+                    default:
+                        error_message = "Opcode " + opcode_to_string(opcode_from_number(current_opcode)) + " not supported";
                         BOOST_LOG_TRIVIAL(error) << error_message;
                         execution_status = false;
                         return;
@@ -640,13 +641,7 @@ namespace nil {
                     std::size_t next_memory_size = (memory_size_word_util(next_mem))*32;
 
                     if( memory.size() < next_mem) memory.resize(next_mem);
-                    std::vector<std::uint8_t> data;
-                    for( std::size_t i = 0; i < length; i++){
-                        data.push_back(memory[src+i]);
-                    }
-                    for( std::size_t i = 0; i < length; i++){
-                        memory[dst + i] = data[i];
-                    }
+                    if( length != 0 ) std::memmove(memory.data() + dst, memory.data() + src, length);
 
                     decrease_gas(3); //static gas
                     decrease_gas(3 * minimum_word_size + memory_expansion); //dynamic gas
@@ -689,9 +684,7 @@ namespace nil {
                     std::size_t new_memory_cost = memory_size_word * memory_size_word / 512 + (3*memory_size_word);
                     std::size_t memory_expansion = new_memory_cost - last_memory_cost;
 
-                    for( std::size_t i = 0; i < 32; i++){
-                        result = (result << 8) + memory[offset + i];
-                    }
+                    result = zkevm_word_from_memory(memory.data() + offset);
 
                     stack.push_back(result);
                     pc++;
@@ -715,10 +708,7 @@ namespace nil {
                         BOOST_LOG_TRIVIAL(trace) << "Memory expansion " << memory.size() << " => " << new_mem_size << std::endl;
                         memory.resize(new_mem_size);
                     }
-                    for( std::size_t i = 0; i < 32; i++){
-                        memory[offset + 31 - i] = std::uint8_t(std::size_t(value % 256));
-                        value = value >> 8;
-                    }
+                    zkevm_word_to_memory(value, memory.data() + offset);
                     decrease_gas(3 + memory_expansion);
                     pc++;
                 }
@@ -815,10 +805,7 @@ namespace nil {
                     if( memory.size() < offset + length) memory.resize(offset + length);
                     decrease_gas(memory_expansion);
 
-                    returndata.clear();
-                    for( std::size_t i = 0; i < length; i++){
-                        returndata.push_back(memory[offset+i]);
-                    }
+                    returndata.assign(memory.begin() + offset, memory.begin() + offset + length);
 
                     if( _call_stack.back().call_is_create || _call_stack.back().call_is_create2 ){
                         call_status = call_context_address;
@@ -841,10 +828,7 @@ namespace nil {
                     if( memory.size() < offset + length) memory.resize(offset + length);
                     decrease_gas(memory_expansion);
 
-                    returndata.clear();
-                    for( std::size_t i = 0; i < length; i++){
-                        returndata.push_back(memory[offset+i]);
-                    }
+                    returndata.assign(memory.begin() + offset, memory.begin() + offset + length);
 
                     _accounts_current_state = _call_stack[_call_stack.size() - 1].state;
                     _call_stack.back().was_accessed = _call_stack[_call_stack.size() - 2].was_accessed;
@@ -1798,7 +1782,6 @@ namespace nil {
 
                 virtual void end_transaction(){
                     BOOST_LOG_TRIVIAL(trace) << "basic_evm::End transaction" << std::endl;
-                    auto returned_call = _call_stack.back();
                     _call_stack.pop_back();
                     depth--;
                     current_opcode = opcode_to_number(zkevm_opcode::end_transaction);
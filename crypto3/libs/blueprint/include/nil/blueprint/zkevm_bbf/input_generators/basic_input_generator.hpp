@@ -64,7 +64,7 @@ namespace nil {
                 std::vector<copy_event>                                  _copy_events;
                 std::vector<zkevm_state>                                 _zkevm_states;
                 std::vector<std::pair<zkevm_word_type, zkevm_word_type>> _exponentiations;
-                std::map<zkevm_word_type, zkevm_account>                 _accounts;
+                zkevm_accounts_type                                      _accounts;
                 std::map<std::size_t, zkevm_call_state_data>            _call_state_data;
                 std::vector<timeline_item>                              _timeline;
 
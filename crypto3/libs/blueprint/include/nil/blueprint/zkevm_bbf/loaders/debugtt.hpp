@@ -48,7 +48,7 @@ namespace nil {
         namespace bbf {
             class debugtt_block_loader : abstract_block_loader{
             protected:
-                std::map<zkevm_word_type, zkevm_account>                    _accounts_initial_state;
+                zkevm_accounts_type                                         _accounts_initial_state;
                 std::set<zkevm_word_type>                                   _existing_accounts;
                 std::size_t current_block = 0;
                 std::size_t blocks_amount = 0;
@@ -121,7 +121,7 @@ namespace nil {
                     return block;
                 }
 
-                virtual std::tuple<zkevm_transaction, std::map<zkevm_word_type, zkevm_account>, std::set<zkevm_word_type>> load_transaction(std::size_t i) {
+                virtual std::tuple<zkevm_transaction, zkevm_accounts_type, std::set<zkevm_word_type>> load_transaction(std::size_t i) {
                     BOOST_LOG_TRIVIAL(trace) << "Load transaction " << i << std::endl;
                     const auto &tt = tx_list[i].get_child("tx");
                     zkevm_transaction tx;
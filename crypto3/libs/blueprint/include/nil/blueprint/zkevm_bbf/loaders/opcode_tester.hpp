@@ -52,7 +52,7 @@ namespace nil {
             class opcode_tester_block_loader : abstract_block_loader{
                 zkevm_block block;
                 zkevm_transaction tx;
-                std::map<zkevm_word_type, zkevm_account> _accounts_initial_state;
+                zkevm_accounts_type _accounts_initial_state;
                 std::set<zkevm_word_type>                _existing_accounts;
                 bool                                     _are_there_more_blocks = true;
             public:
@@ -68,7 +68,7 @@ namespace nil {
 
                 virtual std::tuple<
                     zkevm_transaction,
-                    std::map<zkevm_word_type, zkevm_account>,
+                    zkevm_accounts_type,
                     std::set<zkevm_word_type>
                 > load_transaction(std::size_t tx_order) override{
                     return {tx, _accounts_initial_state, _existing_accounts};
@@ -54,7 +54,7 @@ namespace nil {
                 std::string                                                 path;
                 boost::property_tree::ptree                                 block_ptree;
                 std::vector<boost::property_tree::ptree>                    tx_list;
-                std::map<zkevm_word_type, zkevm_account>                    _accounts_initial_state;
+                zkevm_accounts_type                                         _accounts_initial_state;
                 std::set<zkevm_word_type>                                   _existing_accounts;
                 std::map<std::pair<std::size_t, std::vector<std::uint8_t>>, std::pair<std::size_t, std::vector<std::uint8_t>>> precompiles_cache;
                 boost::property_tree::ptree                                 tx_trace_tree;
@@ -83,7 +83,7 @@ namespace nil {
 
                 virtual std::tuple<
                     zkevm_transaction,
-                    std::map<zkevm_word_type, zkevm_account>,
+                    zkevm_accounts_type,
                     std::set<zkevm_word_type>
                 > load_transaction(std::size_t tx_order) override{
                     current_tx = tx_order;
@@ -31,6 +31,7 @@
 
 #include <nil/blueprint/zkevm_bbf/types/zkevm_block.hpp>
 #include <nil/blueprint/zkevm_bbf/types/zkevm_transaction.hpp>
+#include <nil/blueprint/zkevm_bbf/types/zkevm_account.hpp>
 
 namespace nil {
     namespace blueprint {
@@ -38,7 +39,7 @@ namespace nil {
             class abstract_block_loader{
             public:
                 virtual zkevm_block load_block() = 0;
-                virtual std::tuple<zkevm_transaction, std::map<zkevm_word_type, zkevm_account>, std::set<zkevm_word_type>> load_transaction(std::size_t i) = 0;
+                virtual std::tuple<zkevm_transaction, zkevm_accounts_type, std::set<zkevm_word_type>> load_transaction(std::size_t i) = 0;
                 virtual bool are_there_more_blocks() = 0;
 
                 // TODO: implement precompiles and remove this function from interface
@@ -30,6 +30,7 @@
 #include <nil/blueprint/bbf/generic.hpp>
 
 #include <nil/blueprint/zkevm_bbf/types/zkevm_state.hpp>
+#include <nil/blueprint/zkevm_bbf/types/zkevm_account.hpp>
 
 namespace nil {
     namespace blueprint {
@@ -61,7 +62,7 @@ namespace nil {
 
                 std::set<std::tuple<zkevm_word_type, std::size_t, zkevm_word_type>> was_accessed; // For SLOAD, SSTORE gas proving
                 std::map<std::pair<zkevm_word_type, zkevm_word_type>, zkevm_word_type> transient_storage; // For TLOAD, TSTORE
-                std::map<zkevm_word_type, zkevm_account> state;         // At the beginning of the CALL
+                zkevm_accounts_type state;         // At the beginning of the CALL
 
                 std::size_t end; // rw_counter before opcode that finishes CALL -- REVERT, STOP, RETURN
                 std::size_t args_offset;
@@ -368,166 +368,26 @@ namespace nil {
                 return 0x102;
             }
 
+            static constexpr std::size_t zkevm_opcodes_amount = 0
+                #define ENUM_DEF(name) + 1
+                ZKEVM_OPCODE_ENUM(ENUM_DEF)
+                #undef ENUM_DEF
+            ;
+
+            // Opcode numbers are looked up on every interpreted instruction, so both directions
+            // of the mapping are tabulated once from opcode_number_from_str.
             zkevm_opcode opcode_from_number(std::size_t number){
-                if( number == 0x00) return zkevm_opcode::STOP;
-                if( number == 0x01 ) return zkevm_opcode::ADD;
-                if( number == 0x02 ) return zkevm_opcode::MUL;
-                if( number ==  0x03) return zkevm_opcode::SUB;
-                if( number ==  0x04) return zkevm_opcode::DIV;
-                if( number ==  0x05) return zkevm_opcode::SDIV;
-                if( number ==  0x06) return zkevm_opcode::MOD;
-                if( number ==  0x07) return zkevm_opcode::SMOD;
-                if( number ==  0x08) return zkevm_opcode::ADDMOD;
-                if( number ==  0x09) return zkevm_opcode::MULMOD;
-                if( number ==  0x0a) return zkevm_opcode::EXP;
-                if( number ==  0x0b) return zkevm_opcode::SIGNEXTEND;
-                if( number ==  0x10) return zkevm_opcode::LT;
-                if( number ==  0x11) return zkevm_opcode::GT;
-                if( number ==  0x12) return zkevm_opcode::SLT;
-                if( number ==  0x13) return zkevm_opcode::SGT;
-                if( number ==  0x14) return zkevm_opcode::EQ;
-                if( number ==  0x15) return zkevm_opcode::ISZERO;
-                if( number ==  0x16) return zkevm_opcode::AND;
-                if( number ==  0x17) return zkevm_opcode::OR;
-                if( number ==  0x18) return zkevm_opcode::XOR;
-                if( number ==  0x19) return zkevm_opcode::NOT;
-                if( number ==  0x1a) return zkevm_opcode::BYTE;
-                if( number ==  0x1b) return zkevm_opcode::SHL;
-                if( number ==  0x1c) return zkevm_opcode::SHR;
-                if( number ==  0x1d) return zkevm_opcode::SAR;
-                if( number ==  0x20) return zkevm_opcode::KECCAK256;
-                if( number ==  0x30) return zkevm_opcode::ADDRESS;
-                if( number ==  0x31) return zkevm_opcode::BALANCE;
-                if( number ==  0x32) return zkevm_opcode::ORIGIN;
-                if( number ==  0x33) return zkevm_opcode::CALLER;
-                if( number ==  0x34) return zkevm_opcode::CALLVALUE;
-                if( number ==  0x35) return zkevm_opcode::CALLDATALOAD;
-                if( number ==  0x36) return zkevm_opcode::CALLDATASIZE;
-                if( number ==  0x37) return zkevm_opcode::CALLDATACOPY;
-                if( number ==  0x38) return zkevm_opcode::CODESIZE;
-                if( number ==  0x39) return zkevm_opcode::CODECOPY;
-                if( number ==  0x3a) return zkevm_opcode::GASPRICE;
-                if( number ==  0x3b) return zkevm_opcode::EXTCODESIZE;
-                if( number ==  0x3c) return zkevm_opcode::EXTCODECOPY;
-                if( number ==  0x3d) return zkevm_opcode::RETURNDATASIZE;
-                if( number ==  0x3e) return zkevm_opcode::RETURNDATACOPY;
-                if( number ==  0x3f) return zkevm_opcode::EXTCODEHASH;
-                if( number ==  0x40) return zkevm_opcode::BLOCKHASH;
-                if( number ==  0x41) return zkevm_opcode::COINBASE;
-                if( number ==  0x42) return zkevm_opcode::TIMESTAMP;
-                if( number ==  0x43) return zkevm_opcode::NUMBER;
-                if( number ==  0x44) return zkevm_opcode::DIFFICULTY;
-                if( number ==  0x45) return zkevm_opcode::GASLIMIT;
-                if( number ==  0x46) return zkevm_opcode::CHAINID;
-                if( number ==  0x47) return zkevm_opcode::SELFBALANCE;
-                if( number ==  0x48) return zkevm_opcode::BASEFEE;
-                if( number ==  0x49) return zkevm_opcode::BLOBHASH;
-                if( number ==  0x4a) return zkevm_opcode::BLOBBASEFEE;
-                if( number ==  0x50) return zkevm_opcode::POP;
-                if( number ==  0x51) return zkevm_opcode::MLOAD;
-                if( number ==  0x52) return zkevm_opcode::MSTORE;
-                if( number ==  0x53) return zkevm_opcode::MSTORE8;
-                if( number ==  0x54) return zkevm_opcode::SLOAD;
-                if( number ==  0x55) return zkevm_opcode::SSTORE;
-                if( number ==  0x56) return zkevm_opcode::JUMP;
-                if( number ==  0x57) return zkevm_opcode::JUMPI;
-                if( number ==  0x58) return zkevm_opcode::PC;
-                if( number ==  0x59) return zkevm_opcode::MSIZE;
-                if( number ==  0x5a) return zkevm_opcode::GAS;
-                if( number ==  0x5b) return zkevm_opcode::JUMPDEST;
-                if( number ==  0x5c) return zkevm_opcode::TLOAD;
-                if( number ==  0x5d) return zkevm_opcode::TSTORE;
-                if( number ==  0x5e) return zkevm_opcode::MCOPY;
-                if( number ==  0x5f) return zkevm_opcode::PUSH0;
-                if( number ==  0x60) return zkevm_opcode::PUSH1;
-                if( number ==  0x61) return zkevm_opcode::PUSH2;
-                if( number ==  0x62) return zkevm_opcode::PUSH3;
-                if( number ==  0x63) return zkevm_opcode::PUSH4;
-                if( number ==  0x64) return zkevm_opcode::PUSH5;
-                if( number ==  0x65) return zkevm_opcode::PUSH6;
-                if( number ==  0x66) return zkevm_opcode::PUSH7;
-                if( number ==  0x67) return zkevm_opcode::PUSH8;
-                if( number ==  0x68) return zkevm_opcode::PUSH9;
-                if( number ==  0x69) return zkevm_opcode::PUSH10;
-                if( number ==  0x6a) return zkevm_opcode::PUSH11;
-                if( number ==  0x6b) return zkevm_opcode::PUSH12;
-                if( number ==  0x6c) return zkevm_opcode::PUSH13;
-                if( number ==  0x6d) return zkevm_opcode::PUSH14;
-                if( number ==  0x6e) return zkevm_opcode::PUSH15;
-                if( number ==  0x6f) return zkevm_opcode::PUSH16;
-                if( number ==  0x70) return zkevm_opcode::PUSH17;
-                if( number ==  0x71) return zkevm_opcode::PUSH18;
-                if( number ==  0x72) return zkevm_opcode::PUSH19;
-                if( number ==  0x73) return zkevm_opcode::PUSH20;
-                if( number ==  0x74) return zkevm_opcode::PUSH21;
-                if( number ==  0x75) return zkevm_opcode::PUSH22;
-                if( number ==  0x76) return zkevm_opcode::PUSH23;
-                if( number ==  0x77) return zkevm_opcode::PUSH24;
-                if( number ==  0x78) return zkevm_opcode::PUSH25;
-                if( number ==  0x79) return zkevm_opcode::PUSH26;
-                if( number ==  0x7a) return zkevm_opcode::PUSH27;
-                if( number ==  0x7b) return zkevm_opcode::PUSH28;
-                if( number ==  0x7c) return zkevm_opcode::PUSH29;
-                if( number ==  0x7d) return zkevm_opcode::PUSH30;
-                if( number ==  0x7e) return zkevm_opcode::PUSH31;
-                if( number ==  0x7f) return zkevm_opcode::PUSH32;
-                if( number ==  0x80) return zkevm_opcode::DUP1;
-                if( number ==  0x81) return zkevm_opcode::DUP2;
-                if( number ==  0x82) return zkevm_opcode::DUP3;
-                if( number ==  0x83) return zkevm_opcode::DUP4;
-                if( number ==  0x84) return zkevm_opcode::DUP5;
-                if( number ==  0x85) return zkevm_opcode::DUP6;
-                if( number ==  0x86) return zkevm_opcode::DUP7;
-                if( number ==  0x87) return zkevm_opcode::DUP8;
-                if( number ==  0x88) return zkevm_opcode::DUP9;
-                if( number ==  0x89) return zkevm_opcode::DUP10;
-                if( number ==  0x8a) return zkevm_opcode::DUP11;
-                if( number ==  0x8b) return zkevm_opcode::DUP12;
-                if( number ==  0x8c) return zkevm_opcode::DUP13;
-                if( number ==  0x8d) return zkevm_opcode::DUP14;
-                if( number ==  0x8e) return zkevm_opcode::DUP15;
-                if( number ==  0x8f) return zkevm_opcode::DUP16;
-                if( number ==  0x90) return zkevm_opcode::SWAP1;
-                if( number ==  0x91) return zkevm_opcode::SWAP2;
-                if( number ==  0x92) return zkevm_opcode::SWAP3;
-                if( number ==  0x93) return zkevm_opcode::SWAP4;
-                if( number ==  0x94) return zkevm_opcode::SWAP5;
-                if( number ==  0x95) return zkevm_opcode::SWAP6;
-                if( number ==  0x96) return zkevm_opcode::SWAP7;
-                if( number ==  0x97) return zkevm_opcode::SWAP8;
-                if( number ==  0x98) return zkevm_opcode::SWAP9;
-                if( number ==  0x99) return zkevm_opcode::SWAP10;
-                if( number ==  0x9a) return zkevm_opcode::SWAP11;
-                if( number ==  0x9b) return zkevm_opcode::SWAP12;
-                if( number ==  0x9c) return zkevm_opcode::SWAP13;
-                if( number ==  0x9d) return zkevm_opcode::SWAP14;
-                if( number ==  0x9e) return zkevm_opcode::SWAP15;
-                if( number ==  0x9f) return zkevm_opcode::SWAP16;
-                if( number ==  0xa0) return zkevm_opcode::LOG0;
-                if( number ==  0xa1) return zkevm_opcode::LOG1;
-                if( number ==  0xa2) return zkevm_opcode::LOG2;
-                if( number ==  0xa3) return zkevm_opcode::LOG3;
-                if( number ==  0xa4) return zkevm_opcode::LOG4;
-                if( number ==  0xf0) return zkevm_opcode::CREATE;
-                if( number ==  0xf1) return zkevm_opcode::CALL;
-                if( number ==  0xf2) return zkevm_opcode::CALLCODE;
-                if( number ==  0xf3) return zkevm_opcode::RETURN;
-                if( number ==  0xf4) return zkevm_opcode::DELEGATECALL;
-                if( number ==  0xf5) return zkevm_opcode::CREATE2;
-                if( number ==  0xfa) return zkevm_opcode::STATICCALL;
-                if( number ==  0xfd) return zkevm_opcode::REVERT;
-                if( number ==  0xfe) return zkevm_opcode::INVALID;
-                if( number ==  0xff) return zkevm_opcode::SELFDESTRUCT;
-                // these are not real opcodes, they are for exception processing
-                if( number == 0x100 ) return zkevm_opcode::error_gas; // incorrect stack size
-                if( number == 0x101 ) return zkevm_opcode::err1; // not enough gas
-                if( number == 0x102 ) return zkevm_opcode::padding; // empty opcode for the fixed circuit size
-                if( number == 0x103 ) return zkevm_opcode::start_block; // opcode for start call
-                if( number == 0x104 ) return zkevm_opcode::start_transaction; // opcode for start call
-                if( number == 0x105 ) return zkevm_opcode::start_call; // opcode for start call
-                if( number == 0x106 ) return zkevm_opcode::end_call; // opcode for end call
-                if( number == 0x107 ) return zkevm_opcode::end_transaction; // opcode for end call
-                if( number == 0x108 ) return zkevm_opcode::end_block; // opcode for end call
+                static constexpr std::size_t table_size = 0x109;
+                static const std::array<std::int16_t, table_size> opcodes = [](){
+                    std::array<std::int16_t, table_size> result;
+                    result.fill(-1);
+                    #define ENUM_DEF(name) result[opcode_number_from_str(#name)] = zkevm_opcode::name;
+                    ZKEVM_OPCODE_ENUM(ENUM_DEF)
+                    #undef ENUM_DEF
+                    return result;
+                }();
+
+                if( number < table_size && opcodes[number] >= 0 ) return zkevm_opcode(opcodes[number]);
                 std::cout << "Unknown opcode " << std::hex << number << std::dec << std::endl;
                 BOOST_ASSERT(false);
                 return zkevm_opcode::padding;
@@ -552,7 +412,14 @@ namespace nil {
             }
 
             std::size_t opcode_to_number(const zkevm_opcode &opcode ){
-                return opcode_number_from_str(opcode_to_string(opcode));
+                static const std::array<std::uint16_t, zkevm_opcodes_amount> numbers = [](){
+                    std::array<std::uint16_t, zkevm_opcodes_amount> result;
+                    #define ENUM_DEF(name) result[zkevm_opcode::name] = opcode_number_from_str(#name);
+                    ZKEVM_OPCODE_ENUM(ENUM_DEF)
+                    #undef ENUM_DEF
+                    return result;
+                }();
+                return numbers[opcode];
             }
 
             std::ostream& operator<<(std::ostream& os, const zkevm_opcode& opcode) {
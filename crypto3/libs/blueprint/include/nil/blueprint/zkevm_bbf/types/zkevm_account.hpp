@@ -23,6 +23,8 @@
 //---------------------------------------------------------------------------//
 
 #pragma once
+#include <unordered_map>
+
 #include <nil/crypto3/hash/type_traits.hpp>
 #include <nil/crypto3/hash/algorithm/hash.hpp>
 
@@ -47,8 +49,8 @@ namespace nil {
                 std::size_t     ext_seq_no;
                 std::size_t     request_id;
 
-                std::map<zkevm_word_type, zkevm_word_type> storage; // Optional
-                std::vector<std::uint8_t> bytecode;                 // Optional
+                std::unordered_map<zkevm_word_type, zkevm_word_type> storage; // Optional
+                std::vector<std::uint8_t> bytecode;                           // Optional
 
                 void set(std::size_t field_type, zkevm_word_type storage_key, zkevm_word_type value){
                     BOOST_ASSERT(field_type == 0);  // Other field types not implemented yet
@@ -73,6 +75,10 @@ namespace nil {
                 }
                 return os;
             }
+
+            // Accounts are looked up by address on every state-touching opcode and copied
+            // into each call frame, so hashed lookups are used instead of an ordered tree.
+            using zkevm_accounts_type = std::unordered_map<zkevm_word_type, zkevm_account>;
         } // namespace bbf
     } // namespace blueprint
 } // namespace nil
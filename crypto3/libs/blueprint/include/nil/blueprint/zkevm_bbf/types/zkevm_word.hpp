@@ -24,6 +24,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <iterator>
+
 #include <nil/crypto3/multiprecision/literals.hpp>
 
 #include <nil/crypto3/hash/type_traits.hpp>
@@ -112,6 +116,22 @@ namespace nil {
             return result;
         }
 
+        // Reads a 32-byte big-endian word, e.g. from EVM memory. The bytes are reversed first so that
+        // import_bits can copy them into limbs directly instead of shifting the word byte by byte.
+        zkevm_word_type zkevm_word_from_memory(const std::uint8_t *bytes){
+            std::array<std::uint8_t, 32> reversed;
+            std::reverse_copy(bytes, bytes + 32, reversed.begin());
+            zkevm_word_type result;
+            result.import_bits(reversed.data(), reversed.data() + reversed.size(), 8, false);
+            return result;
+        }
+
+        // Writes a word as 32 big-endian bytes, e.g. into EVM memory.
+        void zkevm_word_to_memory(const zkevm_word_type &word, std::uint8_t *bytes){
+            std::fill_n(bytes, 32, 0);
+            word.export_bits(std::reverse_iterator<std::uint8_t*>(bytes + 32), 8, false);
+        }
+
         template<typename BlueprintFieldType>
         typename BlueprintFieldType::value_type w_hi(const zkevm_word_type &val) {
             static constexpr zkevm_word_type mask =
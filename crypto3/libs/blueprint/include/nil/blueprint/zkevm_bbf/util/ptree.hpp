@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include <nil/blueprint/zkevm_bbf/types/zkevm_word.hpp>
 
 #include <boost/property_tree/ptree.hpp>
@@ -39,8 +41,8 @@ namespace nil {
             return result;
         }
 
-        std::map<zkevm_word_type, zkevm_word_type> key_value_storage_from_ptree(const boost::property_tree::ptree &ptree){
-            std::map<zkevm_word_type, zkevm_word_type> result;
+        std::unordered_map<zkevm_word_type, zkevm_word_type> key_value_storage_from_ptree(const boost::property_tree::ptree &ptree){
+            std::unordered_map<zkevm_word_type, zkevm_word_type> result;
             for(auto it = ptree.begin(); it != ptree.end(); it++){
                 result[zkevm_word_from_string(it->first.data())] = zkevm_word_from_string(it->second.data());
             }
@@ -5,6 +5,7 @@ set(COMMON_TEST_FILES
     "detail/huang_lu"
     "gate_id"
     "utils/connectedness_check"
+    "utils/satisfiability_check"
     "private_input"
     #"mock/mocked_components"
     "component_batch"
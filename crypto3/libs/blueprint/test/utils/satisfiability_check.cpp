@@ -0,0 +1,145 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE satisfiability_check_test
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+
+#include <nil/blueprint/blueprint/plonk/assignment.hpp>
+#include <nil/blueprint/blueprint/plonk/circuit.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_table.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/variable.hpp>
+#include <nil/blueprint/utils/flat_row_set.hpp>
+#include <nil/blueprint/utils/satisfiability_check.hpp>
+
+using namespace nil::blueprint;
+using namespace nil::crypto3;
+
+namespace {
+    using field_type = algebra::curves::pallas::base_field_type;
+    using value_type = typename field_type::value_type;
+    using constraint_system_type = zk::snark::plonk_constraint_system<field_type>;
+    using var = zk::snark::plonk_variable<value_type>;
+
+    // Rows of w_0 count from 0, w_1 holds the squares. Neither 150 nor the rotations line up with the blocks of 64
+    // rows the checker works on.
+    constexpr std::size_t rows_amount = 150;
+
+    struct test_circuit {
+        circuit<constraint_system_type> bp;
+        assignment<constraint_system_type> table{2, 0, 0, 4};
+    };
+
+    // The squares are checked by a gate on every row and by a lookup into the dynamic table of (w_0, w_1)
+    // on the odd rows. lookup_shift is added to the first lookup input.
+    test_circuit make_circuit(std::size_t lookup_shift) {
+        test_circuit result;
+        auto &bp = result.bp;
+        auto &table = result.table;
+
+        for (std::size_t row = 0; row < rows_amount; row++) {
+            table.witness(0, row) = value_type(row);
+            table.witness(1, row) = value_type(row * row);
+        }
+
+        bp.add_gate(zk::snark::PLONK_SPECIAL_SELECTOR_ALL_ROWS_SELECTED,
+                    {var(1, 0) - var(0, 0) * var(0, 0)});
+        std::size_t step_selector = bp.add_gate({
+            var(0, 0) - var(0, -1) - 1,
+            var(1, 1) - var(1, 0) - value_type(2) * var(0, 0) - 1});
+        for (std::size_t row = 1; row + 1 < rows_amount; row++) {
+            table.enable_selector(step_selector, row);
+        }
+
+        bp.reserve_dynamic_table("squares");
+        std::size_t tag_selector = bp.get_dynamic_lookup_table_selector();
+        zk::snark::plonk_lookup_table<field_type> squares(2, tag_selector);
+        squares.append_option({var(0, 0, true, var::column_type::witness), var(1, 0, true, var::column_type::witness)});
+        bp.add_lookup_table(squares);
+        for (std::size_t row = 0; row < rows_amount; row++) {
+            table.enable_selector(tag_selector, row);
+        }
+
+        std::size_t table_id = bp.get_reserved_indices().at("squares");
+        std::size_t lookup_selector = bp.add_lookup_gate(
+            {{table_id, {var(0, -1) + value_type(lookup_shift), var(1, -1)}}});
+        for (std::size_t row = 1; row < rows_amount; row += 2) {
+            table.enable_selector(lookup_selector, row);
+        }
+        return result;
+    }
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(satisfiability_check_test_suite)
+
+BOOST_AUTO_TEST_CASE(satisfiability_check_gates_and_lookups) {
+    auto [bp, table] = make_circuit(0);
+    BOOST_CHECK(satisfiability_checker<field_type>::is_satisfied(bp, table));
+
+    // The gate on all rows, the row wraps around into the rotated loads.
+    for (std::size_t row : {std::size_t(0), std::size_t(63), std::size_t(64), rows_amount - 1}) {
+        auto broken = table;
+        broken.witness(1, row) += value_type::one();
+        BOOST_CHECK(!satisfiability_checker<field_type>::is_satisfied(bp, broken));
+    }
+
+    // A lookup input which is not in the table.
+    auto [shifted_bp, shifted_table] = make_circuit(1);
+    BOOST_CHECK(!satisfiability_checker<field_type>::is_satisfied(shifted_bp, shifted_table));
+}
+
+BOOST_AUTO_TEST_CASE(satisfiability_check_unused_lookup_gate) {
+    // A lookup gate into a table which is not in the circuit, its tables are needed only once it selects a row.
+    auto [bp, table] = make_circuit(0);
+    std::size_t unknown_selector = bp.add_lookup_gate({{1000, {var(0, 0)}}});
+    BOOST_CHECK(satisfiability_checker<field_type>::is_satisfied(bp, table));
+
+    table.enable_selector(unknown_selector, 5);
+    BOOST_CHECK(!satisfiability_checker<field_type>::is_satisfied(bp, table));
+}
+
+BOOST_AUTO_TEST_CASE(satisfiability_check_flat_row_set) {
+    flat_row_set<value_type> set(3);
+    for (std::size_t i = 0; i < 1000; i++) {
+        std::vector<value_type> row = {value_type(i), value_type(i % 7), value_type(0)};
+        BOOST_CHECK(set.insert(row.data()));
+        BOOST_CHECK(!set.insert(row.data()));
+    }
+    BOOST_CHECK_EQUAL(set.size(), 1000);
+    for (std::size_t i = 0; i < 1000; i++) {
+        std::vector<value_type> row = {value_type(i), value_type(i % 7), value_type(0)};
+        BOOST_CHECK(set.contains(row.data()));
+        row[2] = value_type::one();
+        BOOST_CHECK(!set.contains(row.data()));
+    }
+    BOOST_CHECK(set.row(5)[0] == value_type(5));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
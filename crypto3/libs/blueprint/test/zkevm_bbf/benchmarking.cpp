@@ -23,6 +23,7 @@
 //---------------------------------------------------------------------------//
 #define BOOST_TEST_MODULE blueprint_plonk_benchmarking_test
 
+#include <chrono>
 #include <cstdlib>
 #include <string_view>
 #include <unordered_map>
@@ -122,3 +123,51 @@ BOOST_DATA_TEST_CASE(minimal_math_babybear_fp5_fixed_size,
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+// Interpreter throughput of zkevm_basic_evm alone, without circuit assignment.
+// Only transaction execution is timed, trace loading is excluded.
+class basic_evm_throughput_counter : public nil::blueprint::bbf::zkevm_basic_evm {
+  public:
+    std::size_t executed_opcodes = 0;
+    std::chrono::nanoseconds execution_time{0};
+
+    basic_evm_throughput_counter(abstract_block_loader *loader) : zkevm_basic_evm(loader) {}
+
+    virtual void execute_transaction() override {
+        auto start = std::chrono::steady_clock::now();
+        zkevm_basic_evm::execute_transaction();
+        execution_time += std::chrono::steady_clock::now() - start;
+    }
+
+    virtual void execute_opcode() override {
+        executed_opcodes++;
+        zkevm_basic_evm::execute_opcode();
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(basic_evm_throughput, *boost::unit_test::disabled())
+
+static const std::vector<std::string> basic_evm_throughput_traces = {
+    "minimal_math.json", "mem.json", "keccak.json", "exp.json", "modular.json",
+    "call_counter.json", "delegatecall.json", "staticcall.json", "try_catch.json",
+    "precompiles.json", "transient_storage.json", "indexed_log.json"
+};
+
+BOOST_DATA_TEST_CASE(debugtt_traces, boost::unit_test::data::make(basic_evm_throughput_traces)) {
+    constexpr std::size_t repetitions = 10;
+    std::size_t executed_opcodes = 0;
+    std::chrono::nanoseconds execution_time{0};
+    for (std::size_t i = 0; i < repetitions; i++) {
+        debugtt_block_loader loader(sample);
+        basic_evm_throughput_counter evm((abstract_block_loader *)(&loader));
+        evm.execute_blocks();
+        BOOST_CHECK(evm.get_execution_status());
+        executed_opcodes += evm.executed_opcodes;
+        execution_time += evm.execution_time;
+    }
+    double seconds = std::chrono::duration<double>(execution_time).count();
+    BOOST_TEST_MESSAGE(sample << ": " << executed_opcodes << " opcodes in " << seconds
+                              << " s, " << executed_opcodes / seconds << " opcodes/s");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
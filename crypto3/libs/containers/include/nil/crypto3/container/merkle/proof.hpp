@@ -29,8 +29,10 @@
 #define CRYPTO3_MERKLE_PROOF_HPP
 
 #include <algorithm>
-#include <vector>
+#include <optional>
 #include <stack>
+#include <unordered_map>
+#include <vector>
 
 #include <boost/variant.hpp>
 
@@ -95,6 +97,23 @@ namespace nil {
                     typedef std::array<path_element_type, Arity - 1> layer_type;
                     typedef std::vector<layer_type> path_type;
 
+                    // Nodes of one tree authenticated by the proofs validated so far, level 0 holds the leaves.
+                    // Validation against it stops at the first node which is already known, so proofs for
+                    // several leaves of the same tree do not hash their common upper nodes again.
+                    class validated_nodes_type {
+                    public:
+                        void clear() {
+                            _root.reset();
+                            _levels.clear();
+                        }
+
+                    private:
+                        std::optional<value_type> _root;
+                        std::vector<std::unordered_map<std::size_t, value_type>> _levels;
+
+                        friend class merkle_proof_impl;
+                    };
+
                     merkle_proof_impl() : _li(0), _root(value_type()) {};
 
                     merkle_proof_impl(std::size_t li, value_type root, path_type path) : _li(li), _root(root),
@@ -129,21 +148,65 @@ namespace nil {
 
                     template<typename Hashable, typename HashType = typename NodeType::hash_type>
                     bool validate(const Hashable &a) const {
-                        using hash_type = typename NodeType::hash_type;
                         value_type d = crypto3::hash<hash_type>(a);
                         for (auto &it : _path) {
-                            accumulator_set<hash_type> acc;
-                            size_t i = 0;
-                            for (; (i < arity - 1) && i == it[i]._position; ++i) {
-                                crypto3::hash<hash_type>(it[i]._hash, acc);
+                            d = hash_layer(it, d);
+                        }
+                        return (d == _root);
+                    }
+
+                    // Same as validate(a), but the nodes already in validated_nodes are trusted, and the nodes of
+                    // this path together with their siblings are added to it on success.
+                    // validated_nodes must be used with the proofs of one tree only, otherwise it is ignored.
+                    template<typename Hashable>
+                    bool validate(const Hashable &a, validated_nodes_type &validated_nodes) const {
+                        if (!validated_nodes._root) {
+                            validated_nodes._root = _root;
+                            validated_nodes._levels.resize(_path.size());
+                        }
+                        if (*validated_nodes._root != _root || validated_nodes._levels.size() != _path.size()) {
+                            return validate(a);
+                        }
+
+                        // the index of the node on each level is given by the positions of the path elements
+                        std::vector<std::size_t> positions(_path.size());
+                        std::vector<std::size_t> indices(_path.size() + 1, 0);
+                        for (std::size_t level = 0; level < _path.size(); ++level) {
+                            positions[level] = node_position(_path[level]);
+                        }
+                        for (std::size_t level = _path.size(); level-- > 0;) {
+                            indices[level] = indices[level + 1] * arity + positions[level];
+                        }
+
+                        std::vector<value_type> hashes;
+                        hashes.reserve(_path.size());
+                        value_type d = crypto3::hash<hash_type>(a);
+                        for (std::size_t level = 0;; ++level) {
+                            if (level == _path.size()) {
+                                if (d != _root) {
+                                    return false;
+                                }
+                                break;
                             }
-                            crypto3::hash<hash_type>(d, acc);
-                            for (; i < arity - 1; ++i) {
-                                crypto3::hash<hash_type>(it[i]._hash, acc);
+                            auto known = validated_nodes._levels[level].find(indices[level]);
+                            if (known != validated_nodes._levels[level].end()) {
+                                if (known->second != d) {
+                                    return false;
+                                }
+                                break;
                             }
-                            d = accumulators::extract::hash<hash_type>(acc);
+                            hashes.push_back(d);
+                            d = hash_layer(_path[level], d);
                         }
-                        return (d == _root);
+
+                        for (std::size_t level = 0; level < hashes.size(); ++level) {
+                            auto &nodes = validated_nodes._levels[level];
+                            nodes.emplace(indices[level], hashes[level]);
+                            for (const auto &element : _path[level]) {
+                                nodes.emplace(indices[level] - positions[level] + element._position, element._hash);
+                            }
+                        }
+                        return true;
                     }
 
                     static std::vector<merkle_proof_impl>
@@ -278,6 +341,27 @@ namespace nil {
                     }
 
                 private:
+                    // position of the node itself among its siblings
+                    static std::size_t node_position(const layer_type &layer) {
+                        std::size_t i = 0;
+                        for (; (i < arity - 1) && i == layer[i]._position; ++i) {
+                        }
+                        return i;
+                    }
+
+                    static value_type hash_layer(const layer_type &layer, const value_type &d) {
+                        accumulator_set<hash_type> acc;
+                        std::size_t i = 0;
+                        for (; (i < arity - 1) && i == layer[i]._position; ++i) {
+                            crypto3::hash<hash_type>(layer[i]._hash, acc);
+                        }
+                        crypto3::hash<hash_type>(d, acc);
+                        for (; i < arity - 1; ++i) {
+                            crypto3::hash<hash_type>(layer[i]._hash, acc);
+                        }
+                        return accumulators::extract::hash<hash_type>(acc);
+                    }
+
                     std::size_t _li;
                     value_type _root;
                     path_type _path;
@@ -27,8 +27,14 @@
 #ifndef CRYPTO3_MERKLE_TREE_HPP
 #define CRYPTO3_MERKLE_TREE_HPP
 
-#include <vector>
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <vector>
 
 #include <nil/crypto3/algebra/curves/pallas.hpp>
 
@@ -37,6 +43,9 @@
 
 #include <nil/crypto3/hash/type_traits.hpp>
 #include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/multi_lane_hash.hpp>
+#include <nil/crypto3/hash/detail/poseidon/poseidon_permutation.hpp>
+#include <nil/crypto3/hash/detail/poseidon2/poseidon2_sponge.hpp>
 #include <nil/crypto3/container/merkle/node.hpp>
 
 #include <nil/actor/core/thread_pool.hpp>
@@ -482,35 +491,264 @@ namespace nil {
                     return accumulators::extract::hash<T>(acc);
                 }
 
-                template<typename T, std::size_t Arity, typename LeafIterator>
-                merkle_tree_impl<T, Arity> make_merkle_tree(LeafIterator first, LeafIterator last) {
-                    typedef T node_type;
-                    typedef typename node_type::hash_type hash_type;
-                    typedef typename node_type::value_type value_type;
+                // Leaves which are contiguous byte ranges can be hashed by a multi-lane hash directly.
+                template<typename HashType, typename LeafType>
+                constexpr bool is_multi_lane_leaf() {
+                    if constexpr (hashes::multi_lane_hash<HashType>::enabled &&
+                                  std::ranges::contiguous_range<const LeafType> &&
+                                  std::ranges::sized_range<const LeafType>) {
+                        using element_type = std::ranges::range_value_t<const LeafType>;
+                        return std::is_integral_v<element_type> && sizeof(element_type) == 1;
+                    }
+                    return false;
+                }
+
+                // Interior nodes hash the concatenation of their children, which are contiguous in the tree.
+                template<typename HashType, typename ValueType>
+                constexpr bool is_multi_lane_node() {
+                    if constexpr (hashes::multi_lane_hash<HashType>::enabled) {
+                        return std::is_same_v<ValueType, typename HashType::digest_type> &&
+                               sizeof(ValueType) * 8 == HashType::digest_bits;
+                    }
+                    return false;
+                }
+
+                // A Poseidon node of up to 'rate' children is a single permutation of the state
+                // [0, children..., 0...], so the nodes of a row can be permuted in batches.
+                template<typename HashType, std::size_t Arity, typename ValueType>
+                constexpr bool is_poseidon_node() {
+                    if constexpr (hashes::is_poseidon<HashType>::value) {
+                        return std::is_same_v<ValueType, typename HashType::digest_type> &&
+                               Arity < HashType::policy_type::state_words;
+                    }
+                    return false;
+                }
+
+                // Poseidon2 hashes field elements, the leaves of a row which are contiguous ranges of the
+                // same length are hashed in lanes, and so are the nodes, Arity digests each.
+                template<typename HashType, typename LeafType>
+                constexpr bool is_poseidon2_leaf() {
+                    if constexpr (hashes::is_poseidon2<HashType>::value &&
+                                  std::ranges::contiguous_range<const LeafType> &&
+                                  std::ranges::sized_range<const LeafType>) {
+                        return std::is_same_v<std::ranges::range_value_t<const LeafType>,
+                                              typename HashType::word_type>;
+                    }
+                    return false;
+                }
+
+                template<typename HashType, typename ValueType>
+                constexpr bool is_poseidon2_node() {
+                    if constexpr (hashes::is_poseidon2<HashType>::value) {
+                        return std::is_same_v<ValueType, typename HashType::digest_type>;
+                    }
+                    return false;
+                }
+
+                // The number of leaves worth passing to hash_merkle_leaves at once.
+                template<typename HashType>
+                constexpr std::size_t merkle_leaves_batch_size() {
+                    if constexpr (hashes::is_poseidon2<HashType>::value) {
+                        return HashType::construction::type::permutation_type::batch_lanes;
+                    } else {
+                        return hashes::multi_lane_hash<HashType>::lanes;
+                    }
+                }
+
+                // Hashes 'count' leaves starting from 'leaf' into 'out'.
+                template<typename HashType, typename ValueType, typename LeafIterator>
+                void hash_merkle_leaves(LeafIterator leaf, std::size_t count, ValueType *out) {
                     typedef typename std::iterator_traits<LeafIterator>::value_type leaf_value_type;
 
-                    merkle_tree_impl<T, Arity> ret(std::distance(first, last));
-                    ret.resize(ret.complete_size());
+                    if constexpr (is_multi_lane_leaf<HashType, leaf_value_type>() &&
+                                  is_multi_lane_node<HashType, ValueType>()) {
+                        typedef hashes::multi_lane_hash<HashType> multi_lane_type;
+                        std::array<const std::uint8_t *, multi_lane_type::lanes> messages;
+
+                        std::size_t i = 0;
+                        while (i < count) {
+                            // All lanes take messages of the same length, a group ends at a leaf of another size.
+                            const std::size_t length = std::ranges::size(*leaf);
+                            std::size_t group = 0;
+                            for (; group < multi_lane_type::lanes && i + group < count; ++group, ++leaf) {
+                                if (std::ranges::size(*leaf) != length) {
+                                    break;
+                                }
+                                messages[group] = reinterpret_cast<const std::uint8_t *>(std::ranges::data(*leaf));
+                            }
+                            multi_lane_type::hash(messages.data(), length, group, out + i);
+                            i += group;
+                        }
+                    } else if constexpr (is_poseidon2_leaf<HashType, leaf_value_type>() &&
+                                         is_poseidon2_node<HashType, ValueType>()) {
+                        typedef typename HashType::construction::type sponge_type;
+                        typedef typename HashType::word_type word_type;
+                        constexpr std::size_t lanes = sponge_type::permutation_type::batch_lanes;
+                        std::array<const word_type *, lanes> messages;
+
+                        std::size_t i = 0;
+                        while (i < count) {
+                            const std::size_t length = std::ranges::size(*leaf);
+                            std::size_t group = 0;
+                            for (; group < lanes && i + group < count; ++group, ++leaf) {
+                                if (std::ranges::size(*leaf) != length) {
+                                    break;
+                                }
+                                messages[group] = std::ranges::data(*leaf);
+                            }
+                            sponge_type::hash_batch(messages.data(), length, group, out + i);
+                            i += group;
+                        }
+                    } else {
+                        for (std::size_t i = 0; i < count; ++i, ++leaf) {
+                            out[i] = static_cast<ValueType>(crypto3::hash<HashType>(*leaf));
+                        }
+                    }
+                }
 
-                    nil::crypto3::parallel_transform(first, last, ret.begin(), [](const leaf_value_type& leaf) {
-                        return static_cast<value_type>(crypto3::hash<hash_type>(leaf));
-                    });
+                // Hashes 'count' nodes of a row, node i is the hash of children[i * Arity, (i + 1) * Arity).
+                template<typename HashType, std::size_t Arity, typename ValueType>
+                void hash_merkle_nodes(const ValueType *children, std::size_t count, ValueType *out) {
+                    if constexpr (is_multi_lane_node<HashType, ValueType>()) {
+                        typedef hashes::multi_lane_hash<HashType> multi_lane_type;
+                        std::array<const std::uint8_t *, multi_lane_type::lanes> messages;
+
+                        for (std::size_t i = 0; i < count; i += multi_lane_type::lanes) {
+                            const std::size_t group = std::min(multi_lane_type::lanes, count - i);
+                            for (std::size_t lane = 0; lane < group; ++lane) {
+                                messages[lane] = reinterpret_cast<const std::uint8_t *>(children + (i + lane) * Arity);
+                            }
+                            multi_lane_type::hash(messages.data(), Arity * sizeof(ValueType), group, out + i);
+                        }
+                    } else if constexpr (is_poseidon_node<HashType, Arity, ValueType>()) {
+                        typedef typename HashType::policy_type policy_type;
+                        typedef hashes::detail::poseidon_permutation<policy_type> permutation_type;
+                        constexpr std::size_t batch_size = 4 * permutation_type::batch_lanes;
+                        std::array<typename policy_type::state_type, batch_size> states;
+
+                        for (std::size_t i = 0; i < count; i += batch_size) {
+                            const std::size_t group = std::min(batch_size, count - i);
+                            for (std::size_t j = 0; j < group; ++j) {
+                                states[j].fill(ValueType::zero());
+                                std::copy(children + (i + j) * Arity, children + (i + j + 1) * Arity,
+                                          states[j].begin() + 1);
+                            }
+                            permutation_type::permute_batch(states.data(), group);
+                            for (std::size_t j = 0; j < group; ++j) {
+                                out[i + j] = states[j][policy_type::state_words - 1];
+                            }
+                        }
+                    } else if constexpr (is_poseidon2_node<HashType, ValueType>()) {
+                        typedef typename HashType::construction::type sponge_type;
+                        typedef typename HashType::word_type word_type;
+                        constexpr std::size_t lanes = sponge_type::permutation_type::batch_lanes;
+                        std::array<const word_type *, lanes> messages;
+
+                        for (std::size_t i = 0; i < count; i += lanes) {
+                            const std::size_t group = std::min(lanes, count - i);
+                            for (std::size_t lane = 0; lane < group; ++lane) {
+                                messages[lane] = children[(i + lane) * Arity].data();
+                            }
+                            sponge_type::hash_batch(messages.data(), Arity * sponge_type::digest_words, group, out + i);
+                        }
+                    } else {
+                        for (std::size_t i = 0; i < count; ++i) {
+                            out[i] = generate_hash<HashType>(children + i * Arity, children + (i + 1) * Arity);
+                        }
+                    }
+                }
 
-                    std::size_t row_idx = ret.leaves(), row_size = row_idx / Arity;
-                    typename merkle_tree_impl<T, Arity>::iterator it = ret.begin();
+                // Number of leaves in the subtrees which are built by a single task. The digests of a subtree
+                // fit into the L2 cache, and there are at least as many subtrees as workers.
+                template<std::size_t Arity>
+                inline std::size_t merkle_subtree_leaves(std::size_t leaves, std::size_t value_size) {
+                    constexpr std::size_t subtree_cache_bytes = 1 << 18;
+                    const std::size_t workers = ThreadPool::get_instance(ThreadPool::PoolLevel::HIGH).get_pool_size();
 
-                    std::size_t next_row_start_index = std::distance(first, last);
+                    std::size_t subtree_leaves = 1;
+                    while (subtree_leaves * Arity * workers <= leaves &&
+                           2 * subtree_leaves * Arity * value_size <= subtree_cache_bytes) {
+                        subtree_leaves *= Arity;
+                    }
+                    return subtree_leaves;
+                }
 
-                    for (size_t row_number = 1; row_number < ret.row_count(); ++row_number, row_size /= Arity) {
-                        nil::crypto3::parallel_for(0, row_size, [&ret, it, next_row_start_index](std::size_t index) {
-                            ret[next_row_start_index + index] = generate_hash<hash_type>(
-                                it + index * Arity, it + (index + 1) * Arity);
-                        });
-                        next_row_start_index += row_size;
-                        it += row_size * Arity;
+                // The tree is stored row by row, but built subtree by subtree: each task hashes the leaves of
+                // its subtree and then all the rows of the subtree while they are still in the cache. The rows
+                // above the subtrees are built one by one. Hashes with a multi-lane version compute several
+                // nodes of a row per call.
+                //
+                // The leaves are hashed by leaf_hasher(begin, count, out), which writes the digests of the leaves
+                // [begin, begin + count) to out. It is called concurrently for disjoint ranges.
+                template<typename T, std::size_t Arity, typename LeafHasher>
+                merkle_tree_impl<T, Arity> make_merkle_tree_with_leaf_hasher(std::size_t leaves_number,
+                                                                              LeafHasher leaf_hasher) {
+                    typedef T node_type;
+                    typedef typename node_type::hash_type hash_type;
+                    typedef typename node_type::value_type value_type;
+
+                    merkle_tree_impl<T, Arity> ret(leaves_number);
+                    ret.resize(ret.complete_size());
+                    value_type *hashes = &ret[0];
+
+                    const std::size_t leaves = ret.leaves();
+                    const std::size_t subtree_leaves = merkle_subtree_leaves<Arity>(leaves, sizeof(value_type));
+                    std::size_t subtree_rows = 1;
+                    for (std::size_t nodes = subtree_leaves; nodes > 1; nodes /= Arity) {
+                        ++subtree_rows;
+                    }
+
+                    wait_for_all(parallel_run_in_chunks<void>(
+                        leaves / subtree_leaves,
+                        [&leaf_hasher, hashes, leaves, subtree_leaves, subtree_rows](std::size_t begin,
+                                                                                    std::size_t end) {
+                            for (std::size_t subtree = begin; subtree < end; ++subtree) {
+                                leaf_hasher(subtree * subtree_leaves, subtree_leaves, hashes + subtree * subtree_leaves);
+
+                                std::size_t row_start = 0, row_size = leaves, subtree_nodes = subtree_leaves;
+                                for (std::size_t row_number = 1; row_number < subtree_rows; ++row_number) {
+                                    hash_merkle_nodes<hash_type, Arity>(
+                                        hashes + row_start + subtree * subtree_nodes, subtree_nodes / Arity,
+                                        hashes + row_start + row_size + subtree * subtree_nodes / Arity);
+                                    row_start += row_size;
+                                    row_size /= Arity;
+                                    subtree_nodes /= Arity;
+                                }
+                            }
+                        },
+                        ThreadPool::PoolLevel::HIGH));
+
+                    std::size_t row_start = 0, row_size = leaves;
+                    for (std::size_t row_number = 1; row_number < subtree_rows; ++row_number) {
+                        row_start += row_size;
+                        row_size /= Arity;
+                    }
+                    for (std::size_t row_number = subtree_rows; row_number < ret.row_count(); ++row_number) {
+                        const value_type *children = hashes + row_start;
+                        value_type *row = hashes + row_start + row_size;
+                        wait_for_all(parallel_run_in_chunks<void>(
+                            row_size / Arity,
+                            [children, row](std::size_t begin, std::size_t end) {
+                                hash_merkle_nodes<hash_type, Arity>(children + begin * Arity, end - begin, row + begin);
+                            }));
+                        row_start += row_size;
+                        row_size /= Arity;
                     }
                     return ret;
                 }
+
+                template<typename T, std::size_t Arity, typename LeafIterator>
+                merkle_tree_impl<T, Arity> make_merkle_tree(LeafIterator first, LeafIterator last) {
+                    typedef typename T::hash_type hash_type;
+                    typedef typename T::value_type value_type;
+
+                    return make_merkle_tree_with_leaf_hasher<T, Arity>(
+                        std::distance(first, last), [first](std::size_t begin, std::size_t count, value_type *out) {
+                            auto leaf = first;
+                            std::advance(leaf, begin);
+                            hash_merkle_leaves<hash_type>(leaf, count, out);
+                        });
+                }
             }    // namespace detail
 
             template<typename T, std::size_t Arity>
@@ -526,6 +764,19 @@ namespace nil {
                         Arity>(first, last);
             }
 
+            /*!
+             * @brief Builds a tree without keeping the leaves in memory. leaf_hasher(begin, count, out) computes the
+             * digests of the leaves [begin, begin + count) into out, usually from the leaf data produced on the
+             * fly. It is called concurrently for disjoint ranges.
+             */
+            template<typename T, std::size_t Arity, typename LeafHasher>
+            merkle_tree<T, Arity> make_merkle_tree_with_leaf_hasher(std::size_t leaves_number, LeafHasher leaf_hasher) {
+                return detail::make_merkle_tree_with_leaf_hasher<
+                    typename std::conditional<nil::crypto3::detail::is_hash<T>::value, detail::merkle_tree_node<T>,
+                                              T>::type,
+                    Arity>(leaves_number, std::move(leaf_hasher));
+            }
+
         }    // namespace containers
     }        // namespace crypto3
 }    // namespace nil
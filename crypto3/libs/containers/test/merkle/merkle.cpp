@@ -28,10 +28,15 @@
 
 #include <nil/crypto3/algebra/random_element.hpp>
 #include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/fields/alt_bn128/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/bls12/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/babybear.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks.hpp>
 #include <nil/crypto3/hash/block_to_field_elements_wrapper.hpp>
 #include <nil/crypto3/hash/sha2.hpp>
 #include <nil/crypto3/hash/keccak.hpp>
 #include <nil/crypto3/hash/poseidon.hpp>
+#include <nil/crypto3/hash/poseidon2.hpp>
 
 #include <nil/crypto3/container/merkle/tree.hpp>
 #include <nil/crypto3/container/merkle/proof.hpp>
@@ -253,6 +258,38 @@ void testing_hash_template(std::vector<Element> data, std::string result) {
     BOOST_CHECK(result == std::to_string(tree.root()));
 }
 
+// Builds the tree row by row with one hash call per node, as a reference for make_merkle_tree.
+template<typename Hash, size_t Arity, typename Element>
+std::vector<typename Hash::digest_type> reference_merkle_tree(const std::vector<Element> &data) {
+    std::vector<typename Hash::digest_type> nodes;
+    for (const auto &leaf : data) {
+        nodes.emplace_back(hash<Hash>(leaf));
+    }
+    for (std::size_t row_start = 0, row_size = data.size(); row_size > 1; row_start += row_size, row_size /= Arity) {
+        for (std::size_t i = 0; i < row_size / Arity; ++i) {
+            accumulator_set<Hash> acc;
+            for (std::size_t j = 0; j < Arity; ++j) {
+                hash<Hash>(nodes[row_start + i * Arity + j], acc);
+            }
+            nodes.emplace_back(accumulators::extract::hash<Hash>(acc));
+        }
+    }
+    return nodes;
+}
+
+template<typename Hash, size_t Arity>
+void testing_multi_lane_template(std::size_t leaf_number, std::vector<std::size_t> leaf_sizes) {
+    std::vector<std::vector<std::uint8_t>> data(leaf_number);
+    for (std::size_t i = 0; i < leaf_number; ++i) {
+        data[i].resize(leaf_sizes[i % leaf_sizes.size()]);
+        std::generate(data[i].begin(), data[i].end(), []() { return std::rand() % 256; });
+    }
+    merkle_tree<Hash, Arity> tree = make_merkle_tree<Hash, Arity>(data.begin(), data.end());
+    auto expected = reference_merkle_tree<Hash, Arity>(data);
+    BOOST_CHECK_EQUAL(tree.size(), expected.size());
+    BOOST_CHECK(std::equal(tree.begin(), tree.end(), expected.begin(), expected.end()));
+}
+
 BOOST_AUTO_TEST_SUITE(containers_merkltree_test)
 
 using curve_type = algebra::curves::pallas;
@@ -332,6 +369,37 @@ BOOST_AUTO_TEST_CASE(merkletree_validate_test_5) {
     testing_validate_template_random_data_compressed_proofs<hashes::sha2<256>, 4, std::uint8_t, 1>(leaf_number);
 }
 
+template<typename Hash, size_t Arity, typename ValueType, std::size_t N>
+void testing_validate_template_validated_nodes(std::size_t leaf_number) {
+    using merkle_proof_type = typename containers::merkle_proof<Hash, Arity>;
+    auto data = generate_random_data<ValueType, N>(leaf_number);
+    auto tree = make_merkle_tree<Hash, Arity>(data.begin(), data.end());
+
+    // every leaf twice, the second validation of a leaf stops at the leaf itself
+    typename merkle_proof_type::validated_nodes_type validated_nodes;
+    for (std::size_t round = 0; round < 2; ++round) {
+        for (std::size_t i = 0; i < leaf_number; ++i) {
+            std::size_t leaf = (i * 5 + round) % leaf_number;
+            merkle_proof_type proof(tree, leaf);
+            BOOST_CHECK(proof.validate(data[leaf], validated_nodes));
+            BOOST_CHECK(!proof.validate(data[(leaf + 1) % leaf_number], validated_nodes));
+        }
+    }
+
+    // a proof of another tree is validated without the nodes of the first one
+    auto other_data = generate_random_data<ValueType, N>(leaf_number);
+    auto other_tree = make_merkle_tree<Hash, Arity>(other_data.begin(), other_data.end());
+    merkle_proof_type other_proof(other_tree, 0);
+    BOOST_CHECK(other_proof.validate(other_data[0], validated_nodes));
+    BOOST_CHECK(!other_proof.validate(data[0], validated_nodes));
+}
+
+BOOST_AUTO_TEST_CASE(merkletree_validated_nodes_test) {
+    testing_validate_template_validated_nodes<hashes::sha2<256>, 2, std::uint8_t, 1>(16);
+    testing_validate_template_validated_nodes<hashes::sha2<256>, 3, std::uint8_t, 1>(27);
+    testing_validate_template_validated_nodes<poseidon_type, 2, poseidon_type::word_type, 1>(8);
+}
+
 BOOST_AUTO_TEST_CASE(merkletree_hash_test_1) {
     std::vector<std::array<char, 1>> v = {{'0'}, {'1'}, {'2'}, {'3'}, {'4'}, {'5'}, {'6'}, {'7'}};
     testing_hash_template<hashes::sha2<256>, 2>(v, "3b828c4f4b48c5d4cb5562a474ec9e2fd8d5546fae40e90732ef635892e42720");
@@ -358,6 +426,74 @@ BOOST_AUTO_TEST_CASE(merkletree_hash_test_1) {
     BOOST_CHECK(tree.root() == 0x6E7641F1EAE17C0DA8227840EFEA6E1D17FB5EBA600D9DC34F314D5400E5BF3_big_uint255);
 }
 
+BOOST_AUTO_TEST_CASE(merkletree_multi_lane_test) {
+    // Leaf sizes around the Keccak rates of 136 and 72 bytes, mixed sizes break the multi-lane groups.
+    for (std::size_t leaf_size : {0, 1, 64, 71, 72, 135, 136, 137, 300}) {
+        testing_multi_lane_template<hashes::keccak_1600<256>, 2>(64, {leaf_size});
+        testing_multi_lane_template<hashes::keccak_1600<512>, 2>(16, {leaf_size});
+    }
+    testing_multi_lane_template<hashes::keccak_1600<256>, 2>(1 << 12, {32, 32, 32, 33, 200, 200});
+    testing_multi_lane_template<hashes::keccak_1600<256>, 4>(1 << 10, {24});
+    testing_multi_lane_template<hashes::keccak_1600<256>, 2>(1, {24});
+    testing_multi_lane_template<hashes::sha2<256>, 2>(64, {24});
+}
+
+template<typename Hash, size_t Arity>
+void testing_poseidon_nodes_template(std::size_t leaf_number) {
+    using word_type = typename Hash::word_type;
+    std::vector<std::array<word_type, 1>> data(leaf_number);
+    for (std::size_t i = 0; i < leaf_number; ++i) {
+        data[i][0] = word_type(std::rand());
+    }
+    merkle_tree<Hash, Arity> tree = make_merkle_tree<Hash, Arity>(data.begin(), data.end());
+    auto expected = reference_merkle_tree<Hash, Arity>(data);
+    BOOST_CHECK_EQUAL(tree.size(), expected.size());
+    BOOST_CHECK(std::equal(tree.begin(), tree.end(), expected.begin(), expected.end()));
+}
+
+BOOST_AUTO_TEST_CASE(merkletree_poseidon_batch_test) {
+    using bn_field_type = algebra::fields::alt_bn128_scalar_field<254>;
+    using bls_field_type = algebra::fields::bls12_scalar_field<381>;
+    using bn_poseidon_type = hashes::poseidon<hashes::detail::poseidon_policy<bn_field_type, 128, 2>>;
+    using bls_poseidon_type = hashes::poseidon<hashes::detail::poseidon_policy<bls_field_type, 128, 4>>;
+
+    testing_poseidon_nodes_template<poseidon_type, 2>(64);
+    testing_poseidon_nodes_template<bn_poseidon_type, 2>(1 << 10);
+    testing_poseidon_nodes_template<bn_poseidon_type, 2>(2);
+    testing_poseidon_nodes_template<bls_poseidon_type, 4>(1 << 8);
+    // Fewer children than the rate leave the tail of the state zero.
+    testing_poseidon_nodes_template<bls_poseidon_type, 2>(1 << 6);
+}
+
+template<typename Hash, size_t Arity>
+void testing_poseidon2_template(std::size_t leaf_number, std::vector<std::size_t> leaf_sizes) {
+    using word_type = typename Hash::word_type;
+    std::vector<std::vector<word_type>> data(leaf_number);
+    for (std::size_t i = 0; i < leaf_number; ++i) {
+        data[i].resize(leaf_sizes[i % leaf_sizes.size()]);
+        std::generate(data[i].begin(), data[i].end(), []() { return word_type(std::rand()); });
+    }
+    merkle_tree<Hash, Arity> tree = make_merkle_tree<Hash, Arity>(data.begin(), data.end());
+    auto expected = reference_merkle_tree<Hash, Arity>(data);
+    BOOST_CHECK_EQUAL(tree.size(), expected.size());
+    BOOST_CHECK(std::equal(tree.begin(), tree.end(), expected.begin(), expected.end()));
+
+    std::size_t leaf = std::rand() % leaf_number;
+    merkle_proof<Hash, Arity> proof(tree, leaf);
+    BOOST_CHECK(proof.validate(data[leaf]));
+}
+
+BOOST_AUTO_TEST_CASE(merkletree_poseidon2_test) {
+    using babybear_16_type = hashes::poseidon2<hashes::detail::poseidon2_policy<algebra::fields::babybear, 16>>;
+    using babybear_24_type = hashes::poseidon2<hashes::detail::poseidon2_policy<algebra::fields::babybear, 24>>;
+    using goldilocks_16_type = hashes::poseidon2<hashes::detail::poseidon2_policy<algebra::fields::goldilocks, 16>>;
+
+    testing_poseidon2_template<babybear_16_type, 2>(1 << 8, {12});
+    testing_poseidon2_template<babybear_24_type, 2>(1 << 8, {16});
+    testing_poseidon2_template<babybear_24_type, 4>(1 << 6, {3, 3, 17});
+    testing_poseidon2_template<goldilocks_16_type, 2>(1 << 5, {0, 12, 24});
+}
+
 BOOST_AUTO_TEST_CASE(merkletree_hash_test_2) {
     std::vector<std::array<char, 1>> v = {{'0'}, {'1'}, {'2'}, {'3'}, {'4'}, {'5'}, {'6'}, {'7'}, {'8'}};
     testing_hash_template<hashes::sha2<256>, 3>(v, "6831d4d32538bedaa7a51970ac10474d5884701c840781f0a434e5b6868d4b73");
@@ -0,0 +1,209 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_KECCAK_DISPATCH_HPP
+#define CRYPTO3_KECCAK_DISPATCH_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/assert.hpp>
+#include <boost/predef/architecture.h>
+
+#include <nil/crypto3/hash/detail/keccak/keccak_impl.hpp>
+#include <nil/crypto3/hash/detail/keccak/keccak_multi_lane_impl.hpp>
+
+// The x86-64 backends are compiled for their instruction sets with target attributes, so a binary built for the
+// baseline x86-64 picks the best of them for the CPU it runs on.
+#if BOOST_ARCH_X86_64 && (defined(__GNUC__) || defined(__clang__))
+#define CRYPTO3_KECCAK_1600_DISPATCH
+#include <nil/crypto3/hash/detail/keccak/keccak_x86_64_impl.hpp>
+#include <nil/crypto3/hash/detail/keccak/keccak_avx2_impl.hpp>
+#include <nil/crypto3/hash/detail/keccak/keccak_avx512_impl.hpp>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                enum class keccak_1600_backend {
+                    portable,
+                    x86_64,
+                    avx2,
+                    avx512
+                };
+
+                inline bool keccak_1600_backend_supported(keccak_1600_backend backend) {
+#ifdef CRYPTO3_KECCAK_1600_DISPATCH
+                    __builtin_cpu_init();
+                    switch (backend) {
+                        case keccak_1600_backend::avx512:
+                            return __builtin_cpu_supports("avx512f");
+                        case keccak_1600_backend::avx2:
+                            return __builtin_cpu_supports("avx2");
+                        default:
+                            return true;
+                    }
+#else
+                    return backend == keccak_1600_backend::portable;
+#endif
+                }
+
+                inline keccak_1600_backend keccak_1600_best_backend() {
+                    for (auto backend : {keccak_1600_backend::avx512, keccak_1600_backend::avx2,
+                                         keccak_1600_backend::x86_64}) {
+                        if (keccak_1600_backend_supported(backend)) {
+                            return backend;
+                        }
+                    }
+                    return keccak_1600_backend::portable;
+                }
+
+                // The backend used by all the Keccak-f[1600] permutations of the process, the best one the CPU
+                // supports unless switched, e.g. by the tests and the benchmarks.
+                inline std::atomic<keccak_1600_backend> &keccak_1600_selected_backend() {
+                    static std::atomic<keccak_1600_backend> backend(keccak_1600_best_backend());
+                    return backend;
+                }
+
+                inline bool set_keccak_1600_backend(keccak_1600_backend backend) {
+                    if (!keccak_1600_backend_supported(backend)) {
+                        return false;
+                    }
+                    keccak_1600_selected_backend().store(backend, std::memory_order_relaxed);
+                    return true;
+                }
+
+                /*!
+                 * @brief Keccak-f[1600] permutation of the selected backend. The permutation takes hundreds of
+                 * cycles, the backend is looked up on every call.
+                 */
+                template<typename PolicyType>
+                struct keccak_1600_dispatched_impl {
+                    typedef PolicyType policy_type;
+
+                    constexpr static const std::size_t word_bits = policy_type::word_bits;
+                    typedef typename policy_type::word_type word_type;
+
+                    typedef typename policy_type::state_type state_type;
+
+                    typedef typename keccak_1600_impl<policy_type>::round_constants_type round_constants_type;
+                    constexpr static const round_constants_type round_constants =
+                        keccak_1600_impl<policy_type>::round_constants;
+
+                    static inline void permute(state_type &A) {
+#ifdef CRYPTO3_KECCAK_1600_DISPATCH
+                        switch (keccak_1600_selected_backend().load(std::memory_order_relaxed)) {
+                            case keccak_1600_backend::avx512:
+                                return keccak_1600_avx512_impl<policy_type>::permute(A);
+                            case keccak_1600_backend::avx2:
+                                return keccak_1600_avx2_impl<policy_type>::permute(A);
+                            case keccak_1600_backend::x86_64:
+                                return keccak_1600_x86_64_impl<policy_type>::permute(A);
+                            default:
+                                break;
+                        }
+#endif
+                        keccak_1600_impl<policy_type>::permute(A);
+                    }
+                };
+
+                template<typename PolicyType>
+                constexpr typename keccak_1600_dispatched_impl<PolicyType>::round_constants_type const
+                    keccak_1600_dispatched_impl<PolicyType>::round_constants;
+
+                /*!
+                 * @brief Multi-lane Keccak hashing with the vector width of the selected backend: 8 lanes of
+                 * AVX-512, 4 lanes of AVX2, or 2 lanes of SSE2 otherwise. Takes up to `lanes` messages per call
+                 * and splits them into the groups the backend hashes at once.
+                 */
+                template<typename PolicyType>
+                struct keccak_1600_multi_lane_dispatch {
+                    typedef PolicyType policy_type;
+                    typedef typename policy_type::digest_type digest_type;
+
+#ifdef CRYPTO3_KECCAK_1600_DISPATCH
+                    constexpr static const std::size_t lanes = 8;
+#else
+                    constexpr static const std::size_t lanes = keccak_1600_default_lanes;
+#endif
+
+                    static void hash(const std::uint8_t *const *messages, std::size_t length, std::size_t count,
+                                     digest_type *digests) {
+                        BOOST_ASSERT(count <= lanes);
+#ifdef CRYPTO3_KECCAK_1600_DISPATCH
+                        switch (keccak_1600_selected_backend().load(std::memory_order_relaxed)) {
+                            case keccak_1600_backend::avx512:
+                                return hash_avx512(messages, length, count, digests);
+                            case keccak_1600_backend::avx2:
+                                return hash_groups<4>(&hash_avx2, messages, length, count, digests);
+                            default:
+                                return hash_groups<2>(&hash_sse2, messages, length, count, digests);
+                        }
+#else
+                        keccak_1600_multi_lane_impl<policy_type, lanes>::hash(messages, length, count, digests);
+#endif
+                    }
+
+#ifdef CRYPTO3_KECCAK_1600_DISPATCH
+                private:
+                    typedef void (*hash_function_type)(const std::uint8_t *const *, std::size_t, std::size_t,
+                                                       digest_type *);
+
+                    template<std::size_t GroupLanes>
+                    static void hash_groups(hash_function_type hash_group, const std::uint8_t *const *messages,
+                                            std::size_t length, std::size_t count, digest_type *digests) {
+                        for (std::size_t i = 0; i < count; i += GroupLanes) {
+                            hash_group(messages + i, length, std::min(GroupLanes, count - i), digests + i);
+                        }
+                    }
+
+                    // flatten inlines the whole multi-lane hash, so that it is compiled for the target
+                    __attribute__((target("avx512f"), flatten)) static void hash_avx512(
+                        const std::uint8_t *const *messages, std::size_t length, std::size_t count,
+                        digest_type *digests) {
+                        keccak_1600_multi_lane_impl<policy_type, 8>::hash(messages, length, count, digests);
+                    }
+
+                    __attribute__((target("avx2"), flatten)) static void hash_avx2(
+                        const std::uint8_t *const *messages, std::size_t length, std::size_t count,
+                        digest_type *digests) {
+                        keccak_1600_multi_lane_impl<policy_type, 4>::hash(messages, length, count, digests);
+                    }
+
+                    __attribute__((flatten)) static void hash_sse2(
+                        const std::uint8_t *const *messages, std::size_t length, std::size_t count,
+                        digest_type *digests) {
+                        keccak_1600_multi_lane_impl<policy_type, 2>::hash(messages, length, count, digests);
+                    }
+#endif
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_KECCAK_DISPATCH_HPP
@@ -0,0 +1,245 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_KECCAK_MULTI_LANE_IMPL_HPP
+#define CRYPTO3_KECCAK_MULTI_LANE_IMPL_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <boost/endian/conversion.hpp>
+
+#include <nil/crypto3/hash/detail/keccak/keccak_impl.hpp>
+#include <nil/crypto3/hash/detail/keccak/keccak_policy.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                // As many states as 64-bit words in the widest vector register available.
+#if defined(__AVX512F__)
+                constexpr static const std::size_t keccak_1600_default_lanes = 8;
+#elif defined(__AVX2__)
+                constexpr static const std::size_t keccak_1600_default_lanes = 4;
+#else
+                constexpr static const std::size_t keccak_1600_default_lanes = 2;
+#endif
+
+                /*!
+                 * @brief Keccak-f[1600] over Lanes independent states at once. Word i of every state is kept in
+                 * one vector, so each step of the permutation is a single vector instruction for all the states.
+                 * Used for hashing many messages of the same length, e.g. the nodes of a Merkle tree.
+                 */
+                template<typename PolicyType, std::size_t Lanes = keccak_1600_default_lanes>
+                struct keccak_1600_multi_lane_impl {
+                    typedef PolicyType policy_type;
+
+                    constexpr static const std::size_t lanes = Lanes;
+
+                    constexpr static const std::size_t word_bits = policy_type::word_bits;
+                    typedef typename policy_type::word_type word_type;
+
+                    constexpr static const std::size_t state_words = policy_type::state_words;
+                    constexpr static const std::size_t block_words = policy_type::block_words;
+                    constexpr static const std::size_t block_bytes = policy_type::block_bits / 8;
+                    constexpr static const std::size_t digest_bytes = policy_type::digest_bits / 8;
+                    typedef typename policy_type::digest_type digest_type;
+
+                    // A vector type can't be an argument of std::array, its attributes would be dropped.
+                    typedef word_type lane_word_type __attribute__((vector_size(Lanes * sizeof(word_type))));
+                    typedef lane_word_type state_type[state_words];
+
+                    // Rotates in place, a function returning a vector by value would change its ABI with the
+                    // instruction set the caller is compiled for.
+                    template<int Shift>
+                    static inline void rotl(lane_word_type &x) {
+                        x = (x << Shift) | (x >> (word_bits - Shift));
+                    }
+
+                    static inline void permute(state_type &A) {
+                        for (word_type c : keccak_1600_impl<policy_type>::round_constants) {
+                            const lane_word_type C0 = A[0] ^ A[5] ^ A[10] ^ A[15] ^ A[20];
+                            const lane_word_type C1 = A[1] ^ A[6] ^ A[11] ^ A[16] ^ A[21];
+                            const lane_word_type C2 = A[2] ^ A[7] ^ A[12] ^ A[17] ^ A[22];
+                            const lane_word_type C3 = A[3] ^ A[8] ^ A[13] ^ A[18] ^ A[23];
+                            const lane_word_type C4 = A[4] ^ A[9] ^ A[14] ^ A[19] ^ A[24];
+
+                            lane_word_type D0 = C0;
+                            rotl<1>(D0);
+                            D0 ^= C3;
+                            lane_word_type D1 = C1;
+                            rotl<1>(D1);
+                            D1 ^= C4;
+                            lane_word_type D2 = C2;
+                            rotl<1>(D2);
+                            D2 ^= C0;
+                            lane_word_type D3 = C3;
+                            rotl<1>(D3);
+                            D3 ^= C1;
+                            lane_word_type D4 = C4;
+                            rotl<1>(D4);
+                            D4 ^= C2;
+
+                            lane_word_type B00 = A[0] ^ D1;
+                            lane_word_type B10 = A[1] ^ D2;
+                            rotl<1>(B10);
+                            lane_word_type B20 = A[2] ^ D3;
+                            rotl<62>(B20);
+                            lane_word_type B05 = A[3] ^ D4;
+                            rotl<28>(B05);
+                            lane_word_type B15 = A[4] ^ D0;
+                            rotl<27>(B15);
+                            lane_word_type B16 = A[5] ^ D1;
+                            rotl<36>(B16);
+                            lane_word_type B01 = A[6] ^ D2;
+                            rotl<44>(B01);
+                            lane_word_type B11 = A[7] ^ D3;
+                            rotl<6>(B11);
+                            lane_word_type B21 = A[8] ^ D4;
+                            rotl<55>(B21);
+                            lane_word_type B06 = A[9] ^ D0;
+                            rotl<20>(B06);
+                            lane_word_type B07 = A[10] ^ D1;
+                            rotl<3>(B07);
+                            lane_word_type B17 = A[11] ^ D2;
+                            rotl<10>(B17);
+                            lane_word_type B02 = A[12] ^ D3;
+                            rotl<43>(B02);
+                            lane_word_type B12 = A[13] ^ D4;
+                            rotl<25>(B12);
+                            lane_word_type B22 = A[14] ^ D0;
+                            rotl<39>(B22);
+                            lane_word_type B23 = A[15] ^ D1;
+                            rotl<41>(B23);
+                            lane_word_type B08 = A[16] ^ D2;
+                            rotl<45>(B08);
+                            lane_word_type B18 = A[17] ^ D3;
+                            rotl<15>(B18);
+                            lane_word_type B03 = A[18] ^ D4;
+                            rotl<21>(B03);
+                            lane_word_type B13 = A[19] ^ D0;
+                            rotl<8>(B13);
+                            lane_word_type B14 = A[20] ^ D1;
+                            rotl<18>(B14);
+                            lane_word_type B24 = A[21] ^ D2;
+                            rotl<2>(B24);
+                            lane_word_type B09 = A[22] ^ D3;
+                            rotl<61>(B09);
+                            lane_word_type B19 = A[23] ^ D4;
+                            rotl<56>(B19);
+                            lane_word_type B04 = A[24] ^ D0;
+                            rotl<14>(B04);
+
+                            A[0] = B00 ^ (~B01 & B02);
+                            A[1] = B01 ^ (~B02 & B03);
+                            A[2] = B02 ^ (~B03 & B04);
+                            A[3] = B03 ^ (~B04 & B00);
+                            A[4] = B04 ^ (~B00 & B01);
+                            A[5] = B05 ^ (~B06 & B07);
+                            A[6] = B06 ^ (~B07 & B08);
+                            A[7] = B07 ^ (~B08 & B09);
+                            A[8] = B08 ^ (~B09 & B05);
+                            A[9] = B09 ^ (~B05 & B06);
+                            A[10] = B10 ^ (~B11 & B12);
+                            A[11] = B11 ^ (~B12 & B13);
+                            A[12] = B12 ^ (~B13 & B14);
+                            A[13] = B13 ^ (~B14 & B10);
+                            A[14] = B14 ^ (~B10 & B11);
+                            A[15] = B15 ^ (~B16 & B17);
+                            A[16] = B16 ^ (~B17 & B18);
+                            A[17] = B17 ^ (~B18 & B19);
+                            A[18] = B18 ^ (~B19 & B15);
+                            A[19] = B19 ^ (~B15 & B16);
+                            A[20] = B20 ^ (~B21 & B22);
+                            A[21] = B21 ^ (~B22 & B23);
+                            A[22] = B22 ^ (~B23 & B24);
+                            A[23] = B23 ^ (~B24 & B20);
+                            A[24] = B24 ^ (~B20 & B21);
+
+                            A[0] ^= c;
+                        }
+                    }
+
+                    // XORs a rate-sized block of every message into its state, the words are little-endian.
+                    static inline void absorb(state_type &A, const std::uint8_t *const *blocks, std::size_t count) {
+                        for (std::size_t lane = 0; lane < count; ++lane) {
+                            for (std::size_t i = 0; i < block_words; ++i) {
+                                word_type word;
+                                std::memcpy(&word, blocks[lane] + i * sizeof(word_type), sizeof(word_type));
+                                A[i][lane] ^= boost::endian::little_to_native(word);
+                            }
+                        }
+                    }
+
+                    /*!
+                     * @brief Computes the Keccak digests of count <= Lanes messages, all of them `length` bytes
+                     * long. The digest of messages[i] is written to digests[i]. Produces the same digests as
+                     * keccak_1600 with the pad10*1 padding.
+                     */
+                    static void hash(const std::uint8_t *const *messages, std::size_t length, std::size_t count,
+                                     digest_type *digests) {
+                        BOOST_ASSERT(count <= Lanes);
+                        state_type A = {};
+
+                        std::array<const std::uint8_t *, Lanes> blocks;
+                        std::size_t offset = 0;
+                        for (; offset + block_bytes <= length; offset += block_bytes) {
+                            for (std::size_t lane = 0; lane < count; ++lane) {
+                                blocks[lane] = messages[lane] + offset;
+                            }
+                            absorb(A, blocks.data(), count);
+                            permute(A);
+                        }
+
+                        // The last block holds the rest of the message and the padding.
+                        std::array<std::array<std::uint8_t, block_bytes>, Lanes> last_blocks;
+                        const std::size_t rest = length - offset;
+                        for (std::size_t lane = 0; lane < count; ++lane) {
+                            auto &block = last_blocks[lane];
+                            std::copy(messages[lane] + offset, messages[lane] + length, block.begin());
+                            std::fill(block.begin() + rest, block.end(), 0);
+                            block[rest] ^= 0x01;
+                            block[block_bytes - 1] ^= 0x80;
+                            blocks[lane] = block.data();
+                        }
+                        absorb(A, blocks.data(), count);
+                        permute(A);
+
+                        for (std::size_t lane = 0; lane < count; ++lane) {
+                            for (std::size_t i = 0; i < digest_bytes; ++i) {
+                                digests[lane][i] =
+                                    static_cast<std::uint8_t>(A[i / sizeof(word_type)][lane] >> (8 * (i % sizeof(word_type))));
+                            }
+                        }
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_KECCAK_MULTI_LANE_IMPL_HPP
@@ -0,0 +1,174 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_POSEIDON_OPTIMIZED_CONSTANTS_HPP
+#define CRYPTO3_HASH_POSEIDON_OPTIMIZED_CONSTANTS_HPP
+
+#include <array>
+
+#include <nil/crypto3/algebra/matrix/matrix.hpp>
+#include <nil/crypto3/algebra/matrix/math.hpp>
+
+#include <nil/crypto3/hash/detail/poseidon/poseidon_policy.hpp>
+#include <nil/crypto3/hash/detail/poseidon/poseidon_constants.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+
+                /*!
+                 * @brief Constants of the original (ARC-SBOX-MDS) Poseidon, rewritten for the optimized schedule
+                 * from the appendix of the Poseidon paper:
+                 *  - round constants of the partial rounds are moved forward through the linear layer,
+                 *    so that a partial round adds a single constant to the first word, the remainder is
+                 *    added to the constants of the first full round of the second half;
+                 *  - the MDS matrix of every partial round is factored as A * B, where A is sparse
+                 *    (first row, first column and the identity) and B only mixes the words 1..t-1,
+                 *    B commutes with the partial S-box and is moved into the previous round, up to the
+                 *    last full round of the first half, which gets a dense matrix of its own.
+                 * Matrices are stored in the column form, y[j] = sum_i M[j][i] * x[i].
+                 */
+                template<typename PolicyType>
+                class poseidon_optimized_constants {
+                public:
+                    typedef PolicyType policy_type;
+                    typedef typename policy_type::word_type element_type;
+
+                    constexpr static const std::size_t state_words = policy_type::state_words;
+                    constexpr static const std::size_t full_rounds = policy_type::full_rounds;
+                    constexpr static const std::size_t half_full_rounds = policy_type::half_full_rounds;
+                    constexpr static const std::size_t part_rounds = policy_type::part_rounds;
+
+                    typedef std::array<element_type, state_words> state_type;
+                    typedef std::array<state_type, state_words> dense_matrix_type;
+
+                    /// A = [[m00, row], [column, I]].
+                    struct sparse_matrix_type {
+                        element_type m00;
+                        std::array<element_type, state_words - 1> row;
+                        std::array<element_type, state_words - 1> column;
+                    };
+
+                    BOOST_STATIC_ASSERT_MSG(!policy_type::pasta_version,
+                                            "The optimized schedule is defined for the ARC-SBOX-MDS order only.");
+                    BOOST_STATIC_ASSERT_MSG(half_full_rounds > 0 && state_words > 1,
+                                            "The optimized schedule needs full rounds before the partial ones.");
+
+                    poseidon_optimized_constants() {
+                        using data_type = typename poseidon_constants<policy_type>::constants_data_type;
+                        using block_matrix_type = algebra::matrix<element_type, state_words - 1, state_words - 1>;
+
+                        for (std::size_t j = 0; j < state_words; j++) {
+                            for (std::size_t i = 0; i < state_words; i++) {
+                                mds[j][i] = data_type::mds_matrix[j][i];
+                            }
+                        }
+
+                        for (std::size_t r = 0; r < half_full_rounds; r++) {
+                            full_round_constants[r] = to_state(data_type::round_constants[r]);
+                        }
+                        for (std::size_t r = half_full_rounds; r < full_rounds; r++) {
+                            full_round_constants[r] = to_state(data_type::round_constants[r + part_rounds]);
+                        }
+
+                        // Move the constants of words 1..t-1 of every partial round through its MDS.
+                        state_type carry;
+                        carry.fill(element_type::zero());
+                        for (std::size_t q = 0; q < part_rounds; q++) {
+                            state_type t = to_state(data_type::round_constants[half_full_rounds + q]);
+                            for (std::size_t i = 0; i < state_words; i++) {
+                                t[i] += carry[i];
+                            }
+                            part_round_constants[q] = t[0];
+                            t[0] = element_type::zero();
+                            carry = apply(mds, t);
+                        }
+                        for (std::size_t i = 0; i < state_words; i++) {
+                            full_round_constants[half_full_rounds][i] += carry[i];
+                        }
+
+                        // Factor the partial round matrices from the last one backwards, X = A * B.
+                        dense_matrix_type x = mds;
+                        for (std::size_t q = part_rounds; q-- > 0;) {
+                            block_matrix_type b;
+                            for (std::size_t j = 1; j < state_words; j++) {
+                                for (std::size_t i = 1; i < state_words; i++) {
+                                    b[j - 1][i - 1] = x[j][i];
+                                }
+                            }
+                            const block_matrix_type b_inverse = algebra::inverse(b);
+
+                            sparse_matrix_type &a = sparse_mds[q];
+                            a.m00 = x[0][0];
+                            for (std::size_t j = 1; j < state_words; j++) {
+                                a.column[j - 1] = x[j][0];
+                                a.row[j - 1] = element_type::zero();
+                                for (std::size_t i = 1; i < state_words; i++) {
+                                    a.row[j - 1] += x[0][i] * b_inverse[i - 1][j - 1];
+                                }
+                            }
+
+                            // The previous round outputs B * MDS * x.
+                            x[0] = mds[0];
+                            for (std::size_t j = 1; j < state_words; j++) {
+                                for (std::size_t i = 0; i < state_words; i++) {
+                                    x[j][i] = element_type::zero();
+                                    for (std::size_t k = 1; k < state_words; k++) {
+                                        x[j][i] += b[j - 1][k - 1] * mds[k][i];
+                                    }
+                                }
+                            }
+                        }
+                        pre_sparse_mds = x;
+                    }
+
+                    static state_type apply(const dense_matrix_type &m, const state_type &x) {
+                        state_type y;
+                        for (std::size_t j = 0; j < state_words; j++) {
+                            y[j] = m[j][0] * x[0];
+                            for (std::size_t i = 1; i < state_words; i++) {
+                                y[j] += m[j][i] * x[i];
+                            }
+                        }
+                        return y;
+                    }
+
+                    static void apply(const sparse_matrix_type &a, state_type &x) {
+                        const element_type x0 = x[0];
+                        x[0] *= a.m00;
+                        for (std::size_t i = 1; i < state_words; i++) {
+                            x[0] += a.row[i - 1] * x[i];
+                            x[i] += a.column[i - 1] * x0;
+                        }
+                    }
+
+                    dense_matrix_type mds;
+                    /// MDS of the last full round of the first half, with the dense factors of all the
+                    /// partial rounds folded in.
+                    dense_matrix_type pre_sparse_mds;
+                    std::array<sparse_matrix_type, part_rounds> sparse_mds;
+                    std::array<state_type, full_rounds> full_round_constants;
+                    std::array<element_type, part_rounds> part_round_constants;
+
+                private:
+                    template<typename Row>
+                    static state_type to_state(const Row &row) {
+                        state_type result;
+                        for (std::size_t i = 0; i < state_words; i++) {
+                            result[i] = row[i];
+                        }
+                        return result;
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_POSEIDON_OPTIMIZED_CONSTANTS_HPP
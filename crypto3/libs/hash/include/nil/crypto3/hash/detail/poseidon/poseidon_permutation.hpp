@@ -10,8 +10,12 @@
 #ifndef CRYPTO3_HASH_POSEIDON_FUNCTIONS_HPP
 #define CRYPTO3_HASH_POSEIDON_FUNCTIONS_HPP
 
+#include <algorithm>
+#include <array>
+
 #include <nil/crypto3/hash/detail/poseidon/poseidon_policy.hpp>
 #include <nil/crypto3/hash/detail/poseidon/poseidon_round_operator.hpp>
+#include <nil/crypto3/hash/detail/poseidon/poseidon_optimized_constants.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -39,7 +43,29 @@ namespace nil {
                     constexpr static const std::size_t word_bits = policy_type::word_bits;
                     typedef typename policy_type::word_type word_type;
 
+                    /// Number of states interleaved by permute_batch.
+                    constexpr static const std::size_t batch_lanes = 4;
+
                     static inline void permute(state_type &A) {
+                        permute_lanes<1>(&A);
+                    }
+
+                    /*!
+                     * @brief Permutes 'count' independent states. batch_lanes states are processed at once,
+                     * round by round, so that the arithmetic of different states interleaves.
+                     */
+                    static inline void permute_batch(state_type *states, std::size_t count) {
+                        std::size_t i = 0;
+                        for (; i + batch_lanes <= count; i += batch_lanes) {
+                            permute_lanes<batch_lanes>(states + i);
+                        }
+                        for (; i < count; i++) {
+                            permute_lanes<1>(states + i);
+                        }
+                    }
+
+                    /// Straightforward round by round permutation, as in the specification.
+                    static inline void permute_by_rounds(state_type &A) {
                         std::size_t round_number = 0;
 
                         // Converting from std::array to algebra::vector here.
@@ -67,6 +93,97 @@ namespace nil {
                             A[i] = A_vector[i];
                         }
                     }
+
+                private:
+                    typedef poseidon_optimized_constants<policy_type> optimized_constants_type;
+
+                    static const optimized_constants_type &get_optimized_constants() {
+                        static const optimized_constants_type constants;
+                        return constants;
+                    }
+
+                    static inline element_type sbox(const element_type &x) {
+                        if constexpr (policy_type::sbox_power == 5) {
+                            element_type x2 = x.squared();
+                            return x2.squared() * x;
+                        } else if constexpr (policy_type::sbox_power == 7) {
+                            element_type x2 = x.squared();
+                            return x2.squared() * x2 * x;
+                        } else {
+                            return x.pow(policy_type::sbox_power);
+                        }
+                    }
+
+                    template<std::size_t Lanes, typename DenseMatrixType>
+                    static inline void full_round(state_type *states, const state_type &constants,
+                                                  const DenseMatrixType &mds) {
+                        for (std::size_t lane = 0; lane < Lanes; lane++) {
+                            for (std::size_t i = 0; i < state_words; i++) {
+                                states[lane][i] = sbox(states[lane][i] + constants[i]);
+                            }
+                        }
+                        for (std::size_t lane = 0; lane < Lanes; lane++) {
+                            states[lane] = optimized_constants_type::apply(mds, states[lane]);
+                        }
+                    }
+
+                    template<std::size_t Lanes>
+                    static inline void permute_lanes(state_type *states) {
+                        if constexpr (policy_type::pasta_version) {
+                            permute_pasta<Lanes>(states);
+                        } else {
+                            permute_optimized<Lanes>(states);
+                        }
+                    }
+
+                    // Pasta version has full rounds only, in SBOX-MDS-ARC order.
+                    template<std::size_t Lanes>
+                    static inline void permute_pasta(state_type *states) {
+                        using data_type = typename poseidon_constants<policy_type>::constants_data_type;
+
+                        for (std::size_t r = 0; r < full_rounds; r++) {
+                            for (std::size_t lane = 0; lane < Lanes; lane++) {
+                                for (std::size_t i = 0; i < state_words; i++) {
+                                    states[lane][i] = sbox(states[lane][i]);
+                                }
+                            }
+                            for (std::size_t lane = 0; lane < Lanes; lane++) {
+                                const state_type x = states[lane];
+                                for (std::size_t j = 0; j < state_words; j++) {
+                                    element_type y = data_type::round_constants[r][j];
+                                    for (std::size_t i = 0; i < state_words; i++) {
+                                        y += data_type::mds_matrix[j][i] * x[i];
+                                    }
+                                    states[lane][j] = y;
+                                }
+                            }
+                        }
+                    }
+
+                    // Optimized schedule, see poseidon_optimized_constants.
+                    template<std::size_t Lanes>
+                    static inline void permute_optimized(state_type *states) {
+                        const optimized_constants_type &constants = get_optimized_constants();
+
+                        for (std::size_t r = 0; r + 1 < half_full_rounds; r++) {
+                            full_round<Lanes>(states, constants.full_round_constants[r], constants.mds);
+                        }
+                        full_round<Lanes>(states, constants.full_round_constants[half_full_rounds - 1],
+                                          constants.pre_sparse_mds);
+
+                        for (std::size_t q = 0; q < part_rounds; q++) {
+                            for (std::size_t lane = 0; lane < Lanes; lane++) {
+                                states[lane][0] = sbox(states[lane][0] + constants.part_round_constants[q]);
+                            }
+                            for (std::size_t lane = 0; lane < Lanes; lane++) {
+                                optimized_constants_type::apply(constants.sparse_mds[q], states[lane]);
+                            }
+                        }
+
+                        for (std::size_t r = half_full_rounds; r < full_rounds; r++) {
+                            full_round<Lanes>(states, constants.full_round_constants[r], constants.mds);
+                        }
+                    }
                 };
             }    // namespace detail
         }        // namespace hashes
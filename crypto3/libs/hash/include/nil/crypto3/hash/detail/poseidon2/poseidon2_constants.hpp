@@ -0,0 +1,165 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_POSEIDON2_CONSTANTS_HPP
+#define CRYPTO3_HASH_POSEIDON2_CONSTANTS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <nil/crypto3/hash/detail/poseidon2/poseidon2_policy.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief Grain LFSR of the Poseidon papers, initialized for a prime field and an x^d S-box.
+                 */
+                template<typename FieldType>
+                class poseidon2_grain_lfsr {
+                public:
+                    typedef typename FieldType::value_type element_type;
+                    typedef typename FieldType::integral_type integral_type;
+
+                    constexpr static const std::size_t state_bits = 80;
+
+                    poseidon2_grain_lfsr(std::size_t state_words, std::size_t full_rounds, std::size_t part_rounds) :
+                        position(0) {
+                        std::size_t i = 0;
+                        auto put = [this, &i](std::size_t value, std::size_t bits) {
+                            for (std::size_t b = bits; b-- > 0;) {
+                                state[i++] = (value >> b) & 1u;
+                            }
+                        };
+                        put(1, 2);    // prime field
+                        put(0, 4);    // x^d S-box
+                        put(FieldType::modulus_bits, 12);
+                        put(state_words, 12);
+                        put(full_rounds, 10);
+                        put(part_rounds, 10);
+                        put((1u << 30) - 1, 30);
+                        for (std::size_t j = 0; j < 160; j++) {
+                            next_raw_bit();
+                        }
+                    }
+
+                    /// Uniform element of the field, by rejection sampling of modulus_bits random bits.
+                    element_type next_element() {
+                        while (true) {
+                            integral_type value = 0u;
+                            for (std::size_t j = 0; j < FieldType::modulus_bits; j++) {
+                                value <<= 1;
+                                if (next_bit()) {
+                                    value |= 1u;
+                                }
+                            }
+                            if (value < FieldType::modulus) {
+                                return element_type(value);
+                            }
+                        }
+                    }
+
+                private:
+                    /// Bits are output in pairs, the second one is kept if the first one is set.
+                    bool next_bit() {
+                        while (true) {
+                            bool keep = next_raw_bit();
+                            bool bit = next_raw_bit();
+                            if (keep) {
+                                return bit;
+                            }
+                        }
+                    }
+
+                    bool next_raw_bit() {
+                        auto at = [this](std::size_t offset) { return state[(position + offset) % state_bits]; };
+                        bool bit = at(62) ^ at(51) ^ at(38) ^ at(23) ^ at(13) ^ at(0);
+                        state[position] = bit;
+                        position = (position + 1) % state_bits;
+                        return bit;
+                    }
+
+                    std::array<bool, state_bits> state;
+                    std::size_t position;
+                };
+
+                /*!
+                 * @brief Round constants and internal diagonal of Poseidon2.
+                 * The round constants are drawn from the Grain LFSR in the order of the rounds: state_words
+                 * of them for a full round, one for a partial round.
+                 */
+                template<typename PolicyType>
+                class poseidon2_constants {
+                public:
+                    typedef PolicyType policy_type;
+                    typedef typename policy_type::field_type field_type;
+                    typedef typename policy_type::word_type element_type;
+                    typedef typename policy_type::state_type state_type;
+
+                    constexpr static const std::size_t state_words = policy_type::state_words;
+                    constexpr static const std::size_t full_rounds = policy_type::full_rounds;
+                    constexpr static const std::size_t half_full_rounds = policy_type::half_full_rounds;
+                    constexpr static const std::size_t part_rounds = policy_type::part_rounds;
+
+                    static const poseidon2_constants &instance() {
+                        static const poseidon2_constants constants;
+                        return constants;
+                    }
+
+                    /// The internal linear layer is y[i] = internal_diagonal[i] * x[i] + sum(x).
+                    state_type internal_diagonal;
+                    std::array<state_type, full_rounds> full_round_constants;
+                    std::array<element_type, part_rounds> part_round_constants;
+
+                private:
+                    poseidon2_constants() {
+                        poseidon2_grain_lfsr<field_type> lfsr(state_words, full_rounds, part_rounds);
+                        for (std::size_t r = 0; r < half_full_rounds; r++) {
+                            for (auto &constant : full_round_constants[r]) {
+                                constant = lfsr.next_element();
+                            }
+                        }
+                        for (auto &constant : part_round_constants) {
+                            constant = lfsr.next_element();
+                        }
+                        for (std::size_t r = half_full_rounds; r < full_rounds; r++) {
+                            for (auto &constant : full_round_constants[r]) {
+                                constant = lfsr.next_element();
+                            }
+                        }
+
+                        const auto entries =
+                            policy_type::field_parameters_type::template internal_diagonal<state_words>();
+                        if constexpr (std::is_same_v<typename decltype(entries)::value_type, std::uint64_t>) {
+                            for (std::size_t i = 0; i < state_words; i++) {
+                                internal_diagonal[i] = element_type(entries[i]);
+                            }
+                        } else {
+                            const element_type two_inversed = element_type(2u).inversed();
+                            for (std::size_t i = 0; i < state_words; i++) {
+                                const auto &entry = entries[i];
+                                element_type value = entry.numerator < 0
+                                                         ? -element_type(std::uint64_t(-entry.numerator))
+                                                         : element_type(std::uint64_t(entry.numerator));
+                                for (std::size_t k = 0; k < entry.inverse_power_of_two; k++) {
+                                    value *= two_inversed;
+                                }
+                                internal_diagonal[i] = value;
+                            }
+                        }
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_POSEIDON2_CONSTANTS_HPP
@@ -0,0 +1,376 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_POSEIDON2_PERMUTATION_HPP
+#define CRYPTO3_HASH_POSEIDON2_PERMUTATION_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+
+#include <nil/crypto3/multiprecision/detail/big_mod/packed_modular_ops.hpp>
+
+#include <nil/crypto3/hash/detail/poseidon2/poseidon2_policy.hpp>
+#include <nil/crypto3/hash/detail/poseidon2/poseidon2_constants.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief Element-wise arithmetic on arrays of field elements. Fields with packed modular
+                 * arithmetic work on the raw values with the SIMD kernels, the others on the field elements.
+                 */
+                template<typename FieldType>
+                struct poseidon2_arithmetic {
+                    typedef typename FieldType::value_type value_type;
+                    typedef value_type raw_type;
+
+                    constexpr static const std::size_t batch_lanes = 1;
+
+                    static raw_type to_raw(const value_type &x) {
+                        return x;
+                    }
+
+                    static value_type from_raw(const raw_type &x) {
+                        return x;
+                    }
+
+                    template<std::size_t N>
+                    static void add(std::array<raw_type, N> &a, const std::array<raw_type, N> &b) {
+                        for (std::size_t i = 0; i < N; i++) {
+                            a[i] += b[i];
+                        }
+                    }
+
+                    template<std::size_t N>
+                    static void mul(std::array<raw_type, N> &a, const std::array<raw_type, N> &b) {
+                        for (std::size_t i = 0; i < N; i++) {
+                            a[i] *= b[i];
+                        }
+                    }
+
+                    template<std::size_t N>
+                    static void square(std::array<raw_type, N> &a) {
+                        for (std::size_t i = 0; i < N; i++) {
+                            a[i] = a[i].squared();
+                        }
+                    }
+                };
+
+                template<typename FieldType>
+                    requires(multiprecision::detail::packed_modular_ops<
+                                 typename FieldType::modular_type::modular_ops_t>::enabled &&
+                             sizeof(typename FieldType::value_type) ==
+                                 sizeof(typename FieldType::modular_type::base_type))
+                struct poseidon2_arithmetic<FieldType> {
+                    typedef typename FieldType::value_type value_type;
+                    typedef multiprecision::detail::packed_modular_ops<typename FieldType::modular_type::modular_ops_t>
+                        packed_ops;
+                    typedef typename packed_ops::base_type raw_type;
+
+                    /// States permuted together fill a 512-bit register with every word of the state.
+                    constexpr static const std::size_t batch_lanes = 64 / sizeof(raw_type);
+
+                    static raw_type to_raw(const value_type &x) {
+                        return std::bit_cast<raw_type>(x);
+                    }
+
+                    static value_type from_raw(const raw_type &x) {
+                        return std::bit_cast<value_type>(x);
+                    }
+
+                    template<std::size_t N>
+                    static void add(std::array<raw_type, N> &a, const std::array<raw_type, N> &b) {
+                        packed_ops::add(a, b);
+                    }
+
+                    template<std::size_t N>
+                    static void mul(std::array<raw_type, N> &a, const std::array<raw_type, N> &b) {
+                        packed_ops::mul(a, b);
+                    }
+
+                    template<std::size_t N>
+                    static void square(std::array<raw_type, N> &a) {
+                        packed_ops::square(a);
+                    }
+                };
+
+                /*!
+                 * @brief Poseidon2 permutation, https://eprint.iacr.org/2023/323.
+                 * The state goes through the external linear layer, half of the full rounds, the partial
+                 * rounds and the other half of the full rounds. A full round adds a constant to every word,
+                 * applies the S-box to every word and the external layer circ(2 M4, M4, ..., M4). A partial
+                 * round adds a constant to the first word, applies the S-box to it and the internal layer
+                 * diag(d) + 1.
+                 *
+                 * Several states are permuted in lanes: word i of lane l is at [i][l], so that every step
+                 * is the same packed operation on all the lanes. A single state is one lane, and the steps
+                 * applied to every word, the S-boxes of the full rounds and the diagonal, are packed over
+                 * the words of the state instead.
+                 */
+                template<typename PolicyType>
+                class poseidon2_permutation {
+                    typedef PolicyType policy_type;
+                    typedef poseidon2_constants<policy_type> constants_type;
+                    typedef poseidon2_arithmetic<typename policy_type::field_type> arithmetic_type;
+                    typedef typename arithmetic_type::raw_type raw_type;
+
+                public:
+                    typedef typename policy_type::word_type element_type;
+                    typedef typename policy_type::state_type state_type;
+
+                    constexpr static const std::size_t state_words = policy_type::state_words;
+                    constexpr static const std::size_t half_full_rounds = policy_type::half_full_rounds;
+                    constexpr static const std::size_t full_rounds = policy_type::full_rounds;
+                    constexpr static const std::size_t part_rounds = policy_type::part_rounds;
+                    constexpr static const std::size_t sbox_power = policy_type::sbox_power;
+
+                    constexpr static const std::size_t batch_lanes = arithmetic_type::batch_lanes;
+
+                    BOOST_STATIC_ASSERT_MSG(state_words % 4 == 0, "The external layer works on blocks of 4 words.");
+                    BOOST_STATIC_ASSERT_MSG(sbox_power == 3 || sbox_power == 5 || sbox_power == 7,
+                                            "Unsupported S-box power.");
+
+                    static void permute(state_type &state) {
+                        lanes_state_type<1> lanes;
+                        for (std::size_t i = 0; i < state_words; i++) {
+                            lanes[i][0] = arithmetic_type::to_raw(state[i]);
+                        }
+                        permute_lanes<1>(lanes);
+                        for (std::size_t i = 0; i < state_words; i++) {
+                            state[i] = arithmetic_type::from_raw(lanes[i][0]);
+                        }
+                    }
+
+                    /// Permutes count states, batch_lanes of them at a time.
+                    static void permute_batch(state_type *states, std::size_t count) {
+                        if constexpr (batch_lanes == 1) {
+                            for (std::size_t j = 0; j < count; j++) {
+                                permute(states[j]);
+                            }
+                        } else {
+                            lanes_state_type<batch_lanes> lanes;
+                            for (std::size_t first = 0; first < count; first += batch_lanes) {
+                                const std::size_t group = std::min(batch_lanes, count - first);
+                                for (std::size_t i = 0; i < state_words; i++) {
+                                    lanes[i].fill(raw_type());
+                                    for (std::size_t l = 0; l < group; l++) {
+                                        lanes[i][l] = arithmetic_type::to_raw(states[first + l][i]);
+                                    }
+                                }
+                                permute_lanes<batch_lanes>(lanes);
+                                for (std::size_t i = 0; i < state_words; i++) {
+                                    for (std::size_t l = 0; l < group; l++) {
+                                        states[first + l][i] = arithmetic_type::from_raw(lanes[i][l]);
+                                    }
+                                }
+                            }
+                        }
+                    }
+
+                private:
+                    template<std::size_t Lanes>
+                    using lane_type = std::array<raw_type, Lanes>;
+                    template<std::size_t Lanes>
+                    using lanes_state_type = std::array<lane_type<Lanes>, state_words>;
+                    template<std::size_t Lanes>
+                    using flat_state_type = std::array<raw_type, state_words * Lanes>;
+
+                    /// The constants broadcast to all the lanes.
+                    template<std::size_t Lanes>
+                    struct lane_constants {
+                        lane_constants() {
+                            const constants_type &constants = constants_type::instance();
+                            for (std::size_t i = 0; i < state_words; i++) {
+                                for (std::size_t l = 0; l < Lanes; l++) {
+                                    internal_diagonal[i * Lanes + l] =
+                                        arithmetic_type::to_raw(constants.internal_diagonal[i]);
+                                    for (std::size_t r = 0; r < full_rounds; r++) {
+                                        full_round_constants[r][i * Lanes + l] =
+                                            arithmetic_type::to_raw(constants.full_round_constants[r][i]);
+                                    }
+                                }
+                            }
+                            for (std::size_t r = 0; r < part_rounds; r++) {
+                                part_round_constants[r].fill(
+                                    arithmetic_type::to_raw(constants.part_round_constants[r]));
+                            }
+                            for (std::size_t shift = 0; shift < 4; shift++) {
+                                for (std::size_t i = 0; i < state_words; i++) {
+                                    const element_type factor(m4[i % 4][(i + shift) % 4]);
+                                    m4_diagonals[shift][i] = arithmetic_type::to_raw(factor);
+                                }
+                            }
+                        }
+
+                        static const lane_constants &instance() {
+                            static const lane_constants constants;
+                            return constants;
+                        }
+
+                        flat_state_type<Lanes> internal_diagonal;
+                        std::array<flat_state_type<Lanes>, full_rounds> full_round_constants;
+                        std::array<lane_type<Lanes>, part_rounds> part_round_constants;
+                        /// Word 4b + k of diagonal s is M4[k][(k + s) % 4], for the external layer of a single state.
+                        std::array<std::array<raw_type, state_words>, 4> m4_diagonals;
+                    };
+
+                    constexpr static const std::size_t m4[4][4] = {{5, 7, 1, 3}, {4, 6, 1, 1}, {1, 3, 5, 7}, {1, 1, 4, 6}};
+
+                    template<std::size_t N>
+                    static void sbox(std::array<raw_type, N> &x) {
+                        if constexpr (sbox_power == 3) {
+                            std::array<raw_type, N> x2 = x;
+                            arithmetic_type::square(x2);
+                            arithmetic_type::mul(x, x2);
+                        } else if constexpr (sbox_power == 5) {
+                            std::array<raw_type, N> x4 = x;
+                            arithmetic_type::square(x4);
+                            arithmetic_type::square(x4);
+                            arithmetic_type::mul(x, x4);
+                        } else {
+                            std::array<raw_type, N> x2 = x;
+                            arithmetic_type::square(x2);
+                            arithmetic_type::mul(x, x2);
+                            arithmetic_type::square(x2);
+                            arithmetic_type::mul(x, x2);
+                        }
+                    }
+
+                    /// M4 = [[5, 7, 1, 3], [4, 6, 1, 1], [1, 3, 5, 7], [1, 1, 4, 6]] in additions, from the paper.
+                    template<std::size_t Lanes>
+                    static void apply_m4(lane_type<Lanes> &x0, lane_type<Lanes> &x1, lane_type<Lanes> &x2,
+                                         lane_type<Lanes> &x3) {
+                        lane_type<Lanes> t0 = x0;
+                        arithmetic_type::add(t0, x1);
+                        lane_type<Lanes> t1 = x2;
+                        arithmetic_type::add(t1, x3);
+                        lane_type<Lanes> t2 = x1;
+                        arithmetic_type::add(t2, x1);
+                        arithmetic_type::add(t2, t1);
+                        lane_type<Lanes> t3 = x3;
+                        arithmetic_type::add(t3, x3);
+                        arithmetic_type::add(t3, t0);
+                        lane_type<Lanes> t4 = t1;
+                        arithmetic_type::add(t4, t1);
+                        arithmetic_type::add(t4, t4);
+                        arithmetic_type::add(t4, t3);
+                        lane_type<Lanes> t5 = t0;
+                        arithmetic_type::add(t5, t0);
+                        arithmetic_type::add(t5, t5);
+                        arithmetic_type::add(t5, t2);
+                        // x0 = t3 + t5, x1 = t5, x2 = t2 + t4, x3 = t4.
+                        x0 = t3;
+                        arithmetic_type::add(x0, t5);
+                        x1 = t5;
+                        x2 = t2;
+                        arithmetic_type::add(x2, t4);
+                        x3 = t4;
+                    }
+
+                    /// circ(2 M4, M4, ..., M4): M4 on every block of 4 words, then the sum of the blocks is added.
+                    template<std::size_t Lanes>
+                    static void external_linear_layer(lanes_state_type<Lanes> &state) {
+                        if constexpr (Lanes == 1) {
+                            external_linear_layer_single(state);
+                            return;
+                        }
+                        for (std::size_t i = 0; i < state_words; i += 4) {
+                            apply_m4<Lanes>(state[i], state[i + 1], state[i + 2], state[i + 3]);
+                        }
+                        for (std::size_t j = 0; j < 4; j++) {
+                            lane_type<Lanes> sum = state[j];
+                            for (std::size_t i = 4 + j; i < state_words; i += 4) {
+                                arithmetic_type::add(sum, state[i]);
+                            }
+                            for (std::size_t i = j; i < state_words; i += 4) {
+                                arithmetic_type::add(state[i], sum);
+                            }
+                        }
+                    }
+
+                    /// The external layer of a single state, packed over its words: M4 is the sum of its
+                    /// diagonals times the words rotated within the blocks, the blocks are summed by rotations.
+                    static void external_linear_layer_single(lanes_state_type<1> &state) {
+                        typedef std::array<raw_type, state_words> words_type;
+                        const lane_constants<1> &constants = lane_constants<1>::instance();
+
+                        const words_type x = std::bit_cast<words_type>(state);
+                        words_type y = x;
+                        arithmetic_type::mul(y, constants.m4_diagonals[0]);
+                        words_type rotated;
+                        for (std::size_t shift = 1; shift < 4; shift++) {
+                            for (std::size_t i = 0; i < state_words; i++) {
+                                rotated[i] = x[(i & ~std::size_t(3)) | ((i + shift) & 3)];
+                            }
+                            arithmetic_type::mul(rotated, constants.m4_diagonals[shift]);
+                            arithmetic_type::add(y, rotated);
+                        }
+
+                        words_type sum = y;
+                        for (std::size_t shift = 4; shift < state_words; shift += 4) {
+                            for (std::size_t i = 0; i < state_words; i++) {
+                                rotated[i] = y[(i + shift) % state_words];
+                            }
+                            arithmetic_type::add(sum, rotated);
+                        }
+                        arithmetic_type::add(y, sum);
+                        state = std::bit_cast<lanes_state_type<1>>(y);
+                    }
+
+                    template<std::size_t Lanes>
+                    static void full_round(lanes_state_type<Lanes> &state, const flat_state_type<Lanes> &constants) {
+                        flat_state_type<Lanes> flat = std::bit_cast<flat_state_type<Lanes>>(state);
+                        arithmetic_type::add(flat, constants);
+                        sbox(flat);
+                        state = std::bit_cast<lanes_state_type<Lanes>>(flat);
+                        external_linear_layer<Lanes>(state);
+                    }
+
+                    template<std::size_t Lanes>
+                    static void part_round(lanes_state_type<Lanes> &state, const lane_type<Lanes> &constant,
+                                           const flat_state_type<Lanes> &diagonal) {
+                        arithmetic_type::add(state[0], constant);
+                        sbox(state[0]);
+
+                        lane_type<Lanes> sum = state[0];
+                        for (std::size_t i = 1; i < state_words; i++) {
+                            arithmetic_type::add(sum, state[i]);
+                        }
+                        lanes_state_type<Lanes> sums;
+                        sums.fill(sum);
+                        flat_state_type<Lanes> flat = std::bit_cast<flat_state_type<Lanes>>(state);
+                        arithmetic_type::mul(flat, diagonal);
+                        arithmetic_type::add(flat, std::bit_cast<flat_state_type<Lanes>>(sums));
+                        state = std::bit_cast<lanes_state_type<Lanes>>(flat);
+                    }
+
+                    template<std::size_t Lanes>
+                    static void permute_lanes(lanes_state_type<Lanes> &state) {
+                        const lane_constants<Lanes> &constants = lane_constants<Lanes>::instance();
+
+                        external_linear_layer<Lanes>(state);
+                        for (std::size_t r = 0; r < half_full_rounds; r++) {
+                            full_round<Lanes>(state, constants.full_round_constants[r]);
+                        }
+                        for (std::size_t r = 0; r < part_rounds; r++) {
+                            part_round<Lanes>(state, constants.part_round_constants[r], constants.internal_diagonal);
+                        }
+                        for (std::size_t r = half_full_rounds; r < full_rounds; r++) {
+                            full_round<Lanes>(state, constants.full_round_constants[r]);
+                        }
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_POSEIDON2_PERMUTATION_HPP
@@ -0,0 +1,209 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_POSEIDON2_POLICY_HPP
+#define CRYPTO3_HASH_POSEIDON2_POLICY_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/static_assert.hpp>
+
+#include <nil/crypto3/algebra/fields/babybear.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks.hpp>
+#include <nil/crypto3/algebra/fields/koalabear.hpp>
+#include <nil/crypto3/algebra/fields/mersenne31.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /// An entry of the internal diagonal, numerator / 2^inverse_power_of_two.
+                struct poseidon2_diagonal_entry {
+                    std::int64_t numerator;
+                    std::size_t inverse_power_of_two;
+                };
+
+                /*!
+                 * @brief Field dependent parameters of Poseidon2: the S-box power is the smallest d >= 3
+                 * coprime with p - 1, the numbers of partial rounds are the ones of the Poseidon2 paper
+                 * for 128-bit security. The internal diagonals of the 31-bit fields are +-2^k and small
+                 * integers, so that the internal linear layer is cheap, as in Plonky3.
+                 */
+                template<typename FieldType>
+                struct poseidon2_field_parameters;
+
+                template<>
+                struct poseidon2_field_parameters<algebra::fields::babybear> {
+                    constexpr static const std::size_t sbox_power = 7;
+                    constexpr static const std::size_t digest_words = 8;
+
+                    template<std::size_t Width>
+                    constexpr static bool is_supported_width() {
+                        return Width == 16 || Width == 24;
+                    }
+
+                    template<std::size_t Width>
+                    constexpr static std::size_t part_rounds() {
+                        return Width == 16 ? 13 : 21;
+                    }
+
+                    template<std::size_t Width>
+                    constexpr static std::array<poseidon2_diagonal_entry, Width> internal_diagonal() {
+                        if constexpr (Width == 16) {
+                            return {{{-2, 0}, {1, 0}, {2, 0}, {1, 1}, {3, 0}, {4, 0}, {-1, 1}, {-3, 0},
+                                     {-4, 0}, {1, 8}, {1, 2}, {1, 3}, {1, 27}, {-1, 8}, {-1, 4}, {-1, 27}}};
+                        } else {
+                            return {{{-2, 0}, {1, 0}, {2, 0}, {1, 1}, {3, 0}, {4, 0}, {-1, 1}, {-3, 0},
+                                     {-4, 0}, {1, 8}, {1, 2}, {1, 3}, {1, 4}, {1, 7}, {1, 9}, {1, 27},
+                                     {-1, 8}, {-1, 2}, {-1, 3}, {-1, 4}, {-1, 5}, {-1, 6}, {-1, 7}, {-1, 27}}};
+                        }
+                    }
+                };
+
+                template<>
+                struct poseidon2_field_parameters<algebra::fields::koalabear> {
+                    constexpr static const std::size_t sbox_power = 3;
+                    constexpr static const std::size_t digest_words = 8;
+
+                    template<std::size_t Width>
+                    constexpr static bool is_supported_width() {
+                        return Width == 16 || Width == 24;
+                    }
+
+                    template<std::size_t Width>
+                    constexpr static std::size_t part_rounds() {
+                        return Width == 16 ? 20 : 23;
+                    }
+
+                    template<std::size_t Width>
+                    constexpr static std::array<poseidon2_diagonal_entry, Width> internal_diagonal() {
+                        if constexpr (Width == 16) {
+                            return {{{-2, 0}, {1, 0}, {2, 0}, {1, 1}, {3, 0}, {4, 0}, {-1, 1}, {-3, 0},
+                                     {-4, 0}, {1, 8}, {1, 3}, {1, 24}, {-1, 8}, {-1, 3}, {-1, 4}, {-1, 24}}};
+                        } else {
+                            return {{{-2, 0}, {1, 0}, {2, 0}, {1, 1}, {3, 0}, {4, 0}, {-1, 1}, {-3, 0},
+                                     {-4, 0}, {1, 8}, {1, 2}, {1, 3}, {1, 4}, {1, 5}, {1, 6}, {1, 24},
+                                     {-1, 8}, {-1, 3}, {-1, 4}, {-1, 5}, {-1, 6}, {-1, 7}, {-1, 9}, {-1, 24}}};
+                        }
+                    }
+                };
+
+                /// Powers of two are shifts in the Mersenne31 field, the diagonal is [-2, 1, 2, 4, ...].
+                template<>
+                struct poseidon2_field_parameters<algebra::fields::mersenne31> {
+                    constexpr static const std::size_t sbox_power = 5;
+                    constexpr static const std::size_t digest_words = 8;
+
+                    template<std::size_t Width>
+                    constexpr static bool is_supported_width() {
+                        return Width == 16 || Width == 24;
+                    }
+
+                    template<std::size_t Width>
+                    constexpr static std::size_t part_rounds() {
+                        return Width == 16 ? 14 : 22;
+                    }
+
+                    template<std::size_t Width>
+                    constexpr static std::array<poseidon2_diagonal_entry, Width> internal_diagonal() {
+                        std::array<poseidon2_diagonal_entry, Width> diagonal {};
+                        diagonal[0] = {-2, 0};
+                        for (std::size_t i = 1; i < Width; i++) {
+                            // Width 16 skips 2^9 and 2^11, as Plonky3 does.
+                            std::size_t power = i - 1;
+                            if (Width == 16 && power >= 9) {
+                                power = power == 9 ? 10 : power + 2;
+                            }
+                            diagonal[i] = {std::int64_t(1) << power, 0};
+                        }
+                        return diagonal;
+                    }
+                };
+
+                /*!
+                 * The internal diagonals of Goldilocks are the ones of the reference implementation,
+                 * https://github.com/HorizenLabs/poseidon2, also used by Plonky3. They are full field
+                 * elements, given in canonical form.
+                 */
+                template<>
+                struct poseidon2_field_parameters<algebra::fields::goldilocks> {
+                    constexpr static const std::size_t sbox_power = 7;
+                    constexpr static const std::size_t digest_words = 4;
+
+                    template<std::size_t Width>
+                    constexpr static bool is_supported_width() {
+                        return Width == 8 || Width == 12 || Width == 16;
+                    }
+
+                    template<std::size_t Width>
+                    constexpr static std::size_t part_rounds() {
+                        return 22;
+                    }
+
+                    template<std::size_t Width>
+                    constexpr static std::array<std::uint64_t, Width> internal_diagonal() {
+                        static_assert(is_supported_width<Width>(),
+                                      "Goldilocks Poseidon2 is defined for widths 8, 12 and 16.");
+                        if constexpr (Width == 8) {
+                            return {0xa98811a1fed4e3a5, 0x1cc48b54f377e2a0, 0xe40cd4f6c5609a26, 0x11de79ebca97a4a3,
+                                    0x9177c73d8b7e929c, 0x2a6fe8085797e791, 0x3de6e93329f8d5ad, 0x3f7af9125da962fe};
+                        } else if constexpr (Width == 12) {
+                            return {0xc3b6c08e23ba9300, 0xd84b5de94a324fb6, 0x0d0c371c5b35b84f, 0x7964f570e7188037,
+                                    0x5daf18bbd996604b, 0x6743bc47b9595257, 0x5528b9362c59bb70, 0xac45e25b7127b68b,
+                                    0xa2077d7dfbb606b5, 0xf3faac6faee378ae, 0x0c6388b51545e883, 0xd27dbb6944917b60};
+                        } else {
+                            return {0xde9b91a467d6afc0, 0xc5f16b9c76a9be17, 0x0ab0fef2d540ac55, 0x3001d27009d05773,
+                                    0xed23b1f906d3d9eb, 0x5ce73743cba97054, 0x1c3bab944af4ba24, 0x2faa105854dbafae,
+                                    0x53ffb3ae6d421a10, 0xbcda9df8884ba396, 0xfc1273e4a31807bb, 0xc77952573d5142c0,
+                                    0x56683339a819b85e, 0x328fcbd8f0ddc8eb, 0xb5101e303fce9cb7, 0x774487b8c40089bb};
+                        }
+                    }
+                };
+
+                /*!
+                 * @brief Poseidon2 parameters.
+                 * @tparam FieldType One of the small fields: babybear, koalabear, mersenne31, goldilocks.
+                 * @tparam Width Number of field elements in the state, 16 or 24 for the 31-bit fields,
+                 * 8, 12 or 16 for goldilocks.
+                 * The capacity is equal to the digest size, 8 elements of the 31-bit fields or
+                 * 4 goldilocks elements, the rest of the state is the rate.
+                 */
+                template<typename FieldType, std::size_t Width>
+                struct poseidon2_policy {
+                    typedef poseidon2_field_parameters<FieldType> field_parameters_type;
+
+                    BOOST_STATIC_ASSERT_MSG(field_parameters_type::template is_supported_width<Width>(),
+                                            "Poseidon2 is not defined for this width over this field.");
+
+                    using field_type = FieldType;
+                    using word_type = typename field_type::value_type;
+
+                    constexpr static const std::size_t state_words = Width;
+                    constexpr static const std::size_t digest_words = field_parameters_type::digest_words;
+                    constexpr static const std::size_t capacity = digest_words;
+                    constexpr static const std::size_t block_words = state_words - capacity;
+                    constexpr static const std::size_t rate = block_words;
+
+                    using state_type = std::array<word_type, state_words>;
+                    using block_type = std::array<word_type, block_words>;
+                    using digest_type = std::array<word_type, digest_words>;
+
+                    constexpr static const std::size_t full_rounds = 8;
+                    constexpr static const std::size_t half_full_rounds = full_rounds >> 1;
+                    constexpr static const std::size_t part_rounds =
+                        field_parameters_type::template part_rounds<Width>();
+                    constexpr static const std::size_t sbox_power = field_parameters_type::sbox_power;
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_POSEIDON2_POLICY_HPP
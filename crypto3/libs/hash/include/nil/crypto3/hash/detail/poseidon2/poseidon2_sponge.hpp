@@ -0,0 +1,169 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_POSEIDON2_SPONGE_HPP
+#define CRYPTO3_HASH_POSEIDON2_SPONGE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+#include <nil/crypto3/hash/detail/poseidon2/poseidon2_policy.hpp>
+#include <nil/crypto3/hash/detail/poseidon2/poseidon2_permutation.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief Sponge over the Poseidon2 permutation, the digest is the first digest_words words
+                 * of the state. Blocks are added to the rate part of the state. A message which does not end
+                 * on a block boundary, the empty one included, is padded with 1 and zeros, otherwise 1 is
+                 * added to the last word of the capacity before the last permutation. Every block takes one
+                 * permutation, so a 2-to-1 node of a Merkle tree is a single permutation when the rate is
+                 * twice the digest.
+                 *
+                 * The permutation after a block is delayed until the next block or the end of the message,
+                 * as the accumulator hands out full blocks before it knows whether the message goes on.
+                 */
+                template<typename Policy>
+                class poseidon2_sponge_construction {
+                public:
+                    using permutation_type = poseidon2_permutation<Policy>;
+
+                    using word_type = typename Policy::word_type;
+                    using state_type = typename Policy::state_type;
+                    using block_type = typename Policy::block_type;
+                    using digest_type = typename Policy::digest_type;
+
+                    constexpr static const std::size_t state_words = Policy::state_words;
+                    constexpr static const std::size_t block_words = Policy::block_words;
+                    constexpr static const std::size_t digest_words = Policy::digest_words;
+
+                    poseidon2_sponge_construction() {
+                        reset();
+                    }
+
+                    void absorb(const block_type &block) {
+                        absorb(block.data(), block_words);
+                    }
+
+                    void absorb_with_padding(const block_type &block,
+                                             const std::size_t last_block_words_filled = block_words) {
+                        if (last_block_words_filled == block_words) {
+                            absorb(block);
+                            finalize(block.data(), 0);
+                        } else {
+                            finalize(block.data(), last_block_words_filled);
+                        }
+                    }
+
+                    digest_type digest() {
+                        if (!finalized_) {
+                            finalize(nullptr, 0);
+                        }
+                        digest_type result;
+                        std::copy(state_.begin(), state_.begin() + digest_words, result.begin());
+                        return result;
+                    }
+
+                    void reset() {
+                        state_.fill(word_type::zero());
+                        pending_ = false;
+                        finalized_ = false;
+                    }
+
+                    /*!
+                     * @brief Hashes count messages of the same length, the digests are the ones of
+                     * hash<poseidon2>. Up to permutation_type::batch_lanes messages are permuted together.
+                     */
+                    static void hash_batch(const word_type *const *messages, std::size_t words, std::size_t count,
+                                           digest_type *digests) {
+                        constexpr std::size_t batch_size = permutation_type::batch_lanes;
+                        std::array<state_type, batch_size> states;
+
+                        const std::size_t full_blocks = words / block_words;
+                        const std::size_t tail = words % block_words;
+
+                        for (std::size_t first = 0; first < count; first += batch_size) {
+                            const std::size_t group = std::min(batch_size, count - first);
+                            for (std::size_t j = 0; j < group; j++) {
+                                states[j].fill(word_type::zero());
+                            }
+
+                            for (std::size_t b = 0; b < full_blocks; b++) {
+                                if (b > 0) {
+                                    permutation_type::permute_batch(states.data(), group);
+                                }
+                                for (std::size_t j = 0; j < group; j++) {
+                                    add_words(states[j], messages[first + j] + b * block_words, block_words);
+                                }
+                            }
+                            if (tail > 0 || full_blocks == 0) {
+                                if (full_blocks > 0) {
+                                    permutation_type::permute_batch(states.data(), group);
+                                }
+                                for (std::size_t j = 0; j < group; j++) {
+                                    add_words(states[j], messages[first + j] + full_blocks * block_words, tail);
+                                    states[j][tail] += word_type::one();
+                                }
+                            } else {
+                                for (std::size_t j = 0; j < group; j++) {
+                                    states[j][state_words - 1] += word_type::one();
+                                }
+                            }
+                            permutation_type::permute_batch(states.data(), group);
+
+                            for (std::size_t j = 0; j < group; j++) {
+                                std::copy(states[j].begin(), states[j].begin() + digest_words,
+                                          digests[first + j].begin());
+                            }
+                        }
+                    }
+
+                private:
+                    static void add_words(state_type &state, const word_type *words, std::size_t count) {
+                        for (std::size_t i = 0; i < count; i++) {
+                            state[i] += words[i];
+                        }
+                    }
+
+                    void absorb(const word_type *words, std::size_t count) {
+                        if (pending_) {
+                            permutation_type::permute(state_);
+                        }
+                        add_words(state_, words, count);
+                        pending_ = true;
+                    }
+
+                    void finalize(const word_type *words, std::size_t count) {
+                        if (count == 0 && pending_) {
+                            state_[state_words - 1] += word_type::one();
+                        } else {
+                            if (pending_) {
+                                permutation_type::permute(state_);
+                            }
+                            add_words(state_, words, count);
+                            state_[count] += word_type::one();
+                        }
+                        permutation_type::permute(state_);
+                        pending_ = false;
+                        finalized_ = true;
+                    }
+
+                    state_type state_;
+                    /// A block has been added and not permuted yet.
+                    bool pending_;
+                    bool finalized_;
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_POSEIDON2_SPONGE_HPP
@@ -25,7 +25,7 @@
 #ifndef CRYPTO3_SHA3_FUNCTIONS_HPP
 #define CRYPTO3_SHA3_FUNCTIONS_HPP
 
-#include <nil/crypto3/hash/detail/keccak/keccak_impl.hpp>
+#include <nil/crypto3/hash/detail/keccak/keccak_dispatch.hpp>
 #include <nil/crypto3/hash/detail/sha3/sha3_policy.hpp>
 
 #include <array>
@@ -56,7 +56,7 @@ namespace nil {
                     constexpr static const pkcs_id_type pkcs_id = policy_type::pkcs_id;
 
                     static void permute(state_type &A) {
-                        keccak_1600_impl<policy_type>::permute(A);
+                        keccak_1600_dispatched_impl<policy_type>::permute(A);
                     }
 
                     static void absorb(const block_type& block, state_type& state) {
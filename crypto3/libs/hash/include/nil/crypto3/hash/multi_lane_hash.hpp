@@ -0,0 +1,69 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_MULTI_LANE_HASH_HPP
+#define CRYPTO3_HASH_MULTI_LANE_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/detail/keccak/keccak_dispatch.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            /*!
+             * @brief Hashes several independent messages of the same length per call.
+             *
+             * Specializations provide `lanes`, the number of messages hashed together, and
+             *     static void hash(const std::uint8_t *const *messages, std::size_t length, std::size_t count,
+             *                      digest_type *digests);
+             * which writes the digests of count <= lanes byte messages, each `length` bytes long. The digests are
+             * the same as the ones of hash<Hash>. The primary template means that Hash has no multi-lane version.
+             */
+            template<typename Hash, typename Enable = void>
+            struct multi_lane_hash {
+                constexpr static const bool enabled = false;
+                constexpr static const std::size_t lanes = 1;
+            };
+
+            template<std::size_t DigestBits>
+            struct multi_lane_hash<keccak_1600<DigestBits>> {
+                typedef detail::keccak_1600_multi_lane_dispatch<typename keccak_1600<DigestBits>::policy_type> impl_type;
+                typedef typename keccak_1600<DigestBits>::digest_type digest_type;
+
+                constexpr static const bool enabled = true;
+                constexpr static const std::size_t lanes = impl_type::lanes;
+
+                static void hash(const std::uint8_t *const *messages, std::size_t length, std::size_t count,
+                                 digest_type *digests) {
+                    impl_type::hash(messages, length, count, digests);
+                }
+            };
+        }    // namespace hashes
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_MULTI_LANE_HASH_HPP
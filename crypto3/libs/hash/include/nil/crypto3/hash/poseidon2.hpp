@@ -0,0 +1,56 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_POSEIDON2_HPP
+#define CRYPTO3_HASH_POSEIDON2_HPP
+
+#include <nil/crypto3/hash/accumulators/hash.hpp>
+#include <nil/crypto3/hash/detail/poseidon2/poseidon2_policy.hpp>
+#include <nil/crypto3/hash/detail/poseidon2/poseidon2_permutation.hpp>
+#include <nil/crypto3/hash/detail/poseidon2/poseidon2_sponge.hpp>
+#include <nil/crypto3/hash/detail/stream_processors/stream_processors_enum.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+
+            /*!
+             * @brief Poseidon2 over the small fields, e.g.
+             *     poseidon2<detail::poseidon2_policy<algebra::fields::babybear, 24>>.
+             * The input and the digest are field elements, so it may be used for Merkle trees and
+             * transcripts of proofs over the same field without serializing the elements to bytes.
+             */
+            template<typename PolicyType>
+            struct poseidon2 {
+            public:
+                typedef PolicyType policy_type;
+                typedef typename policy_type::word_type word_type;
+
+                constexpr static const std::size_t block_words = policy_type::block_words;
+                typedef typename policy_type::block_type block_type;
+
+                // This is required by 'is_hash' concept.
+                constexpr static const std::size_t digest_bits = 0;
+                using digest_type = typename policy_type::digest_type;
+
+                struct construction {
+                    struct params_type {
+                        // This is required by 'is_hash' concept.
+                    };
+
+                    using type = detail::poseidon2_sponge_construction<policy_type>;
+                };
+
+                constexpr static detail::stream_processor_type stream_processor = detail::stream_processor_type::Raw;
+                using accumulator_tag = accumulators::tag::algebraic_hash<poseidon2<PolicyType>>;
+            };
+        }    // namespace hashes
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_POSEIDON2_HPP
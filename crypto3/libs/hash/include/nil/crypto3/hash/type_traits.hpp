@@ -38,6 +38,14 @@ namespace nil {
             template<typename PolicyType>
             struct poseidon;
 
+            template<typename PolicyType>
+            struct poseidon2;
+
+            namespace detail {
+                template<typename Policy>
+                class poseidon2_sponge_construction;
+            }    // namespace detail
+
             template<typename Field, typename Hash, typename Params>
             struct h2f;
 
@@ -70,6 +78,19 @@ namespace nil {
                 typedef HashType type;
             };
 
+            template<typename HashType, typename Enable = void>
+            struct is_poseidon2 {
+            public:
+                static const bool value = false;
+            };
+
+            template<typename HashType>
+            struct is_poseidon2<HashType, typename std::enable_if_t<std::is_same<nil::crypto3::hashes::poseidon2<typename HashType::policy_type>, HashType>::value>> {
+            public:
+                static const bool value = true;
+                typedef HashType type;
+            };
+
             template <template <typename...> class PrimaryTemplate, typename T>
             struct is_specialization_of : std::false_type {};
 
@@ -87,7 +108,8 @@ namespace nil {
                 std::enable_if_t<
                     is_specialization_of<sponge_construction, typename HashType::construction::type>::value ||
                     is_specialization_of<algebraic_sponge_construction, typename HashType::construction::type>::value ||
-                    is_specialization_of<nil::crypto3::hashes::detail::poseidon_sponge_construction_custom, typename HashType::construction::type>::value
+                    is_specialization_of<nil::crypto3::hashes::detail::poseidon_sponge_construction_custom, typename HashType::construction::type>::value ||
+                    is_specialization_of<nil::crypto3::hashes::detail::poseidon2_sponge_construction, typename HashType::construction::type>::value
                 >
             > {
                 static const bool value = true;
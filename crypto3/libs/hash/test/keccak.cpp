@@ -38,6 +38,7 @@
 #include <nil/crypto3/hash/adaptor/hashed.hpp>
 
 #include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/multi_lane_hash.hpp>
 
 using namespace nil::crypto3;
 using namespace nil::crypto3::accumulators;
@@ -434,3 +435,49 @@ BOOST_AUTO_TEST_CASE(keccak_512_preprocessor2) {
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(keccak_multi_lane_test_suite)
+
+template<typename Hash>
+void check_multi_lane(std::size_t length, std::size_t count) {
+    using multi_lane_type = hashes::multi_lane_hash<Hash>;
+    std::vector<std::vector<std::uint8_t>> messages(count, std::vector<std::uint8_t>(length));
+    std::array<const std::uint8_t *, multi_lane_type::lanes> pointers;
+    for (std::size_t i = 0; i < count; ++i) {
+        for (std::size_t j = 0; j < length; ++j) {
+            messages[i][j] = static_cast<std::uint8_t>(i * 131 + j * 7 + length);
+        }
+        pointers[i] = messages[i].data();
+    }
+    std::vector<typename Hash::digest_type> digests(count);
+    multi_lane_type::hash(pointers.data(), length, count, digests.data());
+    for (std::size_t i = 0; i < count; ++i) {
+        typename Hash::digest_type expected = hash<Hash>(messages[i]);
+        BOOST_CHECK_EQUAL(std::to_string(digests[i]), std::to_string(expected));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(keccak_multi_lane_matches_single) {
+    using hashes::detail::keccak_1600_backend;
+    // Every backend hashes the lanes in groups of its own width.
+    for (auto backend : {keccak_1600_backend::portable, keccak_1600_backend::x86_64, keccak_1600_backend::avx2,
+                         keccak_1600_backend::avx512}) {
+        if (!hashes::detail::set_keccak_1600_backend(backend)) {
+            continue;
+        }
+        BOOST_TEST_CONTEXT("backend " << static_cast<int>(backend)) {
+            // Lengths around the rates: 144, 136, 104 and 72 bytes.
+            for (std::size_t length : {0, 1, 71, 72, 73, 103, 104, 135, 136, 137, 143, 144, 145, 500}) {
+                for (std::size_t count = 1; count <= hashes::multi_lane_hash<hashes::keccak_1600<256>>::lanes; ++count) {
+                    check_multi_lane<hashes::keccak_1600<224>>(length, count);
+                    check_multi_lane<hashes::keccak_1600<256>>(length, count);
+                    check_multi_lane<hashes::keccak_1600<384>>(length, count);
+                    check_multi_lane<hashes::keccak_1600<512>>(length, count);
+                }
+            }
+        }
+    }
+    hashes::detail::set_keccak_1600_backend(hashes::detail::keccak_1600_best_backend());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
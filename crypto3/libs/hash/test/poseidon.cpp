@@ -31,6 +31,7 @@
 #include <nil/crypto3/algebra/fields/alt_bn128/scalar_field.hpp>
 #include <nil/crypto3/algebra/fields/bls12/scalar_field.hpp>
 #include <nil/crypto3/algebra/fields/pallas/base_field.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
 
 using namespace nil::crypto3;
 using namespace nil::crypto3::accumulators;
@@ -359,6 +360,44 @@ BOOST_AUTO_TEST_CASE(poseidon_without_padding_test) {
         BOOST_CHECK_EQUAL(d_uint8, d_field);
     }
 
+template<typename PolicyType>
+void test_poseidon_permutation_schedules() {
+    using permutation_type = poseidon_permutation<PolicyType>;
+    using state_type = typename PolicyType::state_type;
+
+    // Not a multiple of batch_lanes, so that the tail is covered too.
+    std::vector<state_type> states(2 * permutation_type::batch_lanes + 3);
+    for (auto &state : states) {
+        for (auto &word : state) {
+            word = random_element<typename PolicyType::field_type>();
+        }
+    }
+
+    std::vector<state_type> expected = states;
+    for (auto &state : expected) {
+        permutation_type::permute_by_rounds(state);
+    }
+
+    std::vector<state_type> single = states;
+    for (auto &state : single) {
+        permutation_type::permute(state);
+    }
+    permutation_type::permute_batch(states.data(), states.size());
+
+    for (std::size_t i = 0; i < states.size(); i++) {
+        BOOST_CHECK_EQUAL(single[i], expected[i]);
+        BOOST_CHECK_EQUAL(states[i], expected[i]);
+    }
+}
+
+    BOOST_AUTO_TEST_CASE(poseidon_optimized_permutation) {
+        test_poseidon_permutation_schedules<poseidon_policy<fields::alt_bn128_scalar_field<254>, 128, 2>>();
+        test_poseidon_permutation_schedules<poseidon_policy<fields::alt_bn128_scalar_field<254>, 128, 4>>();
+        test_poseidon_permutation_schedules<poseidon_policy<fields::bls12_scalar_field<381>, 128, 2>>();
+        test_poseidon_permutation_schedules<poseidon_policy<fields::bls12_scalar_field<381>, 128, 4>>();
+        test_poseidon_permutation_schedules<pasta_poseidon_policy<fields::pallas_base_field>>();
+    }
+
 // This test can be useful for constants generation in the future.
 //BOOST_AUTO_TEST_CASE(poseidon_generate_pallas_constants) {
 //
@@ -0,0 +1,356 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE poseidon2_test
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/babybear.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks.hpp>
+#include <nil/crypto3/algebra/fields/koalabear.hpp>
+#include <nil/crypto3/algebra/fields/mersenne31.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/poseidon2.hpp>
+#include <nil/crypto3/hash/type_traits.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::hashes::detail;
+
+namespace {
+    /// Poseidon2 straight from the definition, with the linear layers as dense matrices.
+    template<typename Policy>
+    typename Policy::state_type reference_permutation(typename Policy::state_type state) {
+        typedef typename Policy::word_type element_type;
+        typedef typename Policy::state_type state_type;
+        constexpr std::size_t t = Policy::state_words;
+        const auto &constants = poseidon2_constants<Policy>::instance();
+
+        const std::array<std::array<std::size_t, 4>, 4> m4 = {{{5, 7, 1, 3}, {4, 6, 1, 1}, {1, 3, 5, 7}, {1, 1, 4, 6}}};
+        std::array<state_type, t> external, internal;
+        for (std::size_t i = 0; i < t; i++) {
+            for (std::size_t j = 0; j < t; j++) {
+                const std::size_t factor = i / 4 == j / 4 ? 2 : 1;
+                external[i][j] = element_type(factor * m4[i % 4][j % 4]);
+                internal[i][j] = i == j ? constants.internal_diagonal[i] + element_type::one() : element_type::one();
+            }
+        }
+
+        auto multiply = [](const std::array<state_type, t> &m, const state_type &x) {
+            state_type y;
+            for (std::size_t i = 0; i < t; i++) {
+                y[i] = element_type::zero();
+                for (std::size_t j = 0; j < t; j++) {
+                    y[i] += m[i][j] * x[j];
+                }
+            }
+            return y;
+        };
+        auto sbox = [](const element_type &x) { return x.pow(Policy::sbox_power); };
+        auto full_round = [&](state_type &s, std::size_t r) {
+            for (std::size_t i = 0; i < t; i++) {
+                s[i] = sbox(s[i] + constants.full_round_constants[r][i]);
+            }
+            s = multiply(external, s);
+        };
+
+        state = multiply(external, state);
+        for (std::size_t r = 0; r < Policy::half_full_rounds; r++) {
+            full_round(state, r);
+        }
+        for (std::size_t r = 0; r < Policy::part_rounds; r++) {
+            state[0] = sbox(state[0] + constants.part_round_constants[r]);
+            state = multiply(internal, state);
+        }
+        for (std::size_t r = Policy::half_full_rounds; r < Policy::full_rounds; r++) {
+            full_round(state, r);
+        }
+        return state;
+    }
+
+    /// Polynomials over the field, coefficients from the lowest degree.
+    template<typename ElementType>
+    using polynomial_type = std::vector<ElementType>;
+
+    template<typename ElementType>
+    void normalize(polynomial_type<ElementType> &a) {
+        while (a.size() > 1 && a.back().is_zero()) {
+            a.pop_back();
+        }
+        if (a.empty()) {
+            a.push_back(ElementType::zero());
+        }
+    }
+
+    template<typename ElementType>
+    polynomial_type<ElementType> remainder(polynomial_type<ElementType> a, const polynomial_type<ElementType> &f) {
+        normalize(a);
+        const ElementType leading_inversed = f.back().inversed();
+        while (a.size() >= f.size() && !(a.size() == 1 && a[0].is_zero())) {
+            const ElementType factor = a.back() * leading_inversed;
+            const std::size_t shift = a.size() - f.size();
+            for (std::size_t i = 0; i < f.size(); i++) {
+                a[shift + i] -= factor * f[i];
+            }
+            a.pop_back();
+            normalize(a);
+        }
+        return a;
+    }
+
+    template<typename ElementType>
+    polynomial_type<ElementType> multiply_mod(const polynomial_type<ElementType> &a,
+                                              const polynomial_type<ElementType> &b,
+                                              const polynomial_type<ElementType> &f) {
+        polynomial_type<ElementType> product(a.size() + b.size() - 1, ElementType::zero());
+        for (std::size_t i = 0; i < a.size(); i++) {
+            for (std::size_t j = 0; j < b.size(); j++) {
+                product[i + j] += a[i] * b[j];
+            }
+        }
+        return remainder(product, f);
+    }
+
+    /// h^p mod f for the field characteristic p.
+    template<typename FieldType>
+    polynomial_type<typename FieldType::value_type> frobenius(const polynomial_type<typename FieldType::value_type> &h,
+                                                              const polynomial_type<typename FieldType::value_type> &f) {
+        polynomial_type<typename FieldType::value_type> result = {FieldType::value_type::one()}, base = h;
+        for (std::uint64_t e = static_cast<std::uint64_t>(FieldType::modulus); e != 0; e >>= 1) {
+            if (e & 1) {
+                result = multiply_mod(result, base, f);
+            }
+            base = multiply_mod(base, base, f);
+        }
+        return result;
+    }
+
+    template<typename ElementType>
+    std::size_t gcd_degree(polynomial_type<ElementType> a, polynomial_type<ElementType> b) {
+        normalize(b);
+        while (!(b.size() == 1 && b[0].is_zero())) {
+            polynomial_type<ElementType> r = remainder(a, b);
+            a = std::move(b);
+            b = std::move(r);
+        }
+        return a.size() - 1;
+    }
+
+    /*!
+     * The internal matrix D + 1 of Poseidon2 must have an irreducible minimal polynomial and no invariant
+     * subspaces, https://eprint.iacr.org/2023/323, section 5.3. Both hold if its characteristic polynomial
+     * prod(x - d[i]) - sum_i prod_{j != i}(x - d[j]) is irreducible, which is checked by Rabin's test:
+     * x^(p^t) = x mod f, and gcd(x^(p^(t/q)) - x, f) = 1 for the prime divisors q of t.
+     */
+    template<typename Policy>
+    bool internal_matrix_is_secure() {
+        typedef typename Policy::field_type field_type;
+        typedef typename Policy::word_type element_type;
+        constexpr std::size_t t = Policy::state_words;
+        const auto &diagonal = poseidon2_constants<Policy>::instance().internal_diagonal;
+
+        polynomial_type<element_type> f(t + 1, element_type::zero());
+        for (std::size_t skipped = 0; skipped <= t; skipped++) {
+            polynomial_type<element_type> product = {element_type::one()};
+            for (std::size_t j = 0; j < t; j++) {
+                if (j == skipped) {
+                    continue;
+                }
+                polynomial_type<element_type> next(product.size() + 1, element_type::zero());
+                for (std::size_t k = 0; k < product.size(); k++) {
+                    next[k + 1] += product[k];
+                    next[k] -= diagonal[j] * product[k];
+                }
+                product = std::move(next);
+            }
+            for (std::size_t k = 0; k < product.size(); k++) {
+                // The full product with skipped == t, minus the products without one factor.
+                f[k] += skipped == t ? product[k] : -product[k];
+            }
+        }
+
+        const polynomial_type<element_type> x = {element_type::zero(), element_type::one()};
+        std::vector<polynomial_type<element_type>> powers = {x};
+        for (std::size_t k = 1; k <= t; k++) {
+            powers.push_back(frobenius<field_type>(powers.back(), f));
+        }
+        auto minus_x = [](polynomial_type<element_type> h) {
+            h.resize(std::max<std::size_t>(h.size(), 2), element_type::zero());
+            h[1] -= element_type::one();
+            normalize(h);
+            return h;
+        };
+        if (!(minus_x(powers[t]).size() == 1 && minus_x(powers[t])[0].is_zero())) {
+            return false;
+        }
+        for (std::size_t q = 2; q <= t; q++) {
+            bool is_prime_divisor = t % q == 0;
+            for (std::size_t r = 2; r * r <= q && is_prime_divisor; r++) {
+                is_prime_divisor = q % r != 0;
+            }
+            if (is_prime_divisor && gcd_degree(f, minus_x(powers[t / q])) != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Permutation of [0, 1, ..., t - 1] against a known answer.
+    template<typename Policy>
+    void test_known_answer(const std::array<std::uint64_t, Policy::state_words> &expected) {
+        typedef typename Policy::word_type element_type;
+        typename Policy::state_type state;
+        for (std::size_t i = 0; i < Policy::state_words; i++) {
+            state[i] = element_type(i);
+        }
+        poseidon2_permutation<Policy>::permute(state);
+        for (std::size_t i = 0; i < Policy::state_words; i++) {
+            BOOST_CHECK(state[i] == element_type(expected[i]));
+        }
+    }
+
+    template<typename Policy>
+    typename Policy::state_type random_state() {
+        typename Policy::state_type state;
+        for (auto &word : state) {
+            word = algebra::random_element<typename Policy::field_type>();
+        }
+        return state;
+    }
+
+    template<typename Policy>
+    void test_permutation() {
+        typedef poseidon2_permutation<Policy> permutation_type;
+        typedef typename Policy::state_type state_type;
+
+        state_type state = random_state<Policy>();
+        state_type expected = reference_permutation<Policy>(state);
+        permutation_type::permute(state);
+        BOOST_CHECK(state == expected);
+
+        // Several full batches and a partial one.
+        const std::size_t count = 2 * permutation_type::batch_lanes + 3;
+        std::vector<state_type> states(count);
+        for (auto &s : states) {
+            s = random_state<Policy>();
+        }
+        std::vector<state_type> single = states;
+        for (auto &s : single) {
+            permutation_type::permute(s);
+        }
+        permutation_type::permute_batch(states.data(), count);
+        BOOST_CHECK(states == single);
+    }
+
+    template<typename Policy>
+    void test_sponge() {
+        typedef hashes::poseidon2<Policy> hash_type;
+        typedef typename Policy::word_type element_type;
+        typedef typename hash_type::digest_type digest_type;
+        typedef poseidon2_sponge_construction<Policy> sponge_type;
+
+        static_assert(hashes::is_poseidon2<hash_type>::value);
+        static_assert(hashes::uses_sponge_construction<hash_type>::value);
+
+        std::set<std::vector<element_type>> messages_seen;
+        std::vector<digest_type> digests;
+        // Lengths around the block boundaries, with and without a trailing zero.
+        for (std::size_t words : {std::size_t(0), std::size_t(1), Policy::block_words - 1, Policy::block_words,
+                                  Policy::block_words + 1, 2 * Policy::digest_words, 2 * Policy::block_words}) {
+            std::vector<element_type> message(words);
+            for (auto &word : message) {
+                word = algebra::random_element<typename Policy::field_type>();
+            }
+            std::vector<std::vector<element_type>> variants = {message, message};
+            variants[1].push_back(element_type::zero());
+
+            for (const auto &variant : variants) {
+                if (!messages_seen.insert(variant).second) {
+                    continue;
+                }
+                digest_type digest = hash<hash_type>(variant);
+
+                // The same message in lanes.
+                std::vector<digest_type> batch(sponge_type::permutation_type::batch_lanes + 1);
+                std::vector<const element_type *> pointers(batch.size(), variant.data());
+                sponge_type::hash_batch(pointers.data(), variant.size(), batch.size(), batch.data());
+                for (const auto &d : batch) {
+                    BOOST_CHECK(d == digest);
+                }
+                digests.push_back(digest);
+            }
+        }
+
+        // The padding tells apart the messages which differ in trailing zeros only.
+        std::set<digest_type> distinct(digests.begin(), digests.end());
+        BOOST_CHECK_EQUAL(distinct.size(), digests.size());
+    }
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(poseidon2_tests)
+
+BOOST_AUTO_TEST_CASE(poseidon2_babybear) {
+    test_permutation<poseidon2_policy<algebra::fields::babybear, 16>>();
+    test_permutation<poseidon2_policy<algebra::fields::babybear, 24>>();
+    test_sponge<poseidon2_policy<algebra::fields::babybear, 16>>();
+    test_sponge<poseidon2_policy<algebra::fields::babybear, 24>>();
+}
+
+BOOST_AUTO_TEST_CASE(poseidon2_koalabear) {
+    test_permutation<poseidon2_policy<algebra::fields::koalabear, 16>>();
+    test_permutation<poseidon2_policy<algebra::fields::koalabear, 24>>();
+    test_sponge<poseidon2_policy<algebra::fields::koalabear, 16>>();
+    test_sponge<poseidon2_policy<algebra::fields::koalabear, 24>>();
+}
+
+BOOST_AUTO_TEST_CASE(poseidon2_mersenne31) {
+    test_permutation<poseidon2_policy<algebra::fields::mersenne31, 16>>();
+    test_permutation<poseidon2_policy<algebra::fields::mersenne31, 24>>();
+    test_sponge<poseidon2_policy<algebra::fields::mersenne31, 16>>();
+    test_sponge<poseidon2_policy<algebra::fields::mersenne31, 24>>();
+}
+
+BOOST_AUTO_TEST_CASE(poseidon2_goldilocks) {
+    test_permutation<poseidon2_policy<algebra::fields::goldilocks, 8>>();
+    test_permutation<poseidon2_policy<algebra::fields::goldilocks, 12>>();
+    test_permutation<poseidon2_policy<algebra::fields::goldilocks, 16>>();
+    test_sponge<poseidon2_policy<algebra::fields::goldilocks, 8>>();
+    test_sponge<poseidon2_policy<algebra::fields::goldilocks, 12>>();
+    test_sponge<poseidon2_policy<algebra::fields::goldilocks, 16>>();
+}
+
+BOOST_AUTO_TEST_CASE(poseidon2_goldilocks_internal_matrix) {
+    BOOST_CHECK((internal_matrix_is_secure<poseidon2_policy<algebra::fields::goldilocks, 8>>()));
+    BOOST_CHECK((internal_matrix_is_secure<poseidon2_policy<algebra::fields::goldilocks, 12>>()));
+    BOOST_CHECK((internal_matrix_is_secure<poseidon2_policy<algebra::fields::goldilocks, 16>>()));
+}
+
+// Test vectors of https://github.com/HorizenLabs/poseidon2 for the input [0, 1, ..., t - 1].
+BOOST_AUTO_TEST_CASE(poseidon2_goldilocks_known_answer) {
+    test_known_answer<poseidon2_policy<algebra::fields::goldilocks, 8>>(
+        {0xc5fb1cfe0b4697bb, 0x4a4a32ff849af473, 0xd2fd266077f8efba, 0xf4ad9b74e833916d, 0xe6648eb0acc11463,
+         0x8d5529a930d75194, 0xe8c993aa10da6c90, 0xa73104a95b68031c});
+    test_known_answer<poseidon2_policy<algebra::fields::goldilocks, 12>>(
+        {0x01eaef96bdf1c0c1, 0x1f0d2cc525b2540c, 0x6282c1dfe1e0358d, 0xe780d721f698e1e6, 0x280c0b6f753d833b,
+         0x1b942dd5023156ab, 0x43f0df3fcccb8398, 0xe8e8190585489025, 0x56bdbf72f77ada22, 0x7911c32bf9dcd705,
+         0xec467926508fbe67, 0x6a50450ddf85a6ed});
+    test_known_answer<poseidon2_policy<algebra::fields::goldilocks, 16>>(
+        {0x85c54702470d9756, 0xaa53c7a7d52d9898, 0x285128096efb0dd7, 0xf3fde5edd3050ac8, 0xc7b65efd040df908,
+         0x4be3f6c467f57ae9, 0x274e9a67b41754fb, 0x0f7d39cd5de94dac, 0xd0224b9794d0b78c, 0x372f6139570042e1,
+         0xce6e8a93dc4ec26c, 0xace65e30a4daf7af, 0x016f2824cc1ba3db, 0x2e8f3af37c434dec, 0xc80831bb6e09da01,
+         0x3a7d670bf1a86ee8});
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -106,6 +106,36 @@ BOOST_DATA_TEST_CASE(sha3_512_range_hash, string_data("data_512"), array_element
 
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(sha3_keccak_backends_test_suite)
+
+// The same vectors with every Keccak-f[1600] backend the CPU supports.
+template<std::size_t Size>
+void check_vectors(const char *child_name) {
+    for (const auto &element : string_data(child_name)) {
+        std::string out = hash<hashes::sha3<Size>>(element.first);
+        BOOST_CHECK_EQUAL(out, element.second.data());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sha3_keccak_backends) {
+    using hashes::detail::keccak_1600_backend;
+    for (auto backend : {keccak_1600_backend::portable, keccak_1600_backend::x86_64, keccak_1600_backend::avx2,
+                         keccak_1600_backend::avx512}) {
+        if (!hashes::detail::set_keccak_1600_backend(backend)) {
+            continue;
+        }
+        BOOST_TEST_CONTEXT("backend " << static_cast<int>(backend)) {
+            check_vectors<224>("data_224");
+            check_vectors<256>("data_256");
+            check_vectors<384>("data_384");
+            check_vectors<512>("data_512");
+        }
+    }
+    hashes::detail::set_keccak_1600_backend(hashes::detail::keccak_1600_best_backend());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE(sha3_stream_processor_test_suite)
 
 BOOST_AUTO_TEST_CASE(sha3_224_shortmsg_bit1) {
@@ -158,6 +158,25 @@ namespace nil::crypto3 {
             constexpr static const bool value = !std::is_same<no, decltype(test<T>(nullptr))>::value;
         };
 
+        /// @brief Whether an iterator is a window over a stream which can give out its next n bytes
+        ///     in one piece of memory with contiguous_bytes(n), or nullptr when they don't fit.
+        ///     Fixed-length elements of array lists are read and written in runs through such pointers.
+        template<typename T>
+        class has_member_function_contiguous_bytes {
+            struct no { };
+
+        protected:
+            template<typename C>
+            static auto test(std::nullptr_t) -> decltype(std::declval<const C &>().contiguous_bytes(0U));
+
+            template<typename>
+            static no test(...);
+
+        public:
+            constexpr static const bool value =
+                std::is_pointer<decltype(test<T>(nullptr))>::value;
+        };
+
         template<typename T>
         class has_member_function_resize {
             struct no { };
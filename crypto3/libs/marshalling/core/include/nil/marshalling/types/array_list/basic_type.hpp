@@ -215,6 +215,9 @@ namespace nil::crypto3 {
 
                     template<typename TIter>
                     status_type write(TIter &iter, std::size_t len) const {
+                        if constexpr (has_contiguous_runs<TIter>()) {
+                            return write_runs(iter, len);
+                        }
                         return common_funcs::write_sequence(*this, iter, len);
                     }
 
@@ -462,6 +465,11 @@ namespace nil::crypto3 {
                         static_assert(has_member_function_clear<value_type>::value,
                                       "The used storage type for basic_array_list must have clear() member function");
                         value_.clear();
+                        if constexpr (has_contiguous_runs<TIter>()) {
+                            if (len % element_type().length() == 0) {
+                                return read_runs(len / element_type().length(), iter, len);
+                            }
+                        }
                         auto remLen = len;
                         while (0 < remLen) {
                             element_type &elem = create_back();
@@ -499,6 +507,9 @@ namespace nil::crypto3 {
                     template<typename TIter>
                     status_type read_internal_n(std::size_t count, TIter &iter, std::size_t len, field_elem_tag) {
                         clear();
+                        if constexpr (has_contiguous_runs<TIter>()) {
+                            return read_runs(count, iter, len);
+                        }
                         while (0 < count) {
                             auto &elem = create_back();
                             status_type es = read_element(elem, iter, len);
@@ -536,6 +547,89 @@ namespace nil::crypto3 {
                         read_internal(iter, count, raw_data_tag());
                     }
 
+                    /// Fixed-length elements go in runs through plain pointers into the window of an iterator over
+                    /// a stream, instead of through the iterator byte by byte.
+                    static constexpr std::size_t contiguous_run_length = 1 << 16;
+
+                    template<typename TIter>
+                    static constexpr bool has_contiguous_runs() {
+                        return has_member_function_contiguous_bytes<TIter>::value &&
+                               std::is_same<elem_tag, field_elem_tag>::value &&
+                               std::is_same<field_length_tag, fixed_length_tag>::value;
+                    }
+
+                    static std::size_t run_elements(std::size_t count, std::size_t len) {
+                        const std::size_t elem_length = element_type().length();
+                        return std::min({count, std::max<std::size_t>(1, contiguous_run_length / elem_length),
+                                         len / elem_length});
+                    }
+
+                    /// Halves the run until its bytes fit into the window of the iterator, nullptr if not even
+                    /// a single element does.
+                    template<typename TIter>
+                    static auto contiguous_run(TIter &iter, std::size_t &run) {
+                        decltype(iter.contiguous_bytes(0U)) bytes = nullptr;
+                        while (0 < run && (bytes = iter.contiguous_bytes(run * element_type().length())) == nullptr) {
+                            run /= 2;
+                        }
+                        return bytes;
+                    }
+
+                    template<typename TIter>
+                    status_type write_runs(TIter &iter, std::size_t len) const {
+                        status_type es = status_type::success;
+                        auto elem = value_.begin();
+                        while (elem != value_.end() && es == status_type::success) {
+                            std::size_t run =
+                                run_elements(static_cast<std::size_t>(std::distance(elem, value_.end())), len);
+                            auto bytes = contiguous_run(iter, run);
+                            if (bytes == nullptr) {
+                                es = write_element(*elem, iter, len);
+                                ++elem;
+                                continue;
+                            }
+                            auto run_iter = bytes;
+                            for (std::size_t i = 0; i < run && es == status_type::success; ++i, ++elem) {
+                                es = write_element(*elem, run_iter, len);
+                            }
+                            std::advance(iter, run_iter - bytes);
+                        }
+                        return es;
+                    }
+
+                    template<typename TIter>
+                    status_type read_runs(std::size_t count, TIter &iter, std::size_t len) {
+                        if constexpr (has_member_function_reserve<value_type>::value) {
+                            value_.reserve(value_.size() + count);
+                        }
+                        while (0 < count) {
+                            std::size_t run = run_elements(count, len);
+                            auto bytes = contiguous_run(iter, run);
+                            if (bytes == nullptr) {
+                                auto &elem = create_back();
+                                status_type es = read_element(elem, iter, len);
+                                if (es != status_type::success) {
+                                    value_.pop_back();
+                                    return es;
+                                }
+                                --count;
+                                continue;
+                            }
+                            auto run_iter = bytes;
+                            for (std::size_t i = 0; i < run; ++i) {
+                                auto &elem = create_back();
+                                status_type es = read_element(elem, run_iter, len);
+                                if (es != status_type::success) {
+                                    value_.pop_back();
+                                    return es;
+                                }
+                            }
+                            std::advance(iter, run_iter - bytes);
+                            count -= run;
+                        }
+                        return status_type::success;
+                    }
+
                     value_type value_;
                 };
             }        // namespace detail
@@ -0,0 +1,84 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MATH_BATCH_INVERSE_HPP
+#define CRYPTO3_MATH_BATCH_INVERSE_HPP
+
+#include <span>
+#include <vector>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /*!
+             * @brief Replaces every element with its inverse using Montgomery's trick, it costs one field inversion
+             * and 3(n - 1) multiplications. All the elements must be non-zero.
+             */
+            template<typename FieldValueType>
+            void batch_inverse(std::span<FieldValueType> values) {
+                if (values.empty()) {
+                    return;
+                }
+
+                // prefix[i] is the product of values[0..i].
+                std::vector<FieldValueType> prefix(values.size());
+                prefix[0] = values[0];
+                for (std::size_t i = 1; i < values.size(); ++i) {
+                    prefix[i] = prefix[i - 1] * values[i];
+                }
+
+                // inv is the inverse of the product of values[0..i].
+                FieldValueType inv = prefix.back().inversed();
+                for (std::size_t i = values.size() - 1; i > 0; --i) {
+                    const FieldValueType value_inv = inv * prefix[i - 1];
+                    inv *= values[i];
+                    values[i] = value_inv;
+                }
+                values[0] = inv;
+            }
+
+            /*!
+             * @brief Same as batch_inverse, but every chunk is inverted by its own thread, so it costs one field
+             * inversion per chunk.
+             */
+            template<typename FieldValueType>
+            void parallel_batch_inverse(std::span<FieldValueType> values,
+                                        ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
+                wait_for_all(parallel_run_in_chunks<void>(
+                    values.size(),
+                    [values](std::size_t begin, std::size_t end) {
+                        batch_inverse(values.subspan(begin, end - begin));
+                    },
+                    pool_id));
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_BATCH_INVERSE_HPP
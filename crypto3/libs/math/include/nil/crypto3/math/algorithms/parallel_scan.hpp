@@ -0,0 +1,122 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MATH_PARALLEL_SCAN_HPP
+#define CRYPTO3_MATH_PARALLEL_SCAN_HPP
+
+#include <functional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /*!
+             * @brief Inclusive scan of generated values, values[i] becomes transform(0) op ... op transform(i). The
+             * operation must be associative, transform(i) may read values[i] but no other element of values.
+             *
+             * Runs in two passes over the same chunks: first every chunk is scanned on its own, then every chunk
+             * but the first is combined with the total of the chunks before it. Only the totals of the chunks are
+             * combined serially, so there is no serial pass over the values.
+             */
+            template<typename ValueType, typename BinaryOperation, typename UnaryOperation>
+            void parallel_transform_inclusive_scan(std::span<ValueType> values, BinaryOperation op,
+                                                   UnaryOperation transform,
+                                                   ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
+                if (values.empty()) {
+                    return;
+                }
+
+                std::vector<std::pair<std::size_t, std::size_t>> chunks;
+                for (auto& f : parallel_run_in_chunks<std::pair<std::size_t, std::size_t>>(
+                         values.size(),
+                         [values, op, transform](std::size_t begin, std::size_t end) {
+                             values[begin] = transform(begin);
+                             for (std::size_t i = begin + 1; i < end; ++i) {
+                                 values[i] = op(values[i - 1], transform(i));
+                             }
+                             return std::make_pair(begin, end);
+                         },
+                         pool_id)) {
+                    chunks.push_back(f.get());
+                }
+
+                if (chunks.size() == 1) {
+                    return;
+                }
+
+                // carries[k] is the total of all the chunks before chunk k.
+                std::vector<ValueType> carries(chunks.size());
+                carries[1] = values[chunks[0].second - 1];
+                for (std::size_t k = 2; k < chunks.size(); ++k) {
+                    carries[k] = op(carries[k - 1], values[chunks[k - 1].second - 1]);
+                }
+
+                // The same elements count and pool give the same chunks, chunk k is run with thread_id k.
+                wait_for_all(parallel_run_in_chunks_with_thread_id<void>(
+                    values.size(),
+                    [values, op, &chunks, &carries](std::size_t k, std::size_t begin, std::size_t end) {
+                        BOOST_ASSERT(chunks[k].first == begin && chunks[k].second == end);
+                        if (k == 0) {
+                            return;
+                        }
+                        for (std::size_t i = begin; i < end; ++i) {
+                            values[i] = op(carries[k], values[i]);
+                        }
+                    },
+                    pool_id));
+            }
+
+            /*!
+             * @brief In-place inclusive scan, values[i] becomes values[0] op ... op values[i]. The operation must be
+             * associative.
+             */
+            template<typename ValueType, typename BinaryOperation>
+            void parallel_inclusive_scan(std::span<ValueType> values, BinaryOperation op,
+                                         ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
+                parallel_transform_inclusive_scan(
+                    values, op, [values](std::size_t i) { return values[i]; }, pool_id);
+            }
+
+            /*!
+             * @brief In-place prefix products, values[i] becomes values[0] * ... * values[i].
+             */
+            template<typename FieldValueType>
+            void parallel_prefix_product(std::span<FieldValueType> values,
+                                         ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
+                parallel_inclusive_scan(values, std::multiplies<FieldValueType>(), pool_id);
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_PARALLEL_SCAN_HPP
@@ -32,6 +32,7 @@
 
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/domains/detail/basic_radix2_domain_aux.hpp>
+#include <nil/crypto3/math/domains/detail/batched_radix2_fft.hpp>
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/actor/core/parallelization_utils.hpp>
@@ -51,14 +52,23 @@ namespace nil {
             class basic_radix2_domain : public evaluation_domain<FieldType, ValueType> {
                 typedef typename FieldType::value_type field_value_type;
                 typedef ValueType value_type;
-                typedef std::pair<std::vector<field_value_type>, std::vector<field_value_type>> cache_type;
+                typedef typename detail::twiddle_registry<FieldType>::view twiddle_view;
+                typedef std::pair<twiddle_view, twiddle_view> cache_type;
                 std::shared_ptr<cache_type> fft_cache;
 
+                static std::vector<std::vector<value_type> *> batch_lanes(std::vector<std::vector<value_type>> &polys) {
+                    std::vector<std::vector<value_type> *> lanes;
+                    lanes.reserve(polys.size());
+                    for (auto &p : polys) {
+                        lanes.push_back(&p);
+                    }
+                    return lanes;
+                }
+
                 void create_fft_cache() {
-                    fft_cache = std::make_shared<cache_type>(std::vector<field_value_type>(),
-                                                             std::vector<field_value_type>());
-                    detail::create_fft_cache<FieldType>(this->m, omega, fft_cache->first);
-                    detail::create_fft_cache<FieldType>(this->m, omega.inversed(), fft_cache->second);
+                    const std::size_t logm = static_cast<std::size_t>(std::ceil(std::log2(this->m)));
+                    auto &registry = detail::twiddle_registry<FieldType>::instance();
+                    fft_cache = std::make_shared<cache_type>(registry.roots(logm), registry.roots(logm, true));
                 }
 
             public:
@@ -93,7 +103,7 @@ namespace nil {
                         }
                     }
 
-                    detail::basic_radix2_fft_cached<FieldType>(a, fft_cache->first);
+                    detail::radix2_fft_cached<FieldType>(a, fft_cache->first, this->algorithm);
                 }
 
                 void resize_to_domain_size(std::vector<std::vector<value_type>> &a) {
@@ -125,9 +135,13 @@ namespace nil {
                         return;
                     resize_to_domain_size(polys);
 
+                    if (this->algorithm == fft_algorithm::cache_blocked) {
+                        detail::batched_radix2_fft_cached<FieldType>(batch_lanes(polys), fft_cache->first);
+                        return;
+                    }
                     nil::crypto3::parallel_foreach(polys.begin(), polys.end(),
                         [this](std::vector<value_type>& p) {
-                            detail::basic_radix2_fft_cached<FieldType>(p, this->fft_cache->first);
+                            detail::radix2_fft_cached<FieldType>(p, this->fft_cache->first, this->algorithm);
                     }, ThreadPool::PoolLevel::HIGH);
                 }
 
@@ -142,9 +156,19 @@ namespace nil {
                     resize_to_domain_size(polys);
 
                     const field_value_type sconst = field_value_type(this->m).inversed();
+                    if (this->algorithm == fft_algorithm::cache_blocked) {
+                        detail::batched_radix2_fft_cached<FieldType>(batch_lanes(polys), fft_cache->second);
+                        nil::crypto3::parallel_foreach(polys.begin(), polys.end(),
+                            [&sconst](std::vector<value_type>& p) {
+                                nil::crypto3::parallel_foreach(p.begin(), p.end(), [&sconst](value_type& p_i) {
+                                    p_i *= sconst;
+                                });
+                        }, ThreadPool::PoolLevel::HIGH);
+                        return;
+                    }
                     nil::crypto3::parallel_foreach(polys.begin(), polys.end(),
                         [&sconst, this](std::vector<value_type>& p) {
-                            detail::basic_radix2_fft_cached<FieldType>(p, this->fft_cache->second);
+                            detail::radix2_fft_cached<FieldType>(p, this->fft_cache->second, this->algorithm);
                             nil::crypto3::parallel_foreach(p.begin(), p.end(), [&sconst](value_type& p_i) {
                                 p_i *= sconst;
                             });
@@ -160,7 +184,7 @@ namespace nil {
                         }
                     }
 
-                    detail::basic_radix2_fft_cached<FieldType>(a, fft_cache->second);
+                    detail::radix2_fft_cached<FieldType>(a, fft_cache->second, this->algorithm);
 
                     const field_value_type sconst = field_value_type(this->m).inversed();
                     nil::crypto3::parallel_foreach(a.begin(), a.end(), [&sconst](value_type& a_i){
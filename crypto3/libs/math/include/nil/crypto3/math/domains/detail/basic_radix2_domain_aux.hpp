@@ -35,6 +35,8 @@
 
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
 #include <nil/crypto3/math/detail/field_utils.hpp>
+#include <nil/crypto3/math/domains/detail/blocked_radix2_fft.hpp>
+#include <nil/crypto3/math/domains/detail/twiddle_registry.hpp>
 
 #include <nil/actor/core/thread_pool.hpp>
 #include <nil/actor/core/parallelization_utils.hpp>
@@ -44,34 +46,27 @@
 namespace nil {
     namespace crypto3 {
         namespace math {
-            namespace detail {
 
-                /*
-                 * Building caches for fft operations
-                */
-                template<typename FieldType>
-                void create_fft_cache(
-                        const std::size_t size,
-                        const typename FieldType::value_type &omega,
-                        std::vector<typename FieldType::value_type> &cache) {
-                    typedef typename FieldType::value_type value_type;
-                    cache.resize(size, FieldType::value_type::zero());
-                    wait_for_all(parallel_run_in_chunks<void>(
-                        size,
-                        [&cache, &omega](std::size_t begin, std::size_t end) {
-                            cache[begin] = omega.pow(begin);
-                            for (std::size_t i = begin + 1; i < end; ++i) {
-                                cache[i] = cache[i - 1] * omega;
-                            }
-                        }, ThreadPool::PoolLevel::LOW));
-                }
+            /**
+             * Implementation of the radix-2 FFT used by evaluation domains.
+             */
+            enum class fft_algorithm {
+                // Bit reversal followed by log(n) barrier-separated passes over the whole array.
+                radix2,
+                // Cache-blocked radix-4 passes, see detail/blocked_radix2_fft.hpp.
+                cache_blocked
+            };
+
+            namespace detail {
 
                 /*
                  * Below we make use of pseudocode from [CLRS 2n Ed, pp. 864].
                  * Also, note that it's the caller's responsibility to multiply by 1/N.
+                 * omega_cache[i * twiddle_stride] must be omega^i.
                  */
                 template<typename FieldType, typename Range>
-                void basic_radix2_fft_cached(Range &a, const std::vector<typename FieldType::value_type> &omega_cache) {
+                void basic_radix2_fft_cached(Range &a, const std::vector<typename FieldType::value_type> &omega_cache,
+                                             std::size_t twiddle_stride = 1) {
                     typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
                         value_type;
                     BOOST_STATIC_ASSERT(algebra::is_field<FieldType>::value);
@@ -95,7 +90,7 @@ namespace nil {
                     );
 
                     // invariant: m = 2^{s-1}
-                    for (std::size_t s = 1, m = 1, inc = n / 2; s <= logn; ++s, m <<= 1, inc >>= 1) {
+                    for (std::size_t s = 1, m = 1, inc = n / 2 * twiddle_stride; s <= logn; ++s, m <<= 1, inc >>= 1) {
                         // w_m is 2^s-th root of unity now
                         size_t count_k = n / (2 * m) + (n % (2 * m) ? 1 : 0);
 
@@ -130,20 +125,60 @@ namespace nil {
                     }
                 }
 
+                /**
+                 * Runs the FFT with the given algorithm, see basic_radix2_fft_cached for the contract.
+                 */
+                template<typename FieldType, typename Range>
+                void radix2_fft_cached(Range &a, const std::vector<typename FieldType::value_type> &omega_cache,
+                                       fft_algorithm algorithm = fft_algorithm::cache_blocked,
+                                       std::size_t twiddle_stride = 1) {
+                    switch (algorithm) {
+                        case fft_algorithm::radix2:
+                            basic_radix2_fft_cached<FieldType>(a, omega_cache, twiddle_stride);
+                            break;
+                        case fft_algorithm::cache_blocked:
+                            blocked_radix2_fft_cached<FieldType>(a, omega_cache, twiddle_stride);
+                            break;
+                        default:
+                            throw std::invalid_argument("Unknown fft algorithm.");
+                    }
+                }
+
+                template<typename FieldType, typename Range>
+                void radix2_fft_cached(Range &a, const typename twiddle_registry<FieldType>::view &twiddles,
+                                       fft_algorithm algorithm = fft_algorithm::cache_blocked) {
+                    radix2_fft_cached<FieldType>(a, *twiddles.table, algorithm, twiddles.stride);
+                }
+
                 /**
                  * Note that it's the caller's responsibility to multiply by 1/N.
                  */
                 template<typename FieldType, typename Range>
                 void basic_radix2_fft(
                     Range &a, const typename FieldType::value_type &omega,
-                    std::shared_ptr<std::vector<typename FieldType::value_type>> omega_cache = nullptr) {
+                    std::shared_ptr<std::vector<typename FieldType::value_type>> omega_cache = nullptr,
+                    fft_algorithm algorithm = fft_algorithm::cache_blocked) {
+
+                    typedef typename FieldType::value_type field_value_type;
 
                     if (omega_cache == nullptr) {
-                        std::vector<typename FieldType::value_type> omega_powers;
+                        const std::size_t n = a.size(), logn = log2(n);
+                        // The usual roots of unity and their inverses are served from the shared tables,
+                        // only a custom omega gets its own cache.
+                        if (n == (std::size_t(1) << logn) &&
+                            logn <= algebra::fields::arithmetic_params<FieldType>::two_adicity) {
+                            const field_value_type root = unity_root<FieldType>(n);
+                            if (omega == root || omega * root == field_value_type::one()) {
+                                radix2_fft_cached<FieldType>(
+                                    a, twiddle_registry<FieldType>::instance().roots(logn, omega != root), algorithm);
+                                return;
+                            }
+                        }
+                        std::vector<field_value_type> omega_powers;
                         create_fft_cache<FieldType>(a.size(), omega, omega_powers);
-                        basic_radix2_fft_cached<FieldType>(a, omega_powers);
+                        radix2_fft_cached<FieldType>(a, omega_powers, algorithm);
                     } else {
-                        basic_radix2_fft_cached<FieldType>(a, *omega_cache);
+                        radix2_fft_cached<FieldType>(a, *omega_cache, algorithm);
                     }
                 }
 
@@ -0,0 +1,275 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_BATCHED_RADIX2_FFT_HPP
+#define CRYPTO3_MATH_BATCHED_RADIX2_FFT_HPP
+
+#include <bit>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <nil/crypto3/math/detail/field_utils.hpp>
+#include <nil/crypto3/math/domains/detail/blocked_radix2_fft.hpp>
+#include <nil/crypto3/math/domains/detail/twiddle_registry.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+#include <nil/crypto3/bench/scoped_profiler.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace detail {
+
+                template<typename Range>
+                std::size_t batch_log_size(const std::vector<Range *> &lanes) {
+                    const std::size_t n = lanes[0]->size();
+                    if (!std::has_single_bit(n))
+                        throw std::invalid_argument("expected n == (1u << logn)");
+                    const std::size_t logn = std::bit_width(n) - 1;
+                    for (const auto &lane : lanes) {
+                        if (lane->size() != n)
+                            throw std::invalid_argument("All the arrays of a batched FFT must have the same size");
+                    }
+                    return logn;
+                }
+
+                /*
+                 * FFT of every array of 'lanes', all of the same size 2^logn, natural order input and output.
+                 * Unlike a loop over blocked_radix2_fft_cached, the stages of all the arrays are run by the same
+                 * parallel passes, and each tile of 4 arrays is transformed with the same twiddle loads.
+                 * It's the caller's responsibility to multiply by 1/N for the inverse transform.
+                 */
+                template<typename FieldType, typename Range>
+                void batched_radix2_fft_cached(const std::vector<Range *> &lanes,
+                                               const typename twiddle_registry<FieldType>::view &twiddles) {
+                    if (lanes.empty())
+                        return;
+                    const std::size_t logn = batch_log_size(lanes);
+                    if (twiddles.size < (std::size_t(1) << logn) / 2)
+                        throw std::invalid_argument("expected twiddles.size >= n / 2");
+
+                    parallel_foreach(lanes.begin(), lanes.end(), [logn](Range *lane) {
+                        bench::register_fft<FieldType>(logn);
+                        blocked_bitreverse_permutation(*lane, logn);
+                    }, ThreadPool::PoolLevel::HIGH);
+
+                    blocked_radix2_fft_stages<FieldType>(lanes, logn, 0, *twiddles.table, twiddles.stride);
+                }
+
+                /*
+                 * The first part of the low degree extension. 'a' holds 2^log_size coefficients in bit-reversed
+                 * order, coefficient i is multiplied by 'scale' * shift^i (shift_powers may be nullptr for
+                 * shift == 1), and the value at position r is then copied into the 2^log_blowup positions starting
+                 * at r * 2^log_blowup. This is exactly what the first log_blowup stages of the FFT of size
+                 * 2^(log_size + log_blowup) make out of the bit-reversed coefficients padded with zeros.
+                 */
+                template<typename FieldType, typename ValueType>
+                void lde_spread_coefficients(std::span<ValueType> a, const std::size_t log_size,
+                                             const std::size_t log_blowup,
+                                             const typename FieldType::value_type &scale,
+                                             const typename twiddle_registry<FieldType>::view *shift_powers) {
+                    typedef typename FieldType::value_type field_value_type;
+                    const std::size_t blowup = std::size_t(1) << log_blowup;
+
+                    auto spread = [&a, &scale, shift_powers, log_size, log_blowup, blowup](std::size_t r) {
+                        ValueType value = a[r];
+                        if (shift_powers != nullptr) {
+                            value *= field_value_type((*shift_powers)[bitreverse(r, log_size)] * scale);
+                        } else {
+                            value *= scale;
+                        }
+                        const std::size_t target = r << log_blowup;
+                        for (std::size_t t = 0; t < blowup; ++t) {
+                            a[target + t] = value;
+                        }
+                    };
+
+                    std::size_t hi = std::size_t(1) << log_size;
+                    if (log_blowup == 0) {
+                        wait_for_all(parallel_run_in_chunks<void>(
+                            hi,
+                            [&spread](std::size_t begin, std::size_t end) {
+                                for (std::size_t r = begin; r < end; ++r) {
+                                    spread(r);
+                                }
+                            }, ThreadPool::PoolLevel::LOW));
+                        return;
+                    }
+
+                    // Values from [hi / blowup, hi) go to [hi, hi * blowup), which does not intersect the values
+                    // not spread yet, so each round is parallel.
+                    while (hi >= blowup) {
+                        const std::size_t lo = hi >> log_blowup;
+                        wait_for_all(parallel_run_in_chunks<void>(
+                            hi - lo,
+                            [&spread, lo](std::size_t begin, std::size_t end) {
+                                for (std::size_t r = lo + begin; r < lo + end; ++r) {
+                                    spread(r);
+                                }
+                            }, ThreadPool::PoolLevel::LOW));
+                        hi = lo;
+                    }
+                    // The first few values overlap with their own targets, they are spread from the top.
+                    for (std::size_t r = hi; r-- > 0;) {
+                        spread(r);
+                    }
+                }
+
+                /*
+                 * Fused low degree extension of every array of 'lanes'. Each array has size 2^new_log_size, and its
+                 * first 2^log_size values are evaluations of a polynomial on the subgroup of size 2^log_size.
+                 * On return the arrays hold evaluations of the same polynomials on shift * <omega>, where omega is
+                 * the root of unity of order 2^new_log_size.
+                 *
+                 * It's the same as inverse FFT, multiplication by 1/N and by the powers of shift, padding with zeros
+                 * and FFT of the bigger size, but the padding is never materialized: the first
+                 * (new_log_size - log_size) stages of the bigger FFT, which only copy values around, are replaced
+                 * by lde_spread_coefficients, and no temporary arrays are allocated.
+                 */
+                template<typename FieldType, typename ValueType>
+                void batched_radix2_lde(std::vector<std::span<ValueType>> &lanes, const std::size_t log_size,
+                                        const std::size_t new_log_size,
+                                        const typename FieldType::value_type &shift =
+                                            FieldType::value_type::one()) {
+                    typedef typename FieldType::value_type field_value_type;
+
+                    if (lanes.empty())
+                        return;
+                    if (new_log_size < log_size)
+                        throw std::invalid_argument("Low degree extension to a smaller size requested");
+                    const std::size_t size = std::size_t(1) << log_size;
+                    for (const auto &lane : lanes) {
+                        if (lane.size() != (std::size_t(1) << new_log_size))
+                            throw std::invalid_argument("All the arrays of a batched LDE must have the new size");
+                    }
+
+                    auto &registry = twiddle_registry<FieldType>::instance();
+
+                    std::vector<std::span<ValueType>> prefixes;
+                    prefixes.reserve(lanes.size());
+                    for (auto &lane : lanes) {
+                        prefixes.push_back(lane.first(size));
+                    }
+                    std::vector<std::span<ValueType> *> prefix_lanes;
+                    prefix_lanes.reserve(prefixes.size());
+                    for (auto &prefix : prefixes) {
+                        prefix_lanes.push_back(&prefix);
+                    }
+                    batched_radix2_fft_cached<FieldType>(prefix_lanes, registry.roots(log_size, true));
+
+                    const field_value_type scale = field_value_type(size).inversed();
+                    std::optional<typename twiddle_registry<FieldType>::view> shift_powers;
+                    if (shift != field_value_type::one()) {
+                        shift_powers = registry.coset_powers(shift, log_size);
+                    }
+                    parallel_foreach(prefixes.begin(), prefixes.end(),
+                        [&lanes, &prefixes, &scale, &shift_powers, log_size, new_log_size](std::span<ValueType> &prefix) {
+                            blocked_bitreverse_permutation(prefix, log_size);
+                            auto &lane = lanes[&prefix - prefixes.data()];
+                            lde_spread_coefficients<FieldType>(lane, log_size, new_log_size - log_size, scale,
+                                                               shift_powers ? &*shift_powers : nullptr);
+                        }, ThreadPool::PoolLevel::HIGH);
+
+                    std::vector<std::span<ValueType> *> full_lanes;
+                    full_lanes.reserve(lanes.size());
+                    for (auto &lane : lanes) {
+                        bench::register_fft<FieldType>(new_log_size);
+                        full_lanes.push_back(&lane);
+                    }
+                    auto twiddles = registry.roots(new_log_size);
+                    blocked_radix2_fft_stages<FieldType>(full_lanes, new_log_size, new_log_size - log_size,
+                                                         *twiddles.table, twiddles.stride);
+                }
+
+                template<typename ValueType>
+                std::vector<std::span<ValueType>> slab_columns(std::span<ValueType> slab, const std::size_t rows) {
+                    if (rows == 0 || slab.size() % rows != 0)
+                        throw std::invalid_argument("Slab size must be a multiple of the number of rows");
+                    std::vector<std::span<ValueType>> columns;
+                    columns.reserve(slab.size() / rows);
+                    for (std::size_t offset = 0; offset < slab.size(); offset += rows) {
+                        columns.push_back(slab.subspan(offset, rows));
+                    }
+                    return columns;
+                }
+
+            }    // namespace detail
+
+            /**
+             * FFT of every column of a column-major slab: column i occupies slab[i * rows, (i + 1) * rows).
+             * 'rows' must be a power of two, the values are transformed on the subgroup of size 'rows'.
+             */
+            template<typename FieldType, typename ValueType>
+            void batch_fft(std::span<ValueType> slab, const std::size_t rows, const bool inverse = false) {
+                typedef typename FieldType::value_type field_value_type;
+                TAGGED_PROFILE_SCOPE("{low level} FFT", "Batched FFT of {} columns of size {}",
+                                     slab.size() / rows, rows);
+
+                if (!std::has_single_bit(rows))
+                    throw std::invalid_argument("expected rows == (1u << log_rows)");
+                auto columns = detail::slab_columns(slab, rows);
+                std::vector<std::span<ValueType> *> lanes;
+                lanes.reserve(columns.size());
+                for (auto &column : columns) {
+                    lanes.push_back(&column);
+                }
+                detail::batched_radix2_fft_cached<FieldType>(
+                    lanes, detail::twiddle_registry<FieldType>::instance().roots(std::bit_width(rows) - 1, inverse));
+
+                if (inverse) {
+                    const field_value_type sconst = field_value_type(rows).inversed();
+                    parallel_foreach(slab.begin(), slab.end(), [&sconst](ValueType &value) {
+                        value *= sconst;
+                    });
+                }
+            }
+
+            /**
+             * Low degree extension of every column of a column-major slab with 'new_rows' rows per column.
+             * The first 'rows' values of each column are evaluations on the subgroup of size 'rows', they are
+             * replaced by the evaluations on shift * <omega>, where omega is the root of unity of order 'new_rows'.
+             */
+            template<typename FieldType, typename ValueType>
+            void batch_lde(std::span<ValueType> slab, const std::size_t rows, const std::size_t new_rows,
+                           const typename FieldType::value_type &shift = FieldType::value_type::one()) {
+                TAGGED_PROFILE_SCOPE("{low level} FFT", "Batched LDE of {} columns from {} to {}",
+                                     slab.size() / new_rows, rows, new_rows);
+
+                if (!std::has_single_bit(rows) || !std::has_single_bit(new_rows))
+                    throw std::invalid_argument("expected rows and new_rows to be powers of two");
+                auto columns = detail::slab_columns(slab, new_rows);
+                detail::batched_radix2_lde<FieldType>(columns, std::bit_width(rows) - 1, std::bit_width(new_rows) - 1,
+                                                      shift);
+            }
+
+        }        // namespace math
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_BATCHED_RADIX2_FFT_HPP
@@ -0,0 +1,331 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_BLOCKED_RADIX2_FFT_HPP
+#define CRYPTO3_MATH_BLOCKED_RADIX2_FFT_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+#include <nil/crypto3/math/detail/field_utils.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+#include <nil/crypto3/bench/scoped_profiler.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace detail {
+
+                /*
+                 * Cache-blocked radix-2/radix-4 FFT.
+                 *
+                 * The stages of the usual iterative FFT are split into groups, so that all the butterflies of a group
+                 * touch only a small tile of the array. Each tile is loaded into the cache once per group instead of
+                 * once per stage, so an FFT of size 2^24 makes 1 + ceil(24 / tile_log) passes over the memory
+                 * instead of 25. Inside of a tile consecutive stages are merged pairwise into radix-4 butterflies.
+                 *
+                 * A tile of the group starting with the stage of half-span m0 consists of 'rows' rows, placed m0
+                 * elements apart, each of them being 'columns' consecutive elements long. For the first group m0 == 1
+                 * and the tile is just a contiguous block.
+                 */
+
+                // Number of bytes we want a tile to occupy, it should fit into L1/L2 caches together with twiddles.
+                constexpr std::size_t BLOCKED_FFT_TILE_BYTES = 1 << 16;
+                // Number of bytes of a single row of a tile, so each row covers at least 2 cache lines.
+                constexpr std::size_t BLOCKED_FFT_ROW_BYTES = 128;
+                // Number of arrays transformed together by the batched FFT.
+                constexpr std::size_t BLOCKED_FFT_LANES = 4;
+                // Bits of a side of a square tile for the bit-reversal permutation.
+                constexpr std::size_t BLOCKED_BITREVERSE_TILE_LOG = 4;
+
+                template<typename ValueType>
+                constexpr std::size_t blocked_fft_tile_log() {
+                    return std::max<std::size_t>(
+                        4, std::bit_width(std::max<std::size_t>(1, BLOCKED_FFT_TILE_BYTES / sizeof(ValueType))) - 1);
+                }
+
+                template<typename ValueType>
+                constexpr std::size_t blocked_fft_columns_log() {
+                    return std::bit_width(std::max<std::size_t>(1, BLOCKED_FFT_ROW_BYTES / sizeof(ValueType))) - 1;
+                }
+
+                /*
+                 * Bit-reversal permutation done in square tiles of 2^b x 2^b elements. Index is split as
+                 * [hi: b bits][mid][lo: b bits], its reverse is [rev(lo)][rev(mid)][rev(hi)], so a tile with a fixed
+                 * 'mid' is swapped with the tile of rev(mid) while reading and writing rows of 2^b consecutive elements.
+                 */
+                template<typename Range>
+                void blocked_bitreverse_permutation(Range &a, const std::size_t logn) {
+                    const std::size_t n = std::size_t(1) << logn;
+                    const std::size_t b = BLOCKED_BITREVERSE_TILE_LOG;
+
+                    if (logn < 2 * b) {
+                        for (std::size_t k = 0; k < n; ++k) {
+                            const std::size_t rk = bitreverse(k, logn);
+                            if (k < rk)
+                                std::swap(a[k], a[rk]);
+                        }
+                        return;
+                    }
+
+                    const std::size_t mid_log = logn - 2 * b;
+                    const std::size_t side = std::size_t(1) << b;
+
+                    std::vector<std::size_t> rev_side(side);
+                    for (std::size_t i = 0; i < side; ++i) {
+                        rev_side[i] = bitreverse(i, b);
+                    }
+
+                    // Every tile is 2^(2b) elements, so the tiles are big enough to load a core.
+                    wait_for_all(parallel_run_in_chunks<void>(
+                        std::size_t(1) << mid_log,
+                        [&a, &rev_side, logn, b, side, mid_log](std::size_t begin, std::size_t end) {
+                            for (std::size_t mid = begin; mid < end; ++mid) {
+                                const std::size_t rev_mid = bitreverse(mid, mid_log);
+                                if (rev_mid < mid)
+                                    continue;
+                                for (std::size_t hi = 0; hi < side; ++hi) {
+                                    const std::size_t x_base = (hi << (logn - b)) | (mid << b);
+                                    const std::size_t y_low = (rev_mid << b) | rev_side[hi];
+                                    for (std::size_t lo = 0; lo < side; ++lo) {
+                                        const std::size_t x = x_base | lo;
+                                        const std::size_t y = (rev_side[lo] << (logn - b)) | y_low;
+                                        // Tiles with mid != rev_mid are swapped entirely, a self-reversed tile
+                                        // must be swapped only once per pair.
+                                        if (rev_mid != mid || x < y)
+                                            std::swap(a[x], a[y]);
+                                    }
+                                }
+                            }
+                        }, ThreadPool::PoolLevel::HIGH));
+                }
+
+                /*
+                 * Runs 'stages' stages of the FFT over the tile with the given 'base' in each of the 'lanes_count'
+                 * arrays 'lanes'. The first stage has the half-span of m0 elements. 'twiddle_step' is n / (2 * m0)
+                 * times the stride of omega_cache, twiddle of the position p of the stage with half-span m is
+                 * omega_cache[p * stride * n / (2m)]. The twiddles are loaded once for all the lanes.
+                 * The number of lanes is a template parameter, so the loop over them is unrolled.
+                 */
+                template<std::size_t LanesCount, typename Range, typename FieldValueType>
+                void blocked_fft_tile(Range *const *lanes, const std::size_t base, const std::size_t m0,
+                                      const std::size_t columns, const std::size_t stages,
+                                      std::size_t twiddle_step, const std::vector<FieldValueType> &omega_cache) {
+                    typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
+                        value_type;
+
+                    const std::size_t j0 = base % m0;
+                    const std::size_t rows = std::size_t(1) << stages;
+                    value_type t, u;
+
+                    std::array<value_type *, LanesCount> data;
+                    for (std::size_t l = 0; l < LanesCount; ++l) {
+                        data[l] = std::data(*lanes[l]);
+                    }
+
+                    std::size_t s = 0;
+                    // Two stages at once: half-spans of h and 2h rows.
+                    for (; s + 1 < stages; s += 2, twiddle_step >>= 2) {
+                        const std::size_t h = std::size_t(1) << s;
+                        // Twiddle steps for the second stage of the pair, and the offset for its upper half.
+                        const std::size_t twiddle_step_2 = twiddle_step >> 1;
+                        const std::size_t upper_offset = (h * m0) * twiddle_step_2;
+                        for (std::size_t block = 0; block < rows; block += 4 * h) {
+                            for (std::size_t r = block; r < block + h; ++r) {
+                                const std::size_t i0 = base + r * m0;
+                                const std::size_t i1 = i0 + h * m0;
+                                const std::size_t i2 = i1 + h * m0;
+                                const std::size_t i3 = i2 + h * m0;
+                                const std::size_t p0 = (r - block) * m0 + j0;
+                                for (std::size_t c = 0; c < columns; ++c) {
+                                    const std::size_t p = p0 + c;
+                                    const FieldValueType &w1 = omega_cache[p * twiddle_step];
+                                    const FieldValueType &w2 = omega_cache[p * twiddle_step_2];
+                                    const FieldValueType &w3 = omega_cache[p * twiddle_step_2 + upper_offset];
+
+                                    for (std::size_t l = 0; l < LanesCount; ++l) {
+                                        value_type *a = data[l];
+
+                                        t = a[i1 + c];
+                                        t *= w1;
+                                        a[i1 + c] = a[i0 + c];
+                                        a[i1 + c] -= t;
+                                        a[i0 + c] += t;
+
+                                        u = a[i3 + c];
+                                        u *= w1;
+                                        a[i3 + c] = a[i2 + c];
+                                        a[i3 + c] -= u;
+                                        a[i2 + c] += u;
+
+                                        t = a[i2 + c];
+                                        t *= w2;
+                                        a[i2 + c] = a[i0 + c];
+                                        a[i2 + c] -= t;
+                                        a[i0 + c] += t;
+
+                                        u = a[i3 + c];
+                                        u *= w3;
+                                        a[i3 + c] = a[i1 + c];
+                                        a[i3 + c] -= u;
+                                        a[i1 + c] += u;
+                                    }
+                                }
+                            }
+                        }
+                    }
+
+                    // The last radix-2 stage, if the number of stages is odd.
+                    if (s < stages) {
+                        const std::size_t h = std::size_t(1) << s;
+                        for (std::size_t block = 0; block < rows; block += 2 * h) {
+                            for (std::size_t r = block; r < block + h; ++r) {
+                                const std::size_t i0 = base + r * m0;
+                                const std::size_t i1 = i0 + h * m0;
+                                const std::size_t p0 = (r - block) * m0 + j0;
+                                for (std::size_t c = 0; c < columns; ++c) {
+                                    const FieldValueType &w = omega_cache[(p0 + c) * twiddle_step];
+                                    for (std::size_t l = 0; l < LanesCount; ++l) {
+                                        value_type *a = data[l];
+
+                                        t = a[i1 + c];
+                                        t *= w;
+                                        a[i1 + c] = a[i0 + c];
+                                        a[i1 + c] -= t;
+                                        a[i0 + c] += t;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+
+                /*
+                 * Runs the stages [first_stage, logn) of the FFT of size 2^logn over every array of 'lanes',
+                 * the input must be already permuted. Arrays are processed in groups of BLOCKED_FFT_LANES sharing
+                 * the twiddle loads, the work is split over (group, tile) pairs.
+                 * omega_cache[i * twiddle_stride] = omega^i, where omega is the root of unity of order 2^logn.
+                 */
+                template<typename FieldType, typename Range>
+                void blocked_radix2_fft_stages(const std::vector<Range *> &lanes, const std::size_t logn,
+                                               const std::size_t first_stage,
+                                               const std::vector<typename FieldType::value_type> &omega_cache,
+                                               const std::size_t twiddle_stride) {
+                    typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
+                        value_type;
+
+                    const std::size_t n = std::size_t(1) << logn;
+                    const std::size_t groups = (lanes.size() + BLOCKED_FFT_LANES - 1) / BLOCKED_FFT_LANES;
+
+                    constexpr std::size_t tile_log = blocked_fft_tile_log<value_type>();
+                    constexpr std::size_t max_columns_log = blocked_fft_columns_log<value_type>();
+
+                    for (std::size_t stage = first_stage; stage < logn;) {
+                        const std::size_t m0 = std::size_t(1) << stage;
+                        const std::size_t columns_log = std::min(stage, max_columns_log);
+                        const std::size_t stages = std::min(logn - stage, tile_log - columns_log);
+                        const std::size_t columns = std::size_t(1) << columns_log;
+
+                        // Elements spanned by the butterflies of a single tile, and the number of tiles in it.
+                        const std::size_t block_size = m0 << stages;
+                        const std::size_t tiles_per_block = m0 / columns;
+                        const std::size_t tiles = (n / block_size) * tiles_per_block;
+                        const std::size_t twiddle_step = n / (2 * m0) * twiddle_stride;
+
+                        // Each tile holds 2^tile_log elements, so we do not need the LOW level minimal chunk size.
+                        wait_for_all(parallel_run_in_chunks<void>(
+                            groups * tiles,
+                            [&lanes, &omega_cache, m0, columns, stages, block_size, tiles_per_block, tiles,
+                             twiddle_step](std::size_t begin, std::size_t end) {
+                                for (std::size_t task = begin; task < end; ++task) {
+                                    const std::size_t group = task / tiles;
+                                    const std::size_t tile = task % tiles;
+                                    const std::size_t first_lane = group * BLOCKED_FFT_LANES;
+                                    const std::size_t lanes_count =
+                                        std::min(BLOCKED_FFT_LANES, lanes.size() - first_lane);
+                                    const std::size_t base = (tile / tiles_per_block) * block_size +
+                                                             (tile % tiles_per_block) * columns;
+                                    Range *const *tile_lanes = lanes.data() + first_lane;
+                                    switch (lanes_count) {
+                                        case 1:
+                                            blocked_fft_tile<1>(tile_lanes, base, m0, columns, stages,
+                                                                twiddle_step, omega_cache);
+                                            break;
+                                        case 2:
+                                            blocked_fft_tile<2>(tile_lanes, base, m0, columns, stages,
+                                                                twiddle_step, omega_cache);
+                                            break;
+                                        case 3:
+                                            blocked_fft_tile<3>(tile_lanes, base, m0, columns, stages,
+                                                                twiddle_step, omega_cache);
+                                            break;
+                                        default:
+                                            blocked_fft_tile<BLOCKED_FFT_LANES>(tile_lanes, base, m0, columns,
+                                                                                stages, twiddle_step, omega_cache);
+                                    }
+                                }
+                            }, ThreadPool::PoolLevel::HIGH));
+
+                        stage += stages;
+                    }
+                }
+
+                /*
+                 * Same contract as basic_radix2_fft_cached: natural order input and output,
+                 * omega_cache[i * twiddle_stride] = omega^i, and it's the caller's responsibility to multiply by 1/N
+                 * for the inverse transform.
+                 */
+                template<typename FieldType, typename Range>
+                void blocked_radix2_fft_cached(Range &a, const std::vector<typename FieldType::value_type> &omega_cache,
+                                               std::size_t twiddle_stride = 1) {
+                    BOOST_STATIC_ASSERT(algebra::is_field<FieldType>::value);
+
+                    const std::size_t n = a.size(), logn = log2(n);
+                    if (n != (1u << logn))
+                        throw std::invalid_argument("expected n == (1u << logn)");
+                    if (n > 1 && omega_cache.size() <= (n / 2 - 1) * twiddle_stride)
+                        throw std::invalid_argument("expected omega_cache.size() > (n / 2 - 1) * twiddle_stride");
+                    bench::register_fft<FieldType>(logn);
+
+                    blocked_bitreverse_permutation(a, logn);
+                    blocked_radix2_fft_stages<FieldType>(std::vector<Range *>{&a}, logn, 0, omega_cache,
+                                                         twiddle_stride);
+                }
+            }    // namespace detail
+        }        // namespace math
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_BLOCKED_RADIX2_FFT_HPP
@@ -0,0 +1,210 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_TWIDDLE_REGISTRY_HPP
+#define CRYPTO3_MATH_TWIDDLE_REGISTRY_HPP
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+#include <nil/crypto3/math/algorithms/unity_root.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+#include <nil/crypto3/bench/scoped_profiler.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace detail {
+
+                /*
+                 * Building caches for fft operations: cache[i] = omega^i for i < size.
+                */
+                template<typename FieldType>
+                void create_fft_cache(
+                        const std::size_t size,
+                        const typename FieldType::value_type &omega,
+                        std::vector<typename FieldType::value_type> &cache) {
+                    cache.resize(size, FieldType::value_type::zero());
+                    wait_for_all(parallel_run_in_chunks<void>(
+                        size,
+                        [&cache, &omega](std::size_t begin, std::size_t end) {
+                            cache[begin] = omega.pow(begin);
+                            for (std::size_t i = begin + 1; i < end; ++i) {
+                                cache[i] = cache[i - 1] * omega;
+                            }
+                        }, ThreadPool::PoolLevel::LOW));
+                }
+
+                /**
+                 * Process-wide storage of the twiddle factors of FieldType and of the powers of its coset shifts,
+                 * keyed by log size and shift.
+                 *
+                 * For the roots of unity only the table of the largest requested size is kept: with
+                 * omega_n = unity_root<FieldType>(n) we have omega_n^i == omega_N^(i * N / n), so the table of a
+                 * smaller domain is a strided view into the table of the bigger one. Powers of a coset shift are
+                 * shared in the same way, a smaller table is a prefix of the bigger one.
+                 */
+                template<typename FieldType>
+                class twiddle_registry {
+                public:
+                    typedef typename FieldType::value_type value_type;
+                    typedef std::vector<value_type> table_type;
+
+                    // 'size' values, the i-th of them is (*table)[i * stride].
+                    struct view {
+                        std::shared_ptr<const table_type> table;
+                        std::size_t stride = 1;
+                        std::size_t size = 0;
+
+                        const value_type &operator[](std::size_t i) const {
+                            return (*table)[i * stride];
+                        }
+                    };
+
+                    static twiddle_registry &instance() {
+                        static twiddle_registry registry;
+                        return registry;
+                    }
+
+                    /**
+                     * Powers omega^i for i < n / 2, where n = 2^log_size and omega = unity_root<FieldType>(n),
+                     * or its inverse. These are exactly the twiddles read by the radix-2 FFT of size n.
+                     */
+                    view roots(std::size_t log_size, bool inverse = false) {
+                        entry &slot = inverse ? inverse_roots : forward_roots;
+                        {
+                            std::shared_lock lock(mutex);
+                            if (slot.table != nullptr && slot.log_size >= log_size) {
+                                return roots_view(slot, log_size);
+                            }
+                        }
+
+                        value_type omega = unity_root<FieldType>(std::size_t(1) << log_size);
+                        if (inverse) {
+                            omega = omega.inversed();
+                        }
+                        auto table = build_table(omega, log_size == 0 ? 1 : (std::size_t(1) << (log_size - 1)));
+
+                        std::unique_lock lock(mutex);
+                        if (slot.table == nullptr || slot.log_size < log_size) {
+                            slot = entry{omega, log_size, std::move(table)};
+                        }
+                        return roots_view(slot, log_size);
+                    }
+
+                    /**
+                     * Powers shift^i for i < 2^log_size, used to move a polynomial to the coset shift * <omega>.
+                     */
+                    view coset_powers(const value_type &shift, std::size_t log_size) {
+                        const std::size_t size = std::size_t(1) << log_size;
+                        {
+                            std::shared_lock lock(mutex);
+                            for (const auto &slot : cosets) {
+                                if (slot.generator == shift && slot.log_size >= log_size) {
+                                    return view{slot.table, 1, size};
+                                }
+                            }
+                        }
+
+                        auto table = build_table(shift, size);
+
+                        std::unique_lock lock(mutex);
+                        for (auto &slot : cosets) {
+                            if (slot.generator == shift) {
+                                if (slot.log_size < log_size) {
+                                    slot = entry{shift, log_size, std::move(table)};
+                                }
+                                return view{slot.table, 1, size};
+                            }
+                        }
+                        cosets.push_back(entry{shift, log_size, std::move(table)});
+                        return view{cosets.back().table, 1, size};
+                    }
+
+                    // Bytes used by the tables owned by the registry. Views given out earlier keep
+                    // replaced tables alive, those are not counted.
+                    std::size_t memory_usage() const {
+                        std::shared_lock lock(mutex);
+                        std::size_t result = table_bytes(forward_roots) + table_bytes(inverse_roots);
+                        for (const auto &slot : cosets) {
+                            result += table_bytes(slot);
+                        }
+                        return result;
+                    }
+
+                    // Drops all the tables, the memory is released once the views given out are destroyed.
+                    void clear() {
+                        std::unique_lock lock(mutex);
+                        forward_roots = entry();
+                        inverse_roots = entry();
+                        cosets.clear();
+                    }
+
+                private:
+                    struct entry {
+                        value_type generator;
+                        std::size_t log_size = 0;
+                        std::shared_ptr<const table_type> table;
+                    };
+
+                    twiddle_registry() = default;
+
+                    static view roots_view(const entry &slot, std::size_t log_size) {
+                        return view{slot.table, std::size_t(1) << (slot.log_size - log_size),
+                                    log_size == 0 ? 1 : (std::size_t(1) << (log_size - 1))};
+                    }
+
+                    static std::size_t table_bytes(const entry &slot) {
+                        return slot.table == nullptr ? 0 : slot.table->size() * sizeof(value_type);
+                    }
+
+                    // Tables are built without holding the lock: building runs on the thread pool, and a worker
+                    // waiting for it may pick up a task which asks the registry for another table. If two threads
+                    // build the same table at once, the one which finishes last is dropped.
+                    std::shared_ptr<const table_type> build_table(const value_type &generator, std::size_t size) {
+                        PROFILE_SCOPE("Twiddle registry: table of {} values, {} bytes in registry",
+                                      size, memory_usage());
+                        auto table = std::make_shared<table_type>();
+                        create_fft_cache<FieldType>(size, generator, *table);
+                        return table;
+                    }
+
+                    mutable std::shared_mutex mutex;
+                    entry forward_roots;
+                    entry inverse_roots;
+                    std::vector<entry> cosets;
+                };
+
+            }    // namespace detail
+        }        // namespace math
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_TWIDDLE_REGISTRY_HPP
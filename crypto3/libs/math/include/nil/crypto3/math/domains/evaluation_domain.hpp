@@ -29,6 +29,7 @@
 #include <vector>
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/domains/detail/basic_radix2_domain_aux.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -49,6 +50,11 @@ namespace nil {
                 std::size_t m;
                 std::size_t log2_size;
 
+                /**
+                 * FFT implementation used by the radix-2 domains, other domains ignore it.
+                 */
+                fft_algorithm algorithm = fft_algorithm::cache_blocked;
+
                 /**
                  * Construct an evaluation domain S of size m, if possible.
                  *
@@ -47,15 +47,20 @@ namespace nil {
             class extended_radix2_domain : public evaluation_domain<FieldType, ValueType> {
                 typedef typename FieldType::value_type field_value_type;
                 typedef ValueType value_type;
-                typedef std::pair<std::vector<field_value_type>, std::vector<field_value_type>> cache_type;
+                typedef typename detail::twiddle_registry<FieldType>::view twiddle_view;
+                typedef std::pair<twiddle_view, twiddle_view> cache_type;
 
                 std::unique_ptr<cache_type> fft_cache;
+                // Powers of shift and of its inverse, i < small_m.
+                std::unique_ptr<cache_type> shift_powers;
 
                 void create_fft_cache() {
-                    fft_cache = std::make_unique<cache_type>(std::vector<field_value_type>(),
-                                                             std::vector<field_value_type>());
-                    detail::create_fft_cache<FieldType>(small_m, omega, fft_cache->first);
-                    detail::create_fft_cache<FieldType>(small_m, omega.inversed(), fft_cache->second);
+                    const std::size_t log_small_m = static_cast<std::size_t>(std::ceil(std::log2(small_m)));
+                    auto &registry = detail::twiddle_registry<FieldType>::instance();
+                    fft_cache = std::make_unique<cache_type>(registry.roots(log_small_m),
+                                                             registry.roots(log_small_m, true));
+                    shift_powers = std::make_unique<cache_type>(registry.coset_powers(shift, log_small_m),
+                                                                registry.coset_powers(shift.inversed(), log_small_m));
                 }
             public:
                 typedef FieldType field_type;
@@ -97,16 +102,14 @@ namespace nil {
 
                     const field_value_type shift_to_small_m = shift.pow(small_m);
 
-                    field_value_type shift_i = field_value_type::one();
+                    const twiddle_view &shift_i = shift_powers->first;
                     for (std::size_t i = 0; i < small_m; ++i) {
                         a0[i] = a[i] + a[small_m + i];
-                        a1[i] = shift_i * (a[i] + shift_to_small_m * a[small_m + i]);
-
-                        shift_i *= shift;
+                        a1[i] = shift_i[i] * (a[i] + shift_to_small_m * a[small_m + i]);
                     }
 
-                    detail::basic_radix2_fft_cached<FieldType>(a0, fft_cache->first);
-                    detail::basic_radix2_fft_cached<FieldType>(a1, fft_cache->first);
+                    detail::radix2_fft_cached<FieldType>(a0, fft_cache->first, this->algorithm);
+                    detail::radix2_fft_cached<FieldType>(a1, fft_cache->first, this->algorithm);
 
                     for (std::size_t i = 0; i < small_m; ++i) {
                         a[i] = a0[i];
@@ -130,20 +133,16 @@ namespace nil {
                     if (fft_cache == nullptr) {
                         create_fft_cache();
                     }
-                    detail::basic_radix2_fft_cached<FieldType>(a0, fft_cache->second);
-                    detail::basic_radix2_fft_cached<FieldType>(a1, fft_cache->second);
+                    detail::radix2_fft_cached<FieldType>(a0, fft_cache->second, this->algorithm);
+                    detail::radix2_fft_cached<FieldType>(a1, fft_cache->second, this->algorithm);
 
                     const field_value_type shift_to_small_m = shift.pow(small_m);
                     const field_value_type sconst = (field_value_type(small_m) * (field_value_type::one() - shift_to_small_m)).inversed();
 
-                    const field_value_type shift_inverse = shift.inversed();
-                    field_value_type shift_inverse_i = field_value_type::one();
-
+                    const twiddle_view &shift_inverse_i = shift_powers->second;
                     for (std::size_t i = 0; i < small_m; ++i) {
-                        a[i] = sconst * (-shift_to_small_m * a0[i] + shift_inverse_i * a1[i]);
-                        a[i + small_m] = sconst * (a0[i] - shift_inverse_i * a1[i]);
-
-                        shift_inverse_i *= shift_inverse;
+                        a[i] = sconst * (-shift_to_small_m * a0[i] + shift_inverse_i[i] * a1[i]);
+                        a[i + small_m] = sconst * (a0[i] - shift_inverse_i[i] * a1[i]);
                     }
                 }
 
@@ -47,19 +47,21 @@ namespace nil {
             class step_radix2_domain : public evaluation_domain<FieldType, ValueType> {
                 typedef typename FieldType::value_type field_value_type;
                 typedef ValueType value_type;
-                typedef std::pair<std::vector<field_value_type>, std::vector<field_value_type>> cache_type;
+                typedef typename detail::twiddle_registry<FieldType>::view twiddle_view;
+                typedef std::pair<twiddle_view, twiddle_view> cache_type;
 
                 std::unique_ptr<cache_type> small_fft_cache, big_fft_cache;
 
+                // big_omega and small_omega are the roots of unity of orders big_m and small_m,
+                // so both caches are views of the shared tables.
                 void create_fft_cache() {
-                    small_fft_cache = std::make_unique<cache_type>(
-                        std::make_pair(std::vector<field_value_type>(), std::vector<field_value_type>()));
-                    big_fft_cache = std::make_unique<cache_type>(
-                        std::make_pair(std::vector<field_value_type>(), std::vector<field_value_type>()));
-                    detail::create_fft_cache<FieldType>(big_m, big_omega, big_fft_cache->first);
-                    detail::create_fft_cache<FieldType>(big_m, big_omega.inversed(), big_fft_cache->second);
-                    detail::create_fft_cache<FieldType>(small_m, small_omega, small_fft_cache->first);
-                    detail::create_fft_cache<FieldType>(small_m, small_omega.inversed(), small_fft_cache->second);
+                    const std::size_t log_big_m = static_cast<std::size_t>(std::ceil(std::log2(big_m)));
+                    const std::size_t log_small_m = static_cast<std::size_t>(std::ceil(std::log2(small_m)));
+                    auto &registry = detail::twiddle_registry<FieldType>::instance();
+                    big_fft_cache = std::make_unique<cache_type>(registry.roots(log_big_m),
+                                                                 registry.roots(log_big_m, true));
+                    small_fft_cache = std::make_unique<cache_type>(registry.roots(log_small_m),
+                                                                   registry.roots(log_small_m, true));
                 }
             public:
                 typedef FieldType field_type;
@@ -114,8 +116,8 @@ namespace nil {
                         }
                     }
 
-                    detail::basic_radix2_fft_cached<FieldType>(c, big_fft_cache->first);
-                    detail::basic_radix2_fft_cached<FieldType>(e, small_fft_cache->first);
+                    detail::radix2_fft_cached<FieldType>(c, big_fft_cache->first, this->algorithm);
+                    detail::radix2_fft_cached<FieldType>(e, small_fft_cache->first, this->algorithm);
 
                     for (std::size_t i = 0; i < big_m; ++i) {
                         a[i] = c[i];
@@ -135,8 +137,8 @@ namespace nil {
                     if (small_fft_cache == nullptr) {
                         create_fft_cache();
                     }
-                    detail::basic_radix2_fft_cached<FieldType>(U0, big_fft_cache->second);
-                    detail::basic_radix2_fft_cached<FieldType>(U1, small_fft_cache->second);
+                    detail::radix2_fft_cached<FieldType>(U0, big_fft_cache->second, this->algorithm);
+                    detail::radix2_fft_cached<FieldType>(U1, small_fft_cache->second, this->algorithm);
 
                     const field_value_type U0_size_inv = field_value_type(big_m).inversed();
                     for (std::size_t i = 0; i < big_m; ++i) {
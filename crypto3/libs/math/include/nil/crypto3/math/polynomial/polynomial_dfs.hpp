@@ -28,15 +28,22 @@
 #define CRYPTO3_MATH_POLYNOMIAL_POLYNOM_DFT_HPP
 
 #include <algorithm>
+#include <bit>
+#include <functional>
 #include <limits>
+#include <map>
 #include <memory>
+#include <span>
 #include <vector>
 #include <ostream>
 #include <iterator>
 #include <unordered_map>
 
+#include <nil/crypto3/math/algorithms/batch_inverse.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/algorithms/parallel_scan.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
+#include <nil/crypto3/math/domains/detail/batched_radix2_fft.hpp>
 #include <nil/crypto3/math/polynomial/basic_operations.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 
@@ -387,6 +394,13 @@ namespace nil {
                         // Here we cannot write this->val.resize(_sz, this->val[0]), it will segfault.
                         auto value = this->val[0];
                         this->val.resize(_sz, value);
+                    } else if (is_radix2_extension(this->size(), _sz)) {
+                        // Domains of power of two sizes are always the subgroups, no matter which domains were passed.
+                        typedef typename value_type::field_type FieldType;
+                        const std::size_t log_size = std::bit_width(this->size()) - 1;
+                        this->val.resize(_sz, FieldValueType::zero());
+                        std::vector<std::span<FieldValueType>> lanes = {std::span<FieldValueType>(this->val)};
+                        detail::batched_radix2_lde<FieldType>(lanes, log_size, std::bit_width(_sz) - 1);
                     } else {
                         typedef typename value_type::field_type FieldType;
                         if (old_domain == nullptr) {
@@ -405,6 +419,17 @@ namespace nil {
                     }
                 }
 
+                /**
+                 * Returns true if resizing from 'size' to 'new_size' can be done with the fused radix-2 low degree
+                 * extension, see detail::batched_radix2_lde.
+                 */
+                static bool is_radix2_extension(size_type size, size_type new_size) {
+                    typedef typename value_type::field_type FieldType;
+                    return size > 1 && new_size > size && std::has_single_bit(size) && std::has_single_bit(new_size) &&
+                           std::size_t(std::bit_width(new_size) - 1) <=
+                               algebra::fields::arithmetic_params<FieldType>::two_adicity;
+                }
+
                 void swap(polynomial_dfs& other) {
                     val.swap(other.val);
                     std::swap(_d, other._d);
@@ -692,25 +717,7 @@ namespace nil {
                  * Calls inverse on a group element just once, so it's much faster than inverting each element separately.
                  */
                 void element_wise_inverse() {
-                    // Divide the vector of size "this->val.size()" into chunks and inverse each chunk.
-                    container_type result(this->val.size());
-                    wait_for_all(parallel_run_in_chunks<void>(
-                        this->val.size(),
-                        [&result, this](std::size_t range_begin, std::size_t range_end) {
-                            result[range_begin] = value_type::one();
-                            for (size_t i = range_begin + 1; i < range_end; i++) {
-                                result[i] = result[i - 1] * this->val[i - 1];
-                            }
-                            FieldValueType inv = (result[range_end - 1] * this->val[range_end - 1]).inversed();
-                            // Suddenly we need to convert range_begin to int, otherwise it's being compared incorrectly.
-                            for (int i = range_end - 1; i >= (int)range_begin; --i) {
-                                result[i] *= inv;
-                                inv *= this->val[i];
-                            }
-                            for (size_t i = range_begin; i < range_end; i++) {
-                                this->val[i] = result[i];
-                            }
-                        }, ThreadPool::PoolLevel::LOW));
+                    parallel_batch_inverse(std::span<FieldValueType>(this->val));
                 }
 
                 template<typename ContainerType>
@@ -886,6 +893,37 @@ namespace nil {
                 return os;
             }
 
+            /** Running sum of the row-wise sums of the addends, used by grand sum arguments:
+             *     result[0] = 0,
+             *     result[i] = result[i - 1] + addends[0][i - 1] + ... + addends[k - 1][i - 1] for 0 < i <= rows_amount,
+             * the rest of the values are zero. Rows are summed while being prefix-summed in parallel blocks, so no
+             * sum polynomial is built. All the addends must have at least rows_amount values.
+             */
+            template<typename FieldType>
+            polynomial_dfs<typename FieldType::value_type> polynomial_running_sum(
+                    const std::vector<const polynomial_dfs<typename FieldType::value_type>*>& addends,
+                    std::size_t rows_amount,
+                    std::size_t size) {
+                TAGGED_PROFILE_SCOPE("{low level} running sum", "Polynomial running sum");
+
+                using FieldValueType = typename FieldType::value_type;
+
+                BOOST_ASSERT(rows_amount < size);
+                polynomial_dfs<FieldValueType> result(size - 1, size, FieldValueType::zero());
+                parallel_transform_inclusive_scan(
+                    std::span<FieldValueType>(result.data() + 1, rows_amount),
+                    std::plus<FieldValueType>(),
+                    [&addends](std::size_t row) {
+                        FieldValueType row_sum = FieldValueType::zero();
+                        for (const auto* addend : addends) {
+                            BOOST_ASSERT(row < addend->size());
+                            row_sum += (*addend)[row];
+                        }
+                        return row_sum;
+                    });
+                return result;
+            }
+
             template<typename FieldType>
             polynomial_dfs<typename FieldType::value_type> polynomial_sum(
                     std::vector<math::polynomial_dfs<typename FieldType::value_type>> addends) {
@@ -1048,6 +1086,46 @@ namespace nil {
                 return result;
             }
 
+            /**
+             * Same as calling resize(new_size) for each polynomial, but the polynomials of the same size are extended
+             * together by the batched low degree extension, which shares the FFT passes between them.
+             */
+            template<typename FieldValueType, typename Allocator>
+            void polynomial_batch_resize(std::vector<polynomial_dfs<FieldValueType, Allocator>> &polys,
+                                         std::size_t new_size) {
+                typedef polynomial_dfs<FieldValueType, Allocator> polynomial_dfs_type;
+                typedef FieldValueType value_type;
+                typedef typename value_type::field_type FieldType;
+
+                std::map<std::size_t, std::vector<polynomial_dfs_type *>> batches;
+                std::vector<polynomial_dfs_type *> others;
+                for (auto &poly : polys) {
+                    if (poly.size() == new_size)
+                        continue;
+                    if (poly.degree() != 0 && polynomial_dfs_type::is_radix2_extension(poly.size(), new_size)) {
+                        batches[poly.size()].push_back(&poly);
+                    } else {
+                        others.push_back(&poly);
+                    }
+                }
+
+                // Resize uses low level thread pool, so we need to use the high level one here.
+                parallel_foreach(others.begin(), others.end(), [new_size](polynomial_dfs_type *poly) {
+                    poly->resize(new_size);
+                }, ThreadPool::PoolLevel::HIGH);
+
+                for (auto &[size, batch] : batches) {
+                    std::vector<std::span<value_type>> lanes(batch.size());
+                    parallel_for(0, batch.size(), [&batch, &lanes, new_size](std::size_t i) {
+                        auto &storage = batch[i]->get_storage();
+                        storage.resize(new_size, value_type::zero());
+                        lanes[i] = std::span<value_type>(storage);
+                    }, ThreadPool::PoolLevel::HIGH);
+                    detail::batched_radix2_lde<FieldType>(lanes, std::bit_width(size) - 1,
+                                                          std::bit_width(new_size) - 1);
+                }
+            }
+
             /// Converts batch of polynomials to DFS format in the given domain.
             template<typename FieldType>
             std::vector<math::polynomial_dfs<typename FieldType::value_type>> polynomial_batch_from_coefficients(
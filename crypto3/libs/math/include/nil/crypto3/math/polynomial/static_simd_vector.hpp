@@ -29,6 +29,9 @@
 #define CRYPTO3_MATH_POLYNOMIAL_STATIC_SIMD_VECTOR_HPP
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <type_traits>
 
 #include <boost/container/static_vector.hpp>
 #include <boost/functional/hash.hpp>
@@ -37,13 +40,32 @@
 
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
 
-#include <nil/crypto3/multiprecision/detail/big_mod/modular_ops/babybear_simd.hpp>
-
-namespace nil::crypto3::algebra::fields {
-    struct babybear;
-}
+#include <nil/crypto3/multiprecision/detail/big_mod/packed_modular_ops.hpp>
 
 namespace nil::crypto3::math {
+    namespace detail {
+        // Packed arithmetic on the raw values of FieldValueType, void if its field has none.
+        // Elements of extension fields are arrays of 'arity' base field values, so they
+        // are added and subtracted coefficient-wise by the packed base field arithmetic.
+        template<typename FieldValueType>
+        struct packed_ops_of {
+            using type = void;
+            static constexpr std::size_t arity = 1;
+        };
+
+        template<typename FieldValueType>
+            requires(multiprecision::detail::packed_modular_ops<
+                         typename FieldValueType::field_type::modular_type::modular_ops_t>::enabled &&
+                     sizeof(FieldValueType) ==
+                         FieldValueType::field_type::arity *
+                             sizeof(typename FieldValueType::field_type::modular_type::base_type))
+        struct packed_ops_of<FieldValueType> {
+            using type = multiprecision::detail::packed_modular_ops<
+                typename FieldValueType::field_type::modular_type::modular_ops_t>;
+            static constexpr std::size_t arity = FieldValueType::field_type::arity;
+        };
+    }  // namespace detail
+
     template<typename FieldValueType, std::size_t Size>
     class static_simd_vector {
         using container_type = std::array<FieldValueType, Size>;
@@ -139,44 +161,32 @@ namespace nil::crypto3::math {
             return static_simd_vector(value_type::one());
         }
 
-        template<std::size_t VSize,
-                 std::array<FieldValueType, VSize> op(std::array<FieldValueType, VSize>,
-                                                      std::array<FieldValueType, VSize>)>
-        static void vectorize(const static_simd_vector& lhs,
-                              const static_simd_vector& rhs, static_simd_vector& result) {
-            static_assert(Size % VSize == 0);
-            for (std::size_t i = 0; i < Size / VSize; ++i) {
-                std::array<FieldValueType, VSize> lhs_v, rhs_v;
-                for (std::size_t j = 0; j < VSize; ++j) {
-                    lhs_v[j] = lhs[i * VSize + j];
-                    rhs_v[j] = rhs[i * VSize + j];
-                }
-                auto r = op(lhs_v, rhs_v);
-                for (std::size_t j = 0; j < VSize; ++j) {
-                    result[i * VSize + j] = r[j];
-                }
-            }
+        using packed_ops = typename detail::packed_ops_of<FieldValueType>::type;
+        static constexpr std::size_t packed_arity = detail::packed_ops_of<FieldValueType>::arity;
+        // Addition and subtraction are packed for the extension fields as well,
+        // multiplication only for the base fields.
+        static constexpr bool is_packed = !std::is_void_v<packed_ops>;
+        static constexpr bool is_packed_mul = is_packed && packed_arity == 1;
+
+        // lhs = lhs Op rhs for all the raw values, using the vectorized field arithmetic.
+        template<multiprecision::detail::packed_op Op>
+        static void apply_packed(static_simd_vector& lhs, const container_type& rhs) {
+            using raw_container_type =
+                std::array<typename packed_ops::base_type, Size * packed_arity>;
+            auto raw = std::bit_cast<raw_container_type>(lhs.val);
+            packed_ops::template apply<Op>(raw, std::bit_cast<raw_container_type>(rhs));
+            lhs.val = std::bit_cast<container_type>(raw);
         }
 
         static_simd_vector operator+(const static_simd_vector& other) const {
-            static_simd_vector result;
-            if constexpr (std::is_same_v<typename FieldValueType::field_type,
-                                         algebra::fields::babybear>) {
-                vectorize<8, nil::crypto3::multiprecision::detail::babybear::
-                                 babybear_add8<FieldValueType>>(*this, other, result);
-                return result;
-            }
-            for (std::size_t i = 0; i < Size; ++i) {
-                result[i] = (*this)[i] + other[i];
-            }
+            static_simd_vector result = *this;
+            result += other;
             return result;
         }
 
         static_simd_vector& operator+=(const static_simd_vector& other) {
-            if constexpr (std::is_same_v<typename FieldValueType::field_type,
-                                         algebra::fields::babybear>) {
-                vectorize<8, nil::crypto3::multiprecision::detail::babybear::
-                                 babybear_add8<FieldValueType>>(*this, other, *this);
+            if constexpr (is_packed) {
+                apply_packed<multiprecision::detail::packed_op::add>(*this, other.val);
                 return *this;
             }
             for (std::size_t i = 0; i < Size; ++i) {
@@ -186,6 +196,9 @@ namespace nil::crypto3::math {
         }
 
         static_simd_vector& operator+=(const FieldValueType& c) {
+            if constexpr (is_packed) {
+                return *this += static_simd_vector(c);
+            }
             for (std::size_t i = 0; i < Size; ++i) {
                 (*this)[i] += c;
             }
@@ -193,6 +206,9 @@ namespace nil::crypto3::math {
         }
 
         static_simd_vector operator-() const {
+            if constexpr (is_packed) {
+                return zero() - *this;
+            }
             static_simd_vector result;
             for (std::size_t i = 0; i < Size; ++i) {
                 result[i] = -(*this)[i];
@@ -201,14 +217,16 @@ namespace nil::crypto3::math {
         }
 
         static_simd_vector operator-(const static_simd_vector& other) const {
-            static_simd_vector result;
-            for (std::size_t i = 0; i < Size; ++i) {
-                result[i] = (*this)[i] - other[i];
-            }
+            static_simd_vector result = *this;
+            result -= other;
             return result;
         }
 
         static_simd_vector& operator-=(const static_simd_vector& other) {
+            if constexpr (is_packed) {
+                apply_packed<multiprecision::detail::packed_op::sub>(*this, other.val);
+                return *this;
+            }
             for (std::size_t i = 0; i < Size; ++i) {
                 (*this)[i] -= other[i];
             }
@@ -216,6 +234,9 @@ namespace nil::crypto3::math {
         }
 
         static_simd_vector& operator-=(const FieldValueType& c) {
+            if constexpr (is_packed) {
+                return *this -= static_simd_vector(c);
+            }
             for (std::size_t i = 0; i < Size; ++i) {
                 (*this)[i] -= c;
             }
@@ -223,24 +244,14 @@ namespace nil::crypto3::math {
         }
 
         static_simd_vector operator*(const static_simd_vector& other) const {
-            static_simd_vector result;
-            if constexpr (std::is_same_v<typename FieldValueType::field_type,
-                                         algebra::fields::babybear>) {
-                vectorize<8, nil::crypto3::multiprecision::detail::babybear::
-                                 babybear_mul8<FieldValueType>>(*this, other, result);
-                return result;
-            }
-            for (std::size_t i = 0; i < Size; ++i) {
-                result[i] = (*this)[i] * other[i];
-            }
+            static_simd_vector result = *this;
+            result *= other;
             return result;
         }
 
         static_simd_vector& operator*=(const static_simd_vector& other) {
-            if constexpr (std::is_same_v<typename FieldValueType::field_type,
-                                         algebra::fields::babybear>) {
-                vectorize<8, nil::crypto3::multiprecision::detail::babybear::
-                                 babybear_mul8<FieldValueType>>(*this, other, *this);
+            if constexpr (is_packed_mul) {
+                apply_packed<multiprecision::detail::packed_op::mul>(*this, other.val);
                 return *this;
             }
             for (std::size_t i = 0; i < Size; ++i) {
@@ -250,17 +261,45 @@ namespace nil::crypto3::math {
         }
 
         static_simd_vector& operator*=(const FieldValueType& alpha) {
+            if constexpr (is_packed_mul) {
+                return *this *= static_simd_vector(alpha);
+            }
             for (std::size_t i = 0; i < Size; ++i) {
                 (*this)[i] *= alpha;
             }
             return *this;
         }
 
+        static_simd_vector squared() const {
+            static_simd_vector result = *this;
+            if constexpr (is_packed_mul) {
+                apply_packed<multiprecision::detail::packed_op::square>(result, result.val);
+                return result;
+            }
+            for (std::size_t i = 0; i < Size; ++i) {
+                result[i] = result[i].squared();
+            }
+            return result;
+        }
+
         static_simd_vector pow(size_t power) const {
             if (power == 1) {
                 return *this;
             }
 
+            if constexpr (is_packed_mul) {
+                static_simd_vector result = one(), base = *this;
+                for (; power != 0; power >>= 1) {
+                    if (power & 1) {
+                        result *= base;
+                    }
+                    if (power > 1) {
+                        base = base.squared();
+                    }
+                }
+                return result;
+            }
+
             static_simd_vector result;
 
             for (std::size_t i = 0; i < result.size(); ++i) {
@@ -31,13 +31,17 @@
 #include <boost/test/data/monomorphic.hpp>
 
 
+#include <nil/crypto3/algebra/fields/arithmetic_params/babybear.hpp>
 #include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/goldilocks.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
 #include <nil/crypto3/math/polynomial/shift.hpp>
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
 #include <nil/crypto3/math/domains/detail/basic_radix2_domain_aux.hpp>
+#include <nil/crypto3/math/domains/detail/batched_radix2_fft.hpp>
 
 #include <nil/crypto3/algebra/random_element.hpp>
 
@@ -48,6 +52,186 @@ typedef fields::bls12_fr<381> FieldType;
 
 BOOST_AUTO_TEST_SUITE(basic_radix2_domain_test_suit)
 
+template<typename Field>
+void check_fft_algorithms_match(std::size_t max_log_size) {
+    using value_type = typename Field::value_type;
+    for (std::size_t log_size = 1; log_size <= max_log_size; ++log_size) {
+        const std::size_t size = 1 << log_size;
+        std::vector<value_type> a(size);
+        for (auto& v : a) {
+            v = nil::crypto3::algebra::random_element<Field>();
+        }
+        std::vector<value_type> b = a;
+
+        std::vector<value_type> omega_cache;
+        detail::create_fft_cache<Field>(size, unity_root<Field>(size), omega_cache);
+
+        detail::radix2_fft_cached<Field>(a, omega_cache, fft_algorithm::radix2);
+        detail::radix2_fft_cached<Field>(b, omega_cache, fft_algorithm::cache_blocked);
+        BOOST_CHECK_MESSAGE(a == b, "FFT algorithms mismatch for size 2^" << log_size);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(cache_blocked_fft_matches_radix2_test) {
+    check_fft_algorithms_match<fields::bls12_fr<381>>(16);
+    check_fft_algorithms_match<fields::pallas_base_field>(14);
+    check_fft_algorithms_match<fields::goldilocks>(18);
+    check_fft_algorithms_match<fields::babybear>(18);
+}
+
+BOOST_AUTO_TEST_CASE(cache_blocked_domain_round_trip_test) {
+    using value_type = FieldType::value_type;
+    const std::size_t size = 1 << 15;
+
+    std::vector<value_type> coefficients(size);
+    for (auto& v : coefficients) {
+        v = nil::crypto3::algebra::random_element<FieldType>();
+    }
+
+    basic_radix2_domain<FieldType> blocked_domain(size);
+    basic_radix2_domain<FieldType> radix2_domain(size);
+    radix2_domain.algorithm = fft_algorithm::radix2;
+
+    std::vector<value_type> a = coefficients, b = coefficients;
+    blocked_domain.fft(a);
+    radix2_domain.fft(b);
+    BOOST_CHECK(a == b);
+
+    blocked_domain.inverse_fft(a);
+    BOOST_CHECK(a == coefficients);
+}
+
+BOOST_AUTO_TEST_CASE(twiddle_registry_strided_views_test) {
+    using field_type = fields::goldilocks;
+    using value_type = field_type::value_type;
+    auto& registry = detail::twiddle_registry<field_type>::instance();
+    registry.clear();
+
+    // The biggest table is built first, all the smaller domains are served from it.
+    auto big = registry.roots(12);
+    const std::size_t memory_after_big = registry.memory_usage();
+    BOOST_CHECK_EQUAL(memory_after_big, (1 << 11) * sizeof(value_type));
+
+    for (std::size_t log_size = 1; log_size <= 12; ++log_size) {
+        const std::size_t size = 1 << log_size;
+        auto forward = registry.roots(log_size);
+        auto inverse = registry.roots(log_size, true);
+        BOOST_CHECK(forward.table == big.table);
+        BOOST_CHECK_EQUAL(forward.size, size / 2);
+
+        std::vector<value_type> expected;
+        detail::create_fft_cache<field_type>(size / 2, unity_root<field_type>(size), expected);
+        for (std::size_t i = 0; i < size / 2; ++i) {
+            BOOST_CHECK(forward[i] == expected[i]);
+            BOOST_CHECK(forward[i] * inverse[i] == value_type::one());
+        }
+
+        std::vector<value_type> a(size), b;
+        for (auto& v : a) {
+            v = nil::crypto3::algebra::random_element<field_type>();
+        }
+        b = a;
+        detail::radix2_fft_cached<field_type>(a, forward);
+        detail::create_fft_cache<field_type>(size, unity_root<field_type>(size), expected);
+        detail::radix2_fft_cached<field_type>(b, expected);
+        BOOST_CHECK(a == b);
+    }
+    // Only the inverse table was added.
+    BOOST_CHECK_EQUAL(registry.memory_usage(), 2 * memory_after_big);
+
+    const value_type shift = fields::arithmetic_params<field_type>::multiplicative_generator;
+    auto coset = registry.coset_powers(shift, 10);
+    auto small_coset = registry.coset_powers(shift, 4);
+    BOOST_CHECK(coset.table == small_coset.table);
+    BOOST_CHECK_EQUAL(small_coset.size, 16);
+    for (std::size_t i = 0; i < coset.size; ++i) {
+        BOOST_CHECK(coset[i] == shift.pow(i));
+    }
+
+    registry.clear();
+    BOOST_CHECK_EQUAL(registry.memory_usage(), 0);
+}
+
+template<typename Field>
+void check_batched_fft_matches_single(std::size_t log_size, std::size_t columns) {
+    using value_type = typename Field::value_type;
+    const std::size_t size = 1 << log_size;
+    std::vector<value_type> slab(size * columns);
+    for (auto& v : slab) {
+        v = nil::crypto3::algebra::random_element<Field>();
+    }
+    std::vector<value_type> original = slab;
+
+    batch_fft<Field>(std::span<value_type>(slab), size);
+    basic_radix2_domain<Field> domain(size);
+    for (std::size_t c = 0; c < columns; ++c) {
+        std::vector<value_type> column(original.begin() + c * size, original.begin() + (c + 1) * size);
+        domain.fft(column);
+        BOOST_CHECK_MESSAGE(std::equal(column.begin(), column.end(), slab.begin() + c * size),
+                            "Batched FFT mismatch, column " << c << " of " << columns << ", size 2^" << log_size);
+    }
+
+    batch_fft<Field>(std::span<value_type>(slab), size, true);
+    BOOST_CHECK(slab == original);
+}
+
+BOOST_AUTO_TEST_CASE(batched_fft_matches_single_column_test) {
+    for (std::size_t columns : {1, 2, 3, 4, 5, 9}) {
+        check_batched_fft_matches_single<fields::goldilocks>(13, columns);
+        check_batched_fft_matches_single<fields::bls12_fr<381>>(7, columns);
+    }
+    check_batched_fft_matches_single<fields::babybear>(1, 3);
+    check_batched_fft_matches_single<fields::babybear>(16, 6);
+}
+
+template<typename Field>
+void check_batched_lde(std::size_t log_size, std::size_t log_blowup, std::size_t columns,
+                       const typename Field::value_type& shift) {
+    using value_type = typename Field::value_type;
+    const std::size_t size = 1 << log_size, new_size = size << log_blowup;
+
+    std::vector<value_type> slab(new_size * columns);
+    std::vector<std::vector<value_type>> expected(columns);
+    basic_radix2_domain<Field> domain(size), new_domain(new_size);
+    for (std::size_t c = 0; c < columns; ++c) {
+        std::vector<value_type> coefficients(size);
+        for (auto& v : coefficients) {
+            v = nil::crypto3::algebra::random_element<Field>();
+        }
+        std::vector<value_type> evaluations = coefficients;
+        domain.fft(evaluations);
+        std::copy(evaluations.begin(), evaluations.end(), slab.begin() + c * new_size);
+
+        value_type power = value_type::one();
+        for (auto& v : coefficients) {
+            v *= power;
+            power *= shift;
+        }
+        coefficients.resize(new_size, value_type::zero());
+        new_domain.fft(coefficients);
+        expected[c] = std::move(coefficients);
+    }
+
+    batch_lde<Field>(std::span<value_type>(slab), size, new_size, shift);
+    for (std::size_t c = 0; c < columns; ++c) {
+        BOOST_CHECK_MESSAGE(std::equal(expected[c].begin(), expected[c].end(), slab.begin() + c * new_size),
+                            "Batched LDE mismatch, column " << c << ", size 2^" << log_size << ", blowup 2^"
+                                                            << log_blowup);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(batched_lde_test) {
+    using goldilocks_value = fields::goldilocks::value_type;
+    const goldilocks_value generator = fields::arithmetic_params<fields::goldilocks>::multiplicative_generator;
+    for (std::size_t log_blowup : {0, 1, 2, 3}) {
+        check_batched_lde<fields::goldilocks>(10, log_blowup, 5, goldilocks_value::one());
+        check_batched_lde<fields::goldilocks>(10, log_blowup, 3, generator);
+        check_batched_lde<fields::bls12_fr<381>>(6, log_blowup, 2, FieldType::value_type(7));
+    }
+    check_batched_lde<fields::goldilocks>(1, 4, 2, generator);
+    check_batched_lde<fields::babybear>(14, 2, 4, fields::babybear::value_type(31));
+}
+
 // TODO(martun): move this to benchmarks.
 BOOST_AUTO_TEST_CASE(basic_radix2_domain_benchmark, *boost::unit_test::disabled()) {
     using value_type = FieldType::value_type;
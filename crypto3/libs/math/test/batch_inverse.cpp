@@ -0,0 +1,84 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE batch_inverse_test
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/bls12/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/goldilocks.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/algorithms/batch_inverse.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::math;
+
+using field_types = std::tuple<fields::goldilocks, fields::bls12_fr<381>>;
+
+template<typename FieldType>
+std::vector<typename FieldType::value_type> random_non_zero_vector(std::size_t size) {
+    std::vector<typename FieldType::value_type> values(size);
+    for (auto& value : values) {
+        do {
+            value = random_element<FieldType>();
+        } while (value.is_zero());
+    }
+    return values;
+}
+
+BOOST_AUTO_TEST_SUITE(batch_inverse_test_suite)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(batch_inverse_test, FieldType, field_types) {
+    for (std::size_t size : {1, 2, 3, 17, 256}) {
+        auto values = random_non_zero_vector<FieldType>(size);
+        auto inverses = values;
+        batch_inverse(std::span(inverses));
+        for (std::size_t i = 0; i < size; ++i) {
+            BOOST_CHECK(inverses[i] == values[i].inversed());
+        }
+    }
+
+    std::vector<typename FieldType::value_type> empty;
+    batch_inverse(std::span(empty));
+}
+
+// Big enough to be split among several threads.
+BOOST_AUTO_TEST_CASE_TEMPLATE(parallel_batch_inverse_test, FieldType, field_types) {
+    for (std::size_t size : {5, 1 << 16, (1 << 16) + 7}) {
+        auto values = random_non_zero_vector<FieldType>(size);
+        auto inverses = values;
+        parallel_batch_inverse(std::span(inverses));
+        for (std::size_t i = 0; i < size; ++i) {
+            BOOST_CHECK(inverses[i] * values[i] == FieldType::value_type::one());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,76 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE parallel_scan_test
+
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/goldilocks.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/goldilocks.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/algorithms/parallel_scan.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::math;
+
+using field_type = fields::goldilocks;
+using value_type = typename field_type::value_type;
+
+BOOST_AUTO_TEST_SUITE(parallel_scan_test_suite)
+
+BOOST_AUTO_TEST_CASE(parallel_prefix_product_test) {
+    for (std::size_t size : {1, 2, 1000, 1 << 16, (1 << 16) + 7}) {
+        std::vector<value_type> values(size);
+        for (auto& value : values) {
+            value = random_element<field_type>();
+        }
+        std::vector<value_type> expected(size);
+        std::inclusive_scan(values.begin(), values.end(), expected.begin(), std::multiplies<value_type>());
+
+        parallel_prefix_product(std::span(values));
+        BOOST_CHECK(values == expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(parallel_inclusive_scan_test) {
+    for (std::size_t size : {0, 1, 1 << 16, (1 << 16) + 7}) {
+        std::vector<std::uint64_t> values(size);
+        std::iota(values.begin(), values.end(), 1);
+        std::vector<std::uint64_t> expected(size);
+        std::inclusive_scan(values.begin(), values.end(), expected.begin());
+
+        parallel_inclusive_scan(std::span(values), std::plus<std::uint64_t>());
+        BOOST_CHECK(values == expected);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
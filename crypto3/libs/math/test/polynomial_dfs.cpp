@@ -1507,4 +1507,74 @@ BOOST_AUTO_TEST_CASE(polynomial_dfs_batch_conversion_test) {
     BOOST_CHECK_EQUAL(coeffs[1], b_coeffs);
 }
 
+BOOST_AUTO_TEST_CASE(polynomial_dfs_batch_resize_test) {
+    using value_type = typename FieldType::value_type;
+    std::vector<polynomial_dfs<value_type>> polys, expected;
+    for (std::size_t size : {8, 16, 8, 4, 1, 16, 8, 32}) {
+        std::vector<value_type> coefficients(size);
+        for (auto &v : coefficients) {
+            v = nil::crypto3::algebra::random_element<FieldType>();
+        }
+        polys.emplace_back();
+        polys.back().from_coefficients(coefficients);
+
+        // Evaluations of the same polynomial on the bigger domain.
+        expected.emplace_back();
+        coefficients.resize(32, value_type::zero());
+        expected.back().from_coefficients(coefficients);
+    }
+    polys.push_back(polynomial_dfs<value_type>(0, 4, value_type(5)));
+    expected.push_back(polynomial_dfs<value_type>(0, 32, value_type(5)));
+
+    polynomial_batch_resize(polys, 32);
+    for (std::size_t i = 0; i < polys.size(); ++i) {
+        BOOST_CHECK_EQUAL(polys[i].size(), 32);
+        BOOST_CHECK(std::equal(polys[i].begin(), polys[i].end(), expected[i].begin()));
+    }
+
+    const value_type point = 0x10_big_uint255;
+    polynomial_dfs<value_type> small_poly = polys[3];
+    std::vector<polynomial_dfs<value_type>> large = {small_poly};
+    for (std::size_t new_size : {64, 256, 1024}) {
+        polynomial_batch_resize(large, new_size);
+        BOOST_CHECK(small_poly.evaluate(point) == large[0].evaluate(point));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(polynomial_dfs_running_sum_test_suite)
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_running_sum_test) {
+    using value_type = typename FieldType::value_type;
+
+    for (std::size_t size : {8, 1 << 15}) {
+        std::vector<polynomial_dfs<value_type>> addends(5, polynomial_dfs<value_type>(size - 1, size));
+        std::vector<const polynomial_dfs<value_type>*> addend_ptrs;
+        for (auto& addend : addends) {
+            for (auto& v : addend) {
+                v = nil::crypto3::algebra::random_element<FieldType>();
+            }
+            addend_ptrs.push_back(&addend);
+        }
+        const std::size_t rows_amount = size - 3;
+
+        polynomial_dfs<value_type> sum = polynomial_running_sum<FieldType>(addend_ptrs, rows_amount, size);
+
+        BOOST_CHECK_EQUAL(sum.size(), size);
+        BOOST_CHECK(sum[0] == value_type::zero());
+        value_type expected = value_type::zero();
+        for (std::size_t i = 1; i < size; ++i) {
+            if (i <= rows_amount) {
+                for (const auto& addend : addends) {
+                    expected += addend[i - 1];
+                }
+                BOOST_CHECK(sum[i] == expected);
+            } else {
+                BOOST_CHECK(sum[i] == value_type::zero());
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,98 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE static_simd_vector_test
+
+#include <tuple>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/babybear.hpp>
+#include <nil/crypto3/algebra/fields/bls12/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks.hpp>
+#include <nil/crypto3/algebra/fields/koalabear.hpp>
+#include <nil/crypto3/algebra/fields/mersenne31.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/polynomial/static_simd_vector.hpp>
+
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::math;
+
+using field_types = std::tuple<fields::babybear, fields::koalabear, fields::mersenne31, fields::goldilocks,
+                               fields::babybear_fp4, fields::goldilocks_fp2, fields::bls12_fr<381>>;
+
+BOOST_AUTO_TEST_SUITE(static_simd_vector_test_suite)
+
+BOOST_AUTO_TEST_CASE(static_simd_vector_packed_fields_test) {
+    static_assert(static_simd_vector<fields::babybear::value_type, 64>::is_packed_mul);
+    static_assert(static_simd_vector<fields::koalabear::value_type, 64>::is_packed_mul);
+    static_assert(static_simd_vector<fields::mersenne31::value_type, 64>::is_packed_mul);
+    static_assert(static_simd_vector<fields::babybear_fp4::value_type, 64>::is_packed);
+    static_assert(!static_simd_vector<fields::babybear_fp4::value_type, 64>::is_packed_mul);
+    static_assert(!static_simd_vector<fields::bls12_fr<381>::value_type, 64>::is_packed);
+}
+
+// The packed arithmetic must give the same results as the element-wise one.
+BOOST_AUTO_TEST_CASE_TEMPLATE(static_simd_vector_matches_elementwise_test, FieldType, field_types) {
+    using value_type = typename FieldType::value_type;
+    constexpr std::size_t size = 64;
+    using vector_type = static_simd_vector<value_type, size>;
+
+    for (std::size_t round = 0; round < 10; ++round) {
+        vector_type a, b;
+        for (std::size_t i = 0; i < size; ++i) {
+            a[i] = random_element<FieldType>();
+            b[i] = random_element<FieldType>();
+        }
+        // Corner values.
+        a[0] = value_type::zero();
+        a[1] = -value_type::one();
+        b[1] = -value_type::one();
+        b[2] = value_type::zero();
+        const value_type c = random_element<FieldType>();
+
+        vector_type sum = a + b, difference = a - b, product = a * b, negated = -a, squared = a.squared(),
+                    cubed = a.pow(3), sum_c = a, difference_c = a, product_c = a;
+        sum_c += c;
+        difference_c -= c;
+        product_c *= c;
+
+        for (std::size_t i = 0; i < size; ++i) {
+            BOOST_CHECK(sum[i] == a[i] + b[i]);
+            BOOST_CHECK(difference[i] == a[i] - b[i]);
+            BOOST_CHECK(product[i] == a[i] * b[i]);
+            BOOST_CHECK(negated[i] == -a[i]);
+            BOOST_CHECK(squared[i] == a[i] * a[i]);
+            BOOST_CHECK(cubed[i] == a[i] * a[i] * a[i]);
+            BOOST_CHECK(sum_c[i] == a[i] + c);
+            BOOST_CHECK(difference_c[i] == a[i] - c);
+            BOOST_CHECK(product_c[i] == a[i] * c);
+        }
+        BOOST_CHECK(a.pow(0) == vector_type::one());
+        BOOST_CHECK(a.pow(1) == a);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
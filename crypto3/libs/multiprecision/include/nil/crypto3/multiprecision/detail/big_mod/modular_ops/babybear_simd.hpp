@@ -14,6 +14,7 @@
 #include <cstdint>
 
 #include <nil/crypto3/multiprecision/detail/big_mod/modular_ops/babybear.hpp>
+#include <nil/crypto3/multiprecision/detail/big_mod/modular_ops/montgomery_31_bit_simd.hpp>
 
 #include <nil/crypto3/multiprecision/detail/intel_intrinsics.hpp>
 
@@ -22,62 +23,15 @@ namespace nil::crypto3::multiprecision::detail::babybear {
     using u32x4 = std::array<u32, 4>;
     using u32x8 = std::array<u32, 8>;
 
-#if defined(NIL_CO3_MP_HAS_INTRINSICS) && defined(__AVX2__)
-    inline constexpr __m256i pack(u32 v) {
-        return std::bit_cast<__m256i>(u32x8{v, v, v, v, v, v, v, v});
-    }
-
-    inline constexpr __m256i PACKED_P = pack(0x78000001);
-    inline constexpr __m256i PACKED_MU = pack(0x88000001);
-
-    inline __m256i partial_monty_red_unsigned_to_signed(__m256i input) {
-        auto q = _mm256_mul_epu32(input, PACKED_MU);
-        auto q_p = _mm256_mul_epu32(q, PACKED_P);
-
-        return _mm256_sub_epi32(input, q_p);
-    }
-
-    inline __m256i partial_monty_red_signed_to_signed(__m256i input) {
-        auto q = _mm256_mul_epi32(input, PACKED_MU);
-        auto q_p = _mm256_mul_epi32(q, PACKED_P);
-
-        return _mm256_sub_epi32(input, q_p);
-    }
-
-    inline __m256i monty_mul(__m256i lhs, __m256i rhs) {
-        auto prod = _mm256_mul_epu32(lhs, rhs);
-        return partial_monty_red_unsigned_to_signed(prod);
-    }
-
-    inline __m256i monty_mul_signed(__m256i lhs, __m256i rhs) {
-        auto prod = _mm256_mul_epi32(lhs, rhs);
-        return partial_monty_red_signed_to_signed(prod);
-    }
-
-    inline __m256i movehdup_epi32(__m256i x) {
-        return _mm256_castps_si256(_mm256_movehdup_ps(_mm256_castsi256_ps(x)));
-    }
+    static_assert(simd_31_bit::montgomery_mu(babybear_modulus) == 0x88000001);
 
+#if defined(NIL_CO3_MP_HAS_INTRINSICS) && defined(__AVX2__)
     inline __m256i babybear_mul8_avx2(__m256i lhs, __m256i rhs) {
-        auto lhs_evn = lhs;
-        auto rhs_evn = rhs;
-        auto lhs_odd = movehdup_epi32(lhs);
-        auto rhs_odd = movehdup_epi32(rhs);
-
-        auto d_evn = monty_mul(lhs_evn, rhs_evn);
-        auto d_odd = monty_mul(lhs_odd, rhs_odd);
-
-        auto d_evn_hi = movehdup_epi32(d_evn);
-        auto t = _mm256_blend_epi32(d_evn_hi, d_odd, 0b10101010);
-
-        auto u = _mm256_add_epi32(t, PACKED_P);
-        return _mm256_min_epu32(t, u);
+        return simd_31_bit::montgomery_mul8_avx2<babybear_modulus>(lhs, rhs);
     }
 
     inline __m256i babybear_add8_avx2(__m256i lhs, __m256i rhs) {
-        auto t = _mm256_add_epi32(lhs, rhs);
-        auto u = _mm256_sub_epi32(t, PACKED_P);
-        return _mm256_min_epu32(t, u);
+        return simd_31_bit::add8_avx2<babybear_modulus>(lhs, rhs);
     }
 #endif
 
@@ -0,0 +1,182 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+
+#include "nil/crypto3/multiprecision/detail/big_mod/modular_ops/goldilocks.hpp"
+
+#include "nil/crypto3/multiprecision/detail/intel_intrinsics.hpp"
+
+// Packed Goldilocks arithmetic. Like goldilocks_modular_ops with int128 support, the values are
+// stored in the canonical (not Montgomery) form, the products are reduced with
+// 2^64 = 2^32 - 1 (mod p) and 2^96 = -1 (mod p).
+
+namespace nil::crypto3::multiprecision::detail::goldilocks {
+    using u64 = std::uint64_t;
+
+    // 2^64 mod p
+    inline constexpr u64 EPSILON = 0xFFFFFFFFULL;
+
+#if defined(NIL_CO3_MP_HAS_INTRINSICS) && defined(__AVX2__)
+    inline constexpr __m256i pack4(u64 v) {
+        return std::bit_cast<__m256i>(std::array<u64, 4>{v, v, v, v});
+    }
+
+    inline constexpr __m256i PACKED_P = pack4(goldilocks_modulus);
+    inline constexpr __m256i PACKED_EPSILON = pack4(EPSILON);
+    inline constexpr __m256i PACKED_SIGN_BIT = pack4(1ULL << 63);
+
+    // AVX2 has only signed 64-bit comparisons, flipping the sign bits turns them into unsigned ones.
+    inline __m256i cmplt_epu64(__m256i lhs, __m256i rhs) {
+        return _mm256_cmpgt_epi64(_mm256_xor_si256(rhs, PACKED_SIGN_BIT),
+                                  _mm256_xor_si256(lhs, PACKED_SIGN_BIT));
+    }
+
+    // Subtracts p from the lanes which are not less than p.
+    inline __m256i canonicalize(__m256i x) {
+        return _mm256_sub_epi64(x, _mm256_andnot_si256(cmplt_epu64(x, PACKED_P), PACKED_P));
+    }
+
+    inline __m256i goldilocks_add4_avx2(__m256i lhs, __m256i rhs) {
+        auto sum = _mm256_add_epi64(lhs, rhs);
+        // On overflow the lost 2^64 is congruent to EPSILON, and the sum is already less than p.
+        auto overflow = cmplt_epu64(sum, lhs);
+        sum = _mm256_add_epi64(sum, _mm256_and_si256(overflow, PACKED_EPSILON));
+        return canonicalize(sum);
+    }
+
+    inline __m256i goldilocks_sub4_avx2(__m256i lhs, __m256i rhs) {
+        auto diff = _mm256_sub_epi64(lhs, rhs);
+        // On borrow adding p is the same as subtracting EPSILON.
+        auto borrow = cmplt_epu64(lhs, rhs);
+        return _mm256_sub_epi64(diff, _mm256_and_si256(borrow, PACKED_EPSILON));
+    }
+
+    // Same steps as goldilocks_modular_ops::reduce128.
+    inline __m256i reduce128(__m256i lo, __m256i hi) {
+        auto hi_hi = _mm256_srli_epi64(hi, 32);
+        auto t0 = _mm256_sub_epi64(lo, hi_hi);
+        t0 = _mm256_sub_epi64(t0, _mm256_and_si256(cmplt_epu64(lo, hi_hi), PACKED_EPSILON));
+        // hi_lo * EPSILON, only the low 32 bits of hi are used by mul_epu32
+        auto t1 = _mm256_mul_epu32(hi, PACKED_EPSILON);
+        auto t2 = _mm256_add_epi64(t0, t1);
+        t2 = _mm256_add_epi64(t2, _mm256_and_si256(cmplt_epu64(t2, t0), PACKED_EPSILON));
+        return canonicalize(t2);
+    }
+
+    inline __m256i goldilocks_mul4_avx2(__m256i lhs, __m256i rhs) {
+        auto lhs_hi = _mm256_srli_epi64(lhs, 32);
+        auto rhs_hi = _mm256_srli_epi64(rhs, 32);
+
+        auto ll = _mm256_mul_epu32(lhs, rhs);
+        auto lh = _mm256_mul_epu32(lhs, rhs_hi);
+        auto hl = _mm256_mul_epu32(lhs_hi, rhs);
+        auto hh = _mm256_mul_epu32(lhs_hi, rhs_hi);
+
+        // Sum of the middle 32-bit parts, less than 3 * 2^32.
+        auto mid = _mm256_add_epi64(
+            _mm256_add_epi64(_mm256_srli_epi64(ll, 32), _mm256_and_si256(lh, PACKED_EPSILON)),
+            _mm256_and_si256(hl, PACKED_EPSILON));
+        auto lo = _mm256_blend_epi32(ll, _mm256_slli_epi64(mid, 32), 0b10101010);
+        auto hi = _mm256_add_epi64(
+            _mm256_add_epi64(hh, _mm256_srli_epi64(lh, 32)),
+            _mm256_add_epi64(_mm256_srli_epi64(hl, 32), _mm256_srli_epi64(mid, 32)));
+        return reduce128(lo, hi);
+    }
+
+    inline __m256i goldilocks_square4_avx2(__m256i x) {
+        auto x_hi = _mm256_srli_epi64(x, 32);
+
+        auto ll = _mm256_mul_epu32(x, x);
+        auto lh = _mm256_mul_epu32(x, x_hi);
+        auto hh = _mm256_mul_epu32(x_hi, x_hi);
+
+        auto lh_lo = _mm256_and_si256(lh, PACKED_EPSILON);
+        auto mid = _mm256_add_epi64(_mm256_srli_epi64(ll, 32), _mm256_add_epi64(lh_lo, lh_lo));
+        auto lo = _mm256_blend_epi32(ll, _mm256_slli_epi64(mid, 32), 0b10101010);
+        auto lh_hi = _mm256_srli_epi64(lh, 32);
+        auto hi = _mm256_add_epi64(_mm256_add_epi64(hh, _mm256_add_epi64(lh_hi, lh_hi)),
+                                   _mm256_srli_epi64(mid, 32));
+        return reduce128(lo, hi);
+    }
+#endif
+
+#if defined(NIL_CO3_MP_HAS_INTRINSICS) && defined(__AVX512F__)
+    inline constexpr __m512i pack8(u64 v) {
+        return std::bit_cast<__m512i>(std::array<u64, 8>{v, v, v, v, v, v, v, v});
+    }
+
+    inline constexpr __m512i PACKED8_P = pack8(goldilocks_modulus);
+    inline constexpr __m512i PACKED8_EPSILON = pack8(EPSILON);
+
+    inline __m512i canonicalize(__m512i x) {
+        return _mm512_mask_sub_epi64(x, _mm512_cmpge_epu64_mask(x, PACKED8_P), x, PACKED8_P);
+    }
+
+    inline __m512i goldilocks_add8_avx512(__m512i lhs, __m512i rhs) {
+        auto sum = _mm512_add_epi64(lhs, rhs);
+        sum = _mm512_mask_add_epi64(sum, _mm512_cmplt_epu64_mask(sum, lhs), sum, PACKED8_EPSILON);
+        return canonicalize(sum);
+    }
+
+    inline __m512i goldilocks_sub8_avx512(__m512i lhs, __m512i rhs) {
+        auto diff = _mm512_sub_epi64(lhs, rhs);
+        return _mm512_mask_sub_epi64(diff, _mm512_cmplt_epu64_mask(lhs, rhs), diff,
+                                     PACKED8_EPSILON);
+    }
+
+    inline __m512i reduce128(__m512i lo, __m512i hi) {
+        auto hi_hi = _mm512_srli_epi64(hi, 32);
+        auto t0 = _mm512_sub_epi64(lo, hi_hi);
+        t0 = _mm512_mask_sub_epi64(t0, _mm512_cmplt_epu64_mask(lo, hi_hi), t0, PACKED8_EPSILON);
+        auto t1 = _mm512_mul_epu32(hi, PACKED8_EPSILON);
+        auto t2 = _mm512_add_epi64(t0, t1);
+        t2 = _mm512_mask_add_epi64(t2, _mm512_cmplt_epu64_mask(t2, t0), t2, PACKED8_EPSILON);
+        return canonicalize(t2);
+    }
+
+    inline __m512i goldilocks_mul8_avx512(__m512i lhs, __m512i rhs) {
+        auto lhs_hi = _mm512_srli_epi64(lhs, 32);
+        auto rhs_hi = _mm512_srli_epi64(rhs, 32);
+
+        auto ll = _mm512_mul_epu32(lhs, rhs);
+        auto lh = _mm512_mul_epu32(lhs, rhs_hi);
+        auto hl = _mm512_mul_epu32(lhs_hi, rhs);
+        auto hh = _mm512_mul_epu32(lhs_hi, rhs_hi);
+
+        auto mid = _mm512_add_epi64(
+            _mm512_add_epi64(_mm512_srli_epi64(ll, 32), _mm512_and_si512(lh, PACKED8_EPSILON)),
+            _mm512_and_si512(hl, PACKED8_EPSILON));
+        auto lo = _mm512_mask_blend_epi32(0b1010101010101010, ll, _mm512_slli_epi64(mid, 32));
+        auto hi = _mm512_add_epi64(
+            _mm512_add_epi64(hh, _mm512_srli_epi64(lh, 32)),
+            _mm512_add_epi64(_mm512_srli_epi64(hl, 32), _mm512_srli_epi64(mid, 32)));
+        return reduce128(lo, hi);
+    }
+
+    inline __m512i goldilocks_square8_avx512(__m512i x) {
+        auto x_hi = _mm512_srli_epi64(x, 32);
+
+        auto ll = _mm512_mul_epu32(x, x);
+        auto lh = _mm512_mul_epu32(x, x_hi);
+        auto hh = _mm512_mul_epu32(x_hi, x_hi);
+
+        auto lh_lo = _mm512_and_si512(lh, PACKED8_EPSILON);
+        auto mid = _mm512_add_epi64(_mm512_srli_epi64(ll, 32), _mm512_add_epi64(lh_lo, lh_lo));
+        auto lo = _mm512_mask_blend_epi32(0b1010101010101010, ll, _mm512_slli_epi64(mid, 32));
+        auto lh_hi = _mm512_srli_epi64(lh, 32);
+        auto hi = _mm512_add_epi64(_mm512_add_epi64(hh, _mm512_add_epi64(lh_hi, lh_hi)),
+                                   _mm512_srli_epi64(mid, 32));
+        return reduce128(lo, hi);
+    }
+#endif
+}  // namespace nil::crypto3::multiprecision::detail::goldilocks
@@ -0,0 +1,57 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#pragma once
+
+#include "nil/crypto3/multiprecision/detail/big_mod/modular_ops/mersenne31.hpp"
+#include "nil/crypto3/multiprecision/detail/big_mod/modular_ops/simple_31_bit_simd.hpp"
+
+#include "nil/crypto3/multiprecision/detail/intel_intrinsics.hpp"
+
+namespace nil::crypto3::multiprecision::detail::mersenne31 {
+    using simd_31_bit::u32;
+
+    // The product x of two canonical values is less than 2^62, and x = hi * 2^31 + lo is
+    // congruent to hi + lo. Both halves are at most p and hi < p - 2, so their sum is reduced
+    // by a single conditional subtraction.
+
+#if defined(NIL_CO3_MP_HAS_INTRINSICS) && defined(__AVX2__)
+    inline __m256i mersenne31_mul8_avx2(__m256i lhs, __m256i rhs) {
+        constexpr __m256i packed_p = simd_31_bit::pack8(mersenne31_modulus);
+        auto prod_evn = _mm256_mul_epu32(lhs, rhs);
+        auto prod_odd = _mm256_mul_epu32(simd_31_bit::movehdup_epi32(lhs),
+                                         simd_31_bit::movehdup_epi32(rhs));
+
+        // Low 31 bits of the products. The odd lanes take the low half of the odd products.
+        auto lo = _mm256_and_si256(
+            _mm256_blend_epi32(prod_evn, _mm256_slli_epi64(prod_odd, 32), 0b10101010), packed_p);
+        // Bits 31..61 of the products, the high half of prod_odd << 1 holds them for the odd lanes.
+        auto hi = _mm256_blend_epi32(_mm256_srli_epi64(prod_evn, 31),
+                                     _mm256_slli_epi64(prod_odd, 1), 0b10101010);
+
+        return simd_31_bit::add8_avx2<mersenne31_modulus>(lo, hi);
+    }
+#endif
+
+#if defined(NIL_CO3_MP_HAS_INTRINSICS) && defined(__AVX512F__)
+    inline __m512i mersenne31_mul16_avx512(__m512i lhs, __m512i rhs) {
+        constexpr __m512i packed_p = simd_31_bit::pack16(mersenne31_modulus);
+        auto prod_evn = _mm512_mul_epu32(lhs, rhs);
+        auto prod_odd = _mm512_mul_epu32(simd_31_bit::movehdup_epi32(lhs),
+                                         simd_31_bit::movehdup_epi32(rhs));
+
+        auto lo = _mm512_and_si512(_mm512_mask_blend_epi32(0b1010101010101010, prod_evn,
+                                                           _mm512_slli_epi64(prod_odd, 32)),
+                                   packed_p);
+        auto hi = _mm512_mask_blend_epi32(0b1010101010101010, _mm512_srli_epi64(prod_evn, 31),
+                                          _mm512_slli_epi64(prod_odd, 1));
+
+        return simd_31_bit::add16_avx512<mersenne31_modulus>(lo, hi);
+    }
+#endif
+}  // namespace nil::crypto3::multiprecision::detail::mersenne31
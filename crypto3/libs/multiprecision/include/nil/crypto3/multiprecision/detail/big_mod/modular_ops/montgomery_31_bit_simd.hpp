@@ -0,0 +1,85 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#pragma once
+
+#include <cstdint>
+
+#include "nil/crypto3/multiprecision/detail/big_mod/modular_ops/simple_31_bit_simd.hpp"
+
+#include "nil/crypto3/multiprecision/detail/intel_intrinsics.hpp"
+
+// Packed Montgomery multiplication for 31-bit moduli, the same reduction as
+// montgomery_31_bit_modular_ops::mul with R = 2^32.
+
+namespace nil::crypto3::multiprecision::detail::simd_31_bit {
+    // Modulus^-1 mod 2^32
+    constexpr u32 montgomery_mu(u32 modulus) {
+        u32 inv = modulus;
+        for (int i = 0; i < 5; ++i) {
+            inv *= 2u - modulus * inv;
+        }
+        return inv;
+    }
+
+#if defined(NIL_CO3_MP_HAS_INTRINSICS) && defined(__AVX2__)
+    // Works on the even 32-bit lanes, the result is in the odd lanes and lies in (-p, p).
+    // The low halves of input and q * p are equal, so the 32-bit subtraction does not borrow.
+    template<u32 Modulus>
+    inline __m256i monty_red_unsigned_to_signed(__m256i input) {
+        constexpr __m256i packed_p = pack8(Modulus);
+        constexpr __m256i packed_mu = pack8(montgomery_mu(Modulus));
+        auto q = _mm256_mul_epu32(input, packed_mu);
+        auto q_p = _mm256_mul_epu32(q, packed_p);
+        return _mm256_sub_epi32(input, q_p);
+    }
+
+    template<u32 Modulus>
+    inline __m256i montgomery_mul8_avx2(__m256i lhs, __m256i rhs) {
+        constexpr __m256i packed_p = pack8(Modulus);
+        auto lhs_odd = movehdup_epi32(lhs);
+        auto rhs_odd = movehdup_epi32(rhs);
+
+        auto d_evn = monty_red_unsigned_to_signed<Modulus>(_mm256_mul_epu32(lhs, rhs));
+        auto d_odd = monty_red_unsigned_to_signed<Modulus>(_mm256_mul_epu32(lhs_odd, rhs_odd));
+
+        auto d_evn_hi = movehdup_epi32(d_evn);
+        auto t = _mm256_blend_epi32(d_evn_hi, d_odd, 0b10101010);
+
+        auto u = _mm256_add_epi32(t, packed_p);
+        return _mm256_min_epu32(t, u);
+    }
+#endif
+
+#if defined(NIL_CO3_MP_HAS_INTRINSICS) && defined(__AVX512F__)
+    template<u32 Modulus>
+    inline __m512i monty_red_unsigned_to_signed(__m512i input) {
+        constexpr __m512i packed_p = pack16(Modulus);
+        constexpr __m512i packed_mu = pack16(montgomery_mu(Modulus));
+        auto q = _mm512_mul_epu32(input, packed_mu);
+        auto q_p = _mm512_mul_epu32(q, packed_p);
+        return _mm512_sub_epi32(input, q_p);
+    }
+
+    template<u32 Modulus>
+    inline __m512i montgomery_mul16_avx512(__m512i lhs, __m512i rhs) {
+        constexpr __m512i packed_p = pack16(Modulus);
+        auto lhs_odd = movehdup_epi32(lhs);
+        auto rhs_odd = movehdup_epi32(rhs);
+
+        auto d_evn = monty_red_unsigned_to_signed<Modulus>(_mm512_mul_epu32(lhs, rhs));
+        auto d_odd = monty_red_unsigned_to_signed<Modulus>(_mm512_mul_epu32(lhs_odd, rhs_odd));
+
+        auto d_evn_hi = movehdup_epi32(d_evn);
+        auto t = _mm512_mask_blend_epi32(0b1010101010101010, d_evn_hi, d_odd);
+
+        auto u = _mm512_add_epi32(t, packed_p);
+        return _mm512_min_epu32(t, u);
+    }
+#endif
+}  // namespace nil::crypto3::multiprecision::detail::simd_31_bit
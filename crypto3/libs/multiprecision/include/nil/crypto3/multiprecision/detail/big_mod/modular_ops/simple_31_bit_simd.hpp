@@ -0,0 +1,76 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+
+#include "nil/crypto3/multiprecision/detail/intel_intrinsics.hpp"
+
+// Packed addition and subtraction modulo a 31-bit prime. Values are canonical, i.e. less than
+// the modulus, both in the plain and in the Montgomery form, so these work for all 31-bit fields.
+
+namespace nil::crypto3::multiprecision::detail::simd_31_bit {
+    using u32 = std::uint32_t;
+
+#if defined(NIL_CO3_MP_HAS_INTRINSICS) && defined(__AVX2__)
+    inline constexpr __m256i pack8(u32 v) {
+        return std::bit_cast<__m256i>(std::array<u32, 8>{v, v, v, v, v, v, v, v});
+    }
+
+    // a + b < 2p < 2^32, so t - p wraps around to a value bigger than t iff t < p.
+    template<u32 Modulus>
+    inline __m256i add8_avx2(__m256i lhs, __m256i rhs) {
+        constexpr __m256i packed_p = pack8(Modulus);
+        auto t = _mm256_add_epi32(lhs, rhs);
+        auto u = _mm256_sub_epi32(t, packed_p);
+        return _mm256_min_epu32(t, u);
+    }
+
+    template<u32 Modulus>
+    inline __m256i sub8_avx2(__m256i lhs, __m256i rhs) {
+        constexpr __m256i packed_p = pack8(Modulus);
+        auto t = _mm256_sub_epi32(lhs, rhs);
+        auto u = _mm256_add_epi32(t, packed_p);
+        return _mm256_min_epu32(t, u);
+    }
+
+    inline __m256i movehdup_epi32(__m256i x) {
+        return _mm256_castps_si256(_mm256_movehdup_ps(_mm256_castsi256_ps(x)));
+    }
+#endif
+
+#if defined(NIL_CO3_MP_HAS_INTRINSICS) && defined(__AVX512F__)
+    inline constexpr __m512i pack16(u32 v) {
+        return std::bit_cast<__m512i>(
+            std::array<u32, 16>{v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v});
+    }
+
+    template<u32 Modulus>
+    inline __m512i add16_avx512(__m512i lhs, __m512i rhs) {
+        constexpr __m512i packed_p = pack16(Modulus);
+        auto t = _mm512_add_epi32(lhs, rhs);
+        auto u = _mm512_sub_epi32(t, packed_p);
+        return _mm512_min_epu32(t, u);
+    }
+
+    template<u32 Modulus>
+    inline __m512i sub16_avx512(__m512i lhs, __m512i rhs) {
+        constexpr __m512i packed_p = pack16(Modulus);
+        auto t = _mm512_sub_epi32(lhs, rhs);
+        auto u = _mm512_add_epi32(t, packed_p);
+        return _mm512_min_epu32(t, u);
+    }
+
+    inline __m512i movehdup_epi32(__m512i x) {
+        return _mm512_castps_si512(_mm512_movehdup_ps(_mm512_castsi512_ps(x)));
+    }
+#endif
+}  // namespace nil::crypto3::multiprecision::detail::simd_31_bit
@@ -0,0 +1,220 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "nil/crypto3/multiprecision/detail/big_mod/modular_ops/babybear.hpp"
+#include "nil/crypto3/multiprecision/detail/big_mod/modular_ops/goldilocks.hpp"
+#include "nil/crypto3/multiprecision/detail/big_mod/modular_ops/goldilocks_simd.hpp"
+#include "nil/crypto3/multiprecision/detail/big_mod/modular_ops/koalabear.hpp"
+#include "nil/crypto3/multiprecision/detail/big_mod/modular_ops/mersenne31.hpp"
+#include "nil/crypto3/multiprecision/detail/big_mod/modular_ops/mersenne31_simd.hpp"
+#include "nil/crypto3/multiprecision/detail/big_mod/modular_ops/montgomery_31_bit_simd.hpp"
+#include "nil/crypto3/multiprecision/detail/big_mod/modular_ops/simple_31_bit_simd.hpp"
+#include "nil/crypto3/multiprecision/detail/big_mod/modular_ops_storage.hpp"
+
+#include "nil/crypto3/multiprecision/detail/intel_intrinsics.hpp"
+
+namespace nil::crypto3::multiprecision::detail {
+    enum class packed_op { add, sub, mul, square };
+
+    // Element-wise arithmetic on arrays of raw values of modular_ops_t. Fields with a vectorized
+    // implementation specialize this template, the primary one means there is none.
+    template<typename modular_ops_t>
+    struct packed_modular_ops {
+        static constexpr bool enabled = false;
+    };
+
+    // Processes the arrays with the widest kernels available in the current build: AVX-512, then
+    // AVX2, then the scalar modular_ops_t for the tail and in constant evaluation. Kernels provide
+    // avx2<Op>(__m256i, __m256i) and avx512<Op>(__m512i, __m512i), square ignores the second argument.
+    template<typename modular_ops_t, typename Kernels>
+    struct packed_modular_ops_impl {
+        using base_type = typename modular_ops_t::base_type;
+        static constexpr bool enabled = true;
+
+        template<packed_op Op, std::size_t N>
+        static constexpr void apply(std::array<base_type, N> &a,
+                                    const std::array<base_type, N> &b) {
+            std::size_t i = 0;
+#if defined(NIL_CO3_MP_HAS_INTRINSICS)
+            if (!std::is_constant_evaluated()) {
+#if defined(__AVX512F__)
+                constexpr std::size_t avx512_lanes = sizeof(__m512i) / sizeof(base_type);
+                for (; i + avx512_lanes <= N; i += avx512_lanes) {
+                    auto r = Kernels::template avx512<Op>(_mm512_loadu_si512(a.data() + i),
+                                                          _mm512_loadu_si512(b.data() + i));
+                    _mm512_storeu_si512(a.data() + i, r);
+                }
+#endif
+#if defined(__AVX2__)
+                constexpr std::size_t avx2_lanes = sizeof(__m256i) / sizeof(base_type);
+                for (; i + avx2_lanes <= N; i += avx2_lanes) {
+                    auto r = Kernels::template avx2<Op>(
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a.data() + i)),
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b.data() + i)));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(a.data() + i), r);
+                }
+#endif
+            }
+#endif
+            constexpr const auto &ops = modular_ops_storage_fixed_ct<modular_ops_t>::ops();
+            for (; i < N; ++i) {
+                if constexpr (Op == packed_op::add) {
+                    ops.add(a[i], b[i]);
+                } else if constexpr (Op == packed_op::sub) {
+                    ops.sub(a[i], b[i]);
+                } else if constexpr (Op == packed_op::mul) {
+                    ops.mul(a[i], b[i]);
+                } else {
+                    ops.mul(a[i], a[i]);
+                }
+            }
+        }
+
+        template<std::size_t N>
+        static constexpr void add(std::array<base_type, N> &a, const std::array<base_type, N> &b) {
+            apply<packed_op::add>(a, b);
+        }
+
+        template<std::size_t N>
+        static constexpr void sub(std::array<base_type, N> &a, const std::array<base_type, N> &b) {
+            apply<packed_op::sub>(a, b);
+        }
+
+        template<std::size_t N>
+        static constexpr void mul(std::array<base_type, N> &a, const std::array<base_type, N> &b) {
+            apply<packed_op::mul>(a, b);
+        }
+
+        template<std::size_t N>
+        static constexpr void square(std::array<base_type, N> &a) {
+            apply<packed_op::square>(a, a);
+        }
+    };
+
+    template<std::uint32_t Modulus>
+    struct montgomery_31_bit_packed_kernels {
+#if defined(NIL_CO3_MP_HAS_INTRINSICS) && defined(__AVX2__)
+        template<packed_op Op>
+        static __m256i avx2(__m256i a, __m256i b) {
+            if constexpr (Op == packed_op::add) {
+                return simd_31_bit::add8_avx2<Modulus>(a, b);
+            } else if constexpr (Op == packed_op::sub) {
+                return simd_31_bit::sub8_avx2<Modulus>(a, b);
+            } else if constexpr (Op == packed_op::mul) {
+                return simd_31_bit::montgomery_mul8_avx2<Modulus>(a, b);
+            } else {
+                return simd_31_bit::montgomery_mul8_avx2<Modulus>(a, a);
+            }
+        }
+#endif
+#if defined(NIL_CO3_MP_HAS_INTRINSICS) && defined(__AVX512F__)
+        template<packed_op Op>
+        static __m512i avx512(__m512i a, __m512i b) {
+            if constexpr (Op == packed_op::add) {
+                return simd_31_bit::add16_avx512<Modulus>(a, b);
+            } else if constexpr (Op == packed_op::sub) {
+                return simd_31_bit::sub16_avx512<Modulus>(a, b);
+            } else if constexpr (Op == packed_op::mul) {
+                return simd_31_bit::montgomery_mul16_avx512<Modulus>(a, b);
+            } else {
+                return simd_31_bit::montgomery_mul16_avx512<Modulus>(a, a);
+            }
+        }
+#endif
+    };
+
+    struct mersenne31_packed_kernels {
+#if defined(NIL_CO3_MP_HAS_INTRINSICS) && defined(__AVX2__)
+        template<packed_op Op>
+        static __m256i avx2(__m256i a, __m256i b) {
+            if constexpr (Op == packed_op::add) {
+                return simd_31_bit::add8_avx2<mersenne31_modulus>(a, b);
+            } else if constexpr (Op == packed_op::sub) {
+                return simd_31_bit::sub8_avx2<mersenne31_modulus>(a, b);
+            } else if constexpr (Op == packed_op::mul) {
+                return mersenne31::mersenne31_mul8_avx2(a, b);
+            } else {
+                return mersenne31::mersenne31_mul8_avx2(a, a);
+            }
+        }
+#endif
+#if defined(NIL_CO3_MP_HAS_INTRINSICS) && defined(__AVX512F__)
+        template<packed_op Op>
+        static __m512i avx512(__m512i a, __m512i b) {
+            if constexpr (Op == packed_op::add) {
+                return simd_31_bit::add16_avx512<mersenne31_modulus>(a, b);
+            } else if constexpr (Op == packed_op::sub) {
+                return simd_31_bit::sub16_avx512<mersenne31_modulus>(a, b);
+            } else if constexpr (Op == packed_op::mul) {
+                return mersenne31::mersenne31_mul16_avx512(a, b);
+            } else {
+                return mersenne31::mersenne31_mul16_avx512(a, a);
+            }
+        }
+#endif
+    };
+
+    struct goldilocks_packed_kernels {
+#if defined(NIL_CO3_MP_HAS_INTRINSICS) && defined(__AVX2__)
+        template<packed_op Op>
+        static __m256i avx2(__m256i a, __m256i b) {
+            if constexpr (Op == packed_op::add) {
+                return goldilocks::goldilocks_add4_avx2(a, b);
+            } else if constexpr (Op == packed_op::sub) {
+                return goldilocks::goldilocks_sub4_avx2(a, b);
+            } else if constexpr (Op == packed_op::mul) {
+                return goldilocks::goldilocks_mul4_avx2(a, b);
+            } else {
+                return goldilocks::goldilocks_square4_avx2(a);
+            }
+        }
+#endif
+#if defined(NIL_CO3_MP_HAS_INTRINSICS) && defined(__AVX512F__)
+        template<packed_op Op>
+        static __m512i avx512(__m512i a, __m512i b) {
+            if constexpr (Op == packed_op::add) {
+                return goldilocks::goldilocks_add8_avx512(a, b);
+            } else if constexpr (Op == packed_op::sub) {
+                return goldilocks::goldilocks_sub8_avx512(a, b);
+            } else if constexpr (Op == packed_op::mul) {
+                return goldilocks::goldilocks_mul8_avx512(a, b);
+            } else {
+                return goldilocks::goldilocks_square8_avx512(a);
+            }
+        }
+#endif
+    };
+
+    template<>
+    struct packed_modular_ops<babybear_modular_ops>
+        : packed_modular_ops_impl<babybear_modular_ops,
+                                  montgomery_31_bit_packed_kernels<babybear_modulus>> {};
+
+    template<>
+    struct packed_modular_ops<koalabear_modular_ops>
+        : packed_modular_ops_impl<koalabear_modular_ops,
+                                  montgomery_31_bit_packed_kernels<koalabear_modulus>> {};
+
+    template<>
+    struct packed_modular_ops<mersenne31_modular_ops>
+        : packed_modular_ops_impl<mersenne31_modular_ops, mersenne31_packed_kernels> {};
+
+#if defined(NIL_CO3_MP_HAS_INT128)
+    // Without int128 goldilocks_modular_ops keeps the values in the Montgomery form.
+    template<>
+    struct packed_modular_ops<goldilocks_modular_ops>
+        : packed_modular_ops_impl<goldilocks_modular_ops, goldilocks_packed_kernels> {};
+#endif
+}  // namespace nil::crypto3::multiprecision::detail
@@ -0,0 +1,144 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE big_mod_packed_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "nil/crypto3/multiprecision/big_mod.hpp"
+#include "nil/crypto3/multiprecision/detail/big_mod/packed_modular_ops.hpp"
+
+using namespace nil::crypto3::multiprecision;
+using nil::crypto3::multiprecision::detail::packed_modular_ops;
+
+struct BabyBear {
+    using ops_t = detail::babybear_modular_ops;
+    static constexpr std::uint64_t modulus = babybear_modulus;
+};
+
+struct KoalaBear {
+    using ops_t = detail::koalabear_modular_ops;
+    static constexpr std::uint64_t modulus = koalabear_modulus;
+};
+
+struct Mersenne31 {
+    using ops_t = detail::mersenne31_modular_ops;
+    static constexpr std::uint64_t modulus = mersenne31_modulus;
+};
+
+#if defined(NIL_CO3_MP_HAS_INT128)
+struct Goldilocks {
+    using ops_t = detail::goldilocks_modular_ops;
+    static constexpr std::uint64_t modulus = goldilocks_modulus;
+};
+
+using packed_fields = std::tuple<BabyBear, KoalaBear, Mersenne31, Goldilocks>;
+#else
+using packed_fields = std::tuple<BabyBear, KoalaBear, Mersenne31>;
+#endif
+
+// Values which hit the corner cases of the reductions, followed by random ones.
+template<typename Field, std::size_t N>
+std::array<typename Field::ops_t::base_type, N> test_values(std::mt19937_64 &rng) {
+    using base_type = typename Field::ops_t::base_type;
+    const std::uint64_t p = Field::modulus;
+    const std::vector<std::uint64_t> corner = {0,
+                                               1,
+                                               2,
+                                               p - 1,
+                                               p - 2,
+                                               p / 2,
+                                               p / 2 + 1,
+                                               (1ULL << 30),
+                                               (1ULL << 31) - 2,
+                                               0xFFFFFFFFULL % p,
+                                               (1ULL << 32) % p,
+                                               (p - 1) / 3,
+                                               ((1ULL << 63) + 12345) % p,
+                                               (p - 0xFFFFFFFFULL) % p};
+    std::uniform_int_distribution<std::uint64_t> distribution(0, p - 1);
+    std::array<base_type, N> result;
+    for (std::size_t i = 0; i < N; ++i) {
+        result[i] = static_cast<base_type>(
+            i < corner.size() ? corner[i] % p : distribution(rng));
+    }
+    return result;
+}
+
+template<typename Field, std::size_t N>
+void check_packed_matches_scalar(std::mt19937_64 &rng) {
+    using ops_t = typename Field::ops_t;
+    using packed_t = packed_modular_ops<ops_t>;
+    constexpr const auto &ops = detail::modular_ops_storage_fixed_ct<ops_t>::ops();
+
+    auto lhs = test_values<Field, N>(rng);
+    auto rhs = test_values<Field, N>(rng);
+    // Over the rounds the corner values get paired with each other.
+    std::rotate(rhs.begin(), rhs.begin() + (rng() % 14), rhs.begin() + 14);
+
+    auto add = lhs, sub = lhs, mul = lhs, square = lhs;
+    packed_t::add(add, rhs);
+    packed_t::sub(sub, rhs);
+    packed_t::mul(mul, rhs);
+    packed_t::square(square);
+
+    for (std::size_t i = 0; i < N; ++i) {
+        auto expected_add = lhs[i], expected_sub = lhs[i], expected_mul = lhs[i],
+             expected_square = lhs[i];
+        ops.add(expected_add, rhs[i]);
+        ops.sub(expected_sub, rhs[i]);
+        ops.mul(expected_mul, rhs[i]);
+        ops.mul(expected_square, lhs[i]);
+        BOOST_CHECK_EQUAL(add[i], expected_add);
+        BOOST_CHECK_EQUAL(sub[i], expected_sub);
+        BOOST_CHECK_EQUAL(mul[i], expected_mul);
+        BOOST_CHECK_EQUAL(square[i], expected_square);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(packed_modular_ops_tests)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(packed_matches_scalar, Field, packed_fields) {
+    static_assert(packed_modular_ops<typename Field::ops_t>::enabled);
+    std::mt19937_64 rng(0x5eed);
+    for (std::size_t round = 0; round < 100; ++round) {
+        // Sizes which are not a multiple of the vector width leave a scalar tail.
+        check_packed_matches_scalar<Field, 64>(rng);
+        check_packed_matches_scalar<Field, 37>(rng);
+        check_packed_matches_scalar<Field, 16>(rng);
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(packed_constexpr, Field, packed_fields) {
+    using ops_t = typename Field::ops_t;
+    using base_type = typename ops_t::base_type;
+    constexpr auto packed = []() {
+        std::array<base_type, 8> a{1, 2, 3, 4, 5, 6, 7, static_cast<base_type>(Field::modulus - 1)};
+        packed_modular_ops<ops_t>::mul(a, a);
+        packed_modular_ops<ops_t>::add(a, a);
+        return a;
+    }();
+    std::array<base_type, 8> runtime{1, 2, 3, 4, 5, 6, 7, static_cast<base_type>(Field::modulus - 1)};
+    packed_modular_ops<ops_t>::mul(runtime, runtime);
+    packed_modular_ops<ops_t>::add(runtime, runtime);
+    BOOST_CHECK(packed == runtime);
+}
+
+BOOST_AUTO_TEST_CASE(unpacked_field) {
+    static_assert(!packed_modular_ops<detail::montgomery_modular_ops<256>>::enabled);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -48,16 +48,39 @@ namespace nil {
             }
         }
 
+        template<class ReturnType>
+        std::vector<ReturnType> wait_for_all(std::vector<task_future<ReturnType>> futures) {
+            std::vector<ReturnType> results;
+            results.reserve(futures.size());
+            for (auto& f: futures) {
+                f.wait();
+            }
+            for (auto& f: futures) {
+                results.push_back(f.get());
+            }
+            return results;
+        }
+
+        inline void wait_for_all(std::vector<task_future<void>> futures) {
+            // Wait for everything first, so that no task outlives the data it references if one of them throws.
+            for (auto& f: futures) {
+                f.wait();
+            }
+            for (auto& f: futures) {
+                f.get();
+            }
+        }
+
         // Divides work into chunks and makes calls to 'func' in parallel.
         template<class ReturnType>
-        std::vector<std::future<ReturnType>> parallel_run_in_chunks_with_thread_id(
+        std::vector<task_future<ReturnType>> parallel_run_in_chunks_with_thread_id(
                 std::size_t elements_count,
                 std::function<ReturnType(std::size_t thread_id, std::size_t begin, std::size_t end)> func,
                 ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
 
             auto& thread_pool = ThreadPool::get_instance(pool_id);
 
-            std::vector<std::future<ReturnType>> fut;
+            std::vector<task_future<ReturnType>> fut;
             std::size_t workers_to_use = std::max((size_t)1, std::min(elements_count, thread_pool.get_pool_size()));
 
             // For pool #0 we have experimentally found that operations over chunks of <4096 elements
@@ -71,6 +94,8 @@ namespace nil {
                 workers_to_use = std::max((size_t)1, workers_to_use);
             }
 
+            // Every chunk gets its own copy of 'func', callers rely on it to keep mutable per-chunk state.
+            fut.reserve(workers_to_use);
             std::size_t begin = 0;
             for (std::size_t i = 0; i < workers_to_use; i++) {
                 auto end = begin + (elements_count - begin) / (workers_to_use - i);
@@ -83,7 +108,7 @@ namespace nil {
         }
 
         template<class ReturnType>
-        std::vector<std::future<ReturnType>> parallel_run_in_chunks(
+        std::vector<task_future<ReturnType>> parallel_run_in_chunks(
                 std::size_t elements_count,
                 std::function<ReturnType(std::size_t begin, std::size_t end)> func,
                 ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
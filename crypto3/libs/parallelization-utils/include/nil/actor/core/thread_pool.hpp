@@ -26,83 +26,341 @@
 #define CRYPTO3_THREAD_POOL_HPP
 
 #include <sched.h>
-#include <boost/asio/post.hpp>
-#include <boost/asio/thread_pool.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
 #include <functional>
 #include <future>
-#include <thread>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 
 namespace nil {
     namespace crypto3 {
 
+        namespace detail {
+
+            struct task_base {
+                virtual ~task_base() = default;
+                virtual void run() = 0;
+            };
+
+            // Shared state of a posted task: the task itself, its completion flag and its result.
+            // It is allocated once per task and is owned both by the scheduler queue and by the future.
+            template<class ReturnType>
+            struct task_state : task_base {
+                std::atomic<bool> done = false;
+                std::exception_ptr exception;
+                std::optional<ReturnType> result;
+
+                template<class F>
+                void invoke(F& func) {
+                    try {
+                        result.emplace(func());
+                    } catch (...) {
+                        exception = std::current_exception();
+                    }
+                    done.store(true, std::memory_order_release);
+                    done.notify_all();
+                }
+            };
+
+            template<>
+            struct task_state<void> : task_base {
+                std::atomic<bool> done = false;
+                std::exception_ptr exception;
+
+                template<class F>
+                void invoke(F& func) {
+                    try {
+                        func();
+                    } catch (...) {
+                        exception = std::current_exception();
+                    }
+                    done.store(true, std::memory_order_release);
+                    done.notify_all();
+                }
+            };
+
+            template<class ReturnType, class F>
+            struct packaged_task_state : task_state<ReturnType> {
+                explicit packaged_task_state(F&& f) : func(std::move(f)) {
+                }
+
+                void run() override {
+                    this->invoke(func);
+                }
+
+                F func;
+            };
+
+        }    // namespace detail
+
+        template<class ReturnType>
+        class task_future;
+
+        /** Work-stealing fork/join scheduler.
+         *  Every worker owns a deque of tasks: it pushes and pops its own tasks at the back, while idle workers steal
+         *  from the front of the others. Tasks posted from outside of the pool go to a shared injection queue.
+         *  A worker that waits on a task_future does not block, it keeps executing pending tasks until the awaited one
+         *  is complete, so tasks may be nested to any depth without deadlocks.
+         */
         class ThreadPool {
             public:
             static std::size_t core_count() {
 #if defined(__linux__) && !defined(__ANDROID__)
                 cpu_set_t cpuset;
-                if (sched_getaffinity(0, sizeof(cpuset), &cpuset)) {
+                if (sched_getaffinity(0, sizeof(cpuset), &cpuset) == 0) {
                     auto count = CPU_COUNT(&cpuset);
                     if (count != 0) {
                         return count;
                     }
                 }
 #endif
-                return std::thread::hardware_concurrency();
+                return std::max(1u, std::thread::hardware_concurrency());
             }
+
+            /** Level of the work being submitted. LOW is normally used for low-level operations, like polynomial
+             *  operations and fft, HIGH is used by the code that calls them. Both levels are served by the same
+             *  scheduler, the level is only a hint used for chunking, and any level may be nested into any other.
+             */
             enum class PoolLevel {
                 LOW,
                 HIGH
             };
 
-            /** Returns a thread pool, based on the pool_id. pool with LOW is normally used for low-level operations, like polynomial
-             *  operations and fft. Any code that uses these operations and needs to be parallel will submit its tasks to pool with HIGH.
-             *  Submission of higher level tasks to low level pool will immediately result in a deadlock.
-             */
-            static ThreadPool& get_instance(PoolLevel pool_id) {
-                static std::size_t pool_size = core_count();
-                static ThreadPool instance_for_low_level(pool_size);
-                static ThreadPool instance_for_middle_level(pool_size);
-
-                if (pool_id == PoolLevel::LOW)
-                    return instance_for_low_level;
-                if (pool_id == PoolLevel::HIGH)
-                    return instance_for_middle_level;
-                throw std::invalid_argument("Invalid instance of thread pool requested.");
+            static ThreadPool& get_instance(PoolLevel pool_id = PoolLevel::LOW) {
+                static ThreadPool instance(core_count());
+                if (pool_id != PoolLevel::LOW && pool_id != PoolLevel::HIGH)
+                    throw std::invalid_argument("Invalid instance of thread pool requested.");
+                return instance;
             }
 
             ThreadPool(const ThreadPool& obj)= delete;
             ThreadPool& operator=(const ThreadPool& obj)= delete;
 
-            template<class ReturnType>
-            inline std::future<ReturnType> post(std::function<ReturnType()> task) {
-                auto packaged_task = std::make_shared<std::packaged_task<ReturnType()>>(std::move(task));
-                std::future<ReturnType> fut = packaged_task->get_future();
-                boost::asio::post(pool, [packaged_task]() -> void { (*packaged_task)(); });
-                return fut;
+            ~ThreadPool() {
+                {
+                    std::lock_guard<std::mutex> lock(sleep_mutex);
+                    stopped.store(true);
+                }
+                sleep_cv.notify_all();
+                for (auto& worker : workers) {
+                    // The process may exit from inside of a task, a worker cannot join itself.
+                    if (worker.get_id() == std::this_thread::get_id())
+                        worker.detach();
+                    else if (worker.joinable())
+                        worker.join();
+                }
+            }
+
+            template<class ReturnType, class F>
+            inline task_future<ReturnType> post(F&& task) {
+                using state_type = detail::packaged_task_state<ReturnType, std::decay_t<F>>;
+                auto state = std::make_shared<state_type>(std::decay_t<F>(std::forward<F>(task)));
+                push(state);
+                return task_future<ReturnType>(std::move(state));
             }
 
             // Waits for all the tasks to complete.
             inline void join() {
-                pool.join();
+                while (pending_tasks.load(std::memory_order_acquire) != 0) {
+                    if (!is_worker_thread() || !try_run_one(current_worker_index)) {
+                        std::this_thread::yield();
+                    }
+                }
             }
 
             std::size_t get_pool_size() const {
                 return pool_size;
             }
 
+            // Returns true if the calling thread is one of the workers of this pool.
+            bool is_worker_thread() const {
+                return current_pool == this;
+            }
+
+            /** Blocks until 'done' becomes true. Worker threads keep executing queued tasks in the meantime,
+             *  other threads just sleep on the flag.
+             */
+            void wait(const std::atomic<bool>& done) {
+                if (!is_worker_thread()) {
+                    while (!done.load(std::memory_order_acquire)) {
+                        done.wait(false, std::memory_order_acquire);
+                    }
+                    return;
+                }
+                std::size_t idle_rounds = 0;
+                while (!done.load(std::memory_order_acquire)) {
+                    if (try_run_one(current_worker_index)) {
+                        idle_rounds = 0;
+                        continue;
+                    }
+                    // Nothing to steal, the awaited task is being executed by someone else.
+                    if (++idle_rounds < SPIN_ROUNDS_BEFORE_SLEEP) {
+                        std::this_thread::yield();
+                    } else {
+                        std::this_thread::sleep_for(std::chrono::microseconds(50));
+                    }
+                }
+            }
+
         private:
+            static constexpr std::size_t SPIN_ROUNDS_BEFORE_SLEEP = 64;
+
+            struct alignas(64) worker_queue {
+                std::mutex mutex;
+                std::deque<std::shared_ptr<detail::task_base>> tasks;
+            };
+
             inline ThreadPool(std::size_t pool_size)
-                : pool(pool_size)
-                , pool_size(pool_size)  {
+                : pool_size(pool_size)
+                , queues(pool_size) {
+                workers.reserve(pool_size);
+                for (std::size_t i = 0; i < pool_size; ++i) {
+                    workers.emplace_back([this, i]() { worker_loop(i); });
+                }
+            }
+
+            void push(std::shared_ptr<detail::task_base> task) {
+                pending_tasks.fetch_add(1);
+                if (is_worker_thread()) {
+                    auto& queue = queues[current_worker_index];
+                    std::lock_guard<std::mutex> lock(queue.mutex);
+                    queue.tasks.push_back(std::move(task));
+                } else {
+                    std::lock_guard<std::mutex> lock(injection_queue.mutex);
+                    injection_queue.tasks.push_back(std::move(task));
+                }
+                queued_tasks.fetch_add(1);
+                if (sleeping_workers.load() != 0) {
+                    std::lock_guard<std::mutex> lock(sleep_mutex);
+                    sleep_cv.notify_one();
+                }
+            }
+
+            std::shared_ptr<detail::task_base> pop_back(worker_queue& queue) {
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (queue.tasks.empty())
+                    return nullptr;
+                auto task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+                return task;
+            }
+
+            std::shared_ptr<detail::task_base> pop_front(worker_queue& queue) {
+                std::unique_lock<std::mutex> lock(queue.mutex, std::try_to_lock);
+                if (!lock.owns_lock() || queue.tasks.empty())
+                    return nullptr;
+                auto task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+                return task;
+            }
+
+            // Runs one task: the most recent one of our own, otherwise an external one, otherwise a stolen one.
+            bool try_run_one(std::size_t index) {
+                if (queued_tasks.load(std::memory_order_relaxed) == 0)
+                    return false;
+
+                std::shared_ptr<detail::task_base> task = pop_back(queues[index]);
+                if (!task) {
+                    std::lock_guard<std::mutex> lock(injection_queue.mutex);
+                    if (!injection_queue.tasks.empty()) {
+                        task = std::move(injection_queue.tasks.front());
+                        injection_queue.tasks.pop_front();
+                    }
+                }
+                for (std::size_t i = 1; !task && i < pool_size; ++i) {
+                    task = pop_front(queues[(index + i) % pool_size]);
+                }
+                if (!task)
+                    return false;
+
+                queued_tasks.fetch_sub(1);
+                task->run();
+                pending_tasks.fetch_sub(1, std::memory_order_release);
+                return true;
+            }
+
+            void worker_loop(std::size_t index) {
+                current_pool = this;
+                current_worker_index = index;
+                while (!stopped.load()) {
+                    if (try_run_one(index))
+                        continue;
+                    std::unique_lock<std::mutex> lock(sleep_mutex);
+                    sleeping_workers.fetch_add(1);
+                    sleep_cv.wait(lock, [this]() { return stopped.load() || queued_tasks.load() != 0; });
+                    sleeping_workers.fetch_sub(1);
+                }
             }
 
-            boost::asio::thread_pool pool;
             const std::size_t pool_size;
+            std::vector<worker_queue> queues;
+            worker_queue injection_queue;
+            std::vector<std::thread> workers;
+
+            // Tasks sitting in the queues.
+            std::atomic<std::size_t> queued_tasks = 0;
+            // Tasks posted, but not finished yet.
+            std::atomic<std::size_t> pending_tasks = 0;
+
+            std::mutex sleep_mutex;
+            std::condition_variable sleep_cv;
+            std::atomic<std::size_t> sleeping_workers = 0;
+            std::atomic<bool> stopped = false;
+
+            static inline thread_local ThreadPool* current_pool = nullptr;
+            static inline thread_local std::size_t current_worker_index = 0;
+        };
+
+        /** Result of ThreadPool::post. Unlike std::future, waiting on it from a worker thread executes other
+         *  queued tasks instead of blocking the worker.
+         */
+        template<class ReturnType>
+        class task_future {
+        public:
+            task_future() = default;
+
+            explicit task_future(std::shared_ptr<detail::task_state<ReturnType>> state)
+                : state(std::move(state)) {
+            }
 
+            bool valid() const {
+                return state != nullptr;
+            }
+
+            bool is_ready() const {
+                return state->done.load(std::memory_order_acquire);
+            }
+
+            void wait() const {
+                if (!is_ready())
+                    ThreadPool::get_instance().wait(state->done);
+            }
+
+            ReturnType get() {
+                wait();
+                auto finished_state = std::move(state);
+                if (finished_state->exception)
+                    std::rethrow_exception(finished_state->exception);
+                if constexpr (!std::is_void_v<ReturnType>) {
+                    return std::move(*finished_state->result);
+                }
+            }
+
+        private:
+            std::shared_ptr<detail::task_state<ReturnType>> state;
         };
 
     }        // namespace crypto3
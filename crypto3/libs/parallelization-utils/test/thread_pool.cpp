@@ -25,8 +25,10 @@
 
 #define BOOST_TEST_MODULE thread_pool_test
 
-#include <vector>
+#include <atomic>
 #include <cstdint>
+#include <stdexcept>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -61,4 +63,67 @@ BOOST_AUTO_TEST_CASE(vector_multiplication_test) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(nested_fork_join_test) {
+    // HIGH level tasks spawn LOW level work and wait for it, which used to deadlock when done the other way around.
+    std::size_t outer_size = 64;
+    std::size_t inner_size = 1 << 14;
+
+    std::vector<std::vector<std::size_t>> v(outer_size, std::vector<std::size_t>(inner_size));
+
+    nil::crypto3::parallel_for(0, outer_size,
+        [&v, inner_size](std::size_t i) {
+            nil::crypto3::parallel_for(0, inner_size,
+                [&v, i](std::size_t j) {
+                    v[i][j] = i * j;
+                }, nil::crypto3::ThreadPool::PoolLevel::LOW);
+        }, nil::crypto3::ThreadPool::PoolLevel::HIGH);
+
+    for (std::size_t i = 0; i < outer_size; ++i) {
+        for (std::size_t j = 0; j < inner_size; ++j) {
+            BOOST_CHECK_EQUAL(v[i][j], i * j);
+        }
+    }
+
+    // Same level nesting must work as well.
+    std::atomic<std::size_t> counter = 0;
+    nil::crypto3::parallel_for(0, outer_size,
+        [&counter, outer_size](std::size_t) {
+            nil::crypto3::parallel_for(0, outer_size,
+                [&counter](std::size_t) {
+                    counter.fetch_add(1);
+                }, nil::crypto3::ThreadPool::PoolLevel::HIGH);
+        }, nil::crypto3::ThreadPool::PoolLevel::HIGH);
+    BOOST_CHECK_EQUAL(counter.load(), outer_size * outer_size);
+}
+
+BOOST_AUTO_TEST_CASE(chunk_results_test) {
+    std::size_t size = 1 << 20;
+
+    auto sums = nil::crypto3::wait_for_all(nil::crypto3::parallel_run_in_chunks<std::size_t>(
+        size,
+        [](std::size_t begin, std::size_t end) {
+            std::size_t sum = 0;
+            for (std::size_t i = begin; i < end; ++i) {
+                sum += i;
+            }
+            return sum;
+        }, nil::crypto3::ThreadPool::PoolLevel::LOW));
+
+    std::size_t total = 0;
+    for (auto sum : sums) {
+        total += sum;
+    }
+    BOOST_CHECK_EQUAL(total, size * (size - 1) / 2);
+}
+
+BOOST_AUTO_TEST_CASE(exception_propagation_test) {
+    BOOST_CHECK_THROW(
+        nil::crypto3::parallel_for(0, 1 << 16,
+            [](std::size_t i) {
+                if (i == 12345)
+                    throw std::runtime_error("task failed");
+            }),
+        std::runtime_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
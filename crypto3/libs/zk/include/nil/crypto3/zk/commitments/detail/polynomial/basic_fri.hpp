@@ -36,6 +36,7 @@
 #include <memory>
 #include <unordered_map>
 #include <map>
+#include <optional>
 #include <random>
 
 #include <nil/crypto3/math/algorithms/calculate_domain_set.hpp>
@@ -234,6 +235,11 @@ namespace nil {
                             const std::size_t expand_factor;
                             const std::size_t max_step;
                             const std::size_t degree_log;
+
+                            // The first nonce tried by the prover's grinding, a random one if not set. Fixing it
+                            // makes proofs reproducible. Not a part of the proof system, so neither compared
+                            // nor marshalled.
+                            std::optional<std::uint64_t> grinding_seed;
                         };
 
                         struct round_proof_type {
@@ -408,6 +414,70 @@ namespace nil {
                     return (x_index + domain_size / FRI::m) % domain_size;
                 }
 
+                // A leaf holds the values of every polynomial at the points x_index + offset of the coset, the
+                // offsets do not depend on x_index: [0, N/2], then the pairs shifted by N/4, N/8, N/8 + N/4, ...
+                template<typename FRI>
+                static std::vector<std::size_t> get_leaf_offsets(const std::size_t domain_size,
+                                                                 const std::size_t coset_size) {
+                    std::vector<std::size_t> offsets(coset_size);
+                    offsets[0] = 0;
+                    offsets[1] = get_paired_index<FRI>(0, domain_size);
+
+                    std::size_t base_index = domain_size / (FRI::m * FRI::m);
+                    std::size_t prev_half_size = 1;
+                    std::size_t i = 1;
+                    while (i < coset_size / FRI::m) {
+                        for (std::size_t j = 0; j < prev_half_size; j++) {
+                            offsets[2 * i] = (base_index + offsets[2 * j]) % domain_size;
+                            offsets[2 * i + 1] = get_paired_index<FRI>(offsets[2 * i], domain_size);
+                            i++;
+                        }
+                        base_index /= FRI::m;
+                        prev_half_size <<= 1;
+                    }
+                    return offsets;
+                }
+
+                // Builds the precommitment tree straight from the evaluations: value(p, i) is the value of the
+                // polynomial p at the point i of the domain. Each task serializes only the few leaves it hashes
+                // at once, the whole set of leaves is never kept in memory.
+                template<typename FRI, typename ValueGetter>
+                static typename FRI::precommitment_type precommit_leaves(const std::size_t list_size,
+                                                                         const std::size_t domain_size,
+                                                                         const std::size_t fri_step,
+                                                                         ValueGetter value) {
+                    typedef typename FRI::merkle_tree_hash_type hash_type;
+
+                    const std::size_t coset_size = 1 << fri_step;
+                    const std::size_t leafs_number = domain_size / coset_size;
+                    const std::vector<std::size_t> offsets = get_leaf_offsets<FRI>(domain_size, coset_size);
+
+                    return containers::make_merkle_tree_with_leaf_hasher<hash_type, FRI::m>(
+                        leafs_number,
+                        [&offsets, &value, list_size, domain_size, coset_size](std::size_t begin, std::size_t count,
+                                                                               auto *out) {
+                            constexpr std::size_t group_size = containers::detail::merkle_leaves_batch_size<hash_type>();
+                            std::vector<detail::fri_field_element_consumer<FRI>> leaves(
+                                std::min(count, group_size),
+                                detail::fri_field_element_consumer<FRI>(coset_size * list_size));
+
+                            for (std::size_t i = 0; i < count; i += group_size) {
+                                const std::size_t group = std::min(group_size, count - i);
+                                for (std::size_t j = 0; j < group; j++) {
+                                    auto &element_consumer = leaves[j].reset_cursor();
+                                    const std::size_t x_index = begin + i + j;
+                                    for (std::size_t polynom_index = 0; polynom_index < list_size; polynom_index++) {
+                                        for (std::size_t offset : offsets) {
+                                            element_consumer.consume(
+                                                value(polynom_index, (x_index + offset) % domain_size));
+                                        }
+                                    }
+                                }
+                                containers::detail::hash_merkle_leaves<hash_type>(leaves.begin(), group, out + i);
+                            }
+                        });
+                }
+
                 template<typename FRI, typename polynomial_dfs_type>
                     requires((math::is_any_polynomial_dfs<polynomial_dfs_type>::value) &&
                              algebra::is_field_element<
@@ -426,43 +496,9 @@ namespace nil {
                         throw std::runtime_error("Polynomial size does not match the domain size in FRI precommit.");
                     }
 
-                    std::size_t domain_size = D->size();
-                    std::size_t coset_size = 1 << fri_step;
-                    std::size_t leafs_number = domain_size / coset_size;
-                    std::vector<detail::fri_field_element_consumer<FRI>> y_data(
-                        leafs_number,
-                        detail::fri_field_element_consumer<FRI>(coset_size)
-                    );
-
-                    for (std::size_t x_index = 0; x_index < leafs_number; x_index++) {
-                        std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
-                        s_indices[0][0] = x_index;
-                        s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
-
-                        auto& element_consumer = y_data[x_index].reset_cursor();
-                        element_consumer.consume(f[s_indices[0][0]]);
-                        element_consumer.consume(f[s_indices[0][1]]);
-
-                        std::size_t base_index = domain_size / (FRI::m * FRI::m);
-                        std::size_t prev_half_size = 1;
-                        std::size_t i = 1;
-                        while (i < coset_size / FRI::m) {
-                            for (std::size_t j = 0; j < prev_half_size; j++) {
-                                s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
-                                s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
-
-                                element_consumer.consume(f[s_indices[i][0]]);
-                                element_consumer.consume(f[s_indices[i][1]]);
-
-                                i++;
-                            }
-                            base_index /= FRI::m;
-                            prev_half_size <<= 1;
-                        }
-                    }
-
-                    return containers::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::m>(y_data.begin(),
-                                                                                                     y_data.end());
+                    return precommit_leaves<FRI>(
+                        1, D->size(), fri_step,
+                        [&f](std::size_t, std::size_t index) -> const auto & { return f[index]; });
                 }
 
                 template<typename FRI,
@@ -513,76 +549,28 @@ namespace nil {
                     PROFILE_SCOPE("Basic FRI precommit");
 
                     TAGGED_PROFILE_SCOPE("{low level} FFT", "Resize polynomials");
-                    // Resize uses low level thread pool, so we need to use the high
-                    // level one here.
-                    parallel_for(
-                        0, poly.size(),
-                        [&poly, &D](std::size_t i) {
-                            if (poly[i].size() != D->size()) {
-                                poly[i].resize(D->size());
-                            }
-                        },
-                        ThreadPool::PoolLevel::HIGH);
-                    PROFILE_SCOPE_END();
-
-                    TAGGED_PROFILE_SCOPE("{low level} hash",
-                                         "Create field element consumers");
-                    std::size_t domain_size = D->size();
-                    std::size_t list_size = poly.size();
-                    std::size_t coset_size = 1 << fri_step;
-                    std::size_t leafs_number = domain_size / coset_size;
-                    std::vector<detail::fri_field_element_consumer<FRI>> y_data(
-                        leafs_number,
-                        detail::fri_field_element_consumer<FRI>(coset_size * list_size)
-                    );
-                    PROFILE_SCOPE_END();
-
-                    TAGGED_PROFILE_SCOPE("{low level} hash", "Precommit leafs");
-                    parallel_for(
-                        0, leafs_number,
-                        [&y_data, &poly, domain_size, coset_size,
-                         list_size](std::size_t x_index) {
-                            auto &element_consumer = y_data[x_index].reset_cursor();
-                            for (std::size_t polynom_index = 0; polynom_index < list_size;
-                                 polynom_index++) {
-                                std::vector<std::array<std::size_t, FRI::m>> s_indices(
-                                    coset_size / FRI::m);
-                                s_indices[0][0] = x_index;
-                                s_indices[0][1] =
-                                    get_paired_index<FRI>(x_index, domain_size);
-
-                                element_consumer.consume(
-                                    poly[polynom_index][s_indices[0][0]]);
-                                element_consumer.consume(
-                                    poly[polynom_index][s_indices[0][1]]);
-
-                                std::size_t base_index = domain_size / (FRI::m * FRI::m);
-                                std::size_t prev_half_size = 1;
-                                std::size_t i = 1;
-                                while (i < coset_size / FRI::m) {
-                                    for (std::size_t j = 0; j < prev_half_size; j++) {
-                                        s_indices[i][0] =
-                                            (base_index + s_indices[j][0]) % domain_size;
-                                        s_indices[i][1] = get_paired_index<FRI>(
-                                            s_indices[i][0], domain_size);
-                                        element_consumer.consume(
-                                            poly[polynom_index][s_indices[i][0]]);
-                                        element_consumer.consume(
-                                            poly[polynom_index][s_indices[i][1]]);
-
-                                        i++;
-                                    }
-                                    base_index /= FRI::m;
-                                    prev_half_size <<= 1;
+                    if constexpr (requires { math::polynomial_batch_resize(poly, D->size()); }) {
+                        math::polynomial_batch_resize(poly, D->size());
+                    } else {
+                        // Resize uses low level thread pool, so we need to use the high
+                        // level one here.
+                        parallel_for(
+                            0, poly.size(),
+                            [&poly, &D](std::size_t i) {
+                                if (poly[i].size() != D->size()) {
+                                    poly[i].resize(D->size());
                                 }
-                            }
-                        });
+                            },
+                            ThreadPool::PoolLevel::HIGH);
+                    }
                     PROFILE_SCOPE_END();
 
                     TAGGED_PROFILE_SCOPE("{low level} hash", "Make merkle tree");
-
-                    return containers::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::m>(y_data.begin(),
-                                                                                                     y_data.end());
+                    return precommit_leaves<FRI>(
+                        poly.size(), D->size(), fri_step,
+                        [&poly](std::size_t polynom_index, std::size_t index) -> const auto & {
+                            return poly[polynom_index][index];
+                        });
                 }
 
                 template<typename FRI, typename ContainerType,
@@ -1130,7 +1118,8 @@ namespace nil {
 
                     if (fri_params.use_grinding) {
                         PROFILE_SCOPE("Basic FRI grinding phase");
-                        return FRI::grinding_type::generate(transcript, fri_params.grinding_parameter);
+                        return FRI::grinding_type::generate(transcript, fri_params.grinding_parameter,
+                                                            fri_params.grinding_seed);
                     }
                     return typename FRI::grinding_type::output_type();
                 }
@@ -1210,12 +1199,25 @@ namespace nil {
                     return alphas;
                 }
 
+                // Merkle nodes authenticated by the query proofs checked so far. Queries of one FRI proof open
+                // the same trees, so their paths share the upper nodes which need to be hashed only once.
+                template<typename FRI>
+                struct validated_merkle_nodes {
+                    using nodes_type = typename FRI::merkle_proof_type::validated_nodes_type;
+
+                    // by batch id
+                    std::map<std::size_t, nodes_type> initial;
+                    // by FRI round
+                    std::vector<nodes_type> rounds;
+                };
+
                 template<typename FRI>
                 static bool verify_initial_proof(
                     const std::map<std::size_t, typename FRI::initial_proof_type>& initial_proof,
                     const std::map<std::size_t, typename FRI::commitment_type>& commitments,
                     const std::vector<std::pair<std::size_t, std::size_t>>& correct_order_idx,
-                    std::size_t coset_size
+                    std::size_t coset_size,
+                    validated_merkle_nodes<FRI>* validated_nodes = nullptr
                     ) {
                     for (auto const &it: initial_proof) {
                         auto k = it.first;
@@ -1233,7 +1235,10 @@ namespace nil {
                                 leaf_data.consume(initial_proof.at(k).values[i][idx][1]);
                             }
                         }
-                        if (!initial_proof.at(k).p.validate(leaf_data)) {
+                        const bool valid = validated_nodes
+                            ? initial_proof.at(k).p.validate(leaf_data, validated_nodes->initial[k])
+                            : initial_proof.at(k).p.validate(leaf_data);
+                        if (!valid) {
                             BOOST_LOG_TRIVIAL(info) << "FRI verification failed: Wrong initial proof.";
                             return false;
                         }
@@ -1323,7 +1328,8 @@ namespace nil {
                     size_t i,
                     std::uint64_t& x_index,
                     std::size_t& domain_size,
-                    std::size_t& t
+                    std::size_t& t,
+                    validated_merkle_nodes<FRI>* validated_nodes = nullptr
                 ) {
                     size_t coset_size = 1 << fri_params.step_list[i];
                     if (round_proof.p.root() != fri_root) {
@@ -1340,7 +1346,13 @@ namespace nil {
                         leaf_data.consume(y[idx][0]);
                         leaf_data.consume(y[idx][1]);
                     }
-                    if (!round_proof.p.validate(leaf_data)) {
+                    if (validated_nodes && validated_nodes->rounds.size() <= i) {
+                        validated_nodes->rounds.resize(fri_params.step_list.size());
+                    }
+                    const bool valid = validated_nodes
+                        ? round_proof.p.validate(leaf_data, validated_nodes->rounds[i])
+                        : round_proof.p.validate(leaf_data);
+                    if (!valid) {
                         BOOST_LOG_TRIVIAL(info) << "Wrong round merkle proof on " << i << "-th round";
                         return false;
                     }
@@ -1445,7 +1457,8 @@ namespace nil {
                     typename FRI::transcript_type &transcript,
                     typename FRI::polynomial_values_type& combined_Q_y_out,
                     typename FRI::field_type::value_type& x_out,
-                    std::uint64_t& x_index_out
+                    std::uint64_t& x_index_out,
+                    validated_merkle_nodes<FRI>* validated_nodes = nullptr
                 ) {
                     typename FRI::field_type::value_type x_challenge =
                         transcript.template challenge<typename FRI::field_type>();
@@ -1459,7 +1472,7 @@ namespace nil {
                     auto correct_order_idx = get_correct_order<FRI>(x_index_out, domain_size, fri_params.step_list[0], s_indices);
 
                     // Check initial proof.
-                    if (!verify_initial_proof<FRI>(initial_proof, commitments, correct_order_idx, coset_size)) {
+                    if (!verify_initial_proof<FRI>(initial_proof, commitments, correct_order_idx, coset_size, validated_nodes)) {
                         BOOST_LOG_TRIVIAL(info) << "Initial FRI proof/consistency check verification failed.";
                         return false;
                     }
@@ -1510,7 +1523,8 @@ namespace nil {
                     const math::polynomial<typename FRI::field_type::value_type>& final_polynomial,
                     const std::size_t coset_size,
                     std::size_t domain_size,
-                    typename FRI::transcript_type &transcript
+                    typename FRI::transcript_type &transcript,
+                    validated_merkle_nodes<FRI>* validated_nodes = nullptr
                 ) {
                     typename FRI::field_type::value_type x;
                     std::uint64_t x_index;
@@ -1520,7 +1534,7 @@ namespace nil {
                     size_t starting_index = 0;
                     if (!verify_initial_proof_and_return_combined_Q_values<FRI>(
                             query_proof.initial_proof, combined_U, poly_ids, denominators, fri_params, commitments, theta, coset_size, domain_size,
-                            starting_index, transcript, y, x, x_index)) {
+                            starting_index, transcript, y, x, x_index, validated_nodes)) {
                         return false;
                     }
 
@@ -1528,7 +1542,7 @@ namespace nil {
                     std::size_t t = 0;
                     for (std::size_t i = 0; i < fri_params.step_list.size(); i++) {
                         if (!verify_round_proof<FRI>(query_proof.round_proofs[i], y, fri_params,
-                                                     alphas, fri_roots[i], i, x_index, domain_size, t))
+                                                     alphas, fri_roots[i], i, x_index, domain_size, t, validated_nodes))
                             return false;
                     }
 
@@ -1562,9 +1576,11 @@ namespace nil {
                     std::size_t domain_size = fri_params.D[0]->size();
                     std::size_t coset_size = 1 << fri_params.step_list[0];
 
+                    validated_merkle_nodes<FRI> validated_nodes;
                     for (std::size_t query_id = 0; query_id < fri_params.lambda; query_id++) {
                         if (!verify_query_proof<FRI>(proof.query_proofs[query_id], combined_U, poly_ids, denominators, fri_params, commitments,
-                                                     theta, alphas, proof.fri_roots, proof.final_polynomial, coset_size, domain_size, transcript))
+                                                     theta, alphas, proof.fri_roots, proof.final_polynomial, coset_size, domain_size, transcript,
+                                                     &validated_nodes))
                             return false;
                     }
 
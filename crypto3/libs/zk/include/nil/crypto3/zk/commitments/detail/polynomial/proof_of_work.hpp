@@ -27,9 +27,17 @@
 #define CRYPTO3_PROOF_OF_WORK_HPP
 
 #include <boost/property_tree/ptree.hpp>
+#include <boost/random/random_device.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <optional>
 
+#include <nil/crypto3/hash/multi_lane_hash.hpp>
 #include <nil/crypto3/random/algebraic_engine.hpp>
 #include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
 #include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
@@ -41,6 +49,45 @@ namespace nil {
     namespace crypto3 {
         namespace zk {
             namespace commitments {
+                namespace detail {
+                    /*!
+                     * @brief Returns the smallest nonce offset accepted by search, scanning blocks of per_block offsets
+                     * on the low level pool. search(first, count) checks the offsets first, ..., first + count - 1 and
+                     * returns the position of the first accepted one, or count if there is none.
+                     * Every worker stops as soon as it passes the best offset found so far, and the smallest one wins,
+                     * so the result does not depend on the scheduling: with a fixed seed the proof is reproducible.
+                     */
+                    template<typename Search>
+                    std::size_t grind(std::size_t per_block, std::size_t batch_size, Search search) {
+                        constexpr std::size_t not_found = std::numeric_limits<std::size_t>::max();
+                        std::atomic<std::size_t> found = not_found;
+
+                        for (std::size_t block = 0;; block += per_block) {
+                            wait_for_all(parallel_run_in_chunks<void>(
+                                per_block,
+                                [&found, &search, block, batch_size](std::size_t begin, std::size_t end) {
+                                    for (std::size_t i = block + begin; i < block + end && i < found;
+                                         i += batch_size) {
+                                        const std::size_t count = std::min(batch_size, block + end - i);
+                                        const std::size_t position = search(i, count);
+                                        if (position < count) {
+                                            std::size_t current = found;
+                                            while (i + position < current &&
+                                                   !found.compare_exchange_weak(current, i + position)) {
+                                            }
+                                            break;
+                                        }
+                                    }
+                                },
+                                ThreadPool::PoolLevel::LOW));
+
+                            if (found != not_found) {
+                                return found;
+                            }
+                        }
+                    }
+                }    // namespace detail
+
                 template<typename TranscriptHashType, typename OutType = std::uint32_t>
                 class proof_of_work {
                 public:
@@ -58,49 +105,46 @@ namespace nil {
                             return bytes;
                         }
 
-                    static inline OutType generate(transcript_type &transcript, std::size_t grinding_bits = 16) {
+                    /*!
+                     * @brief Finds a nonce such that the challenge drawn after absorbing it has grinding_bits zero low
+                     * bits, and absorbs it into the transcript. The nonces are tried in order from seed, a random
+                     * one if no seed is given.
+                     */
+                    static inline OutType generate(transcript_type &transcript, std::size_t grinding_bits = 16,
+                                                   std::optional<std::uint64_t> seed = std::nullopt) {
                         BOOST_ASSERT_MSG(grinding_bits < 64, "Grinding parameter should be bits, not mask");
                         output_type mask = grinding_bits > 0 ? ( 1ULL << grinding_bits ) - 1 : 0;
-                        output_type pow_seed = std::rand();
+                        static boost::random::random_device dev;
+                        output_type pow_seed = seed ? static_cast<output_type>(*seed) : static_cast<output_type>(dev());
 
                         /* Enough work for ~ two minutes on 48 cores, keccak<512> */
                         std::size_t per_block = 1 << 30;
 
-                        std::atomic<bool> challenge_found = false;
-                        std::atomic<std::size_t> pow_value_offset;
-
-                        while( true ) {
-                            wait_for_all(parallel_run_in_chunks<void>(
-                                per_block,
-                                [&transcript, &pow_seed, &challenge_found, &pow_value_offset, &mask](std::size_t pow_start, std::size_t pow_finish) {
-                                    std::size_t i = pow_start;
-                                    while ( i < pow_finish ) {
-                                        if (challenge_found) {
-                                            break;
-                                        }
+                        std::size_t pow_value_offset;
+                        if constexpr (hashes::multi_lane_hash<transcript_hash_type>::enabled) {
+                            pow_value_offset = detail::grind(
+                                per_block, multi_lane_batch_size,
+                                [&transcript, pow_seed, mask](std::size_t first, std::size_t count) {
+                                    return search_multi_lane(transcript.get_state(), pow_seed, mask, first, count);
+                                });
+                        } else {
+                            pow_value_offset = detail::grind(
+                                per_block, 1,
+                                [&transcript, pow_seed, mask](std::size_t first, std::size_t count) {
+                                    for (std::size_t i = 0; i < count; ++i) {
                                         transcript_type tmp_transcript = transcript;
-                                        tmp_transcript(to_byte_array(pow_seed + i));
-                                        OutType pow_result = tmp_transcript.template int_challenge<OutType>();
-                                        if ( ((pow_result & mask) == 0) && !challenge_found ) {
-                                            bool expected = false;
-                                            if (challenge_found.compare_exchange_strong(expected, true)) {
-                                                pow_value_offset = i;
-                                            }
-                                            break;
+                                        tmp_transcript(to_byte_array(pow_seed + first + i));
+                                        if ((tmp_transcript.template int_challenge<OutType>() & mask) == 0) {
+                                            return i;
                                         }
-                                        ++i;
                                     }
-                                }, ThreadPool::PoolLevel::LOW));
-
-                            if (challenge_found) {
-                                break;
-                            }
-                            pow_seed += per_block;
+                                    return count;
+                                });
                         }
 
-                        transcript(to_byte_array(pow_seed + (std::size_t)pow_value_offset));
+                        transcript(to_byte_array(pow_seed + pow_value_offset));
                         transcript.template int_challenge<OutType>();
-                        return pow_seed + (std::size_t)pow_value_offset;
+                        return pow_seed + pow_value_offset;
                     }
 
                     static inline bool verify(transcript_type &transcript, output_type proof_of_work, std::size_t grinding_bits = 16) {
@@ -110,6 +154,57 @@ namespace nil {
                         output_type mask = grinding_bits > 0 ? ( 1ULL << grinding_bits ) - 1 : 0;
                         return ((result & mask) == 0);
                     }
+
+                private:
+                    // Nonces checked between two looks at the other workers' progress.
+                    constexpr static const std::size_t multi_lane_batch_size = 1024;
+
+                    /*!
+                     * The challenge for a nonce is H(H(state || nonce)), of which int_challenge takes the last bytes
+                     * as a big-endian number. Both hashes have fixed length inputs, so the nonces are hashed in
+                     * lanes with the transcript state copied into every message once.
+                     */
+                    static std::size_t search_multi_lane(const typename transcript_hash_type::digest_type &state,
+                                                         output_type pow_seed, output_type mask, std::size_t first,
+                                                         std::size_t count) {
+                        using multi_lane_type = hashes::multi_lane_hash<transcript_hash_type>;
+                        using digest_type = typename multi_lane_type::digest_type;
+                        constexpr std::size_t lanes = multi_lane_type::lanes;
+                        constexpr std::size_t digest_bytes = transcript_hash_type::digest_bits / 8;
+                        static_assert(sizeof(OutType) <= digest_bytes);
+
+                        std::array<std::array<std::uint8_t, digest_bytes + sizeof(OutType)>, lanes> messages;
+                        std::array<const std::uint8_t *, lanes> message_pointers;
+                        std::array<digest_type, lanes> inner, outer;
+                        std::array<const std::uint8_t *, lanes> inner_pointers;
+                        for (std::size_t lane = 0; lane < lanes; ++lane) {
+                            std::copy(state.begin(), state.end(), messages[lane].begin());
+                            message_pointers[lane] = messages[lane].data();
+                            inner_pointers[lane] = inner[lane].data();
+                        }
+
+                        for (std::size_t i = 0; i < count; i += lanes) {
+                            const std::size_t group = std::min(lanes, count - i);
+                            for (std::size_t lane = 0; lane < group; ++lane) {
+                                auto nonce = to_byte_array(pow_seed + first + i + lane);
+                                std::copy(nonce.begin(), nonce.end(), messages[lane].begin() + digest_bytes);
+                            }
+                            multi_lane_type::hash(message_pointers.data(), digest_bytes + sizeof(OutType), group,
+                                                  inner.data());
+                            multi_lane_type::hash(inner_pointers.data(), digest_bytes, group, outer.data());
+
+                            for (std::size_t lane = 0; lane < group; ++lane) {
+                                output_type result = 0;
+                                for (std::size_t j = digest_bytes - sizeof(OutType); j < digest_bytes; ++j) {
+                                    result = (result << 8) | outer[lane][j];
+                                }
+                                if ((result & mask) == 0) {
+                                    return i + lane;
+                                }
+                            }
+                        }
+                        return count;
+                    }
                 };
 
                 // Note that the interface here is slightly different from the one above:
@@ -124,10 +219,11 @@ namespace nil {
                     using value_type = typename FieldType::value_type;
                     using integral_type = typename FieldType::integral_type;
 
-                    static inline value_type generate(transcript_type &transcript, std::size_t GrindingBits=16) {
+                    static inline value_type generate(transcript_type &transcript, std::size_t GrindingBits=16,
+                                                      std::optional<std::uint64_t> seed = std::nullopt) {
                         static boost::random::random_device dev;
                         static nil::crypto3::random::algebraic_engine<FieldType> random_engine(dev);
-                        value_type pow_seed = random_engine();
+                        value_type pow_seed = seed ? value_type(*seed) : random_engine();
 
                         integral_type mask =
                             (GrindingBits > 0 ?
@@ -137,43 +233,24 @@ namespace nil {
                         /* Enough work for ~ two minutes on 48 cores, poseidon<pallas> */
                         std::size_t per_block = 1 << 23;
 
-                        std::atomic<bool> challenge_found = false;
-                        std::atomic<std::size_t> pow_value_offset;
-
-                        while( true ) {
-                            wait_for_all(parallel_run_in_chunks<void>(
-                                per_block,
-                                [&transcript, &pow_seed, &challenge_found, &pow_value_offset, &mask](std::size_t pow_start, std::size_t pow_finish) {
-                                    std::size_t i = pow_start;
-                                    while ( i < pow_finish ) {
-                                        if (challenge_found) {
-                                            break;
-                                        }
-                                        transcript_type tmp_transcript = transcript;
-                                        tmp_transcript(pow_seed + i);
-                                        integral_type pow_result = integral_type(
-                                            tmp_transcript.template challenge<FieldType>()
-                                                .to_integral());
-                                        if ( ((pow_result & mask) == 0) && !challenge_found ) {
-                                            bool expected = false;
-                                            if (challenge_found.compare_exchange_strong(expected, true)) {
-                                                pow_value_offset = i;
-                                            }
-                                            break;
-                                        }
-                                        ++i;
+                        std::size_t pow_value_offset = detail::grind(
+                            per_block, 1,
+                            [&transcript, &pow_seed, &mask](std::size_t first, std::size_t count) {
+                                for (std::size_t i = 0; i < count; ++i) {
+                                    transcript_type tmp_transcript = transcript;
+                                    tmp_transcript(pow_seed + first + i);
+                                    integral_type pow_result = integral_type(
+                                        tmp_transcript.template challenge<FieldType>().to_integral());
+                                    if ((pow_result & mask) == 0) {
+                                        return i;
                                     }
-                                }, ThreadPool::PoolLevel::LOW));
-
-                            if (challenge_found) {
-                                break;
-                            }
-                            pow_seed += per_block;
-                        }
+                                }
+                                return count;
+                            });
 
-                        transcript(pow_seed + (std::size_t)pow_value_offset);
+                        transcript(pow_seed + pow_value_offset);
                         transcript.template challenge<FieldType>();
-                        return pow_seed + (std::size_t)pow_value_offset;
+                        return pow_seed + pow_value_offset;
                     }
 
                     static inline bool verify(transcript_type &transcript, value_type proof_of_work, std::size_t GrindingBits = 16) {
@@ -29,6 +29,7 @@
 #ifndef CRYPTO3_ZK_COMMITMENTS_KZG_HPP
 #define CRYPTO3_ZK_COMMITMENTS_KZG_HPP
 
+#include <memory>
 #include <tuple>
 #include <vector>
 #include <set>
@@ -45,6 +46,7 @@
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
 #include <nil/crypto3/algebra/multiexp/multiexp.hpp>
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/algebra/multiexp/pippenger.hpp>
 #include <nil/crypto3/algebra/random_element.hpp>
 #include <nil/crypto3/hash/block_to_field_elements_wrapper.hpp>
 
@@ -77,7 +79,7 @@ namespace nil {
                     typedef CurveType curve_type;
                     typedef typename curve_type::gt_type::value_type gt_value_type;
 
-                    using multiexp_method = typename algebra::policies::multiexp_method_BDLO12;
+                    using multiexp_method = typename algebra::policies::multiexp_method_pippenger;
                     using field_type = typename curve_type::scalar_field_type;
                     using scalar_value_type = typename curve_type::scalar_field_type::value_type;
                     using single_commitment_type = std::vector<typename curve_type::template g1_type<>::value_type>;
@@ -119,6 +121,19 @@ namespace nil {
 
                         params_type(single_commitment_type ck, verification_key_type vk) :
                                 commitment_key(ck), verification_key(vk) {}
+
+                        using commitment_table_type = algebra::multiexp_precomputed_table<commitment_type, field_type>;
+
+                        /// Multiples of the commitment key for algebra::multiexp_precomputed_table, shared by the copies
+                        /// of the params. Commits go through it once it is built, at windows_count times the key memory.
+                        std::shared_ptr<const commitment_table_type> commitment_table;
+
+                        void precompute_commitment_key(std::size_t window_bits = 0) {
+                            if (!commitment_table) {
+                                commitment_table = std::make_shared<const commitment_table_type>(
+                                        commitment_key.begin(), commitment_key.end(), window_bits);
+                            }
+                        }
                     };
 
                     struct public_key_type {
@@ -146,6 +161,9 @@ namespace nil {
                 commit(const typename CommitmentSchemeType::params_type &params,
                        const typename math::polynomial<typename CommitmentSchemeType::scalar_value_type> &f) {
                     BOOST_ASSERT(f.size() <= params.commitment_key.size());
+                    if (params.commitment_table) {
+                        return params.commitment_table->process(f.begin(), f.end());
+                    }
                     return algebra::multiexp<typename CommitmentSchemeType::multiexp_method>(
                             params.commitment_key.begin(),
                             params.commitment_key.begin() + f.size(),
@@ -244,7 +262,7 @@ namespace nil {
                     typedef TranscriptHashType transcript_hash_type;
                     typedef typename curve_type::gt_type::value_type gt_value_type;
 
-                    using multiexp_method = typename algebra::policies::multiexp_method_BDLO12;
+                    using multiexp_method = typename algebra::policies::multiexp_method_pippenger;
                     using field_type = typename curve_type::scalar_field_type;
                     using scalar_value_type = typename curve_type::scalar_field_type::value_type;
                     using single_commitment_type = typename curve_type::template g1_type<>::value_type;
@@ -312,8 +330,23 @@ namespace nil {
                         params_type operator=(const params_type &other) {
                             commitment_key = other.commitment_key;
                             verification_key = other.verification_key;
+                            commitment_table = other.commitment_table;
                             return *this;
                         }
+
+                        using commitment_table_type =
+                                algebra::multiexp_precomputed_table<single_commitment_type, field_type>;
+
+                        /// Multiples of the commitment key for algebra::multiexp_precomputed_table, shared by the copies
+                        /// of the params. Commits go through it once it is built, at windows_count times the key memory.
+                        std::shared_ptr<const commitment_table_type> commitment_table;
+
+                        void precompute_commitment_key(std::size_t window_bits = 0) {
+                            if (!commitment_table) {
+                                commitment_table = std::make_shared<const commitment_table_type>(
+                                        commitment_key.begin(), commitment_key.end(), window_bits);
+                            }
+                        }
                     };
 
                     struct public_key_type {
@@ -405,6 +438,9 @@ namespace nil {
                 commit_one(const typename CommitmentSchemeType::params_type &params,
                            const typename math::polynomial<typename CommitmentSchemeType::field_type::value_type> &poly) {
                     BOOST_ASSERT(poly.size() <= params.commitment_key.size());
+                    if (params.commitment_table) {
+                        return params.commitment_table->process(poly.begin(), poly.end());
+                    }
                     return algebra::multiexp<typename CommitmentSchemeType::multiexp_method>(
                             params.commitment_key.begin(),
                             params.commitment_key.begin() + poly.size(),
@@ -423,6 +459,9 @@ namespace nil {
                         const typename math::polynomial_dfs<typename CommitmentSchemeType::field_type::value_type> &poly) {
                     auto poly_normal = poly.coefficients();
                     BOOST_ASSERT(poly_normal.size() <= params.commitment_key.size());
+                    if (params.commitment_table) {
+                        return params.commitment_table->process(poly_normal.begin(), poly_normal.end());
+                    }
                     return algebra::multiexp<typename CommitmentSchemeType::multiexp_method>(
                             params.commitment_key.begin(),
                             params.commitment_key.begin() +
@@ -740,7 +779,10 @@ namespace nil {
                     void set_fixed_polys_values(const preprocessed_data_type& value) {
                     }
 
-                    kzg_commitment_scheme(params_type kzg_params) : _params(kzg_params) {}
+                    // Every commit of the scheme is over the same SRS, its multiples are computed once here.
+                    kzg_commitment_scheme(params_type kzg_params) : _params(kzg_params) {
+                        _params.precompute_commitment_key();
+                    }
 
                     // Differs from static, because we pack the result into byte blob.
                     commitment_type commit(std::size_t index) {
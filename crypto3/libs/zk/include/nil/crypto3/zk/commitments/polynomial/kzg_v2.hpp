@@ -189,6 +189,8 @@ namespace nil {
 
                     kzg_commitment_scheme_v2(params_type kzg_params) : _params(kzg_params) {
                         BOOST_ASSERT(kzg_params.verification_key.size() == 2);
+                        // Every commit of the scheme is over the same SRS, its multiples are computed once here.
+                        _params.precompute_commitment_key();
                     }
 
                     // Differs from static, because we pack the result into byte blob.
@@ -536,7 +536,8 @@ namespace nil {
                         const std::map<std::size_t, commitment_type> &commitments,
                         transcript_type &transcript
                     ) {
-                        PROFILE_SCOPE("LPC verify eval");
+                        // parallel scope, proofs of a batch are verified concurrently
+                        PARALLEL_PROFILE_SCOPE("LPC verify eval");
                         this->_z = proof.z;
                         for (auto const &it: commitments) {
                             transcript(commitments.at(it.first));
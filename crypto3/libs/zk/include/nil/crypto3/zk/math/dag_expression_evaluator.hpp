@@ -39,6 +39,7 @@
 
 #include <nil/crypto3/zk/math/expression.hpp>
 #include <nil/crypto3/zk/math/dag_expression.hpp>
+#include <nil/crypto3/zk/math/dag_expression_program.hpp>
 
 #include <nil/crypto3/bench/scoped_profiler.hpp>
 
@@ -63,18 +64,10 @@ namespace nil::crypto3::zk::snark {
 
         dag_expression_evaluator(const dag_expression<polynomial_dfs_variable_type>& expr, size_t max_degree)
             : _expr(expr)
+            , _program(expr)
             , _max_degree(max_degree) {
         }
 
-        simd_vector_type get_variable_value_chunk(
-                const cached_assignment_table_type& _cached_assignment_table,
-                const simd_vector_variable_type& var,
-                size_t extended_domain_size,
-                size_t begin, size_t j) {
-            return math::get_chunk<mini_chunk_size>(
-                *_cached_assignment_table.get(var, extended_domain_size), begin, j);
-        }
-
         /** \Brief Computes the evaluation results of all the expressions.
          *  We must take care about converting everything we need to a simd type and parallelize here.
          *  The provided cache must already contain all the required variables in the required sizes.
@@ -95,20 +88,19 @@ namespace nil::crypto3::zk::snark {
                 result.push_back(polynomial_dfs_type(degree, extended_domain_size));
             }
 
+            std::vector<const polynomial_dfs_type*> variable_values;
+            for (const auto& variable : _program.get_variables()) {
+                variable_values.push_back(_cached_assignment_table.get(variable, extended_domain_size).get());
+            }
+
             wait_for_all(parallel_run_in_chunks<void>(
                 extended_domain_size,
-                [this, &_cached_assignment_table, &result, extended_domain_size](
-                    std::size_t begin, std::size_t end) {
+                [this, &variable_values, &result](std::size_t begin, std::size_t end) {
                     auto count = math::count_chunks<mini_chunk_size>(end - begin);
 
-                    std::vector<simd_vector_type> assignment_chunks(this->_expr.get_nodes_count());
+                    std::vector<simd_vector_type> registers(this->_program.get_register_count());
                     for (std::size_t j = 0; j < count; ++j) {
-                        this->compute_dag_chunk_values(
-                            assignment_chunks, _cached_assignment_table, extended_domain_size, begin, j);
-
-                        for (std::size_t k = 0; k < this->_expr.get_root_nodes_count(); ++k) {
-                            math::set_chunk(result[k], begin, j, assignment_chunks[this->_expr.get_root_node(k)]);
-                        }
+                        this->_program.execute(registers, variable_values, result, begin, j);
                     }
                 },
                 ThreadPool::PoolLevel::HIGH
@@ -119,49 +111,8 @@ namespace nil::crypto3::zk::snark {
         }
 
     private:
-
-        // TODO(martun): change this function to use a visitor class.
-        /** \brief Computes all the values of DAG assignments for the given chunk.
-         *  This function is called from multiple threads
-         *  to compute the final results for the whole DAG.
-         *
-         *  \param[out] assignment_chunks - Computed values for the current chunk for each DAG node.
-         */
-        void compute_dag_chunk_values(std::vector<simd_vector_type>& assignment_chunks,
-                                      const cached_assignment_table_type& _cached_assignment_table,
-                                      size_t extended_domain_size, size_t begin, size_t j) {
-            const auto& nodes = _expr.get_nodes();
-
-            for (size_t k = 0; k < nodes.size(); ++k) {
-                const auto& node = nodes[k];
-                if (std::holds_alternative<dag_constant<polynomial_dfs_variable_type>>(node)) {
-                    assignment_chunks[k] = math::get_chunk<mini_chunk_size>(
-                            std::get<dag_constant<polynomial_dfs_variable_type>>(node).value, begin, j);
-                } else if (std::holds_alternative<dag_variable<polynomial_dfs_variable_type>>(node)) {
-                    assignment_chunks[k] = get_variable_value_chunk(
-                        _cached_assignment_table,
-                        std::get<dag_variable<polynomial_dfs_variable_type>>(node).variable,
-                        extended_domain_size, begin, j);
-                } else if (std::holds_alternative<dag_addition>(node)) {
-                    const auto& add = std::get<dag_addition>(node);
-                    assignment_chunks[k] = assignment_chunks[add.operands[0]];
-                    for (std::size_t i = 1; i < add.operands.size(); i++) {
-                        assignment_chunks[k] += assignment_chunks[add.operands[i]];
-                    }
-                } else if (std::holds_alternative<dag_multiplication>(node)) {
-                    const auto& mul = std::get<dag_multiplication>(node);
-                    assignment_chunks[k] = assignment_chunks[mul.operands[0]];
-                    for (std::size_t i = 1; i < mul.operands.size(); i++) {
-                        assignment_chunks[k] *= assignment_chunks[mul.operands[i]];
-                    }
-                } else if (std::holds_alternative<dag_negation>(node)) {
-                    assignment_chunks[k] =
-                        -assignment_chunks[std::get<dag_negation>(node).operand];
-                }
-            }
-        }
-
         dag_expression<polynomial_dfs_variable_type> _expr;
+        dag_expression_program<FieldType> _program;
         size_t _max_degree;
     };
 
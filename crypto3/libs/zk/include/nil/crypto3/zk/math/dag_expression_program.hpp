@@ -0,0 +1,395 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef CRYPTO3_ZK_MATH_DAG_EXPRESSION_PROGRAM_HPP
+#define CRYPTO3_ZK_MATH_DAG_EXPRESSION_PROGRAM_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <tuple>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include <nil/crypto3/math/polynomial/static_simd_vector.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/variable.hpp>
+#include <nil/crypto3/zk/math/dag_expression.hpp>
+
+namespace nil::crypto3::zk::snark {
+
+    /** \brief A DAG expression lowered to a linear program over a few SIMD registers.
+     *
+     *  The nodes are numbered in SSA form first. On the way the constants of degree 0 are folded into scalars,
+     *  which become immediate operands of additions and multiplications, and equal instructions are merged.
+     *  Then every value gets a register, which is reused as soon as the last instruction reading it is done, so a
+     *  worker needs as many registers as values are alive at once, instead of one per DAG node.
+     */
+    template<typename FieldType>
+    class dag_expression_program {
+    public:
+        using value_type = typename FieldType::value_type;
+        using polynomial_dfs_type = math::polynomial_dfs<value_type>;
+        using polynomial_dfs_variable_type = plonk_variable<polynomial_dfs_type>;
+        using dag_expression_type = dag_expression<polynomial_dfs_variable_type>;
+
+        enum class opcode : std::uint8_t {
+            load_variable,    // r[dst] = chunk of variables[a]
+            load_constant,    // r[dst] = chunk of constants[a]
+            broadcast,        // r[dst] = scalars[a] in every lane
+            add,              // r[dst] = r[a] + r[b]
+            mul,              // r[dst] = r[a] * r[b]
+            add_scalar,       // r[dst] = r[a] + scalars[b]
+            mul_scalar,       // r[dst] = r[a] * scalars[b]
+            neg,              // r[dst] = -r[a]
+            store             // result[dst] = r[a]
+        };
+
+        struct instruction {
+            opcode op;
+            std::uint32_t dst;
+            std::uint32_t a;
+            std::uint32_t b;
+        };
+
+        explicit dag_expression_program(const dag_expression_type& expr) {
+            compile(expr);
+        }
+
+        /** \brief Computes chunk j of the block at begin for every root node and writes it to result.
+         *  \param registers - Scratch space of get_register_count() vectors, reused between the calls.
+         *  \param variable_values - The values of get_variables(), in the same order.
+         */
+        template<std::size_t Size>
+        void execute(std::vector<math::static_simd_vector<value_type, Size>>& registers,
+                     const std::vector<const polynomial_dfs_type*>& variable_values,
+                     std::vector<polynomial_dfs_type>& result,
+                     std::size_t begin, std::size_t j) const {
+            using simd_vector_type = math::static_simd_vector<value_type, Size>;
+            run(registers,
+                [&variable_values, begin, j](std::size_t variable, simd_vector_type& dst) {
+                    dst = math::get_chunk<Size>(*variable_values[variable], begin, j);
+                },
+                [begin, j](const polynomial_dfs_type& constant, simd_vector_type& dst) {
+                    dst = math::get_chunk<Size>(constant, begin, j);
+                },
+                [&result, begin, j](std::size_t root, const simd_vector_type& value) {
+                    math::set_chunk(result[root], begin, j, value);
+                });
+        }
+
+        /** \brief Runs the program once, over vectors of any size. Every root is handed to store as soon as it
+         *  is computed, the register holding it is reused afterwards.
+         *  \param load_variable - Called as load_variable(i, dst) to load the values of get_variables()[i].
+         *  \param load_constant - Called as load_constant(c, dst) to load the values of a constant polynomial c.
+         *  \param store - Called as store(i, value) with the values of the root i.
+         */
+        template<typename VectorType, typename LoadVariable, typename LoadConstant, typename Store>
+        void run(std::vector<VectorType>& registers, const LoadVariable& load_variable,
+                 const LoadConstant& load_constant, const Store& store) const {
+            for (const auto& ins : _instructions) {
+                if (ins.op == opcode::store) {
+                    store(ins.dst, registers[ins.a]);
+                    continue;
+                }
+                auto& dst = registers[ins.dst];
+                switch (ins.op) {
+                    case opcode::load_variable:
+                        load_variable(ins.a, dst);
+                        break;
+                    case opcode::load_constant:
+                        load_constant(_constants[ins.a], dst);
+                        break;
+                    case opcode::broadcast:
+                        dst = VectorType(_scalars[ins.a]);
+                        break;
+                    case opcode::add:
+                        // Both operations are commutative, so the destination may be either operand.
+                        if (ins.dst == ins.b) {
+                            dst += registers[ins.a];
+                        } else {
+                            if (ins.dst != ins.a) {
+                                dst = registers[ins.a];
+                            }
+                            dst += registers[ins.b];
+                        }
+                        break;
+                    case opcode::mul:
+                        if (ins.dst == ins.b) {
+                            dst *= registers[ins.a];
+                        } else {
+                            if (ins.dst != ins.a) {
+                                dst = registers[ins.a];
+                            }
+                            dst *= registers[ins.b];
+                        }
+                        break;
+                    case opcode::add_scalar:
+                        if (ins.dst != ins.a) {
+                            dst = registers[ins.a];
+                        }
+                        dst += _scalars[ins.b];
+                        break;
+                    case opcode::mul_scalar:
+                        if (ins.dst != ins.a) {
+                            dst = registers[ins.a];
+                        }
+                        dst *= _scalars[ins.b];
+                        break;
+                    case opcode::neg:
+                        dst = -registers[ins.a];
+                        break;
+                    case opcode::store:
+                        break;
+                }
+            }
+        }
+
+        const std::vector<polynomial_dfs_variable_type>& get_variables() const {
+            return _variables;
+        }
+
+        const std::vector<instruction>& get_instructions() const {
+            return _instructions;
+        }
+
+        std::size_t get_register_count() const {
+            return _register_count;
+        }
+
+    private:
+        // The value of a DAG node: a scalar known at compile time, or the result of an SSA instruction.
+        using operand_type = std::variant<value_type, std::size_t>;
+        // In SSA form a and b of the arithmetic instructions are the SSA values they read.
+        using ssa_instruction = std::tuple<opcode, std::size_t, std::size_t>;
+
+        void compile(const dag_expression_type& expr) {
+            std::vector<ssa_instruction> ssa;
+            std::map<ssa_instruction, std::size_t> numbering;
+            std::unordered_map<value_type, std::size_t> scalar_index;
+            std::unordered_map<polynomial_dfs_variable_type, std::size_t> variable_index;
+
+            auto scalar = [this, &scalar_index](const value_type& x) {
+                auto [it, inserted] = scalar_index.try_emplace(x, _scalars.size());
+                if (inserted) {
+                    _scalars.push_back(x);
+                }
+                return it->second;
+            };
+            // Returns the SSA value of the instruction, merging it with an equal one emitted before.
+            auto emit = [&ssa, &numbering](opcode op, std::size_t a, std::size_t b) {
+                if ((op == opcode::add || op == opcode::mul) && b < a) {
+                    std::swap(a, b);
+                }
+                auto [it, inserted] = numbering.try_emplace(ssa_instruction(op, a, b), ssa.size());
+                if (inserted) {
+                    ssa.emplace_back(op, a, b);
+                }
+                return it->second;
+            };
+            // Combines the operands of an addition or multiplication, folding the scalars into one.
+            auto fold = [&](const dag_operands_vector_type& operands, const std::vector<operand_type>& node_values,
+                            opcode op, value_type folded) -> operand_type {
+                std::vector<std::size_t> values;
+                for (std::size_t operand : operands) {
+                    const auto& v = node_values[operand];
+                    if (std::holds_alternative<value_type>(v)) {
+                        folded = op == opcode::add ? folded + std::get<value_type>(v)
+                                                   : folded * std::get<value_type>(v);
+                    } else {
+                        values.push_back(std::get<std::size_t>(v));
+                    }
+                }
+                if (values.empty() || (op == opcode::mul && folded.is_zero())) {
+                    return folded;
+                }
+                std::sort(values.begin(), values.end());
+                std::size_t result = values[0];
+                for (std::size_t i = 1; i < values.size(); ++i) {
+                    result = emit(op, result, values[i]);
+                }
+                if (op == opcode::add) {
+                    if (!folded.is_zero()) {
+                        result = emit(opcode::add_scalar, result, scalar(folded));
+                    }
+                } else if (folded == -value_type::one()) {
+                    result = emit(opcode::neg, result, 0);
+                } else if (folded != value_type::one()) {
+                    result = emit(opcode::mul_scalar, result, scalar(folded));
+                }
+                return result;
+            };
+
+            // The children of a node always come before it.
+            const auto& nodes = expr.get_nodes();
+            std::vector<operand_type> node_values(nodes.size());
+            for (std::size_t k = 0; k < nodes.size(); ++k) {
+                const auto& node = nodes[k];
+                if (std::holds_alternative<dag_constant<polynomial_dfs_variable_type>>(node)) {
+                    const auto& value = std::get<dag_constant<polynomial_dfs_variable_type>>(node).value;
+                    if (value.degree() == 0) {
+                        node_values[k] = value[0];
+                    } else {
+                        _constants.push_back(value);
+                        node_values[k] = emit(opcode::load_constant, _constants.size() - 1, 0);
+                    }
+                } else if (std::holds_alternative<dag_variable<polynomial_dfs_variable_type>>(node)) {
+                    const auto& variable = std::get<dag_variable<polynomial_dfs_variable_type>>(node).variable;
+                    auto [it, inserted] = variable_index.try_emplace(variable, _variables.size());
+                    if (inserted) {
+                        _variables.push_back(variable);
+                    }
+                    node_values[k] = emit(opcode::load_variable, it->second, 0);
+                } else if (std::holds_alternative<dag_addition>(node)) {
+                    node_values[k] = fold(std::get<dag_addition>(node).operands, node_values,
+                                          opcode::add, value_type::zero());
+                } else if (std::holds_alternative<dag_multiplication>(node)) {
+                    node_values[k] = fold(std::get<dag_multiplication>(node).operands, node_values,
+                                          opcode::mul, value_type::one());
+                } else if (std::holds_alternative<dag_negation>(node)) {
+                    const auto& v = node_values[std::get<dag_negation>(node).operand];
+                    if (std::holds_alternative<value_type>(v)) {
+                        node_values[k] = -std::get<value_type>(v);
+                    } else {
+                        std::size_t operand = std::get<std::size_t>(v);
+                        const auto& [op, a, b] = ssa[operand];
+                        node_values[k] = op == opcode::neg ? a : emit(opcode::neg, operand, 0);
+                    }
+                }
+            }
+
+            // Every root is stored right after its value is computed.
+            std::vector<std::vector<std::size_t>> stores(ssa.size());
+            for (std::size_t i = 0; i < expr.get_root_nodes_count(); ++i) {
+                const auto& v = node_values[expr.get_root_node(i)];
+                std::size_t value = std::holds_alternative<value_type>(v)
+                                        ? emit(opcode::broadcast, scalar(std::get<value_type>(v)), 0)
+                                        : std::get<std::size_t>(v);
+                stores.resize(ssa.size());
+                stores[value].push_back(i);
+            }
+            stores.resize(ssa.size());
+
+            allocate_registers(ssa, stores);
+        }
+
+        static bool reads_registers(opcode op) {
+            return op != opcode::load_variable && op != opcode::load_constant && op != opcode::broadcast;
+        }
+
+        static bool reads_b_register(opcode op) {
+            return op == opcode::add || op == opcode::mul;
+        }
+
+        // Drops the instructions no root depends on, then gives every value the first register free at its
+        // definition. The operands are released first, so a value read for the last time is overwritten in place.
+        void allocate_registers(const std::vector<ssa_instruction>& ssa,
+                                const std::vector<std::vector<std::size_t>>& stores) {
+            std::vector<bool> live(ssa.size(), false);
+            for (std::size_t v = ssa.size(); v-- > 0;) {
+                live[v] = live[v] || !stores[v].empty();
+                if (live[v]) {
+                    const auto& [op, a, b] = ssa[v];
+                    if (reads_registers(op)) {
+                        live[a] = true;
+                        if (reads_b_register(op)) {
+                            live[b] = true;
+                        }
+                    }
+                }
+            }
+
+            // Position of the last instruction reading every value, the stores included.
+            std::vector<std::size_t> last_use(ssa.size(), 0);
+            std::size_t position = 0;
+            for (std::size_t v = 0; v < ssa.size(); ++v) {
+                if (!live[v]) {
+                    continue;
+                }
+                const auto& [op, a, b] = ssa[v];
+                if (reads_registers(op)) {
+                    last_use[a] = position;
+                    if (reads_b_register(op)) {
+                        last_use[b] = position;
+                    }
+                }
+                position += 1 + stores[v].size();
+                if (!stores[v].empty()) {
+                    last_use[v] = position - 1;
+                }
+            }
+
+            std::vector<std::uint32_t> value_register(ssa.size());
+            std::vector<std::uint32_t> free_registers;
+            auto release = [&](std::size_t v, std::size_t at) {
+                if (last_use[v] == at) {
+                    free_registers.push_back(value_register[v]);
+                }
+            };
+
+            position = 0;
+            for (std::size_t v = 0; v < ssa.size(); ++v) {
+                if (!live[v]) {
+                    continue;
+                }
+                const auto& [op, a, b] = ssa[v];
+                instruction ins{op, 0, static_cast<std::uint32_t>(a), static_cast<std::uint32_t>(b)};
+                if (reads_registers(op)) {
+                    ins.a = value_register[a];
+                    release(a, position);
+                    if (reads_b_register(op)) {
+                        ins.b = value_register[b];
+                        if (b != a) {
+                            release(b, position);
+                        }
+                    }
+                }
+                if (free_registers.empty()) {
+                    free_registers.push_back(_register_count++);
+                }
+                ins.dst = value_register[v] = free_registers.back();
+                free_registers.pop_back();
+                _instructions.push_back(ins);
+                ++position;
+
+                for (std::size_t root : stores[v]) {
+                    _instructions.push_back(instruction{opcode::store, static_cast<std::uint32_t>(root),
+                                                        value_register[v], 0});
+                    release(v, position);
+                    ++position;
+                }
+            }
+        }
+
+        std::vector<instruction> _instructions;
+        std::vector<value_type> _scalars;
+        std::vector<polynomial_dfs_type> _constants;
+        std::vector<polynomial_dfs_variable_type> _variables;
+        std::size_t _register_count = 0;
+    };
+
+} // namespace nil::crypto3::zk::snark
+
+#endif // CRYPTO3_ZK_MATH_DAG_EXPRESSION_PROGRAM_HPP
@@ -0,0 +1,406 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_PLONK_COMPACT_COLUMN_HPP
+#define CRYPTO3_ZK_PLONK_COMPACT_COLUMN_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/actor/core/parallelization_utils.hpp>
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+
+                /**
+                 * A read-only column of a plonk table, stored in the narrowest encoding its values fit.
+                 * Most columns of the circuits hold flags, bytes or 16-bit limbs, or are zero on almost every row,
+                 * while a field element takes 32 bytes. The zero rows at the end of the column are never stored,
+                 * the rest are bit-packed, stored as 8 or 16-bit integers, as the non-zero rows with their indices
+                 * or as field elements, whichever takes less memory.
+                 * The values are converted to field elements on access, decode() does it for the whole column.
+                 */
+                template<typename FieldType>
+                class plonk_compact_column {
+                public:
+                    using field_type = FieldType;
+                    using value_type = typename FieldType::value_type;
+
+                    enum class encoding : std::uint8_t {
+                        zero,
+                        boolean,
+                        u8,
+                        u16,
+                        sparse,
+                        full
+                    };
+
+                    plonk_compact_column() = default;
+
+                    explicit plonk_compact_column(const plonk_column<FieldType> &column) : _size(column.size()) {
+                        const value_type zero = value_type::zero();
+                        _stored_rows = _size;
+                        while (_stored_rows > 0 && column[_stored_rows - 1] == zero) {
+                            _stored_rows--;
+                        }
+
+                        // the widest integer the stored rows fit, 0 when some value does not fit 16 bits
+                        std::size_t width = 1;
+                        std::size_t non_zero_rows = 0;
+                        for (std::size_t row = 0; row < _stored_rows; row++) {
+                            if (column[row] == zero) {
+                                continue;
+                            }
+                            non_zero_rows++;
+                            if (width == 0) {
+                                continue;
+                            }
+                            const auto integral = column[row].to_integral();
+                            if (integral < 2u) {
+                                continue;
+                            }
+                            width = integral < 0x100u ? std::max<std::size_t>(width, 8)
+                                  : integral < 0x10000u ? std::max<std::size_t>(width, 16)
+                                  : 0;
+                        }
+
+                        const std::size_t sparse_bytes = non_zero_rows * (sizeof(std::uint32_t) + sizeof(value_type));
+                        const std::size_t narrow_bytes = width == 0 ? _stored_rows * sizeof(value_type)
+                                                                    : (_stored_rows * width + 7) / 8;
+                        if (_stored_rows == 0) {
+                            _encoding = encoding::zero;
+                        } else if (sparse_bytes < narrow_bytes && _stored_rows <= max_sparse_rows) {
+                            _encoding = encoding::sparse;
+                            _rows.reserve(non_zero_rows);
+                            _values.reserve(non_zero_rows);
+                            for (std::size_t row = 0; row < _stored_rows; row++) {
+                                if (column[row] != zero) {
+                                    _rows.push_back(static_cast<std::uint32_t>(row));
+                                    _values.push_back(column[row]);
+                                }
+                            }
+                        } else if (width == 0) {
+                            _encoding = encoding::full;
+                            _values.assign(column.begin(), column.begin() + _stored_rows);
+                        } else {
+                            _encoding = width == 1 ? encoding::boolean : width == 8 ? encoding::u8 : encoding::u16;
+                            _bytes.resize(narrow_bytes);
+                            for (std::size_t row = 0; row < _stored_rows; row++) {
+                                const auto value = static_cast<std::uint16_t>(
+                                    static_cast<std::uint64_t>(column[row].to_integral()));
+                                switch (_encoding) {
+                                    case encoding::boolean:
+                                        _bytes[row / 8] |= std::uint8_t(value << (row % 8));
+                                        break;
+                                    case encoding::u8:
+                                        _bytes[row] = std::uint8_t(value);
+                                        break;
+                                    default:
+                                        _bytes[2 * row] = std::uint8_t(value);
+                                        _bytes[2 * row + 1] = std::uint8_t(value >> 8);
+                                }
+                            }
+                        }
+                    }
+
+                    std::size_t size() const {
+                        return _size;
+                    }
+
+                    encoding get_encoding() const {
+                        return _encoding;
+                    }
+
+                    // Bytes taken by the values, not counting the object itself.
+                    std::size_t memory_usage() const {
+                        return _bytes.capacity() + _rows.capacity() * sizeof(std::uint32_t) +
+                               _values.capacity() * sizeof(value_type);
+                    }
+
+                    value_type operator[](std::size_t row) const {
+                        BOOST_ASSERT(row < _size);
+                        if (row >= _stored_rows) {
+                            return value_type::zero();
+                        }
+                        switch (_encoding) {
+                            case encoding::boolean:
+                                return (_bytes[row / 8] >> (row % 8)) & 1 ? value_type::one() : value_type::zero();
+                            case encoding::u8:
+                                return value_type(_bytes[row]);
+                            case encoding::u16:
+                                return value_type(std::uint32_t(_bytes[2 * row]) | std::uint32_t(_bytes[2 * row + 1]) << 8);
+                            case encoding::sparse: {
+                                auto it = std::lower_bound(_rows.begin(), _rows.end(), row);
+                                return it != _rows.end() && *it == row ? _values[it - _rows.begin()] : value_type::zero();
+                            }
+                            case encoding::full:
+                                return _values[row];
+                            default:
+                                return value_type::zero();
+                        }
+                    }
+
+                    // Writes all size() values to out.
+                    void decode(value_type *out) const {
+                        std::fill(out + _stored_rows, out + _size, value_type::zero());
+                        switch (_encoding) {
+                            case encoding::zero:
+                                break;
+                            case encoding::boolean:
+                                for (std::size_t row = 0; row < _stored_rows; row++) {
+                                    out[row] = (_bytes[row / 8] >> (row % 8)) & 1 ? value_type::one() : value_type::zero();
+                                }
+                                break;
+                            case encoding::u8: {
+                                std::array<value_type, 0x100> bytes;
+                                for (std::size_t i = 0; i < bytes.size(); i++) {
+                                    bytes[i] = value_type(i);
+                                }
+                                for (std::size_t row = 0; row < _stored_rows; row++) {
+                                    out[row] = bytes[_bytes[row]];
+                                }
+                                break;
+                            }
+                            case encoding::u16:
+                                for (std::size_t row = 0; row < _stored_rows; row++) {
+                                    out[row] = value_type(std::uint32_t(_bytes[2 * row]) | std::uint32_t(_bytes[2 * row + 1]) << 8);
+                                }
+                                break;
+                            case encoding::sparse:
+                                std::fill(out, out + _stored_rows, value_type::zero());
+                                for (std::size_t i = 0; i < _rows.size(); i++) {
+                                    out[_rows[i]] = _values[i];
+                                }
+                                break;
+                            case encoding::full:
+                                std::copy(_values.begin(), _values.end(), out);
+                                break;
+                        }
+                    }
+
+                    plonk_column<FieldType> to_column() const {
+                        plonk_column<FieldType> column(_size);
+                        decode(column.data());
+                        return column;
+                    }
+
+                    // Whether the column holds the same values, without compressing it first.
+                    bool matches(const plonk_column<FieldType> &column) const {
+                        if (column.size() != _size) {
+                            return false;
+                        }
+                        const value_type zero = value_type::zero();
+                        if (!std::all_of(column.begin() + _stored_rows, column.end(),
+                                         [&zero](const value_type &value) { return value == zero; })) {
+                            return false;
+                        }
+                        switch (_encoding) {
+                            case encoding::zero:
+                                return true;
+                            case encoding::sparse: {
+                                std::size_t next = 0;
+                                for (std::size_t row = 0; row < _stored_rows; row++) {
+                                    const bool stored = next < _rows.size() && _rows[next] == row;
+                                    if (column[row] != (stored ? _values[next++] : zero)) {
+                                        return false;
+                                    }
+                                }
+                                return true;
+                            }
+                            case encoding::full:
+                                return std::equal(_values.begin(), _values.end(), column.begin());
+                            default:
+                                for (std::size_t row = 0; row < _stored_rows; row++) {
+                                    if (column[row] != (*this)[row]) {
+                                        return false;
+                                    }
+                                }
+                                return true;
+                        }
+                    }
+
+                    bool operator==(const plonk_compact_column &other) const = default;
+
+                private:
+                    static constexpr std::size_t max_sparse_rows = std::size_t(1) << 32;
+
+                    std::size_t _size = 0;
+                    // rows starting from _stored_rows are zero
+                    std::size_t _stored_rows = 0;
+                    encoding _encoding = encoding::zero;
+                    // bits, bytes or little-endian 16-bit values
+                    std::vector<std::uint8_t> _bytes;
+                    // rows of the non-zero values of the sparse encoding
+                    std::vector<std::uint32_t> _rows;
+                    // values of the full or the sparse encoding
+                    std::vector<value_type> _values;
+                };
+
+                /**
+                 * A read-only plonk table of compact columns, for tables which are kept in memory long after they
+                 * are filled. The columns are compressed and decompressed in parallel.
+                 * plonk_table itself keeps plain columns: the assigner writes its cells in place and the prover
+                 * reads them through references, so a table in use is always decompressed.
+                 */
+                template<typename FieldType>
+                class plonk_compact_table {
+                public:
+                    using field_type = FieldType;
+                    using column_type = plonk_compact_column<FieldType>;
+                    using table_type = plonk_table<FieldType, plonk_column<FieldType>>;
+                    using private_table_type = typename table_type::private_table_type;
+                    using public_table_type = typename table_type::public_table_type;
+
+                    plonk_compact_table() = default;
+
+                    explicit plonk_compact_table(const table_type &table)
+                        : _witnesses(compress(table.witnesses()))
+                        , _public_inputs(compress(table.public_inputs()))
+                        , _constants(compress(table.constants()))
+                        , _selectors(compress(table.selectors())) {
+                    }
+
+                    // a table without witness columns
+                    explicit plonk_compact_table(const public_table_type &public_table)
+                        : _public_inputs(compress(public_table.public_inputs()))
+                        , _constants(compress(public_table.constants()))
+                        , _selectors(compress(public_table.selectors())) {
+                    }
+
+                    std::uint32_t witnesses_amount() const {
+                        return _witnesses.size();
+                    }
+
+                    std::uint32_t public_inputs_amount() const {
+                        return _public_inputs.size();
+                    }
+
+                    std::uint32_t constants_amount() const {
+                        return _constants.size();
+                    }
+
+                    std::uint32_t selectors_amount() const {
+                        return _selectors.size();
+                    }
+
+                    const column_type &witness(std::uint32_t index) const {
+                        return _witnesses[index];
+                    }
+
+                    const column_type &public_input(std::uint32_t index) const {
+                        return _public_inputs[index];
+                    }
+
+                    const column_type &constant(std::uint32_t index) const {
+                        return _constants[index];
+                    }
+
+                    const column_type &selector(std::uint32_t index) const {
+                        return _selectors[index];
+                    }
+
+                    std::size_t memory_usage() const {
+                        std::size_t result = 0;
+                        for (auto const *columns : {&_witnesses, &_public_inputs, &_constants, &_selectors}) {
+                            for (auto const &column : *columns) {
+                                result += sizeof(column) + column.memory_usage();
+                            }
+                        }
+                        return result;
+                    }
+
+                    std::shared_ptr<private_table_type> decompress_private_table() const {
+                        return std::make_shared<private_table_type>(decompress(_witnesses));
+                    }
+
+                    std::shared_ptr<public_table_type> decompress_public_table() const {
+                        return std::make_shared<public_table_type>(
+                            decompress(_public_inputs), decompress(_constants), decompress(_selectors));
+                    }
+
+                    table_type decompress() const {
+                        return table_type(decompress_private_table(), decompress_public_table());
+                    }
+
+                    // Whether the public columns hold the same values as public_table, column by column and
+                    // without compressing public_table first.
+                    bool matches(const public_table_type &public_table) const {
+                        return matches(_public_inputs, public_table.public_inputs()) &&
+                               matches(_constants, public_table.constants()) &&
+                               matches(_selectors, public_table.selectors());
+                    }
+
+                    bool operator==(const plonk_compact_table &other) const = default;
+
+                private:
+                    static bool matches(const std::vector<column_type> &compact,
+                                        const std::vector<plonk_column<FieldType>> &columns) {
+                        if (compact.size() != columns.size()) {
+                            return false;
+                        }
+                        for (std::size_t i = 0; i < compact.size(); i++) {
+                            if (!compact[i].matches(columns[i])) {
+                                return false;
+                            }
+                        }
+                        return true;
+                    }
+
+                    static std::vector<column_type> compress(const std::vector<plonk_column<FieldType>> &columns) {
+                        std::vector<column_type> result(columns.size());
+                        parallel_for(0, columns.size(), [&columns, &result](std::size_t i) {
+                            result[i] = column_type(columns[i]);
+                        }, ThreadPool::PoolLevel::HIGH);
+                        return result;
+                    }
+
+                    static std::vector<plonk_column<FieldType>> decompress(const std::vector<column_type> &columns) {
+                        std::vector<plonk_column<FieldType>> result(columns.size());
+                        parallel_for(0, columns.size(), [&columns, &result](std::size_t i) {
+                            result[i] = columns[i].to_column();
+                        }, ThreadPool::PoolLevel::HIGH);
+                        return result;
+                    }
+
+                    std::vector<column_type> _witnesses;
+                    std::vector<column_type> _public_inputs;
+                    std::vector<column_type> _constants;
+                    std::vector<column_type> _selectors;
+                };
+            }    // namespace snark
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_PLONK_COMPACT_COLUMN_HPP
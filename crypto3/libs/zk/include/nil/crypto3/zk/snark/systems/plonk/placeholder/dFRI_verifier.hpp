@@ -26,6 +26,9 @@
 #define CRYPTO3_ZK_PLONK_PLACEHOLDER_DFRI_VERIFIER_HPP
 
 #include <boost/log/trivial.hpp>
+#include <cstdint>
+
+#include <nil/actor/core/parallelization_utils.hpp>
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 
@@ -62,6 +65,7 @@ namespace nil {
 
                     /** Checks the aggregated proof. We shall accept shared pointers here to help proof-producer with its resource providers. 
                      *
+                     *  param[in] commitment_schemes - Must be distinct objects, the provers are checked in parallel.
                      *  param[in] public_inputs - Can be empty, in which case they are not checked.
                      */
                     static inline bool process(
@@ -89,7 +93,6 @@ namespace nil {
 
                         std::vector<placeholder_proof<FieldType, ParamsType>> proofs;
                         std::vector<value_type> F_consolidated(N);
-                        // Verify partial proofs.
                         for (size_t i = 0; i < N; i++) {
                             // Create a proof from aggregated_proof.
                             typename placeholder_proof<FieldType, ParamsType>::evaluation_proof eval_proof;
@@ -102,7 +105,12 @@ namespace nil {
                             }
 
                             proofs.push_back(placeholder_proof<FieldType, ParamsType>(agg_proof.partial_proofs[i], eval_proof));
-                            
+                        }
+
+                        // Verify partial proofs. Every prover has its own commitment scheme and transcript, so they are checked in parallel.
+                        // Not std::vector<bool>, the results are written concurrently.
+                        std::vector<std::uint8_t> partial_proof_results(N, 0);
+                        parallel_for(0, N, [&](std::size_t i) {
                             // We cannot re-use transcripts[i] here, since 'fill_challenge_queue' changes the transcript passed into it.
                             transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> empty_transcript(std::vector<std::uint8_t>({}));
 
@@ -112,23 +120,24 @@ namespace nil {
                             verifier_type::fill_challenge_queue(
                                 *common_datas[i], proofs[i], *constraint_systems[i], *commitment_schemes[i], empty_transcript, queue, evaluation_challenge);
 
+                            const auto precomputation = verifier_type::precompute(*common_datas[i]);
+
                             // F_consolidated[i] is an out parameter here. If public inputs were passed, we shall check them, if not, we will not.
                             if (public_inputs.size() != 0) {
-                                if (!verifier_type::verify_partial_proof(
-                                        *common_datas[i], proofs[i], *table_descriptions[i], *constraint_systems[i], *commitment_schemes[i],
-                                        *public_inputs[i], transcripts[i], F_consolidated[i], evaluation_challenge)) 
-                                {
-                                    BOOST_LOG_TRIVIAL(info) << "dFRI Verification failed: partial proof #" << i << " failed.";
-                                    return false;
-                                }
+                                partial_proof_results[i] = verifier_type::verify_partial_proof(
+                                    *common_datas[i], proofs[i], *table_descriptions[i], *constraint_systems[i], *commitment_schemes[i],
+                                    *public_inputs[i], transcripts[i], F_consolidated[i], evaluation_challenge, precomputation);
                             } else {
-                                if (!verifier_type::verify_partial_proof(
-                                        *common_datas[i], proofs[i], *table_descriptions[i], *constraint_systems[i], *commitment_schemes[i],
-                                        transcripts[i], F_consolidated[i], evaluation_challenge)) 
-                                {
-                                    BOOST_LOG_TRIVIAL(info) << "dFRI Verification failed: partial proof #" << i << " failed.";
-                                    return false;
-                                }
+                                partial_proof_results[i] = verifier_type::verify_partial_proof(
+                                    *common_datas[i], proofs[i], *table_descriptions[i], *constraint_systems[i], *commitment_schemes[i],
+                                    transcripts[i], F_consolidated[i], evaluation_challenge, precomputation);
+                            }
+                        }, ThreadPool::PoolLevel::HIGH);
+
+                        for (size_t i = 0; i < N; i++) {
+                            if (!partial_proof_results[i]) {
+                                BOOST_LOG_TRIVIAL(info) << "dFRI Verification failed: partial proof #" << i << " failed.";
+                                return false;
                             }
                         }
 
@@ -187,7 +196,21 @@ namespace nil {
                         // List of involved polynomials for each eval point [batch_id, poly_id, point_id]
                         std::vector<std::vector<std::vector<std::tuple<std::size_t, std::size_t>>>> poly_maps(N);
 
-                        for (size_t i = 0; i < N; i++) {
+                        // Make a separate copy of the aggregated transcript for each prover.
+                        std::vector<transcript_type> aggregated_transcripts(N, aggregated_transcript);
+
+                        // Values of x, x_index and combined Q at each query, for each prover.
+                        std::vector<std::vector<value_type>> prover_xs(N, std::vector<value_type>(fri_params.lambda));
+                        std::vector<std::vector<std::uint64_t>> prover_x_indexs(N, std::vector<std::uint64_t>(fri_params.lambda));
+                        std::vector<std::vector<typename fri_type::polynomial_values_type>> prover_ys(
+                            N, std::vector<typename fri_type::polynomial_values_type>(fri_params.lambda));
+                        std::vector<std::uint8_t> initial_proof_results(N, 0);
+
+                        // Verify initial proofs for each prover. This checks the consistency.
+                        // This checks the proofs generated by 'proof_eval_lpc_proof' in prover.
+                        // The provers are independent here, their queries are checked in order since they share the transcript
+                        // and the already validated Merkle nodes.
+                        parallel_for(0, N, [&](std::size_t i) {
                             size_t total_points = commitment_schemes[i]->get_total_points();
                             Us[i].resize(total_points);
                             Vs[i].resize(total_points);
@@ -196,32 +219,35 @@ namespace nil {
                             value_type theta_acc = theta.pow(starting_indexes[i]);
                             commitment_schemes[i]->generate_U_V_polymap(
                                 Us[i], Vs[i], poly_maps[i], proofs[i].eval_proof.eval_proof.z, theta, theta_acc, total_points);
-                        }
 
-                        // Make a separate copy of the aggregated transcript for each prover.
-                        std::vector<transcript_type> aggregated_transcripts(N, aggregated_transcript);
+                            nil::crypto3::zk::algorithms::validated_merkle_nodes<fri_type> validated_nodes;
+                            for (size_t query_id = 0; query_id < fri_params.lambda; query_id++) {
+                                if (!nil::crypto3::zk::algorithms::verify_initial_proof_and_return_combined_Q_values<fri_type>(
+                                        agg_proof.aggregated_proof.initial_proofs_per_prover[i].initial_fri_proofs.initial_proofs[query_id], Us[i], poly_maps[i], Vs[i],
+                                        fri_params, commitments[i], theta, coset_size, domain_size, starting_indexes[i], aggregated_transcripts[i],
+                                        prover_ys[i][query_id], prover_xs[i][query_id], prover_x_indexs[i][query_id], &validated_nodes
+                                        )) {
+                                    return;
+                                }
+                            }
+                            initial_proof_results[i] = 1;
+                        }, ThreadPool::PoolLevel::HIGH);
 
                         std::vector<value_type> xs;
                         std::vector<std::uint64_t> x_indexs;
                         // Combined Q values
                         std::vector<typename fri_type::polynomial_values_type> ys;
 
-                        // Verify initial proofs for each prover. This checks the consistency.
-                        // This checks the proofs generated by 'proof_eval_lpc_proof' in prover.
                         for (size_t i = 0; i < N; i++) {
+                            if (!initial_proof_results[i]) {
+                                BOOST_LOG_TRIVIAL(info) << "dFRI Verification failed: initial FRI proof/consistency check verification failed for prover #" << i << ".";
+                                return false;
+                            }
                             for (size_t query_id = 0; query_id < fri_params.lambda; query_id++) {
-                                value_type x;
-                                std::uint64_t x_index;
+                                const value_type& x = prover_xs[i][query_id];
+                                const std::uint64_t x_index = prover_x_indexs[i][query_id];
                                 // Combined Q values
-                                typename fri_type::polynomial_values_type y;
-
-                                if (!nil::crypto3::zk::algorithms::verify_initial_proof_and_return_combined_Q_values<fri_type>(
-                                        agg_proof.aggregated_proof.initial_proofs_per_prover[i].initial_fri_proofs.initial_proofs[query_id], Us[i], poly_maps[i], Vs[i], 
-                                        fri_params, commitments[i], theta, coset_size, domain_size, starting_indexes[i], aggregated_transcripts[i], y, x, x_index 
-                                        )) {
-                                    BOOST_LOG_TRIVIAL(info) << "dFRI Verification failed: initial FRI proof/consistency check verification failed for prover #" << i << ".";
-                                    return false;
-                                }
+                                const typename fri_type::polynomial_values_type& y = prover_ys[i][query_id];
 
                                 // Here I assumed that the values of X must match.
                                 // For all the provers the values of x and x_index must match, since we're using the same transcript for each prover.
@@ -257,6 +283,8 @@ namespace nil {
                         }
 
                         // Now run the round proofs once for the summed polynomial combined_Q.
+                        // Queries open the same round trees, so the Merkle nodes validated by one query are reused by the next ones.
+                        nil::crypto3::zk::algorithms::validated_merkle_nodes<fri_type> validated_round_nodes;
                         for (size_t query_id = 0; query_id < fri_params.lambda; query_id++) {
                             size_t t = 0;
                             // Domain size changes during checks of 'verify_round_proof'.
@@ -264,7 +292,7 @@ namespace nil {
                             for (size_t i = 0; i < fri_params.step_list.size(); i++) {
                                 if (!nil::crypto3::zk::algorithms::verify_round_proof<fri_type>(
                                         agg_proof.aggregated_proof.fri_proof.fri_round_proof.round_proofs[query_id][i], ys[query_id], fri_params,
-                                        alphas, fri_roots[i], i, x_indexs[query_id], domain_size_for_rounds, t)) {
+                                        alphas, fri_roots[i], i, x_indexs[query_id], domain_size_for_rounds, t, &validated_round_nodes)) {
                                     BOOST_LOG_TRIVIAL(info) << "dFRI Verification failed: final FRI proof round proof failed for query "
                                         << query_id << " and step " << i << ".";
                                     return false;
@@ -199,15 +199,15 @@ namespace nil {
                         PROFILE_SCOPE("Lookup argument work on h and g");
 
                         // Compute polynomial U: U(wX) - U(X) = Sum(hs) + Sum(gs).
-                        polynomial_dfs_type sum_H_G = polynomial_sum<FieldType>(hs) + polynomial_sum<FieldType>(gs);
-                        polynomial_dfs_type U(basic_domain_size - 1, basic_domain_size,
-                                              FieldType::value_type::zero());
-
-                        U[0] = FieldType::value_type::zero();
-                        for (std::size_t i = 1; i <= usable_rows_amount; i++) {
-                            U[i] = U[i - 1];
-                            U[i] += sum_H_G[i - 1];
+                        std::vector<const polynomial_dfs_type*> hs_and_gs;
+                        for (const auto& h : hs) {
+                            hs_and_gs.push_back(&h);
                         }
+                        for (const auto& g : gs) {
+                            hs_and_gs.push_back(&g);
+                        }
+                        polynomial_dfs_type U = math::polynomial_running_sum<FieldType>(
+                            hs_and_gs, usable_rows_amount, basic_domain_size);
 
                         // Commit to hs, gs and U.
                         commitment_scheme.append_to_batch(PERMUTATION_BATCH, U);
@@ -291,8 +291,14 @@ namespace nil {
                         PROFILE_SCOPE("Lookup argument compute F_dfs[3]");
                         // Check that Mask(X) * (U(wX) - U(X) - Sum(hs) - Sum(gs)) ==
                         // 0.
-                        F_dfs[3] =
-                            math::polynomial_shift(U, 1, basic_domain_size) - U - sum_H_G;
+                        F_dfs[3] = polynomial_dfs_type(basic_domain_size - 1, basic_domain_size);
+                        parallel_for(0, basic_domain_size, [this, &F_dfs, &U, &hs_and_gs](std::size_t j) {
+                            value_type value = U[(j + 1) % basic_domain_size] - U[j];
+                            for (const auto* addend : hs_and_gs) {
+                                value -= (*addend)[j];
+                            }
+                            F_dfs[3][j] = value;
+                        }, ThreadPool::PoolLevel::LOW);
                         F_dfs[3] *= polynomial_dfs_type(preprocessed_data.q_last +
                                                         preprocessed_data.q_blind) -
                                     one_polynomial;
@@ -28,13 +28,17 @@
 #define CRYPTO3_ZK_PLONK_PLACEHOLDER_PERMUTATION_ARGUMENT_HPP
 
 #include <algorithm>
+#include <functional>
 #include <queue>
+#include <span>
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
 #include <nil/crypto3/math/polynomial/shift.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
+#include <nil/crypto3/math/algorithms/batch_inverse.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/algorithms/parallel_scan.hpp>
 
 #include <nil/crypto3/hash/sha2.hpp>
 
@@ -107,10 +111,6 @@ namespace nil {
                         value_type gamma = transcript.template challenge<FieldType>();
 
                         // 2. Calculate id_binding, sigma_binding for j from 1 to N_rows
-                        // 3. Calculate $V_P$
-                        polynomial_dfs_type V_P(basic_domain->size() - 1,
-                                                                                 basic_domain->size());
-
                         std::vector<polynomial_dfs_type> g_v(S_id.begin(), S_id.end());
                        std::vector<polynomial_dfs_type>
                             h_v(S_sigma.begin(), S_sigma.end());
@@ -134,24 +134,30 @@ namespace nil {
                             h_v[i] += column_polynomials[global_indices[i]];
                         }, ThreadPool::PoolLevel::HIGH);
 
-                        V_P[0] = FieldType::value_type::one();
-
-                        auto V_P_parts = std::make_unique<std::vector<value_type>>(
-                            basic_domain->size(), FieldType::value_type::zero());
-                        parallel_for(1, basic_domain->size(), [&g_v, &h_v, &S_id, &V_P_parts](std::size_t j) {
-                            value_type nom = FieldType::value_type::one();
-                            value_type denom = FieldType::value_type::one();
-
-                            for (std::size_t i = 0; i < S_id.size(); i++) {
-                                nom *= g_v[i][j - 1];
-                                denom *= h_v[i][j - 1];
-                            }
-                            (*V_P_parts)[j] = nom * denom.inversed();
-                        }, ThreadPool::PoolLevel::LOW);
-
-                        for (std::size_t j = 1; j < basic_domain->size(); ++j)
-                            V_P[j] = V_P[j - 1] * (*V_P_parts)[j];
-                        V_P_parts.reset(nullptr);
+                        // 3. Calculate $V_P$
+                        // V_P[j] is the product of nom[k] / denom[k] over the rows k < j. The denominators are
+                        // inverted in a batch and the ratios are accumulated by a parallel prefix product.
+                        std::vector<value_type> V_P_values(basic_domain->size(), FieldType::value_type::one());
+                        {
+                            std::vector<value_type> denoms(basic_domain->size(), FieldType::value_type::one());
+                            parallel_for(1, basic_domain->size(), [&g_v, &h_v, &S_id, &V_P_values, &denoms](std::size_t j) {
+                                value_type nom = FieldType::value_type::one();
+                                value_type denom = FieldType::value_type::one();
+
+                                for (std::size_t i = 0; i < S_id.size(); i++) {
+                                    nom *= g_v[i][j - 1];
+                                    denom *= h_v[i][j - 1];
+                                }
+                                V_P_values[j] = nom;
+                                denoms[j] = denom;
+                            }, ThreadPool::PoolLevel::LOW);
+
+                            math::parallel_batch_inverse(std::span<value_type>(denoms));
+                            parallel_transform(V_P_values.begin(), V_P_values.end(), denoms.begin(), V_P_values.begin(),
+                                               std::multiplies<value_type>());
+                        }
+                        math::parallel_prefix_product(std::span<value_type>(V_P_values));
+                        polynomial_dfs_type V_P(basic_domain->size() - 1, std::move(V_P_values));
 
                         // 4. Compute and add commitment to $V_P$ to $\text{transcript}$.
                         // TODO: Better enumeration for polynomial batches
@@ -224,10 +230,12 @@ namespace nil {
                                 const auto& h = hs[i];
                                 auto reduced_g = reduce_dfs_polynomial_domain(g, basic_domain->m);
                                 auto reduced_h = reduce_dfs_polynomial_domain(h, basic_domain->m);
+                                math::parallel_batch_inverse(
+                                    std::span<value_type>(reduced_h.data(), assignment_desc.usable_rows_amount));
 
                                 parallel_for(0, assignment_desc.usable_rows_amount,
                                     [&reduced_g, &reduced_h, &current_poly, &previous_poly](std::size_t j) {
-                                        current_poly[j] = (previous_poly[j] * reduced_g[j]) * reduced_h[j].inversed();
+                                        current_poly[j] = (previous_poly[j] * reduced_g[j]) * reduced_h[j];
                                     },
                                     ThreadPool::PoolLevel::LOW);
 
@@ -353,8 +361,8 @@ namespace nil {
 
                         std::array<value_type, argument_size> F;
 
-                        F[0] = common_data.lagrange_0.evaluate(challenge) *
-                               (one - perm_polynomial_value);
+                        // special_selector_values[0] is lagrange_0 at the challenge
+                        F[0] = special_selector_values[0] * (one - perm_polynomial_value);
 
                         std::vector<value_type> permutation_alphas;
                         for( std::size_t i = 0; i < common_data.permutation_parts - 1; i++ ){
@@ -29,7 +29,13 @@
 #define CRYPTO3_ZK_PLONK_PLACEHOLDER_VERIFIER_HPP
 
 #include <boost/log/trivial.hpp>
+#include <cstdint>
+#include <map>
 #include <queue>
+#include <stdexcept>
+#include <vector>
+
+#include <nil/actor/core/parallelization_utils.hpp>
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 
@@ -66,6 +72,8 @@ namespace nil {
                     using eval_storage_type = commitments::eval_storage<FieldType>;
                     using transcript_type =
                         typename commitment_scheme_type::transcript_type;
+                    using common_data_type =
+                        typename public_preprocessor_type::preprocessed_data_type::common_data_type;
 
                     constexpr static const std::size_t gate_parts = 1;
                     constexpr static const std::size_t permutation_parts = 3;
@@ -73,6 +81,58 @@ namespace nil {
                     constexpr static const std::size_t f_parts = 8;
 
                   public:
+                    // Values which depend on common_data only, so they are computed once for all the proofs of a circuit.
+                    struct circuit_precomputation_type {
+                        typename SmallFieldType::value_type omega;
+                        // omega^rotation for every rotation of the columns
+                        std::map<int, typename SmallFieldType::value_type> omega_rotations;
+                        // size of the basic domain and its inverse, for the closed form of lagrange_0
+                        std::size_t domain_size;
+                        typename FieldType::value_type domain_size_inversed;
+                        // position of rotation 0 among the rotations of each permuted column
+                        std::vector<std::size_t> permuted_zero_indices;
+                    };
+
+                    static circuit_precomputation_type precompute(const common_data_type &common_data) {
+                        circuit_precomputation_type precomputation;
+                        precomputation.omega = common_data.basic_domain->get_domain_element(1);
+                        for (const auto &rotations: common_data.columns_rotations) {
+                            for (int rotation: rotations) {
+                                if (precomputation.omega_rotations.find(rotation) == precomputation.omega_rotations.end()) {
+                                    precomputation.omega_rotations[rotation] = precomputation.omega.pow(rotation);
+                                }
+                            }
+                        }
+                        precomputation.domain_size = common_data.lagrange_0.size();
+                        precomputation.domain_size_inversed =
+                            typename FieldType::value_type(precomputation.domain_size).inversed();
+                        for (std::size_t i: common_data.permuted_columns) {
+                            std::size_t zero_index = 0;
+                            for (int v: common_data.columns_rotations[i]) {
+                                if (v == 0) {
+                                    break;
+                                }
+                                zero_index++;
+                            }
+                            precomputation.permuted_zero_indices.push_back(zero_index);
+                        }
+                        return precomputation;
+                    }
+
+                    // lagrange_0(x) = (x^n - 1) / (n * (x - 1)) on the basic domain of size n, instead of
+                    // interpolating common_data.lagrange_0 for every evaluation.
+                    static typename FieldType::value_type evaluate_lagrange_0(
+                        const circuit_precomputation_type &precomputation,
+                        const typename FieldType::value_type &x
+                    ) {
+                        const auto one = FieldType::value_type::one();
+                        if (x == one) {
+                            return one;
+                        }
+                        return (x.pow(precomputation.domain_size) - one) * (x - one).inversed() *
+                            precomputation.domain_size_inversed;
+                    }
+
                     // TODO(martun): this function is pretty similar to the one in prover,
                     // we should de-duplicate it.
                     static void generate_evaluation_points(
@@ -82,13 +142,27 @@ namespace nil {
                         const plonk_table_description<SmallFieldType> &table_description,
                         const typename FieldType::value_type& challenge,
                         bool _is_lookup_enabled
+                    ) {
+                        generate_evaluation_points(
+                            _commitment_scheme, common_data, constraint_system, table_description, challenge,
+                            _is_lookup_enabled, precompute(common_data));
+                    }
+
+                    static void generate_evaluation_points(
+                        commitment_scheme_type &_commitment_scheme,
+                        const typename public_preprocessor_type::preprocessed_data_type::common_data_type &common_data,
+                        const plonk_constraint_system<SmallFieldType> &constraint_system,
+                        const plonk_table_description<SmallFieldType> &table_description,
+                        const typename FieldType::value_type& challenge,
+                        bool _is_lookup_enabled,
+                        const circuit_precomputation_type &precomputation
                     ) {
                         const std::size_t witness_columns = table_description.witness_columns;
                         const std::size_t public_input_columns = table_description.public_input_columns;
                         const std::size_t constant_columns = table_description.constant_columns;
                         const std::size_t selector_columns = table_description.selector_columns;
 
-                        auto _omega = common_data.basic_domain->get_domain_element(1);
+                        const auto& _omega = precomputation.omega;
 
                         // variable_values' rotations
                         for (std::size_t variable_values_index = 0;
@@ -102,7 +176,7 @@ namespace nil {
                                 _commitment_scheme.append_eval_point(
                                     VARIABLE_VALUES_BATCH,
                                     variable_values_index,
-                                    challenge * _omega.pow(rotation)
+                                    challenge * precomputation.omega_rotations.at(rotation)
                                 );
                             }
                         }
@@ -145,7 +219,7 @@ namespace nil {
                                 _commitment_scheme.append_eval_point(
                                     FIXED_VALUES_BATCH,
                                     start_index + ind,
-                                    challenge * _omega.pow(rotation)
+                                    challenge * precomputation.omega_rotations.at(rotation)
                                 );
                             }
                         }
@@ -154,35 +228,15 @@ namespace nil {
                     static inline bool process(
                         const typename public_preprocessor_type::preprocessed_data_type::common_data_type &common_data,
                         const proof_type &proof,
-                        const plonk_table_description<FieldType> &table_description,
-                        const plonk_constraint_system<FieldType> &constraint_system,
+                        const plonk_table_description<SmallFieldType> &table_description,
+                        const plonk_constraint_system<SmallFieldType> &constraint_system,
                         commitment_scheme_type& commitment_scheme,
                         const std::vector<std::vector<typename FieldType::value_type>> &public_input
                     ) {
                         PROFILE_SCOPE("Verifier with public input");
-                        transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(std::vector<std::uint8_t>({}));
-                        typename FieldType::value_type F_consolidated;
-
-                        typename FieldType::value_type evaluation_challenge;
-                        std::queue<typename FieldType::value_type> queue;
-                        fill_challenge_queue(common_data, proof, constraint_system, commitment_scheme, transcript, queue, evaluation_challenge);
-
-                        if (!verify_partial_proof(
-                                common_data, proof, table_description, constraint_system,
-                                commitment_scheme, public_input, transcript, F_consolidated, evaluation_challenge))
-                        {
-                            BOOST_LOG_TRIVIAL(info) << "Verification failed: partial proof failed.";
-                            return false;
-                        }
-
-                        std::map<std::size_t, typename commitment_scheme_type::commitment_type> commitments = proof.commitments;
-                        commitments[FIXED_VALUES_BATCH] = common_data.commitments.fixed_values;
-
-                        if (!commitment_scheme.verify_eval(proof.eval_proof.eval_proof, commitments, transcript)) {
-                            BOOST_LOG_TRIVIAL(info) << "Verification failed: LPC proof failed.";
-                            return false;
-                        }
-                        return true;
+                        return verify_proof(
+                            common_data, proof, table_description, constraint_system, commitment_scheme, &public_input,
+                            precompute(common_data));
                     }
 
                     // Takes out values of different polynomials at challenge point 'Y' from the evaluation proofs.
@@ -240,7 +294,63 @@ namespace nil {
                         const plonk_constraint_system<SmallFieldType> &constraint_system,
                         commitment_scheme_type &commitment_scheme) {
                         PROFILE_SCOPE("Verifier");
-                        auto& Z = proof.eval_proof.eval_proof.z;
+                        return verify_proof(
+                            common_data, proof, table_description, constraint_system, commitment_scheme, nullptr,
+                            precompute(common_data));
+                    }
+
+                    /** Verifies a batch of proofs of one circuit. The values derived from common_data are computed once
+                     *  for the whole batch, and the proofs are checked in parallel, each with its own copy of commitment_scheme.
+                     *
+                     *  param[in] public_inputs - Public inputs of each proof. Can be empty, in which case they are not checked.
+                     *  \returns true if all the proofs pass.
+                     */
+                    static inline bool process_batch(
+                        const common_data_type &common_data,
+                        const std::vector<proof_type> &proofs,
+                        const plonk_table_description<SmallFieldType> &table_description,
+                        const plonk_constraint_system<SmallFieldType> &constraint_system,
+                        const commitment_scheme_type &commitment_scheme,
+                        const std::vector<std::vector<std::vector<typename FieldType::value_type>>> &public_inputs = {}
+                    ) {
+                        if (!public_inputs.empty() && public_inputs.size() != proofs.size()) {
+                            throw std::invalid_argument("Invalid number of public inputs for the batch of proofs.");
+                        }
+                        PROFILE_SCOPE("Verifier batch of {} proofs", proofs.size());
+                        const circuit_precomputation_type precomputation = precompute(common_data);
+
+                        // not std::vector<bool>, the results are written concurrently
+                        std::vector<std::uint8_t> results(proofs.size(), 0);
+                        parallel_for(0, proofs.size(),
+                            [&common_data, &proofs, &table_description, &constraint_system, &commitment_scheme,
+                             &public_inputs, &precomputation, &results](std::size_t i) {
+                                commitment_scheme_type proof_commitment_scheme = commitment_scheme;
+                                results[i] = verify_proof(
+                                    common_data, proofs[i], table_description, constraint_system, proof_commitment_scheme,
+                                    public_inputs.empty() ? nullptr : &public_inputs[i], precomputation);
+                            }, ThreadPool::PoolLevel::HIGH);
+
+                        for (std::size_t i = 0; i < proofs.size(); i++) {
+                            if (!results[i]) {
+                                BOOST_LOG_TRIVIAL(info) << "Verification failed: proof #" << i << " of the batch failed.";
+                                return false;
+                            }
+                        }
+                        return true;
+                    }
+
+                    /** Checks one proof with the given precomputation. Public input is not checked if it is nullptr.
+                     *  No profiling scopes are opened here, so that proofs can be checked in parallel.
+                     */
+                    static inline bool verify_proof(
+                        const common_data_type &common_data,
+                        const proof_type &proof,
+                        const plonk_table_description<SmallFieldType> &table_description,
+                        const plonk_constraint_system<SmallFieldType> &constraint_system,
+                        commitment_scheme_type &commitment_scheme,
+                        const std::vector<std::vector<typename FieldType::value_type>> *public_input,
+                        const circuit_precomputation_type &precomputation
+                    ) {
                         transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(std::vector<std::uint8_t>({}));
                         typename FieldType::value_type F_consolidated;
 
@@ -252,10 +362,14 @@ namespace nil {
 
                         // TODO(martun): remove all usage of transcript from the verification code. We already have all the challenges in a queue.
                         // Not doing it now to have a smaller PR.
-                        if (!verify_partial_proof(
-                                common_data, proof, table_description, constraint_system,
-                                commitment_scheme, transcript, F_consolidated, evaluation_challenge))
-                        {
+                        const bool partial_proof_passed = public_input
+                            ? verify_partial_proof(
+                                  common_data, proof, table_description, constraint_system, commitment_scheme,
+                                  *public_input, transcript, F_consolidated, evaluation_challenge, precomputation)
+                            : verify_partial_proof(
+                                  common_data, proof, table_description, constraint_system, commitment_scheme,
+                                  transcript, F_consolidated, evaluation_challenge, precomputation);
+                        if (!partial_proof_passed) {
                             BOOST_LOG_TRIVIAL(info) << "Verification failed: partial proof failed.";
                             return false;
                         }
@@ -282,6 +396,24 @@ namespace nil {
                         transcript_type &transcript,
                         typename FieldType::value_type &F_consolidated_out,
                         const typename FieldType::value_type &evaluation_challenge) {
+                        return verify_partial_proof(
+                            common_data, proof, table_description, constraint_system, commitment_scheme, public_input,
+                            transcript, F_consolidated_out, evaluation_challenge, precompute(common_data));
+                    }
+
+                    static inline bool verify_partial_proof(
+                        const typename public_preprocessor_type::preprocessed_data_type::
+                            common_data_type &common_data,
+                        const proof_type &proof,
+                        const plonk_table_description<SmallFieldType> &table_description,
+                        const plonk_constraint_system<SmallFieldType> &constraint_system,
+                        commitment_scheme_type &commitment_scheme,
+                        const std::vector<std::vector<typename FieldType::value_type>>
+                            &public_input,
+                        transcript_type &transcript,
+                        typename FieldType::value_type &F_consolidated_out,
+                        const typename FieldType::value_type &evaluation_challenge,
+                        const circuit_precomputation_type &precomputation) {
                         // TODO: process rotations for public input.
 
                         // If public input sizes are set, all of them should be set.
@@ -293,10 +425,10 @@ namespace nil {
 
                         if (!verify_partial_proof(
                                 common_data, proof, table_description, constraint_system,
-                                commitment_scheme, transcript, F_consolidated_out, evaluation_challenge))
+                                commitment_scheme, transcript, F_consolidated_out, evaluation_challenge, precomputation))
                             return false;
 
-                        auto omega = common_data.basic_domain->get_domain_element(1);
+                        auto omega = precomputation.omega;
                         auto numerator = evaluation_challenge.pow(table_description.rows_amount) - FieldType::value_type::one();
                         numerator *= typename FieldType::value_type(table_description.rows_amount).inversed();
 
@@ -400,6 +532,22 @@ namespace nil {
                         transcript_type &transcript,
                         typename FieldType::value_type &F_consolidated_out,
                         const typename FieldType::value_type &evaluation_challenge) {
+                        return verify_partial_proof(
+                            common_data, proof, table_description, constraint_system, commitment_scheme,
+                            transcript, F_consolidated_out, evaluation_challenge, precompute(common_data));
+                    }
+
+                    static inline bool verify_partial_proof(
+                        const typename public_preprocessor_type::preprocessed_data_type::
+                            common_data_type &common_data,
+                        const proof_type &proof,
+                        const plonk_table_description<SmallFieldType> &table_description,
+                        const plonk_constraint_system<SmallFieldType> &constraint_system,
+                        commitment_scheme_type &commitment_scheme,
+                        transcript_type &transcript,
+                        typename FieldType::value_type &F_consolidated_out,
+                        const typename FieldType::value_type &evaluation_challenge,
+                        const circuit_precomputation_type &precomputation) {
                         auto& Z = proof.eval_proof.eval_proof.z;
 
                         // We cannot add eval points unless everything is committed, so when verifying assume it's committed.
@@ -426,12 +574,14 @@ namespace nil {
                         // 3. append witness commitments to transcript
                         transcript(proof.commitments.at(VARIABLE_VALUES_BATCH));
 
+                        const typename FieldType::value_type lagrange_0_value =
+                            evaluate_lagrange_0(precomputation, evaluation_challenge);
+                        const typename FieldType::value_type lagrange_0_shifted_value =
+                            evaluate_lagrange_0(precomputation, evaluation_challenge * precomputation.omega);
+
                         std::vector<typename FieldType::value_type>
                             special_selector_values(3);
-                        PROFILE_SCOPE("Evaluate lagrange_0 at challenge");
-                        special_selector_values[0] =
-                            common_data.lagrange_0.evaluate(evaluation_challenge);
-                        PROFILE_SCOPE_END();
+                        special_selector_values[0] = lagrange_0_value;
                         special_selector_values[1] = Z.get(
                             FIXED_VALUES_BATCH, 2*common_data.permuted_columns.size(), 0);
                         special_selector_values[2] = Z.get(
@@ -452,13 +602,7 @@ namespace nil {
                                 S_sigma.push_back(Z.get(FIXED_VALUES_BATCH, permutation_size + perm_i, 0));
 
                                 std::size_t i = permuted_polys_global_indices[perm_i];
-                                std::size_t zero_index = 0;
-                                for (int v: common_data.columns_rotations[i]) {
-                                    if (v == 0){
-                                        break;
-                                    }
-                                    zero_index++;
-                                }
+                                std::size_t zero_index = precomputation.permuted_zero_indices[perm_i];
                                 if (i < witness_columns + public_input_columns) {
                                     f[perm_i] = Z.get(VARIABLE_VALUES_BATCH,i,zero_index);
                                 } else if (i >= witness_columns + public_input_columns ) {
@@ -569,17 +713,14 @@ namespace nil {
                                 PLONK_SPECIAL_SELECTOR_ALL_NON_FIRST_USABLE_ROWS_SELECTED, 0,
                                 plonk_variable<typename FieldType::value_type>::column_type::selector
                             );
-                            PROFILE_SCOPE("Evaluate lagrange_0 for selectors 0");
-                            columns_at_y[key] = mask_value - common_data.lagrange_0.evaluate(evaluation_challenge);
+                            columns_at_y[key] = mask_value - lagrange_0_value;
                         }
                         {
                             auto key = std::make_tuple(
                                 PLONK_SPECIAL_SELECTOR_ALL_NON_FIRST_USABLE_ROWS_SELECTED, 1,
                                 plonk_variable<typename FieldType::value_type>::column_type::selector
                             );
-                            PROFILE_SCOPE("Evaluate lagrange_0 for selectors 1");
-                            columns_at_y[key] = shifted_mask_value - common_data.lagrange_0.evaluate(
-                                evaluation_challenge * common_data.basic_domain->get_domain_element(1));
+                            columns_at_y[key] = shifted_mask_value - lagrange_0_shifted_value;
                         }
 
                         {
@@ -594,8 +735,7 @@ namespace nil {
                                 PLONK_SPECIAL_SELECTOR_ALL_ROWS_SELECTED, 1,
                                 plonk_variable<typename FieldType::value_type>::column_type::selector
                             );
-                            columns_at_y[key] = FieldType::value_type::one() - common_data.lagrange_0.evaluate(
-                                evaluation_challenge * common_data.basic_domain->get_domain_element(1));
+                            columns_at_y[key] = FieldType::value_type::one() - lagrange_0_shifted_value;
                         }
 
                         // 6. lookup argument
@@ -659,7 +799,9 @@ namespace nil {
                             F_consolidated_out += alphas[i] * F[i];
                         }
 
-                        prepare_polynomials(proof.eval_proof, common_data, table_description, constraint_system, commitment_scheme, evaluation_challenge);
+                        prepare_polynomials(
+                            proof.eval_proof, common_data, table_description, constraint_system, commitment_scheme,
+                            evaluation_challenge, precomputation);
 
                         if (!verify_consolidated_polynomial(common_data, proof, F_consolidated_out, evaluation_challenge))
                             return false;
@@ -680,10 +822,9 @@ namespace nil {
                                 challenge.pow((common_data.desc.rows_amount) * i);
                         }
 
-                        PROFILE_SCOPE("Final check");
-
                         // Z is polynomial -1, 0 ...., 0, 1
-                        typename FieldType::value_type Z_at_challenge = common_data.Z.evaluate(challenge);
+                        typename FieldType::value_type Z_at_challenge =
+                            challenge.pow(common_data.desc.rows_amount) - FieldType::value_type::one();
                         if (F_consolidated != Z_at_challenge * T_consolidated) {
                             BOOST_LOG_TRIVIAL(info) << "Verification failed: F consolidated polynomial mismatch.";
                             return false;
@@ -701,6 +842,20 @@ namespace nil {
                         const plonk_constraint_system<SmallFieldType> &constraint_system,
                         commitment_scheme_type &commitment_scheme,
                         const typename FieldType::value_type &evaluation_challenge) {
+                        prepare_polynomials(
+                            eval_proof, common_data, table_description, constraint_system, commitment_scheme,
+                            evaluation_challenge, precompute(common_data));
+                    }
+
+                    static inline void prepare_polynomials(
+                        const typename proof_type::evaluation_proof &eval_proof,
+                        const typename public_preprocessor_type::preprocessed_data_type::
+                            common_data_type &common_data,
+                        const plonk_table_description<SmallFieldType> &table_description,
+                        const plonk_constraint_system<SmallFieldType> &constraint_system,
+                        commitment_scheme_type &commitment_scheme,
+                        const typename FieldType::value_type &evaluation_challenge,
+                        const circuit_precomputation_type &precomputation) {
                         commitment_scheme.set_batch_size(VARIABLE_VALUES_BATCH,
                             eval_proof.eval_proof.z.get_batch_size(VARIABLE_VALUES_BATCH));
                         commitment_scheme.set_batch_size(FIXED_VALUES_BATCH,
@@ -720,7 +875,7 @@ namespace nil {
 
                         generate_evaluation_points(
                             commitment_scheme, common_data, constraint_system,
-                            table_description, evaluation_challenge, is_lookup_enabled);
+                            table_description, evaluation_challenge, is_lookup_enabled, precomputation);
                     }
                 };
             }    // namespace snark
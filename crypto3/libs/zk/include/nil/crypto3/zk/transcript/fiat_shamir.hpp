@@ -34,6 +34,7 @@
 #include <nil/crypto3/hash/algorithm/hash.hpp>
 #include <nil/crypto3/hash/keccak.hpp>
 #include <nil/crypto3/hash/poseidon.hpp>
+#include <nil/crypto3/hash/poseidon2.hpp>
 #include <nil/crypto3/hash/sha2.hpp>
 #include <nil/crypto3/hash/type_traits.hpp>
 #include <nil/crypto3/hash/type_traits.hpp>
@@ -255,6 +256,11 @@ namespace nil {
                         return result;
                     }
 
+                    // The digest of everything absorbed so far, the next input is hashed together with it.
+                    const typename hash_type::digest_type &get_state() const {
+                        return state;
+                    }
+
                 private:
                     typename hash_type::digest_type state;
                 };
@@ -382,6 +388,131 @@ namespace nil {
                     hashes::detail::poseidon_sponge_construction_custom<typename Hash::policy_type> sponge;
                 };
 
+                /*!
+                 * @brief Duplex sponge over Poseidon2, as the DuplexChallenger of Plonky3. Observed field
+                 * elements are buffered and overwrite the rate part of the state when the buffer is full
+                 * or a challenge is drawn. The challenges are taken from the end of the rate part of the
+                 * last permuted state, an observation discards the ones left. Bytes and other integers are
+                 * observed as field elements, one per value.
+                 */
+                template<typename Hash>
+                struct fiat_shamir_heuristic_sequential<
+                    Hash,
+                    typename std::enable_if_t<nil::crypto3::hashes::is_poseidon2<Hash>::value>
+                > {
+                    typedef Hash hash_type;
+                    typedef typename Hash::policy_type policy_type;
+                    typedef typename policy_type::field_type field_type;
+                    typedef typename policy_type::word_type word_type;
+                    typedef nil::crypto3::hashes::detail::poseidon2_permutation<policy_type> permutation_type;
+                    typedef typename policy_type::state_type state_type;
+
+                    constexpr static const std::size_t rate = policy_type::rate;
+
+                    fiat_shamir_heuristic_sequential() {
+                        state.fill(word_type::zero());
+                    }
+
+                    template<typename InputRange>
+                    fiat_shamir_heuristic_sequential(const InputRange &r) : fiat_shamir_heuristic_sequential() {
+                        (*this)(r);
+                    }
+
+                    template<typename InputIterator>
+                    fiat_shamir_heuristic_sequential(InputIterator first, InputIterator last) :
+                        fiat_shamir_heuristic_sequential() {
+                        (*this)(first, last);
+                    }
+
+                    template<typename InputRange>
+                    typename std::enable_if_t<
+                        !algebra::is_curve_element<InputRange>::value &&
+                        !algebra::is_field_element<InputRange>::value>
+                    operator()(const InputRange &r) {
+                        (*this)(std::begin(r), std::end(r));
+                    }
+
+                    template<typename InputIterator>
+                    void operator()(InputIterator first, InputIterator last) {
+                        for (; first != last; ++first) {
+                            observe(word_type(*first));
+                        }
+                    }
+
+                    void operator()(const word_type &data) {
+                        observe(data);
+                    }
+
+                    template<typename Field>
+                    typename Field::value_type challenge() {
+                        if constexpr (Field::arity == 1) {
+                            return sample();
+                        } else {
+                            std::array<typename Field::small_subfield::value_type, Field::arity> elems;
+                            for (auto &elem : elems) {
+                                elem = sample();
+                            }
+                            return typename Field::value_type(elems);
+                        }
+                    }
+
+                    template<typename Integral>
+                    Integral int_challenge() {
+                        return static_cast<Integral>(static_cast<std::uint64_t>(sample().to_integral()));
+                    }
+
+                    template<typename Field, std::size_t N>
+                    std::array<typename Field::value_type, N> challenges() {
+
+                        std::array<typename Field::value_type, N> result;
+                        for (auto &ch : result) {
+                            ch = challenge<Field>();
+                        }
+
+                        return result;
+                    }
+
+                    template<typename Field>
+                    std::vector<typename Field::value_type> challenges(std::size_t N) {
+
+                        std::vector<typename Field::value_type> result;
+                        for (std::size_t i = 0; i < N; ++i) {
+                            result.push_back(challenge<Field>());
+                        }
+
+                        return result;
+                    }
+
+                private:
+                    void observe(const word_type &word) {
+                        output_size = 0;
+                        input[input_size++] = word;
+                        if (input_size == rate) {
+                            duplexing();
+                        }
+                    }
+
+                    word_type sample() {
+                        if (input_size != 0 || output_size == 0) {
+                            duplexing();
+                        }
+                        return state[--output_size];
+                    }
+
+                    void duplexing() {
+                        std::copy(input.begin(), input.begin() + input_size, state.begin());
+                        input_size = 0;
+                        permutation_type::permute(state);
+                        output_size = rate;
+                    }
+
+                    state_type state;
+                    std::array<word_type, rate> input;
+                    std::size_t input_size = 0;
+                    /// The challenges left are state[0, output_size).
+                    std::size_t output_size = 0;
+                };
+
             }    // namespace transcript
         }        // namespace zk
     }            // namespace crypto3
@@ -46,6 +46,9 @@
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 #include <nil/crypto3/math/algorithms/calculate_domain_set.hpp>
 
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+
 #include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
 #include <nil/crypto3/zk/commitments/polynomial/fri.hpp>
 #include <nil/crypto3/zk/commitments/type_traits.hpp>
@@ -143,4 +146,78 @@ BOOST_AUTO_TEST_CASE(fri_basic_test_polynomial_dfs) {
 }
 
 
+// Reference precommitment: every leaf is serialized up front, then the tree is built from the leaves.
+template<typename FRI>
+typename FRI::merkle_tree_type
+    materialized_precommit(const std::vector<math::polynomial_dfs<typename FRI::field_type::value_type>> &poly,
+                           std::size_t fri_step) {
+    const std::size_t domain_size = poly[0].size();
+    const std::size_t coset_size = 1 << fri_step;
+    const std::size_t leafs_number = domain_size / coset_size;
+
+    std::vector<zk::algorithms::detail::fri_field_element_consumer<FRI>> y_data(
+        leafs_number, zk::algorithms::detail::fri_field_element_consumer<FRI>(coset_size * poly.size()));
+    for (std::size_t x_index = 0; x_index < leafs_number; x_index++) {
+        auto &element_consumer = y_data[x_index].reset_cursor();
+        for (const auto &f : poly) {
+            std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
+            s_indices[0][0] = x_index;
+            s_indices[0][1] = (x_index + domain_size / FRI::m) % domain_size;
+            element_consumer.consume(f[s_indices[0][0]]);
+            element_consumer.consume(f[s_indices[0][1]]);
+
+            std::size_t base_index = domain_size / (FRI::m * FRI::m);
+            std::size_t prev_half_size = 1;
+            std::size_t i = 1;
+            while (i < coset_size / FRI::m) {
+                for (std::size_t j = 0; j < prev_half_size; j++) {
+                    s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
+                    s_indices[i][1] = (s_indices[i][0] + domain_size / FRI::m) % domain_size;
+                    element_consumer.consume(f[s_indices[i][0]]);
+                    element_consumer.consume(f[s_indices[i][1]]);
+                    i++;
+                }
+                base_index /= FRI::m;
+                prev_half_size <<= 1;
+            }
+        }
+    }
+    return containers::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::m>(y_data.begin(), y_data.end());
+}
+
+template<typename FieldType, typename MerkleHashType>
+void fri_streamed_precommit_test() {
+    typedef zk::commitments::fri<FieldType, MerkleHashType, hashes::sha2<256>, 2> fri_type;
+    typedef math::polynomial_dfs<typename FieldType::value_type> polynomial_type;
+
+    const std::size_t domain_size = 1 << 10;
+    auto D = math::make_evaluation_domain<FieldType>(domain_size);
+
+    for (std::size_t list_size : {1, 3}) {
+        std::vector<polynomial_type> poly(list_size, polynomial_type(domain_size - 1, domain_size));
+        for (auto &f : poly) {
+            for (std::size_t i = 0; i < domain_size; i++) {
+                f[i] = algebra::random_element<FieldType>();
+            }
+        }
+        for (std::size_t fri_step = 1; fri_step <= 4; fri_step++) {
+            auto expected = materialized_precommit<fri_type>(poly, fri_step);
+            auto tree = zk::algorithms::precommit<fri_type>(poly, D, fri_step);
+            BOOST_CHECK(tree.root() == expected.root());
+            if (list_size == 1) {
+                BOOST_CHECK(zk::algorithms::precommit<fri_type>(poly[0], D, fri_step).root() == expected.root());
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(fri_streamed_precommit_keccak_test) {
+    fri_streamed_precommit_test<algebra::curves::pallas::base_field_type, hashes::keccak_1600<256>>();
+}
+
+BOOST_AUTO_TEST_CASE(fri_streamed_precommit_sha2_test) {
+    fri_streamed_precommit_test<algebra::curves::pallas::base_field_type, hashes::sha2<256>>();
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
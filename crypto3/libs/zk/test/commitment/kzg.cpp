@@ -155,6 +155,52 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(kzg_random_test, F, RandomTestFixtures) {
     BOOST_CHECK(fixture.run_test());
 }
 
+template<typename curve_type>
+struct kzg_precomputed_test_runner {
+
+    bool run_test() {
+        typedef typename curve_type::scalar_field_type scalar_field_type;
+        typedef typename curve_type::scalar_field_type::value_type scalar_value_type;
+
+        typedef zk::commitments::kzg<curve_type> kzg_type;
+
+        std::size_t n = 298;
+        auto params = typename kzg_type::params_type(n);
+        auto precomputed = params;
+        precomputed.precompute_commitment_key();
+        BOOST_CHECK(!params.commitment_table);
+        BOOST_CHECK_EQUAL(precomputed.commitment_table->size(), n);
+
+        bool result = true;
+        // the whole key, a prefix of it and a constant
+        for (std::size_t size : {n, n / 3, std::size_t(1)}) {
+            polynomial<scalar_value_type> f(size);
+            for (auto &coefficient : f) {
+                coefficient = algebra::random_element<scalar_field_type>();
+            }
+            auto commit = zk::algorithms::commit<kzg_type>(precomputed, f);
+            BOOST_CHECK_EQUAL(commit, zk::algorithms::commit<kzg_type>(params, f));
+
+            scalar_value_type z = algebra::random_element<scalar_field_type>();
+            typename kzg_type::public_key_type pk = {commit, z, f.evaluate(z)};
+            auto proof = zk::algorithms::proof_eval<kzg_type>(precomputed, f, pk);
+            result = result && zk::algorithms::verify_eval<kzg_type>(precomputed, proof, pk);
+        }
+        return result;
+    }
+};
+
+using PrecomputedTestFixtures = boost::mpl::list<
+    kzg_precomputed_test_runner<algebra::curves::bls12_381>,
+    kzg_precomputed_test_runner<algebra::curves::mnt4_298>,
+    kzg_precomputed_test_runner<algebra::curves::mnt6_298>
+>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(kzg_precomputed_test, F, PrecomputedTestFixtures) {
+    F fixture;
+    BOOST_CHECK(fixture.run_test());
+}
+
 BOOST_AUTO_TEST_CASE(kzg_false_test) {
 
     typedef algebra::curves::bls12<381> curve_type;
@@ -371,6 +417,40 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(batched_kzg_bigger_test, F, BatchedBiggerTestFixtu
     BOOST_CHECK(fixture.run_test());
 }
 
+BOOST_AUTO_TEST_CASE(batched_kzg_precomputed_test) {
+    typedef algebra::curves::bls12_381 curve_type;
+    typedef typename curve_type::scalar_field_type::value_type scalar_value_type;
+
+    typedef hashes::keccak_1600<256> transcript_hash_type;
+    typedef zk::commitments::batched_kzg<curve_type, transcript_hash_type, math::polynomial<scalar_value_type>> kzg_type;
+    typedef zk::commitments::batched_kzg<curve_type, transcript_hash_type> kzg_dfs_type;
+
+    scalar_value_type alpha = 7u;
+    typename kzg_type::batch_of_polynomials_type polys = {{
+        {{ 1u,  2u,  3u,  4u,  5u,  6u,  7u,  8u}},
+        {{11u, 12u, 13u}},
+        {{21u}}
+    }};
+
+    auto params = typename kzg_type::params_type(8, 8, alpha);
+    auto precomputed = params;
+    precomputed.precompute_commitment_key();
+    BOOST_CHECK(zk::algorithms::commit<kzg_type>(precomputed, polys) == zk::algorithms::commit<kzg_type>(params, polys));
+
+    // the copy assignment keeps the table
+    typename kzg_type::params_type assigned;
+    assigned = precomputed;
+    BOOST_CHECK(assigned.commitment_table == precomputed.commitment_table);
+
+    typename kzg_dfs_type::params_type dfs_params(8, 8, alpha);
+    auto dfs_precomputed = dfs_params;
+    dfs_precomputed.precompute_commitment_key();
+    typename kzg_dfs_type::polynomial_type dfs_poly;
+    dfs_poly.from_coefficients(polys[0].get_storage());
+    BOOST_CHECK_EQUAL(zk::algorithms::commit_one<kzg_dfs_type>(dfs_precomputed, dfs_poly),
+                      zk::algorithms::commit_one<kzg_type>(params, polys[0]));
+}
+
 template<typename kzg_type>
 typename kzg_type::params_type create_kzg_params(std::size_t degree_log) {
     typename kzg_type::field_type::value_type alpha(7u);
@@ -35,6 +35,7 @@
 #include <nil/crypto3/hash/poseidon.hpp>
 #include <nil/crypto3/hash/detail/poseidon/poseidon_policy.hpp>
 #include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
 
 #include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
 
@@ -95,4 +96,56 @@ BOOST_AUTO_TEST_SUITE(proof_of_knowledge_test_suite)
         BOOST_ASSERT(!hard_pow_type::verify(old_transcript_1, result, grinding_bits));
     }
 
+    // With a seed the result is the first nonce from the seed which passes, whatever the hash path is.
+    template<typename Hash, typename OutType>
+    void check_seeded_pow(std::uint64_t seed, std::size_t grinding_bits) {
+        using pow_type = nil::crypto3::zk::commitments::proof_of_work<Hash, OutType>;
+        using transcript_type = nil::crypto3::zk::transcript::fiat_shamir_heuristic_sequential<Hash>;
+
+        std::vector<std::uint8_t> init_blob{1u, 2u, 3u, static_cast<std::uint8_t>(seed)};
+        transcript_type transcript(init_blob), same_seed_transcript(init_blob);
+
+        OutType result = pow_type::generate(transcript, grinding_bits, seed);
+        BOOST_CHECK_EQUAL(result, pow_type::generate(same_seed_transcript, grinding_bits, seed));
+        BOOST_CHECK(transcript.template int_challenge<std::uint32_t>() ==
+                    same_seed_transcript.template int_challenge<std::uint32_t>());
+
+        for (OutType nonce = static_cast<OutType>(seed); nonce != result; ++nonce) {
+            transcript_type tmp_transcript(init_blob);
+            BOOST_CHECK(!pow_type::verify(tmp_transcript, nonce, grinding_bits));
+        }
+        transcript_type verifier_transcript(init_blob);
+        BOOST_CHECK(pow_type::verify(verifier_transcript, result, grinding_bits));
+    }
+
+    BOOST_AUTO_TEST_CASE(pow_seeded_test) {
+        using namespace nil::crypto3::hashes;
+
+        for (std::uint64_t seed : {0ull, 12345ull, 0xFFFFFFF0ull}) {
+            check_seeded_pow<keccak_1600<256>, std::uint32_t>(seed, 10);
+            check_seeded_pow<keccak_1600<512>, std::uint64_t>(seed, 10);
+            check_seeded_pow<sha2<256>, std::uint32_t>(seed, 8);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(pow_poseidon_seeded_test) {
+        using field_type = curves::pallas::base_field_type;
+        using policy = nil::crypto3::hashes::detail::pasta_poseidon_policy<field_type>;
+        using poseidon = nil::crypto3::hashes::poseidon<policy>;
+        using pow_type = nil::crypto3::zk::commitments::field_proof_of_work<poseidon, field_type>;
+
+        const std::size_t grinding_bits = 6;
+        const std::uint64_t seed = 42;
+        nil::crypto3::zk::transcript::fiat_shamir_heuristic_sequential<poseidon> transcript;
+        auto same_seed_transcript = transcript, verifier_transcript = transcript;
+
+        auto result = pow_type::generate(transcript, grinding_bits, seed);
+        BOOST_CHECK(result == pow_type::generate(same_seed_transcript, grinding_bits, seed));
+        for (auto nonce = field_type::value_type(seed); nonce != result; ++nonce) {
+            auto tmp_transcript = verifier_transcript;
+            BOOST_CHECK(!pow_type::verify(tmp_transcript, nonce, grinding_bits));
+        }
+        BOOST_CHECK(pow_type::verify(verifier_transcript, result, grinding_bits));
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -23,6 +23,7 @@
 
 #define BOOST_TEST_MODULE dag_expression_evaluator_test
 
+#include <functional>
 #include <iostream>
 #include <variant>
 
@@ -41,6 +42,7 @@
 #include <nil/crypto3/zk/math/cached_assignment_table.hpp>
 #include <nil/crypto3/zk/math/dag_expression.hpp>
 #include <nil/crypto3/zk/math/dag_expression_evaluator.hpp>
+#include <nil/crypto3/zk/math/dag_expression_program.hpp>
 
 #include <nil/crypto3/test_tools/random_test_initializer.hpp>
 
@@ -107,4 +109,86 @@ BOOST_AUTO_TEST_CASE(dag_expression_evaluator_test) {
     BOOST_CHECK(classic_result.coefficients() == result[0].coefficients());
 }
 
+
+// Expressions with foldable constants, shared subexpressions and a constant root, checked point by point
+// against the extended domain values of the variables.
+BOOST_AUTO_TEST_CASE(dag_expression_program_test) {
+    using curve_type = algebra::curves::pallas;
+    using FieldType = typename curve_type::base_field_type;
+    using value_type = typename FieldType::value_type;
+    using polynomial_dfs_type = math::polynomial_dfs<value_type>;
+    using var = plonk_variable<polynomial_dfs_type>;
+    using cached_assignment_table_type = cached_assignment_table<FieldType>;
+
+    test_tools::random_test_initializer<FieldType> random_test_initializer;
+
+    using private_table_type = plonk_polynomial_dfs_table<FieldType>::private_table_type;
+    using public_table_type = plonk_polynomial_dfs_table<FieldType>::public_table_type;
+
+    const std::size_t domain_size = 64;
+    const std::size_t max_degree = 4;
+    std::vector<polynomial_dfs_type> witness_values(4, polynomial_dfs_type(domain_size - 1, domain_size));
+    for (auto& column : witness_values) {
+        for (auto& value : column) {
+            value = random_test_initializer.alg_random_engines.template get_alg_engine<FieldType>()();
+        }
+    }
+
+    auto polynomial_table = std::make_shared<plonk_polynomial_dfs_table<FieldType>>(
+        std::make_shared<private_table_type>(witness_values), std::make_shared<public_table_type>());
+    polynomial_dfs_type mask_assignment(domain_size - 1, domain_size);
+    polynomial_dfs_type lagrange_0(domain_size - 1, domain_size);
+    cached_assignment_table_type table(polynomial_table, mask_assignment, lagrange_0);
+
+    std::vector<var> w;
+    for (std::size_t i = 0; i < 4; ++i) {
+        w.emplace_back(i, 0, var::column_type::witness);
+    }
+    auto constant = [](std::uint64_t x) {
+        return expression<var>(polynomial_dfs_type(0, 1, value_type(x)));
+    };
+
+    std::vector<expression<var>> exprs = {
+        w[0] * w[1] + w[2] * constant(2) + constant(3),
+        (w[0] * w[1] + w[2] * constant(2)) * w[3],
+        w[0] * constant(0) + constant(1) * w[2] + -(-w[3]),
+        constant(2) * constant(3),
+        w[0] * w[0] * w[0] - w[1],
+    };
+    std::vector<std::function<value_type(const std::vector<value_type>&)>> expected = {
+        [](const auto& v) { return v[0] * v[1] + v[2] * 2u + 3u; },
+        [](const auto& v) { return (v[0] * v[1] + v[2] * 2u) * v[3]; },
+        [](const auto& v) { return v[2] + v[3]; },
+        [](const auto&) { return value_type(6u); },
+        [](const auto& v) { return v[0] * v[0] * v[0] - v[1]; },
+    };
+
+    dag_expression_builder<var> dag_expr_builder;
+    for (const auto& expr : exprs) {
+        dag_expr_builder.add_expression(expr);
+    }
+    dag_expression<var> dag_expr = dag_expr_builder.build();
+
+    dag_expression_program<FieldType> program(dag_expr);
+    BOOST_CHECK(program.get_register_count() < dag_expr.get_nodes_count());
+    BOOST_CHECK_EQUAL(program.get_variables().size(), 4);
+
+    const std::size_t extended_domain_size = domain_size * max_degree;
+    table.ensure_cache({w[0], w[1], w[2], w[3]}, extended_domain_size);
+
+    dag_expression_evaluator<FieldType> dag_evaluator(dag_expr, max_degree);
+    std::vector<polynomial_dfs_type> result = dag_evaluator.evaluate(table);
+    BOOST_CHECK_EQUAL(result.size(), exprs.size());
+
+    for (std::size_t i = 0; i < extended_domain_size; ++i) {
+        std::vector<value_type> values;
+        for (const auto& v : w) {
+            values.push_back((*table.get(v, extended_domain_size))[i]);
+        }
+        for (std::size_t k = 0; k < exprs.size(); ++k) {
+            BOOST_CHECK(result[k][i] == expected[k](values));
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,157 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE plonk_compact_column_test
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/compact_column.hpp>
+
+using namespace nil::crypto3;
+
+namespace {
+    using field_type = algebra::curves::pallas::base_field_type;
+    using value_type = typename field_type::value_type;
+    using column_type = zk::snark::plonk_column<field_type>;
+    using compact_column_type = zk::snark::plonk_compact_column<field_type>;
+    using encoding = typename compact_column_type::encoding;
+
+    constexpr std::size_t rows_amount = 1024;
+
+    // Values of the column of the given encoding, with a zero tail.
+    column_type make_column(encoding e) {
+        column_type column(rows_amount);
+        for (std::size_t row = 0; row < rows_amount - 100; row++) {
+            switch (e) {
+                case encoding::zero:
+                    break;
+                case encoding::boolean:
+                    column[row] = value_type(row % 3 == 0);
+                    break;
+                case encoding::u8:
+                    column[row] = value_type(row % 251);
+                    break;
+                case encoding::u16:
+                    column[row] = value_type(row * 61);
+                    break;
+                case encoding::sparse:
+                    column[row] = row % 97 == 1 ? -value_type(row) : value_type::zero();
+                    break;
+                case encoding::full:
+                    column[row] = value_type(row) - value_type(3);
+                    break;
+            }
+        }
+        return column;
+    }
+
+    void check_column(const column_type &column, const compact_column_type &compact) {
+        BOOST_CHECK_EQUAL(compact.size(), column.size());
+        for (std::size_t row = 0; row < column.size(); row++) {
+            BOOST_CHECK(compact[row] == column[row]);
+        }
+        BOOST_CHECK(compact.to_column() == column);
+        BOOST_CHECK(compact.matches(column));
+        if (column.empty()) {
+            return;
+        }
+
+        // a changed stored row, a changed row of the zero tail and a different size
+        for (std::size_t row : {std::size_t(0), column.size() / 2, column.size() - 1}) {
+            column_type changed = column;
+            changed[row] += value_type(5);
+            BOOST_CHECK(!compact.matches(changed));
+        }
+        column_type longer = column;
+        longer.push_back(value_type::zero());
+        BOOST_CHECK(!compact.matches(longer));
+    }
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(plonk_compact_column_test_suite)
+
+BOOST_AUTO_TEST_CASE(plonk_compact_column_encodings) {
+    for (encoding e : {encoding::zero, encoding::boolean, encoding::u8, encoding::u16, encoding::sparse, encoding::full}) {
+        const column_type column = make_column(e);
+        const compact_column_type compact(column);
+        BOOST_CHECK(compact.get_encoding() == e);
+        check_column(column, compact);
+        if (e != encoding::full) {
+            BOOST_CHECK_LT(compact.memory_usage(), column.size() * sizeof(value_type) / 4);
+        }
+    }
+
+    // A single value which does not fit 16 bits makes a dense column full.
+    column_type column = make_column(encoding::u16);
+    column[10] = -value_type::one();
+    const compact_column_type compact(column);
+    BOOST_CHECK(compact.get_encoding() == encoding::full);
+    check_column(column, compact);
+
+    check_column(column_type(), compact_column_type(column_type()));
+}
+
+BOOST_AUTO_TEST_CASE(plonk_compact_table_round_trip) {
+    zk::snark::plonk_table<field_type, column_type> table(4, 1, 1, 1);
+    for (std::size_t i = 0; i < 4; i++) {
+        const column_type column = make_column(encoding(i + 2));
+        for (std::size_t row = 0; row < rows_amount; row++) {
+            table.witness(i, row) = column[row];
+        }
+    }
+    table.fill_constant(0, make_column(encoding::u8));
+    table.fill_selector(0, make_column(encoding::boolean));
+    table.public_input(0, 0) = value_type(42);
+    table.public_input(0, rows_amount - 1) = value_type::zero();
+
+    const zk::snark::plonk_compact_table<field_type> compact(table);
+    BOOST_CHECK_EQUAL(compact.witnesses_amount(), 4);
+    BOOST_CHECK_EQUAL(compact.public_input(0).memory_usage(), 1);
+    BOOST_CHECK_LT(compact.memory_usage(), 7 * rows_amount * sizeof(value_type) / 2);
+
+    const auto decompressed = compact.decompress();
+    BOOST_CHECK(decompressed.witnesses() == table.witnesses());
+    BOOST_CHECK(decompressed.public_inputs() == table.public_inputs());
+    BOOST_CHECK(decompressed.constants() == table.constants());
+    BOOST_CHECK(decompressed.selectors() == table.selectors());
+
+    const zk::snark::plonk_compact_table<field_type> compact_public(*table.public_table());
+    BOOST_CHECK(compact_public.matches(*table.public_table()));
+    table.public_input(0, 1) = value_type(7);
+    BOOST_CHECK(!compact_public.matches(*table.public_table()));
+    table.public_input(0, 1) = value_type::zero();
+    table.selector(0, 3) = value_type::one() - table.selector(0, 3);
+    BOOST_CHECK(!compact_public.matches(*table.public_table()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -27,7 +27,7 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 //---------------------------------------------------------------------------//
-// Test circuit1 on different hashes: poseidon, keccak<256>, keccak<512>, sha2
+// Test circuit1 on different hashes: poseidon, keccak<256>, keccak<512>, sha2, poseidon2
 //
 
 #define BOOST_TEST_MODULE placeholder_hashes_test
@@ -38,10 +38,17 @@
 #include <nil/crypto3/algebra/curves/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/pallas.hpp>
 #include <nil/crypto3/algebra/fields/arithmetic_params/alt_bn128.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/babybear.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/goldilocks.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/koalabear.hpp>
 #include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+#include <nil/crypto3/algebra/fields/babybear.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks.hpp>
+#include <nil/crypto3/algebra/fields/koalabear.hpp>
 #include <nil/crypto3/hash/algorithm/hash.hpp>
 #include <nil/crypto3/hash/keccak.hpp>
 #include <nil/crypto3/hash/poseidon.hpp>
+#include <nil/crypto3/hash/poseidon2.hpp>
 #include <nil/crypto3/hash/sha2.hpp>
 #include <nil/crypto3/test_tools/random_test_initializer.hpp>
 
@@ -78,6 +85,18 @@ using AltBnTestRunners = boost::mpl::list<
     placeholder_test_runner<alt_bn_field_type, keccak_512_type, keccak_512_type>,
     placeholder_test_runner<alt_bn_field_type, sha2_256_type, sha2_256_type>>;
 
+template<typename FieldType, std::size_t Width>
+using poseidon2_test_runner = placeholder_test_runner<
+    FieldType,
+    hashes::poseidon2<hashes::detail::poseidon2_policy<FieldType, Width>>,
+    hashes::poseidon2<hashes::detail::poseidon2_policy<FieldType, Width>>>;
+
+// Mersenne31 is not supported by placeholder yet.
+using Poseidon2TestRunners = boost::mpl::list<
+    poseidon2_test_runner<algebra::fields::babybear, 24>,
+    poseidon2_test_runner<algebra::fields::koalabear, 24>,
+    poseidon2_test_runner<algebra::fields::goldilocks, 12>>;
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(hash_test_pallas, TestRunner, PallasTestRunners) {
     test_tools::random_test_initializer<pallas_field_type> random_test_initializer;
     auto circuit = circuit_test_1<pallas_field_type>(
@@ -96,4 +115,14 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(hash_test_alt_bn, TestRunner, AltBnTestRunners) {
     BOOST_CHECK(test_runner.run_test());
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(hash_test_poseidon2, TestRunner, Poseidon2TestRunners) {
+    using field_type = typename TestRunner::field_type;
+    test_tools::random_test_initializer<field_type> random_test_initializer;
+    auto circuit = circuit_test_1<field_type>(
+        random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+        random_test_initializer.generic_random_engine);
+    TestRunner test_runner(circuit);
+    BOOST_CHECK(test_runner.run_test());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -112,6 +112,50 @@ struct placeholder_test_runner {
         return verifier_res;
     }
 
+    // Verifies batch_size copies of one proof with the batch verifier, then checks that a batch
+    // with one broken proof is rejected.
+    bool run_batch_test(std::size_t batch_size) {
+        using verifier_type = placeholder_verifier<field_type, lpc_placeholder_params_type>;
+
+        lpc_scheme_type lpc_scheme(fri_params);
+
+        typename placeholder_public_preprocessor<field_type, lpc_placeholder_params_type>::preprocessed_data_type
+                lpc_preprocessed_public_data = placeholder_public_preprocessor<field_type, lpc_placeholder_params_type>::process(
+                constraint_system, assignments.public_table(), desc, lpc_scheme, max_quotient_poly_chunks);
+
+        typename placeholder_private_preprocessor<field_type, lpc_placeholder_params_type>::preprocessed_data_type
+                lpc_preprocessed_private_data = placeholder_private_preprocessor<field_type, lpc_placeholder_params_type>::process(
+                constraint_system, assignments.private_table(), desc);
+
+        auto lpc_proof = placeholder_prover<field_type, lpc_placeholder_params_type>::process(
+                lpc_preprocessed_public_data, std::move(lpc_preprocessed_private_data), desc, constraint_system,
+                lpc_scheme);
+
+        lpc_scheme_type verifier_lpc_scheme(fri_params);
+        std::vector<decltype(lpc_proof)> proofs(batch_size, lpc_proof);
+        std::vector<std::vector<std::vector<typename field_type::value_type>>> public_inputs(
+                batch_size, assignments.public_inputs());
+
+        // the single proof overload with public input goes through the same checks
+        lpc_scheme_type single_lpc_scheme(fri_params);
+        if (!verifier_type::process(
+                *lpc_preprocessed_public_data.common_data, lpc_proof, desc, constraint_system, single_lpc_scheme,
+                assignments.public_inputs())) {
+            return false;
+        }
+
+        if (!verifier_type::process_batch(
+                *lpc_preprocessed_public_data.common_data, proofs, desc, constraint_system, verifier_lpc_scheme,
+                public_inputs)) {
+            return false;
+        }
+
+        auto &broken_z = proofs.back().eval_proof.eval_proof.z;
+        broken_z.set(QUOTIENT_BATCH, 0, 0, broken_z.get(QUOTIENT_BATCH, 0, 0) + field_type::value_type::one());
+        return !verifier_type::process_batch(
+                *lpc_preprocessed_public_data.common_data, proofs, desc, constraint_system, verifier_lpc_scheme);
+    }
+
     circuit_type circuit;
     plonk_table_description<field_type> desc;
     typename policy_type::constraint_system_type constraint_system;
@@ -57,6 +57,7 @@ in stdenv.mkDerivation {
       (if crypto3_bechmarks then "-DBUILD_CRYPTO3_BENCH_TESTS=ON" else "-DBUILD_CRYPTO3_BENCH_TESTS=OFF")
       (if staticBuild then "-DPROOF_PRODUCER_STATIC_BINARIES=ON" else "-DPROOF_PRODUCER_STATIC_BINARIES=OFF")
       (if profiling then "-DPROFILING_ENABLED=ON" else "-DPROFILING_ENABLED=OFF")
+      "-DCRYPTO3_NATIVE_ARCH=ON" # the default, AVX2/AVX-512 field arithmetic where the build host has it
       "-G Ninja"
     ];
 
@@ -57,5 +57,11 @@ namespace nil {
                 ("max-quotient-chunks,q", make_defaulted_option(config.max_quotient_chunks), "Maximum quotient polynomial parts amount");
         }
 
+        inline void register_preprocessed_data_cache_cli_args(PreprocessedDataCacheConfig& config, po::options_description& cli_options) {
+            cli_options.add_options()
+                ("preprocessed-cache-dir", po::value(&config.directory), "Directory to cache public preprocessed data in, keyed by circuit, table and placeholder config")
+                ("preprocessed-cache-max-size", make_defaulted_option(config.max_size_mb), "Maximum size of the preprocessed data cache in MiB, least recently used entries are removed first");
+        }
+
     } // namespace proof_producer
 } // namespace nil
@@ -0,0 +1,269 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <concepts>
+#include <cstddef>
+#include <format>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+#include <boost/core/demangle.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <nil/proof-generator/command_step.hpp>
+
+
+namespace nil {
+
+    namespace proof_producer {
+
+        namespace detail {
+
+            // "nil::proof_producer::LpcSchemeIO<Curve, Hash>::Writer" -> "LpcSchemeIO::Writer"
+            template <typename Step>
+            std::string step_name() {
+                const std::string full_name = boost::core::demangle(typeid(Step).name());
+                std::string name;
+                int depth = 0;
+                for (char c : full_name) {
+                    if (c == '<') {
+                        depth++;
+                    } else if (c == '>') {
+                        depth--;
+                    } else if (depth == 0) {
+                        name += c;
+                    }
+                }
+                constexpr std::string_view ns_prefix = "nil::proof_producer::";
+                if (name.starts_with(ns_prefix)) {
+                    name.erase(0, ns_prefix.size());
+                }
+                return name;
+            }
+
+        } // namespace detail
+
+
+        // a set of command steps executed as a dependency graph
+        // a step depends on every step of the graph it gets in the constructor arguments, i.e. on the providers of
+        // the resources it subscribes to, and on the steps added by run_after
+        // steps whose dependencies are done run concurrently, each step releases its resources right after execution
+        // the graph is considered failed if any of the steps fails, no new steps are started after a failure
+        // when the command succeeds, the time of each step and the critical path are logged
+        class command_graph: public command_step {
+
+            using clock = std::chrono::steady_clock;
+
+        public:
+            CommandResult execute() override final {
+                const auto graph_start = clock::now();
+
+                std::mutex mutex;
+                std::condition_variable step_finished;
+                std::set<std::size_t> ready; // ordered, so that sequential execution keeps the order of add_step calls
+                std::vector<std::size_t> pending(nodes_.size());
+                std::size_t running = 0;
+                std::optional<std::pair<std::size_t, CommandResult>> failure;
+
+                for (std::size_t i = 0; i < nodes_.size(); ++i) {
+                    pending[i] = nodes_[i].dependencies.size();
+                    if (pending[i] == 0) {
+                        ready.insert(i);
+                    }
+                }
+
+                std::vector<std::jthread> workers;
+                {
+                    std::unique_lock lock(mutex);
+                    while (true) {
+                        while (!failure && !ready.empty() && running < max_concurrent_steps) {
+                            const std::size_t i = *ready.begin();
+                            ready.erase(ready.begin());
+                            running++;
+                            BOOST_LOG_TRIVIAL(trace) << "starting step " << i + 1 << " of " << nodes_.size() << ": " << nodes_[i].name;
+
+                            workers.emplace_back([&, i] {
+                                node& current = nodes_[i];
+                                current.started = clock::now();
+                                auto const res = execute_guarded(*current.step);
+                                current.finished = clock::now();
+                                current.step.reset();
+
+                                std::lock_guard guard(mutex);
+                                running--;
+                                if (!res.succeeded()) {
+                                    if (!failure) {
+                                        failure.emplace(i, res);
+                                    }
+                                } else {
+                                    for (std::size_t dependent : current.dependents) {
+                                        if (--pending[dependent] == 0) {
+                                            ready.insert(dependent);
+                                        }
+                                    }
+                                }
+                                step_finished.notify_one();
+                            });
+                        }
+                        if (running == 0) {
+                            break;
+                        }
+                        step_finished.wait(lock);
+                    }
+                }
+                workers.clear();
+
+                if (failure) {
+                    auto const& [i, res] = *failure;
+                    BOOST_LOG_TRIVIAL(error) << "command failed on step " << i + 1 << " of " << nodes_.size()
+                                             << " (" << nodes_[i].name << "): " << res.error_message();
+                    return res;
+                }
+
+                log_timings(graph_start);
+                return CommandResult::Ok();
+            }
+
+        protected:
+            // returns reference to the added step (non-owning, ownership is guaranteed by the graph)
+            template <typename Step, typename... Args>
+                requires (std::derived_from<Step, command_step> && std::constructible_from<Step, Args...>)
+            Step& add_step(Args&&... args) {
+                BOOST_LOG_TRIVIAL(trace) << "adding " << nodes_.size() + 1 << " step: " << __PRETTY_FUNCTION__;
+
+                std::vector<std::size_t> dependencies;
+                (collect_dependency(dependencies, args), ...);
+
+                auto step = std::make_unique<Step>(std::forward<Args>(args)...);
+                Step& added = *step;
+                nodes_.push_back(node{std::move(step), detail::step_name<Step>()});
+                for (std::size_t dependency : dependencies) {
+                    add_edge(dependency, nodes_.size() - 1);
+                }
+                return added;
+            }
+
+            // orders steps which do not share a resource subscription, e.g. when the prerequisite modifies a resource
+            // the step reads; prerequisite must be added before the step
+            void run_after(const command_step& step, const command_step& prerequisite) {
+                auto const step_index = index_of(step);
+                auto const prerequisite_index = index_of(prerequisite);
+                BOOST_ASSERT(step_index && prerequisite_index);
+                BOOST_ASSERT(*prerequisite_index < *step_index);
+                add_edge(*prerequisite_index, *step_index);
+            }
+
+        private:
+            struct node {
+                std::unique_ptr<command_step> step;
+                std::string name;
+                std::vector<std::size_t> dependencies;
+                std::vector<std::size_t> dependents;
+                clock::time_point started{};
+                clock::time_point finished{};
+            };
+
+            // steps share global profiling state, so they are not run concurrently in profiling builds
+#ifdef PROFILING_ENABLED
+            static constexpr std::size_t max_concurrent_steps = 1;
+#else
+            static constexpr std::size_t max_concurrent_steps = std::numeric_limits<std::size_t>::max();
+#endif
+
+            std::optional<std::size_t> index_of(const command_step& step) const {
+                for (std::size_t i = 0; i < nodes_.size(); ++i) {
+                    if (nodes_[i].step.get() == &step) {
+                        return i;
+                    }
+                }
+                return std::nullopt;
+            }
+
+            template <typename Arg>
+            void collect_dependency(std::vector<std::size_t>& dependencies, const Arg& arg) const {
+                if constexpr (std::derived_from<std::remove_cvref_t<Arg>, command_step>) {
+                    auto const index = index_of(static_cast<const command_step&>(arg));
+                    if (index && std::find(dependencies.begin(), dependencies.end(), *index) == dependencies.end()) {
+                        dependencies.push_back(*index);
+                    }
+                }
+            }
+
+            void add_edge(std::size_t from, std::size_t to) {
+                auto& dependencies = nodes_[to].dependencies;
+                if (std::find(dependencies.begin(), dependencies.end(), from) == dependencies.end()) {
+                    dependencies.push_back(from);
+                    nodes_[from].dependents.push_back(to);
+                }
+            }
+
+            void log_timings(clock::time_point graph_start) const {
+                using std::chrono::duration_cast;
+                using std::chrono::milliseconds;
+
+                if (nodes_.empty()) {
+                    return;
+                }
+
+                // walk back from the last finished step through the dependencies which finished last
+                std::vector<bool> critical(nodes_.size(), false);
+                std::size_t last = 0;
+                for (std::size_t i = 1; i < nodes_.size(); ++i) {
+                    if (nodes_[i].finished > nodes_[last].finished) {
+                        last = i;
+                    }
+                }
+                std::vector<std::size_t> critical_path{last};
+                while (!nodes_[critical_path.back()].dependencies.empty()) {
+                    auto const& dependencies = nodes_[critical_path.back()].dependencies;
+                    critical_path.push_back(*std::max_element(dependencies.begin(), dependencies.end(),
+                        [this](std::size_t a, std::size_t b) { return nodes_[a].finished < nodes_[b].finished; }));
+                }
+                std::reverse(critical_path.begin(), critical_path.end());
+
+                milliseconds steps_total{0};
+                milliseconds critical_total{0};
+                for (std::size_t i : critical_path) {
+                    critical[i] = true;
+                    critical_total += duration_cast<milliseconds>(nodes_[i].finished - nodes_[i].started);
+                }
+
+                for (std::size_t i = 0; i < nodes_.size(); ++i) {
+                    auto const& n = nodes_[i];
+                    auto const duration = duration_cast<milliseconds>(n.finished - n.started);
+                    steps_total += duration;
+                    BOOST_LOG_TRIVIAL(info) << std::format("step {} ({}): started at {} ms, took {} ms{}",
+                        i + 1, n.name,
+                        duration_cast<milliseconds>(n.started - graph_start).count(),
+                        duration.count(),
+                        critical[i] ? " [critical path]" : "");
+                }
+
+                std::string path;
+                for (std::size_t i : critical_path) {
+                    path += (path.empty() ? "" : " -> ") + nodes_[i].name;
+                }
+                BOOST_LOG_TRIVIAL(info) << std::format("critical path: {} ({} ms of {} ms wall time, {} ms in all steps)",
+                    path,
+                    critical_total.count(),
+                    duration_cast<milliseconds>(clock::now() - graph_start).count(),
+                    steps_total.count());
+            }
+
+            std::vector<node> nodes_;
+        };
+
+    } // namespace proof_producer
+} // namespace nil
@@ -110,6 +110,23 @@ namespace nil {
         };
 
 
+        // executes the step, exceptions escaping it are converted to the error result
+        inline CommandResult execute_guarded(command_step& step) {
+            try {
+                return step.execute();
+            }
+            catch (std::logic_error const& e) {
+                return CommandResult::Error(ResultCode::ProverError, "caught logic error during command execution: {}", e.what());
+            }
+            catch (std::bad_alloc const& e) {
+                return CommandResult::Error(ResultCode::OutOfMemory, "allocation failure: {}", e.what());
+            }
+            catch (std::exception const& e) {
+                return CommandResult::UnknownError("unknown exception: {}", e.what());
+            }
+        }
+
+
         // a chain of command steps to be executed sequentially
         // each step is executed in the queue order and is popped from the queue after execution and releases its resources
         // the chain is considered failed if any of the steps fails
@@ -120,35 +137,17 @@ namespace nil {
             CommandResult execute() override final {
                 int stage{1};
                 int total_stages = steps_.size();
-                CommandResult chain_res = CommandResult::Ok();
-                try {
-                    while (!steps_.empty()) {
-                        auto const res = steps_.front()->execute();
-                        if (!res.succeeded())
-                        {
-                            chain_res = res;
-                            break;
-                        }
-                        steps_.pop();
-                        stage++;
+                while (!steps_.empty()) {
+                    auto const res = execute_guarded(*steps_.front());
+                    if (!res.succeeded()) {
+                        BOOST_LOG_TRIVIAL(error) << "command failed on stage " << stage << " of " << total_stages << ": " << res.error_message();
+                        return res;
                     }
-                }
-                catch (std::logic_error const& e) {
-                    chain_res = CommandResult::Error(ResultCode::ProverError, "caught logic error during command execution: {}", e.what());
-                }
-                catch (std::bad_alloc const& e) {
-                    chain_res = CommandResult::Error(ResultCode::OutOfMemory, "allocation failure: {}", e.what());
-                }
-                catch (std::exception const& e) {
-                    chain_res = CommandResult::UnknownError("unknown exception: {}", e.what());
-                }
-
-                if (!chain_res.succeeded()) {
-                    BOOST_LOG_TRIVIAL(error) << "command failed on stage " << stage << " of " << total_stages << ": " << chain_res.error_message();
-                    return chain_res;
+                    steps_.pop();
+                    stage++;
                 }
 
-                return chain_res;
+                return CommandResult::Ok();
             }
 
         protected:
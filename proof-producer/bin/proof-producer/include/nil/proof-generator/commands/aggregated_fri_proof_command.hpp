@@ -132,20 +132,17 @@ namespace nil {
                         transcript.template challenge<BlueprintField>();
 
                     // Sum up all the polynomials from the files.
-                    polynomial_type sum_poly;
-                    for (const auto& path : input_combined_Q_polynomial_files) {
-                        std::optional<polynomial_type> next_combined_Q = PolynomialIO::read_poly_from_file(path);
-                        if (!next_combined_Q) {
-                            return CommandResult::Error(ResultCode::IOError, "Failed to read next combined Q from {}", path.string());
-                        }
-                        sum_poly += next_combined_Q.value();
+                    std::optional<polynomial_type> sum_poly = PolynomialIO::read_poly_sum_from_files(
+                        input_combined_Q_polynomial_files);
+                    if (!sum_poly) {
+                        return CommandResult::Error(ResultCode::IOError, "Failed to read combined Q polynomials");
                     }
                     auto lpc_scheme = commitment_scheme_fac_.make_lpc_scheme(table_description_->rows_amount);
                     FriProof fri_proof;
                     std::vector<typename BlueprintField::value_type> challenges;
                     ProofOfWorkType proof_of_work;
 
-                    lpc_scheme->proof_eval_FRI_proof(sum_poly, fri_proof, challenges, proof_of_work, transcript);
+                    lpc_scheme->proof_eval_FRI_proof(sum_poly.value(), fri_proof, challenges, proof_of_work, transcript);
 
                     auto res = save_fri_proof_to_file(fri_proof, aggregated_fri_proof_output_file);
                     if (!res) {
@@ -6,6 +6,7 @@
 
 #include <nil/proof-generator/types/type_system.hpp>
 #include <nil/proof-generator/command_step.hpp>
+#include <nil/proof-generator/command_graph.hpp>
 #include <nil/proof-generator/commands/detail/io/circuit_io.hpp>
 #include <nil/proof-generator/commands/detail/io/assignment_table_io.hpp>
 #include <nil/proof-generator/evm_verifier_print.hpp>
@@ -19,10 +20,11 @@ namespace nil {
     namespace proof_producer {
 
         template<typename CurveType, typename HashType>
-        class AllCommand: public command_chain {
+        class AllCommand: public command_graph {
         public:
             struct Args {
                 PlaceholderConfig config;
+                PreprocessedDataCacheConfig preprocessed_cache;
                 boost::filesystem::path in_circuit_file_path;
                 boost::filesystem::path in_assignment_table_file_path;
 
@@ -49,6 +51,7 @@ namespace nil {
 
                     register_output_artifacts_cli_args(out_assignment_debug_opts, config);
                     register_placeholder_config_cli_args(this->config, config);
+                    register_preprocessed_data_cache_cli_args(preprocessed_cache, config);
                 }
             };
 
@@ -82,7 +85,8 @@ namespace nil {
                     args.config,
                     table_reader,
                     table_reader,
-                    circuit_reader
+                    circuit_reader,
+                    args.preprocessed_cache
                 );
                 auto& private_preprocessor = add_step<PrivatePreprocessor>(circuit_reader, table_reader, table_reader); // preprocess private data
                 auto& prover = add_step<Prover>(                                                                             // generate proof
@@ -113,9 +117,10 @@ namespace nil {
                     add_step<CommonDataWriter>(public_preprocessor, args.out_common_data_file_path);
                 }
 
-                // optional: write lpc scheme
+                // optional: write lpc scheme, the prover commits to it, so the state after proving is written
                 if (!args.out_lpc_scheme_file_path.empty()) {
-                    add_step<LpcSchemeWriter>(public_preprocessor, args.out_lpc_scheme_file_path);
+                    auto& lpc_scheme_writer = add_step<LpcSchemeWriter>(public_preprocessor, args.out_lpc_scheme_file_path);
+                    run_after(lpc_scheme_writer, prover);
                 }
 
                 // optional: print evm verifier
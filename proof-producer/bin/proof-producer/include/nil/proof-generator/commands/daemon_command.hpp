@@ -0,0 +1,457 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <format>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/program_options.hpp>
+#include <boost/system/system_error.hpp>
+
+#include <nil/crypto3/bench/scoped_profiler.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/compact_column.hpp>
+
+#include <nil/proof-generator/types/type_system.hpp>
+#include <nil/proof-generator/command_step.hpp>
+#include <nil/proof-generator/command_graph.hpp>
+#include <nil/proof-generator/resources.hpp>
+#include <nil/proof-generator/cli_arg_utils.hpp>
+#include <nil/proof-generator/preset/preset.hpp>
+#include <nil/proof-generator/preset/limits.hpp>
+#include <nil/proof-generator/assigner/options.hpp>
+
+#include <nil/proof-generator/commands/detail/io/assignment_table_io.hpp>
+#include <nil/proof-generator/commands/detail/io/preprocessed_data_io.hpp>
+#include <nil/proof-generator/commands/detail/io/lpc_scheme_io.hpp>
+#include <nil/proof-generator/commands/detail/proof_gen.hpp>
+#include <nil/proof-generator/commands/preprocess_command.hpp>
+#include <nil/proof-generator/commands/fill_assignment_command.hpp>
+#include <nil/proof-generator/commands/gen_fast_partial_proof_command.hpp>
+
+
+namespace nil {
+    namespace proof_producer {
+
+        // the trace independent data of circuits kept in memory by the daemon between the jobs
+        template <typename CurveType, typename HashType>
+        struct CircuitCache {
+            using Types                   = TypeSystem<CurveType, HashType>;
+            using ConstraintSystem        = typename Types::ConstraintSystem;
+            using TableDescription        = typename Types::TableDescription;
+            using PublicPreprocessedData  = typename Types::PublicPreprocessedData;
+            using LpcScheme               = typename Types::LpcScheme;
+            using CompactTable            = nil::crypto3::zk::snark::plonk_compact_table<typename Types::BlueprintField>;
+
+            // the tables stay in memory for the lifetime of the daemon, so they are kept in compact columns
+            struct Entry {
+                // preset results, the table is decompressed for each job as the assigner fills it in place
+                std::shared_ptr<ConstraintSystem> constraint_system;
+                std::shared_ptr<CompactTable> preset_table;
+                std::shared_ptr<TableDescription> preset_description;
+
+                // public preprocessing results, reused while the public table and the description of a job are
+                // the same as the ones they were computed from
+                // the LPC scheme is kept as it was right after preprocessing, each job gets its own copy to commit into
+                std::shared_ptr<CompactTable> public_table;
+                std::shared_ptr<TableDescription> table_description;
+                std::shared_ptr<PublicPreprocessedData> public_preprocessed_data;
+                std::shared_ptr<LpcScheme> lpc_scheme;
+
+                std::size_t last_used{0};
+            };
+
+            explicit CircuitCache(std::size_t max_entries): max_entries_(std::max<std::size_t>(max_entries, 1)) {}
+
+            // the least recently used entry is evicted when a new circuit does not fit, so the circuit name
+            // is expected to be checked before
+            Entry& get(const std::string& circuit_name, const CircuitsLimits& limits, const PlaceholderConfig& config) {
+                auto const key = make_key(circuit_name, limits, config);
+                auto it = entries_.find(key);
+                if (it == entries_.end()) {
+                    if (entries_.size() >= max_entries_) {
+                        auto const lru = std::min_element(entries_.begin(), entries_.end(), [](auto const& a, auto const& b) {
+                            return a.second.last_used < b.second.last_used;
+                        });
+                        BOOST_LOG_TRIVIAL(info) << "Evicting circuit " << lru->first << " from the cache";
+                        entries_.erase(lru);
+                    }
+                    it = entries_.emplace(key, Entry{}).first;
+                }
+                it->second.last_used = ++uses_;
+                return it->second;
+            }
+
+            // drops the entry of a circuit, e.g. the one of a failed preset
+            void erase(const std::string& circuit_name, const CircuitsLimits& limits, const PlaceholderConfig& config) {
+                entries_.erase(make_key(circuit_name, limits, config));
+            }
+
+            bool contains(const std::string& circuit_name, const CircuitsLimits& limits, const PlaceholderConfig& config) const {
+                return entries_.contains(make_key(circuit_name, limits, config));
+            }
+
+            std::size_t size() const {
+                return entries_.size();
+            }
+
+        private:
+            static std::string make_key(const std::string& circuit_name, const CircuitsLimits& limits, const PlaceholderConfig& config) {
+                return std::format("{}[{},{},{},{},{},{},{},{},{},{},{}][{},{},{},{}]",
+                    circuit_name,
+                    limits.max_copy_rows, limits.max_rw_rows, limits.max_keccak_blocks, limits.max_bytecode_rows,
+                    limits.max_total_rows, limits.max_mpt_rows, limits.max_zkevm_rows, limits.max_exp_rows,
+                    limits.max_exp_ops, limits.max_state_rows, limits.RLC_CHALLENGE,
+                    config.max_quotient_chunks, config.expand_factor, config.lambda, config.grind);
+            }
+
+            std::size_t max_entries_;
+            std::size_t uses_{0};
+            std::map<std::string, Entry> entries_;
+        };
+
+
+        template <typename CurveType, typename HashType>
+        struct CachedPresetStep {
+            using Types            = TypeSystem<CurveType, HashType>;
+            using BlueprintField   = typename Types::BlueprintField;
+            using ConstraintSystem = typename Types::ConstraintSystem;
+            using AssignmentTable  = typename Types::AssignmentTable;
+            using TableDescription = typename Types::TableDescription;
+            using CompactTable     = typename CircuitCache<CurveType, HashType>::CompactTable;
+            using CacheEntry       = typename CircuitCache<CurveType, HashType>::Entry;
+
+            // same as PresetStep, but the circuit is built only once per cache entry
+            struct Executor:
+                public command_step,
+                public resources::resources_provider<ConstraintSystem, AssignmentTable, TableDescription>
+            {
+                Executor(CacheEntry& cache_entry, const std::string& circuit_name, const CircuitsLimits& circuit_limits):
+                    cache_entry_(cache_entry),
+                    circuit_name_(circuit_name),
+                    circuit_limits_(circuit_limits)
+                {}
+
+                CommandResult execute() override {
+                    using resources::notify;
+
+                    if (!cache_entry_.constraint_system) {
+                        PROFILE_SCOPE("Preset");
+                        std::shared_ptr<AssignmentTable> preset_table;
+                        const auto err = CircuitFactory<BlueprintField>::initialize_circuit(
+                                circuit_name_,
+                                cache_entry_.constraint_system,
+                                preset_table,
+                                cache_entry_.preset_description,
+                                circuit_limits_
+                        );
+                        PROFILE_SCOPE_END();
+
+                        if (err) {
+                            cache_entry_ = CacheEntry{};
+                            return CommandResult::Error(ResultCode::InvalidInput, "Can't initialize circuit '{}', err: {}" , circuit_name_, err.value());
+                        }
+                        cache_entry_.preset_table = std::make_shared<CompactTable>(*preset_table);
+                        BOOST_LOG_TRIVIAL(debug) << "Compact preset table of circuit " << circuit_name_ << " takes "
+                                                 << cache_entry_.preset_table->memory_usage() << " bytes";
+                    } else {
+                        BOOST_LOG_TRIVIAL(info) << "Using cached preset of circuit " << circuit_name_;
+                    }
+
+                    notify<ConstraintSystem>(*this, cache_entry_.constraint_system);
+                    notify<AssignmentTable> (*this, std::make_shared<AssignmentTable>(cache_entry_.preset_table->decompress()));
+                    notify<TableDescription>(*this, std::make_shared<TableDescription>(*cache_entry_.preset_description));
+
+                    return CommandResult::Ok();
+                }
+
+            private:
+                CacheEntry& cache_entry_;
+                const std::string circuit_name_;
+                const CircuitsLimits circuit_limits_;
+            };
+        };
+
+
+        template <typename CurveType, typename HashType>
+        struct CachedPublicPreprocessStep {
+            using Types                   = TypeSystem<CurveType, HashType>;
+            using PublicPreprocessedData  = typename Types::PublicPreprocessedData;
+            using CommonData              = typename Types::CommonData;
+            using ConstraintSystem        = typename Types::ConstraintSystem;
+            using LpcScheme               = typename Types::LpcScheme;
+            using AssignmentTable         = typename Types::AssignmentTable;
+            using AssignmentPublicTable   = typename Types::AssignmentPublicTable;
+            using TableDescription        = typename Types::TableDescription;
+            using PublicPreprocessor      = PublicPreprocessStep<CurveType, HashType>;
+            using CompactTable            = typename CircuitCache<CurveType, HashType>::CompactTable;
+            using CacheEntry              = typename CircuitCache<CurveType, HashType>::Entry;
+
+            // same as PublicPreprocessStep, but the result is reused while the public part of the table does not change
+            struct Executor: public command_step,
+                public resources::resources_provider<PublicPreprocessedData, CommonData, LpcScheme>
+            {
+                Executor(
+                    CacheEntry& cache_entry,
+                    PlaceholderConfig config,
+                    resources::resource_provider<TableDescription>& desc_provider,
+                    resources::resource_provider<AssignmentTable>& table_provider,
+                    resources::resource_provider<ConstraintSystem>& constraint_provider
+                ): cache_entry_(cache_entry),
+                   commitment_scheme_fac_(config)
+                {
+                    resources::subscribe_value<TableDescription>(desc_provider, table_description_);
+                    resources::subscribe_value<ConstraintSystem>(constraint_provider, constraint_system_);
+                    resources::subscribe<AssignmentTable>(table_provider, [&] (std::shared_ptr<AssignmentTable> table) {
+                        assignment_public_table_ = table->public_table();
+                    });
+                }
+
+                CommandResult execute() override {
+                    BOOST_ASSERT(table_description_);
+                    BOOST_ASSERT(assignment_public_table_);
+                    BOOST_ASSERT(constraint_system_);
+
+                    using resources::notify;
+
+                    std::shared_ptr<PublicPreprocessedData> public_preprocessed_data;
+                    std::shared_ptr<LpcScheme> lpc_scheme;
+
+                    // the columns of the job are compared with the cached compact ones as they are, the table
+                    // is compressed only when it is cached
+                    if (cache_entry_.public_preprocessed_data &&
+                        *cache_entry_.table_description == *table_description_ &&
+                        cache_entry_.public_table->matches(*assignment_public_table_))
+                    {
+                        BOOST_LOG_TRIVIAL(info) << "Using cached public preprocessed data";
+                        public_preprocessed_data = cache_entry_.public_preprocessed_data;
+                        lpc_scheme = std::make_shared<LpcScheme>(*cache_entry_.lpc_scheme);
+                    } else {
+                        std::tie(public_preprocessed_data, lpc_scheme) = PublicPreprocessor::preprocess(
+                            commitment_scheme_fac_, *constraint_system_, assignment_public_table_, *table_description_);
+
+                        cache_entry_.public_table = std::make_shared<CompactTable>(*assignment_public_table_);
+                        cache_entry_.table_description = std::make_shared<TableDescription>(*table_description_);
+                        cache_entry_.public_preprocessed_data = public_preprocessed_data;
+                        cache_entry_.lpc_scheme = std::make_shared<LpcScheme>(*lpc_scheme);
+                    }
+
+                    notify<PublicPreprocessedData>(*this, public_preprocessed_data);
+                    notify<CommonData>(*this, public_preprocessed_data->common_data);
+                    notify<LpcScheme>(*this, lpc_scheme);
+
+                    return CommandResult::Ok();
+                }
+
+            private:
+                CacheEntry& cache_entry_;
+                typename PublicPreprocessor::CommitmentSchemeFac commitment_scheme_fac_;
+
+                std::shared_ptr<TableDescription> table_description_;
+                std::shared_ptr<AssignmentPublicTable> assignment_public_table_;
+                std::shared_ptr<ConstraintSystem> constraint_system_;
+            };
+        };
+
+
+        // fast-generate-partial-proof job with the preset and the public preprocessing taken from the cache
+        template <typename CurveType, typename HashType>
+        class DaemonJob: public command_graph {
+        public:
+            using Args       = typename FastPartialProofCommand<CurveType, HashType>::Args;
+            using CacheEntry = typename CircuitCache<CurveType, HashType>::Entry;
+
+            DaemonJob(const Args& args, CacheEntry& cache_entry) {
+                using Preset                      = CachedPresetStep<CurveType, HashType>::Executor;
+                using Assigner                    = FillAssignmentStep<CurveType, HashType>::Executor;
+                using PublicPreprocessor          = CachedPublicPreprocessStep<CurveType, HashType>::Executor;
+                using PrivatePreprocessor         = PrivatePreprocessStep<CurveType, HashType>::Executor;
+                using Prover                      = ProveStep<CurveType, HashType>::PartialProofGenerator;
+                using LpcSchemeWriter             = LpcSchemeIO<CurveType, HashType>::Writer;
+                using CommonDataWriter            = PreprocessedPublicDataIO<CurveType, HashType>::CommonDataWriter;
+                using AssignmentDescriptionWriter = AssignmentTableIO<CurveType, HashType>::DescriptionWriter;
+
+                auto& circuit_maker        = add_step<Preset>(cache_entry, args.circuit_name, args.circuit_limits);
+                auto& assigner             = add_step<Assigner>(circuit_maker, circuit_maker, args.circuit_name, args.in_trace_file_path, AssignerOptions(false, args.circuit_limits));
+                auto& public_preprocessor  = add_step<PublicPreprocessor>(cache_entry, args.config, assigner, assigner, circuit_maker);
+                auto& private_preprocessor = add_step<PrivatePreprocessor>(circuit_maker, assigner, assigner);
+
+                auto& prover = add_step<Prover>(
+                    circuit_maker,
+                    assigner,            // for table
+                    assigner,            // for table description
+                    public_preprocessor, // for public data
+                    public_preprocessor, // for LPC scheme
+                    private_preprocessor,
+
+                    args.out_proof_file_path,
+                    args.out_challenge_file_path,
+                    args.out_theta_power_file_path
+                );
+                auto& lpc_scheme_writer = add_step<LpcSchemeWriter>(public_preprocessor, args.out_updated_lpc_scheme_file_path);
+                run_after(lpc_scheme_writer, prover); // the prover updates the scheme in place
+                add_step<CommonDataWriter>(public_preprocessor, args.out_common_data_file_path);
+                add_step<AssignmentDescriptionWriter>(assigner, args.out_assignment_desc_file_path);
+            }
+        };
+
+
+        // long-running prover which runs fast-generate-partial-proof jobs back-to-back
+        // a job is a line with the arguments of fast-generate-partial-proof, it is answered with a line
+        // "ok <latency ms>" or "error <result code> <message>"
+        // "stats" is answered with the job counters, "shutdown" stops the daemon
+        // jobs are read from stdin, or from the connections to the unix socket, one connection at a time
+        template <typename CurveType, typename HashType>
+        class DaemonCommand: public command_step {
+            using clock          = std::chrono::steady_clock;
+            using Job            = DaemonJob<CurveType, HashType>;
+            using BlueprintField = typename TypeSystem<CurveType, HashType>::BlueprintField;
+
+        public:
+            struct Args {
+                boost::filesystem::path socket_path;
+                std::size_t max_cached_circuits{1};
+
+                Args(boost::program_options::options_description& desc) {
+                    namespace po = boost::program_options;
+
+                    desc.add_options()
+                        ("socket", po::value(&socket_path), "Unix socket to accept jobs on, jobs are read from stdin if not set")
+                        ("max-cached-circuits", make_defaulted_option(max_cached_circuits), "Number of circuits kept preprocessed in memory");
+                }
+            };
+
+            DaemonCommand(const Args& args):
+                socket_path_(args.socket_path),
+                cache_(args.max_cached_circuits)
+            {}
+
+            CommandResult execute() override {
+                if (socket_path_.empty()) {
+                    BOOST_LOG_TRIVIAL(info) << "Reading jobs from stdin";
+                    serve(std::cin, std::cout);
+                    return CommandResult::Ok();
+                }
+
+                namespace local = boost::asio::local;
+                try {
+                    boost::asio::io_context io_context;
+                    boost::system::error_code ec;
+                    boost::filesystem::remove(socket_path_, ec);
+                    local::stream_protocol::acceptor acceptor(io_context, local::stream_protocol::endpoint(socket_path_.string()));
+                    BOOST_LOG_TRIVIAL(info) << "Accepting jobs on " << socket_path_;
+
+                    bool shutdown = false;
+                    while (!shutdown) {
+                        local::stream_protocol::iostream connection;
+                        acceptor.accept(connection.socket());
+                        shutdown = serve(connection, connection);
+                    }
+                    boost::filesystem::remove(socket_path_, ec);
+                } catch (boost::system::system_error const& e) {
+                    return CommandResult::Error(ResultCode::IOError, "Socket {} failure: {}", socket_path_.string(), e.what());
+                }
+                return CommandResult::Ok();
+            }
+
+            // runs the jobs read from in and answers them to out, returns true if the daemon is asked to shut down
+            bool serve(std::istream& in, std::ostream& out) {
+                std::string line;
+                while (std::getline(in, line)) {
+                    if (line.empty()) {
+                        continue;
+                    }
+                    if (line == "shutdown") {
+                        out << "ok" << std::endl;
+                        return true;
+                    }
+                    if (line == "stats") {
+                        out << stats() << std::endl;
+                        continue;
+                    }
+
+                    auto const started = clock::now();
+                    auto const res = run_job(line);
+                    auto const latency = std::chrono::duration_cast<std::chrono::milliseconds>(clock::now() - started);
+                    account_job(started, latency, res);
+
+                    if (res.succeeded()) {
+                        out << "ok " << latency.count() << std::endl;
+                    } else {
+                        out << "error " << static_cast<int>(res.result_code()) << " " << res.error_message() << std::endl;
+                    }
+                }
+                return false;
+            }
+
+        private:
+            CommandResult run_job(const std::string& line) {
+                namespace po = boost::program_options;
+
+                po::options_description desc;
+                typename Job::Args args(desc);
+                try {
+                    po::variables_map vm;
+                    po::store(po::command_line_parser(po::split_unix(line)).options(desc).run(), vm);
+                    po::notify(vm);
+                } catch (po::error const& e) {
+                    return CommandResult::Error(ResultCode::InvalidInput, "Invalid job arguments: {}", e.what());
+                }
+
+                // checked before the cache is touched, a job with an unknown circuit does not evict anything
+                if (!CircuitFactory<BlueprintField>::is_known_circuit(args.circuit_name)) {
+                    return CommandResult::Error(ResultCode::InvalidInput, "Unknown circuit name {}", args.circuit_name);
+                }
+
+                auto& cache_entry = cache_.get(args.circuit_name, args.circuit_limits, args.config);
+                Job job(args, cache_entry);
+                auto res = job.execute();
+                if (!cache_entry.constraint_system) {
+                    BOOST_LOG_TRIVIAL(info) << "Dropping circuit " << args.circuit_name << " from the cache, its preset failed";
+                    cache_.erase(args.circuit_name, args.circuit_limits, args.config);
+                }
+                return res;
+            }
+
+            void account_job(clock::time_point started, std::chrono::milliseconds latency, const CommandResult& res) {
+                if (jobs_ == 0) {
+                    first_job_started_ = started;
+                }
+                jobs_++;
+                if (!res.succeeded()) {
+                    failed_jobs_++;
+                }
+                total_latency_ += latency;
+                BOOST_LOG_TRIVIAL(info) << std::format("Job {} {} in {} ms, {}",
+                    jobs_, res.succeeded() ? "done" : "failed", latency.count(), stats());
+            }
+
+            std::string stats() const {
+                auto const uptime = std::chrono::duration<double>(clock::now() - first_job_started_).count();
+                auto const proofs = jobs_ - failed_jobs_;
+                return std::format("jobs={} failed={} proofs_per_hour={:.1f} mean_latency_ms={} cached_circuits={}",
+                    jobs_, failed_jobs_,
+                    uptime > 0 ? proofs * 3600.0 / uptime : 0.0,
+                    jobs_ > 0 ? total_latency_.count() / jobs_ : 0,
+                    cache_.size());
+            }
+
+            const boost::filesystem::path socket_path_;
+            CircuitCache<CurveType, HashType> cache_;
+
+            std::size_t jobs_{0};
+            std::size_t failed_jobs_{0};
+            std::chrono::milliseconds total_latency_{0};
+            clock::time_point first_job_started_{};
+        };
+
+    } // namespace proof_producer
+} // namespace nil
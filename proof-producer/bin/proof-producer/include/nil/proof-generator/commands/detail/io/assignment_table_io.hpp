@@ -11,6 +11,7 @@
 #include <nil/proof-generator/marshalling_utils.hpp>
 #include <nil/proof-generator/output_artifacts/output_artifacts.hpp>
 #include <nil/proof-generator/output_artifacts/assignment_table_writer.hpp>
+#include <nil/proof-generator/output_artifacts/mapped_assignment_table.hpp>
 
 
 namespace nil {
@@ -26,14 +27,17 @@ namespace nil {
             using AssignmentTable = typename Types::AssignmentTable;
             using TableDescription = typename Types::TableDescription;
             using TableMarshalling = typename Types::TableMarshalling;
+            using MappedTable = mapped_assignment_table<BlueprintField>;
 
             struct BinaryWriter: public command_step {
 
                 BinaryWriter(
                     resources::resource_provider<AssignmentTable>& table_provider,
                     resources::resource_provider<TableDescription>& description_provider,
-                    const boost::filesystem::path& output_filename):
-                output_filename_ (output_filename)
+                    const boost::filesystem::path& output_filename,
+                    bool mapped_format = false):
+                output_filename_ (output_filename),
+                mapped_format_(mapped_format)
                 {
                     resources::subscribe_value<AssignmentTable>(table_provider, assignment_table_);
                     resources::subscribe_value<TableDescription>(description_provider, table_description_);
@@ -53,6 +57,13 @@ namespace nil {
                         return CommandResult::Error(ResultCode::IOError, "Failed to open file {}", output_filename_.string());
                     }
 
+                    if (mapped_format_) {
+                        if (!MappedTable::write(out, *assignment_table_, *table_description_)) {
+                            return CommandResult::Error(ResultCode::IOError, "Failed to write assignment table to {}", output_filename_.string());
+                        }
+                        return CommandResult::Ok();
+                    }
+
                     writer::write_binary_assignment(
                         out, *assignment_table_, *table_description_
                     );
@@ -62,6 +73,7 @@ namespace nil {
 
             private:
                 const boost::filesystem::path output_filename_;
+                const bool mapped_format_;
                 std::shared_ptr<AssignmentTable> assignment_table_;
                 std::shared_ptr<TableDescription> table_description_;
             };
@@ -179,6 +191,18 @@ namespace nil {
 
                     BOOST_LOG_TRIVIAL(info) << "Read assignment table from " << assignment_table_file_path_;
 
+                    if (MappedTable::is_mapped_file(assignment_table_file_path_.string())) {
+                        auto mapped_table = MappedTable::open(assignment_table_file_path_.string());
+                        if (!mapped_table) {
+                            return CommandResult::Error(ResultCode::IOError, "Failed to read assignment table from {}", assignment_table_file_path_.string());
+                        }
+
+                        notify<AssignmentTable>(*this, std::make_shared<AssignmentTable>(mapped_table->make_table()));
+                        notify<TableDescription>(*this, std::make_shared<TableDescription>(mapped_table->description()));
+
+                        return CommandResult::Ok();
+                    }
+
                     auto marshalled_table =
                         detail::decode_marshalling_from_file<TableMarshalling>(assignment_table_file_path_);
                     if (!marshalled_table) {
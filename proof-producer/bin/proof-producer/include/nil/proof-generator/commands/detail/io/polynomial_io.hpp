@@ -1,6 +1,15 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <optional>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include <boost/filesystem.hpp>
 #include <boost/log/trivial.hpp>
@@ -9,6 +18,9 @@
 #include <nil/proof-generator/file_operations.hpp>
 #include <nil/proof-generator/marshalling_utils.hpp>
 
+#include <nil/actor/core/parallelization_utils.hpp>
+
+#include <nil/crypto3/math/type_traits.hpp>
 #include <nil/crypto3/marshalling/math/types/polynomial.hpp>
 
 namespace nil {
@@ -16,9 +28,10 @@ namespace nil {
 
         template <typename CurveType, typename HashType>
         struct PolynomialIO {
-            using Types      = TypeSystem<CurveType, HashType>;
-            using TTypeBase  = typename Types::TTypeBase;
-            using Endianness = typename Types::Endianness;
+            using Types           = TypeSystem<CurveType, HashType>;
+            using TTypeBase       = typename Types::TTypeBase;
+            using Endianness      = typename Types::Endianness;
+            using polynomial_type = typename Types::polynomial_type;
 
             // NOTE: PolynomialType is not required to match Types::polynomial_type
             template <typename PolynomialType = Types::polynomial_type>
@@ -60,6 +73,128 @@ namespace nil {
                 return detail::encode_marshalling_to_file<polynomial_marshalling_type>(
                     output_file, marshalled_poly);
             }
+
+            // Reads the sum of the polynomials in the files into one preallocated polynomial, chunks of rows are
+            // read from all the files and added in parallel, so the memory stays near one polynomial for any
+            // number of files. The polynomials which have to be resized for the sum (those over a smaller domain
+            // or constant ones) are read whole and added afterwards.
+            static std::optional<polynomial_type> read_poly_sum_from_files(
+                const std::vector<boost::filesystem::path>& input_files
+            ) {
+                static_assert(nil::crypto3::math::is_polynomial_dfs<polynomial_type>::value);
+
+                using value_type = typename polynomial_type::value_type;
+                using size_marshalling_type = nil::crypto3::marshalling::types::integral<TTypeBase, std::size_t>;
+                using element_marshalling_type = nil::crypto3::marshalling::types::field_element<TTypeBase, value_type>;
+
+                constexpr std::size_t chunk_rows = 1 << 14;
+                const std::size_t size_length = size_marshalling_type().length();
+                const std::size_t header_length = 2 * size_length;
+                const std::size_t element_length = element_marshalling_type().length();
+
+                struct input_file {
+                    boost::filesystem::path path;
+                    int fd;
+                    std::size_t file_size;
+                    std::size_t degree;
+                    std::size_t size;
+
+                    input_file(boost::filesystem::path path, int fd): path(std::move(path)), fd(fd) {}
+                    input_file(input_file&& other) noexcept
+                        : path(std::move(other.path)), fd(std::exchange(other.fd, -1)), file_size(other.file_size),
+                          degree(other.degree), size(other.size) {
+                    }
+                    ~input_file() {
+                        if (fd >= 0) {
+                            ::close(fd);
+                        }
+                    }
+                };
+
+                // the marshalled polynomial_dfs is the degree and the values with their count as a prefix
+                std::vector<input_file> inputs;
+                inputs.reserve(input_files.size());
+                for (const auto& path : input_files) {
+                    const int fd = ::open(path.c_str(), O_RDONLY);
+                    if (fd < 0) {
+                        BOOST_LOG_TRIVIAL(error) << "Can't read file " << path;
+                        return std::nullopt;
+                    }
+                    auto& input = inputs.emplace_back(path, fd);
+
+                    struct stat file_stat;
+                    std::vector<std::uint8_t> header(header_length);
+                    if (::fstat(fd, &file_stat) != 0 ||
+                        ::pread(fd, header.data(), header_length, 0) != static_cast<ssize_t>(header_length)) {
+                        BOOST_LOG_TRIVIAL(error) << "Problem with reading a polynomial header from a file " << path;
+                        return std::nullopt;
+                    }
+                    size_marshalling_type degree, size;
+                    auto read_iter = header.cbegin();
+                    degree.read(read_iter, size_length);
+                    size.read(read_iter, size_length);
+
+                    input.file_size = file_stat.st_size;
+                    input.degree = degree.value();
+                    input.size = size.value();
+                    // a polynomial_dfs has fewer coefficients than values, the constant zero one has a single value
+                    if (input.file_size != header_length + input.size * element_length || input.degree >= input.size) {
+                        BOOST_LOG_TRIVIAL(error) << "Problem with de-marshalling a polynomial read from a file " << path;
+                        return std::nullopt;
+                    }
+                }
+
+                std::size_t rows = 0;
+                for (const auto& input : inputs) {
+                    rows = std::max(rows, input.size);
+                }
+                std::vector<const input_file*> streamed, resized;
+                std::size_t degree = 0;
+                for (const auto& input : inputs) {
+                    if (input.size == rows && input.degree != 0) {
+                        streamed.push_back(&input);
+                        degree = std::max(degree, input.degree);
+                    } else {
+                        resized.push_back(&input);
+                    }
+                }
+
+                polynomial_type sum_poly = streamed.empty() ? polynomial_type() : polynomial_type(degree, rows);
+                std::atomic<bool> failed = false;
+                nil::crypto3::parallel_for(0, (rows + chunk_rows - 1) / chunk_rows,
+                    [&](std::size_t chunk) {
+                        const std::size_t begin = chunk * chunk_rows;
+                        const std::size_t end = std::min(begin + chunk_rows, rows);
+                        for (const input_file* input : streamed) {
+                            fd_input_window window(input->fd, input->file_size, (end - begin) * element_length);
+                            fd_window_iterator read_iter(window, header_length + begin * element_length);
+                            element_marshalling_type element;
+                            bool read_ok = true;
+                            for (std::size_t i = begin; read_ok && i < end; ++i) {
+                                read_ok = element.read(read_iter, element_length) ==
+                                    nil::crypto3::marshalling::status_type::success;
+                                sum_poly[i] += element.value();
+                            }
+                            if (!read_ok || window.failed()) {
+                                BOOST_LOG_TRIVIAL(error) << "Problem with reading a polynomial from a file " << input->path;
+                                failed = true;
+                                return;
+                            }
+                        }
+                    }, nil::crypto3::ThreadPool::PoolLevel::HIGH);
+                if (failed) {
+                    return std::nullopt;
+                }
+
+                for (const input_file* input : resized) {
+                    auto poly = read_poly_from_file(input->path);
+                    if (!poly) {
+                        return std::nullopt;
+                    }
+                    sum_poly += poly.value();
+                }
+                return sum_poly;
+            }
         };
 
     } // namespace proof_producer
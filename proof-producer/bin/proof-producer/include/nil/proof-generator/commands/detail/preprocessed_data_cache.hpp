@@ -0,0 +1,270 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+#include <boost/core/demangle.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <nil/actor/core/parallelization_utils.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+
+#include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
+
+#include <nil/proof-generator/types/type_system.hpp>
+#include <nil/proof-generator/marshalling_utils.hpp>
+#include <nil/proof-generator/output_artifacts/circuit_writer.hpp>
+
+
+namespace nil {
+    namespace proof_producer {
+
+        // Public preprocessed data and the LPC scheme committed to the fixed columns, stored on disk under a key
+        // which is the digest of everything public preprocessing depends on: the circuit, the table description,
+        // the public columns of the table, the placeholder config and the field and commitment scheme types.
+        // Every entry is a directory with the two marshalled files, written under a temporary name and renamed,
+        // so a concurrent process never sees a partial entry. A hit refreshes the modification time of the entry,
+        // and the least recently used entries are removed once the cache grows over its size limit.
+        // The cache never fails the command: errors are logged and the data is preprocessed as without the cache.
+        template <typename CurveType, typename HashType>
+        class PreprocessedDataCache {
+        public:
+            using Types                  = TypeSystem<CurveType, HashType>;
+            using BlueprintField         = typename Types::BlueprintField;
+            using Endianness             = typename Types::Endianness;
+            using TTypeBase              = typename Types::TTypeBase;
+            using PublicPreprocessedData = typename Types::PublicPreprocessedData;
+            using LpcScheme              = typename Types::LpcScheme;
+            using ConstraintSystem       = typename Types::ConstraintSystem;
+            using AssignmentPublicTable  = typename Types::AssignmentPublicTable;
+            using TableDescription       = typename Types::TableDescription;
+            using Column                 = typename Types::Column;
+            using KeyHash                = nil::crypto3::hashes::sha2<256>;
+
+            using Entry = std::pair<std::shared_ptr<PublicPreprocessedData>, std::shared_ptr<LpcScheme>>;
+
+            PreprocessedDataCache(PreprocessedDataCacheConfig config): config_(std::move(config)) {}
+
+            bool enabled() const {
+                return !config_.directory.empty();
+            }
+
+            static std::string make_key(
+                const ConstraintSystem& constraint_system,
+                const TableDescription& table_description,
+                const AssignmentPublicTable& public_table,
+                const PlaceholderConfig& placeholder_config
+            ) {
+                using value_type = typename BlueprintField::value_type;
+                using writer = circuit_writer<Endianness, BlueprintField>;
+                using element_marshalling_type = nil::crypto3::marshalling::types::field_element<TTypeBase, value_type>;
+
+                // columns are hashed in chunks in parallel, the key is the digest of the parameters and chunk digests
+                constexpr std::size_t chunk_size = 1 << 16;
+
+                std::ostringstream parameters;
+                writer::write_binary_circuit(parameters, constraint_system, constraint_system.public_input_sizes());
+                parameters << boost::core::demangle(typeid(LpcScheme).name()) << '\n'
+                           << table_description.witness_columns << ' ' << table_description.public_input_columns << ' '
+                           << table_description.constant_columns << ' ' << table_description.selector_columns << ' '
+                           << table_description.usable_rows_amount << ' ' << table_description.rows_amount << '\n'
+                           << placeholder_config.max_quotient_chunks << ' ' << placeholder_config.expand_factor << ' '
+                           << placeholder_config.lambda << ' ' << placeholder_config.grind << '\n';
+
+                struct chunk {
+                    const Column* column;
+                    std::size_t begin;
+                    std::size_t end;
+                };
+                std::vector<chunk> chunks;
+                for (auto const* columns : {&public_table.public_inputs(), &public_table.constants(), &public_table.selectors()}) {
+                    for (auto const& column : *columns) {
+                        parameters << ' ' << column.size();
+                        for (std::size_t begin = 0; begin < column.size(); begin += chunk_size) {
+                            chunks.push_back(chunk{&column, begin, std::min(begin + chunk_size, column.size())});
+                        }
+                    }
+                }
+
+                // the values are hashed in their marshalled form, as in the files, so the key does not depend on
+                // the in-memory representation of the field elements
+                const std::size_t element_length = element_marshalling_type().length();
+                std::vector<typename KeyHash::digest_type> digests(chunks.size());
+                nil::crypto3::parallel_for(0, chunks.size(), [&chunks, &digests, element_length](std::size_t i) {
+                    std::vector<std::uint8_t> bytes((chunks[i].end - chunks[i].begin) * element_length);
+                    auto write_iter = bytes.begin();
+                    for (std::size_t row = chunks[i].begin; row < chunks[i].end; row++) {
+                        element_marshalling_type((*chunks[i].column)[row]).write(write_iter, element_length);
+                    }
+                    digests[i] = nil::crypto3::hash<KeyHash>(bytes.begin(), bytes.end());
+                }, nil::crypto3::ThreadPool::PoolLevel::HIGH);
+
+                const std::string parameters_bytes = parameters.str();
+                std::vector<std::uint8_t> key_input(parameters_bytes.begin(), parameters_bytes.end());
+                for (auto const& digest : digests) {
+                    key_input.insert(key_input.end(), digest.begin(), digest.end());
+                }
+                const typename KeyHash::digest_type key = nil::crypto3::hash<KeyHash>(key_input.begin(), key_input.end());
+                return std::string(std::to_string(key).data());
+            }
+
+            std::optional<Entry> load(const std::string& key) const {
+                using namespace nil::crypto3::marshalling::types;
+
+                using PublicPreprocessedDataMarshalling = placeholder_preprocessed_public_data<TTypeBase, PublicPreprocessedData>;
+                using CommitmentStateMarshalling = typename commitment_scheme_state<TTypeBase, LpcScheme>::type;
+
+                const auto entry_path = boost::filesystem::path(config_.directory) / key;
+                boost::system::error_code ec;
+                if (!boost::filesystem::exists(entry_path / lpc_scheme_file, ec)) {
+                    return std::nullopt;
+                }
+
+                BOOST_LOG_TRIVIAL(info) << "Reading cached public preprocessed data from " << entry_path;
+
+                const auto remove_corrupted = [&entry_path, &ec] {
+                    BOOST_LOG_TRIVIAL(warning) << "Removing corrupted preprocessed data cache entry " << entry_path;
+                    boost::filesystem::remove_all(entry_path, ec);
+                };
+
+                auto marshalled_data = detail::decode_marshalling_from_mapped_file<PublicPreprocessedDataMarshalling>(
+                    entry_path / public_data_file);
+                auto marshalled_lpc_scheme = detail::decode_marshalling_from_mapped_file<CommitmentStateMarshalling>(
+                    entry_path / lpc_scheme_file);
+                if (!marshalled_data || !marshalled_lpc_scheme) {
+                    remove_corrupted();
+                    return std::nullopt;
+                }
+                auto lpc_scheme = make_commitment_scheme<Endianness, LpcScheme>(*marshalled_lpc_scheme);
+                if (!lpc_scheme) {
+                    remove_corrupted();
+                    return std::nullopt;
+                }
+
+                boost::filesystem::last_write_time(entry_path, std::time(nullptr), ec);
+
+                return Entry{
+                    std::make_shared<PublicPreprocessedData>(
+                        make_placeholder_preprocessed_public_data<Endianness, PublicPreprocessedData>(*marshalled_data)),
+                    std::make_shared<LpcScheme>(std::move(lpc_scheme.value()))
+                };
+            }
+
+            void store(const std::string& key, const PublicPreprocessedData& public_preprocessed_data, const LpcScheme& lpc_scheme) const {
+                using namespace nil::crypto3::marshalling::types;
+
+                const boost::filesystem::path directory(config_.directory);
+                const auto entry_path = directory / key;
+                const auto temporary_path = directory / (key + temporary_suffix + std::to_string(::getpid()));
+
+                boost::system::error_code ec;
+                boost::filesystem::create_directories(directory, ec);
+                boost::filesystem::remove_all(temporary_path, ec);
+                if (!boost::filesystem::create_directory(temporary_path, ec) || ec) {
+                    BOOST_LOG_TRIVIAL(warning) << "Failed to create preprocessed data cache entry " << temporary_path
+                                               << ": " << ec.message();
+                    return;
+                }
+
+                const bool written =
+                    detail::encode_marshalling_to_file(
+                        temporary_path / public_data_file,
+                        fill_placeholder_preprocessed_public_data<Endianness, PublicPreprocessedData>(public_preprocessed_data)
+                    ) &&
+                    detail::encode_marshalling_to_file(
+                        temporary_path / lpc_scheme_file,
+                        fill_commitment_scheme<Endianness, LpcScheme>(lpc_scheme)
+                    );
+                if (written) {
+                    boost::filesystem::rename(temporary_path, entry_path, ec);
+                }
+                if (!written || ec) {
+                    // another process may have stored the same entry in the meantime
+                    boost::filesystem::remove_all(temporary_path, ec);
+                    if (!boost::filesystem::exists(entry_path / lpc_scheme_file, ec)) {
+                        BOOST_LOG_TRIVIAL(warning) << "Failed to store preprocessed data cache entry " << entry_path;
+                    }
+                    return;
+                }
+
+                BOOST_LOG_TRIVIAL(info) << "Public preprocessed data cached in " << entry_path;
+                evict(entry_path);
+            }
+
+        private:
+            static constexpr const char* public_data_file = "preprocessed_data.dat";
+            static constexpr const char* lpc_scheme_file = "commitment_scheme_state.dat";
+            static constexpr const char* temporary_suffix = ".tmp.";
+
+            // removes the least recently used entries, except for the one just stored, until the cache fits the limit
+            void evict(const boost::filesystem::path& keep) const {
+                namespace fs = boost::filesystem;
+
+                struct cached_entry {
+                    fs::path path;
+                    std::time_t last_used;
+                    std::uintmax_t size;
+                };
+
+                // only an error of the iterator itself ends a loop, an entry which can't be queried is skipped
+                boost::system::error_code iterator_ec;
+                std::vector<cached_entry> entries;
+                std::uintmax_t total_size = 0;
+                for (auto it = fs::directory_iterator(config_.directory, iterator_ec);
+                     !iterator_ec && it != fs::directory_iterator(); it.increment(iterator_ec)) {
+                    const auto& path = it->path();
+                    boost::system::error_code status_ec;
+                    if (!fs::is_directory(path, status_ec) || path.filename().string().find(temporary_suffix) != std::string::npos) {
+                        continue;
+                    }
+                    boost::system::error_code time_ec;
+                    cached_entry entry{path, fs::last_write_time(path, time_ec), 0};
+                    boost::system::error_code file_iterator_ec;
+                    for (auto file = fs::directory_iterator(path, file_iterator_ec);
+                         !file_iterator_ec && file != fs::directory_iterator(); file.increment(file_iterator_ec)) {
+                        boost::system::error_code size_ec;
+                        const auto file_size = fs::file_size(file->path(), size_ec);
+                        entry.size += size_ec ? 0 : file_size;
+                    }
+                    total_size += entry.size;
+                    entries.push_back(std::move(entry));
+                }
+
+                const std::uintmax_t max_size = std::uintmax_t(config_.max_size_mb) << 20;
+                std::sort(entries.begin(), entries.end(), [](const cached_entry& a, const cached_entry& b) {
+                    return a.last_used < b.last_used;
+                });
+                for (auto const& entry : entries) {
+                    if (total_size <= max_size) {
+                        break;
+                    }
+                    if (entry.path == keep) {
+                        continue;
+                    }
+                    BOOST_LOG_TRIVIAL(info) << "Removing preprocessed data cache entry " << entry.path;
+                    boost::system::error_code remove_ec;
+                    fs::remove_all(entry.path, remove_ec);
+                    total_size -= entry.size;
+                }
+            }
+
+            const PreprocessedDataCacheConfig config_;
+        };
+
+    } // namespace proof_producer
+} // namespace nil
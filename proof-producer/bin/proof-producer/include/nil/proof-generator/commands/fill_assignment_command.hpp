@@ -93,6 +93,7 @@ namespace nil {
                 boost::filesystem::path in_trace_file_path;
                 boost::filesystem::path out_circuit_file_path;
                 boost::filesystem::path out_assignment_table_file_path;
+                bool mapped_assignment_table = false;
                 boost::filesystem::path out_assignment_description_file_path;
                 nil::proof_producer::OutputArtifacts output_artifacts;
                 nil::proof_producer::CircuitsLimits circuit_limits;
@@ -102,6 +103,7 @@ namespace nil {
                         ("circuit-name", po::value(&circuit_name)->required(), "Target circuit name")
                         ("circuit", po::value(&out_circuit_file_path)->required(), "Circuit output file")
                         ("assignment-table,t", po::value(&out_assignment_table_file_path)->required(), "Assignment table output file")
+                        ("mapped-assignment-table", po::bool_switch(&mapped_assignment_table), "Write assignment table in the column-aligned format which is read via mmap")
                         ("assignment-description-file", po::value(&out_assignment_description_file_path)->required(), "Assignment table description output file")
                         ("trace", po::value(&in_trace_file_path), "Base path for EVM trace files");
                     register_output_artifacts_cli_args(output_artifacts, config);
@@ -134,7 +136,7 @@ namespace nil {
 
                 // write assignment table to file if needed
                 if (!args.out_assignment_table_file_path.empty()) {
-                    add_step<AssignmentTableBinaryWriter>(assigner, assigner, args.out_assignment_table_file_path);
+                    add_step<AssignmentTableBinaryWriter>(assigner, assigner, args.out_assignment_table_file_path, args.mapped_assignment_table);
                 }
 
                 // write assignment description to file if needed
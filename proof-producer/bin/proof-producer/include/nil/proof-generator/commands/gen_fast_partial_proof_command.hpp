@@ -5,6 +5,7 @@
 
 #include <nil/proof-generator/types/type_system.hpp>
 #include <nil/proof-generator/command_step.hpp>
+#include <nil/proof-generator/command_graph.hpp>
 #include <nil/proof-generator/resources.hpp>
 
 #include <nil/proof-generator/commands/detail/io/circuit_io.hpp>
@@ -23,7 +24,7 @@ namespace nil {
     namespace proof_producer {
 
         template<typename CurveType, typename HashType>
-        class FastPartialProofCommand: public command_chain {
+        class FastPartialProofCommand: public command_graph {
         public:
             struct Args {
                 PlaceholderConfig config;
@@ -72,7 +73,7 @@ namespace nil {
                 auto& public_preprocessor  = add_step<PublicPreprocessor>(args.config, assigner, assigner, circuit_maker);
                 auto& private_preprocessor = add_step<PrivatePreprocessor>(circuit_maker, assigner, assigner);
 
-                add_step<Prover>(
+                auto& prover = add_step<Prover>(
                     circuit_maker,
                     assigner,            // for table
                     assigner,            // for table description
@@ -84,7 +85,8 @@ namespace nil {
                     args.out_challenge_file_path,
                     args.out_theta_power_file_path
                 );
-                add_step<LpcSchemeWriter>(public_preprocessor, args.out_updated_lpc_scheme_file_path);
+                auto& lpc_scheme_writer = add_step<LpcSchemeWriter>(public_preprocessor, args.out_updated_lpc_scheme_file_path);
+                run_after(lpc_scheme_writer, prover); // the prover updates the scheme in place
                 add_step<CommonDataWriter>(public_preprocessor, args.out_common_data_file_path);
                 add_step<AssignmentDescriptionWriter>(assigner, args.out_assignment_desc_file_path);
             }
@@ -5,6 +5,7 @@
 
 #include <nil/proof-generator/types/type_system.hpp>
 #include <nil/proof-generator/command_step.hpp>
+#include <nil/proof-generator/command_graph.hpp>
 #include <nil/proof-generator/resources.hpp>
 
 #include <nil/proof-generator/commands/detail/io/circuit_io.hpp>
@@ -21,7 +22,7 @@ namespace nil {
     namespace proof_producer {
 
         template<typename CurveType, typename HashType>
-        class ProveCommand: public command_chain {
+        class ProveCommand: public command_graph {
         public:
             struct Args {
                 boost::filesystem::path in_circuit_file_path;
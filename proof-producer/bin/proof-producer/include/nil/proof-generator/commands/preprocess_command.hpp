@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <utility>
 #include <boost/log/trivial.hpp>
 #include <boost/filesystem.hpp>
 
@@ -8,6 +9,7 @@
 
 #include <nil/proof-generator/types/type_system.hpp>
 #include <nil/proof-generator/command_step.hpp>
+#include <nil/proof-generator/command_graph.hpp>
 #include <nil/proof-generator/commands/detail/io/circuit_io.hpp>
 #include <nil/proof-generator/commands/detail/io/assignment_table_io.hpp>
 #include <nil/proof-generator/commands/detail/io/preprocessed_data_io.hpp>
@@ -18,6 +20,8 @@
 #include <nil/proof-generator/resources.hpp>
 #include <nil/proof-generator/output_artifacts/output_artifacts.hpp>
 #include <nil/proof-generator/commands/detail/commitment_scheme_factory.hpp>
+#include <nil/proof-generator/commands/detail/preprocessed_data_cache.hpp>
+#include <nil/proof-generator/cli_arg_utils.hpp>
 
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/preprocessor.hpp>
 
@@ -39,6 +43,61 @@ namespace nil {
             using PlaceholderParams       = typename Types::PlaceholderParams;
             using CommitmentSchemeFac = CommitmentSchemeFactory<CurveType, HashType>;
 
+            // returns the preprocessed public data and the LPC scheme holding the commitment to the fixed batch
+            static std::pair<std::shared_ptr<PublicPreprocessedData>, std::shared_ptr<LpcScheme>> preprocess(
+                const CommitmentSchemeFac& commitment_scheme_fac,
+                const ConstraintSystem& constraint_system,
+                std::shared_ptr<AssignmentPublicTable> assignment_public_table,
+                const TableDescription& table_description
+            ) {
+                auto lpc_scheme = commitment_scheme_fac.make_lpc_scheme(table_description.rows_amount);
+
+                BOOST_LOG_TRIVIAL(info) << "Preprocessing public data";
+
+                PROFILE_SCOPE("Preprocess public data");
+                auto public_preprocessed_data = std::make_shared<PublicPreprocessedData>(
+                    nil::crypto3::zk::snark::placeholder_public_preprocessor<BlueprintField, PlaceholderParams>::
+                        process(
+                            constraint_system,
+                            assignment_public_table,
+                            table_description,
+                            *lpc_scheme,
+                            commitment_scheme_fac.config_.max_quotient_chunks
+                        )
+                );
+                PROFILE_SCOPE_END();
+
+                return {public_preprocessed_data, lpc_scheme};
+            }
+
+            // same as preprocess, but the result is looked up in the on-disk cache first and stored there on a miss
+            static std::pair<std::shared_ptr<PublicPreprocessedData>, std::shared_ptr<LpcScheme>> preprocess(
+                const CommitmentSchemeFac& commitment_scheme_fac,
+                const PreprocessedDataCacheConfig& cache_config,
+                const ConstraintSystem& constraint_system,
+                std::shared_ptr<AssignmentPublicTable> assignment_public_table,
+                const TableDescription& table_description
+            ) {
+                const PreprocessedDataCache<CurveType, HashType> cache(cache_config);
+                if (!cache.enabled()) {
+                    return preprocess(commitment_scheme_fac, constraint_system, assignment_public_table, table_description);
+                }
+
+                PROFILE_SCOPE("Preprocessed data cache lookup");
+                auto const key = cache.make_key(
+                    constraint_system, table_description, *assignment_public_table, commitment_scheme_fac.config_);
+                auto cached = cache.load(key);
+                PROFILE_SCOPE_END();
+                if (cached) {
+                    BOOST_LOG_TRIVIAL(info) << "Using cached public preprocessed data " << key;
+                    return *cached;
+                }
+
+                auto result = preprocess(commitment_scheme_fac, constraint_system, assignment_public_table, table_description);
+                cache.store(key, *result.first, *result.second);
+                return result;
+            }
+
             struct Executor: public command_step,
                 public resources::resources_provider<PublicPreprocessedData, CommonData, LpcScheme>
             {
@@ -46,8 +105,10 @@ namespace nil {
                     PlaceholderConfig config,
                     resources::resource_provider<TableDescription>& desc_provider,
                     resources::resource_provider<AssignmentTable>& table_provider,
-                    resources::resource_provider<ConstraintSystem>& constraint_provider
-                ): commitment_scheme_fac_(config)
+                    resources::resource_provider<ConstraintSystem>& constraint_provider,
+                    PreprocessedDataCacheConfig cache_config = {}
+                ): commitment_scheme_fac_(config),
+                   cache_config_(std::move(cache_config))
                 {
                     resources::subscribe_value<TableDescription>(desc_provider, table_description_);
                     resources::subscribe_value<ConstraintSystem>(constraint_provider, constraint_system_);
@@ -64,22 +125,8 @@ namespace nil {
 
                     using resources::notify;
 
-                    auto lpc_scheme = commitment_scheme_fac_.make_lpc_scheme(table_description_->rows_amount);
-
-                    BOOST_LOG_TRIVIAL(info) << "Preprocessing public data";
-
-                    PROFILE_SCOPE("Preprocess public data");
-                    auto public_preprocessed_data = std::make_shared<PublicPreprocessedData>(
-                        nil::crypto3::zk::snark::placeholder_public_preprocessor<BlueprintField, PlaceholderParams>::
-                            process(
-                                *constraint_system_,
-                                assignment_public_table_,
-                                *table_description_,
-                                *lpc_scheme,
-                                commitment_scheme_fac_.config_.max_quotient_chunks
-                            )
-                    );
-                    PROFILE_SCOPE_END();
+                    auto const [public_preprocessed_data, lpc_scheme] = preprocess(
+                        commitment_scheme_fac_, cache_config_, *constraint_system_, assignment_public_table_, *table_description_);
 
                     notify<PublicPreprocessedData>(*this, public_preprocessed_data);
                     notify<CommonData>(*this, public_preprocessed_data->common_data);
@@ -89,6 +136,7 @@ namespace nil {
                 }
 
                 CommitmentSchemeFac commitment_scheme_fac_;
+                const PreprocessedDataCacheConfig cache_config_;
 
                 std::shared_ptr<TableDescription> table_description_;
                 std::shared_ptr<AssignmentPublicTable> assignment_public_table_;
@@ -153,7 +201,7 @@ namespace nil {
         };
 
         template <typename CurveType, typename HashType>
-        struct PreprocessCommand: public command_chain {
+        struct PreprocessCommand: public command_graph {
             struct Args {
                 boost::filesystem::path in_circuit_file_path;
                 boost::filesystem::path in_assignment_table_file_path;
@@ -164,6 +212,7 @@ namespace nil {
                 boost::filesystem::path out_evm_verifier_dir_path;
                 OutputArtifacts assignment_debug_opts;
                 PlaceholderConfig placeholder_config;
+                PreprocessedDataCacheConfig preprocessed_cache;
 
                 Args(boost::program_options::options_description& config) {
                     config.add_options()
@@ -177,6 +226,7 @@ namespace nil {
 
                     register_output_artifacts_cli_args(assignment_debug_opts, config);
                     register_placeholder_config_cli_args(placeholder_config, config);
+                    register_preprocessed_data_cache_cli_args(preprocessed_cache, config);
                 }
             };
 
@@ -200,7 +250,7 @@ namespace nil {
                     add_step<DebugPrinter>(table_reader, table_reader, args.assignment_debug_opts); // optional: print table in debug format
                 }
 
-                auto& preprocessor = add_step<PublicPreprocessor>(args.placeholder_config, table_reader, table_reader, circuit_reader); // preprocess public data
+                auto& preprocessor = add_step<PublicPreprocessor>(args.placeholder_config, table_reader, table_reader, circuit_reader, args.preprocessed_cache); // preprocess public data
 
                 if (!args.out_public_preprocessed_data_file_path.empty()) {
                     add_step<PublicDataWriter>(preprocessor, args.out_public_preprocessed_data_file_path); // optional: write public preprocessed data
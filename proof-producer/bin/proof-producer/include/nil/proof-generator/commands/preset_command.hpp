@@ -83,6 +83,7 @@ namespace nil {
                 std::string circuit_name;
                 boost::filesystem::path out_circuit_file_path;
                 boost::filesystem::path out_assignment_table_file_path;
+                bool mapped_assignment_table = false;
                 nil::proof_producer::OutputArtifacts output_artifacts;
                 nil::proof_producer::CircuitsLimits circuit_limits;
 
@@ -92,7 +93,8 @@ namespace nil {
                     config.add_options()
                         ("circuit-name", po::value(&circuit_name)->required(), "Target circuit name")
                         ("circuit", po::value(&out_circuit_file_path), "Circuit output file")
-                        ("assignment-table,t", po::value(&out_assignment_table_file_path), "Assignment table (empty) output file");
+                        ("assignment-table,t", po::value(&out_assignment_table_file_path), "Assignment table (empty) output file")
+                        ("mapped-assignment-table", po::bool_switch(&mapped_assignment_table), "Write assignment table in the column-aligned format which is read via mmap");
 
                     register_output_artifacts_cli_args(output_artifacts, config);
                     register_circuits_limits_cli_args(circuit_limits, config);
@@ -114,7 +116,7 @@ namespace nil {
 
                 // prints empty table to check if it's working
                 if (!args.out_assignment_table_file_path.empty()) {
-                    add_step<AssignmentTableBinaryWriter>(circuit_maker, circuit_maker, args.out_assignment_table_file_path);
+                    add_step<AssignmentTableBinaryWriter>(circuit_maker, circuit_maker, args.out_assignment_table_file_path, args.mapped_assignment_table);
                 }
 
                 // prints empty table to check if it's working
@@ -16,12 +16,26 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cerrno>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
 #include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <boost/filesystem.hpp>
 #include <boost/log/trivial.hpp>
 
@@ -97,6 +111,312 @@ namespace nil {
             return file;
         }
 
+        // read-only mapping of a whole file, the pages are loaded on first access
+        class mapped_file {
+        public:
+            mapped_file(const mapped_file&) = delete;
+            mapped_file& operator=(const mapped_file&) = delete;
+
+            mapped_file(mapped_file&& other) noexcept
+                : data_(std::exchange(other.data_, nullptr))
+                , size_(std::exchange(other.size_, 0)) {
+            }
+
+            ~mapped_file() {
+                if (data_ != nullptr) {
+                    ::munmap(const_cast<std::uint8_t*>(data_), size_);
+                }
+            }
+
+            static std::optional<mapped_file> open(const std::string& path) {
+                int fd = ::open(path.c_str(), O_RDONLY);
+                if (fd < 0) {
+                    BOOST_LOG_TRIVIAL(error) << "Unable to open file: " << path;
+                    return std::nullopt;
+                }
+
+                struct stat file_stat;
+                if (::fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+                    BOOST_LOG_TRIVIAL(error) << "Unable to map empty file: " << path;
+                    ::close(fd);
+                    return std::nullopt;
+                }
+
+                const std::size_t size = file_stat.st_size;
+                void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+                ::close(fd);
+                if (data == MAP_FAILED) {
+                    BOOST_LOG_TRIVIAL(error) << "Unable to map file: " << path;
+                    return std::nullopt;
+                }
+                ::madvise(data, size, MADV_SEQUENTIAL);
+                return mapped_file(static_cast<const std::uint8_t*>(data), size);
+            }
+
+            std::span<const std::uint8_t> data() const {
+                return {data_, size_};
+            }
+
+        private:
+            mapped_file(const std::uint8_t* data, std::size_t size): data_(data), size_(size) {}
+
+            const std::uint8_t* data_;
+            std::size_t size_;
+        };
+
+        // Buffered output to a file descriptor, written through fd_window_iterator.
+        // Marshalling writes every byte of the output once and in increasing order of offsets, although through
+        // copies of the iterator, so only a window of the output is kept in memory: an access past the window
+        // writes the window out and moves it forward. Bytes which are never accessed are written as zeros.
+        class fd_output_window {
+        public:
+            using reference = std::uint8_t&;
+            using pointer = std::uint8_t*;
+
+            static constexpr std::size_t default_capacity = 1 << 20;
+
+            explicit fd_output_window(int fd, std::size_t capacity = default_capacity)
+                : fd_(fd), buffer_(capacity, 0x00) {
+            }
+
+            fd_output_window(const fd_output_window&) = delete;
+            fd_output_window& operator=(const fd_output_window&) = delete;
+
+            std::uint8_t& at(std::size_t offset) {
+                if (offset - base_ < buffer_.size()) [[likely]] {
+                    return buffer_[offset - base_];
+                }
+                return slide(offset);
+            }
+
+            // the bytes [offset, offset + size) in one piece of the window, for bulk writes of marshalling,
+            // nullptr if they don't fit into the window
+            std::uint8_t* contiguous(std::size_t offset, std::size_t size) {
+                if (size > buffer_.size()) {
+                    return nullptr;
+                }
+                if (offset < base_ || offset + size - base_ > buffer_.size()) {
+                    slide(offset);
+                    // the bytes before offset are complete, the window starts at offset then
+                    if (!failed_ && offset > base_) {
+                        write_buffer(offset - base_);
+                    }
+                }
+                return failed_ ? nullptr : buffer_.data() + (offset - base_);
+            }
+
+            // writes out the bytes up to end, which is the total size of the output
+            bool flush(std::size_t end) {
+                while (!failed_ && end > base_) {
+                    const std::size_t size = std::min(end - base_, buffer_.size());
+                    write_buffer(size);
+                }
+                return !failed_;
+            }
+
+            bool failed() const {
+                return failed_;
+            }
+
+        private:
+            std::uint8_t& slide(std::size_t offset) {
+                if (offset < base_) {
+                    BOOST_LOG_TRIVIAL(error) << "Output window is behind offset " << offset;
+                    failed_ = true;
+                }
+                while (!failed_ && offset - base_ >= buffer_.size()) {
+                    write_buffer(buffer_.size());
+                }
+                return failed_ ? dummy_ : buffer_[offset - base_];
+            }
+
+            void write_buffer(std::size_t size) {
+                const std::uint8_t* data = buffer_.data();
+                std::size_t left = size;
+                while (left > 0) {
+                    const ssize_t written = ::write(fd_, data, left);
+                    if (written < 0 && errno == EINTR) {
+                        continue;
+                    }
+                    if (written <= 0) {
+                        BOOST_LOG_TRIVIAL(error) << "Error occurred during writing to file descriptor " << fd_;
+                        failed_ = true;
+                        return;
+                    }
+                    data += written;
+                    left -= written;
+                }
+                // the rest of the window moves to the front, it may hold bytes written ahead of the written part
+                std::copy(buffer_.begin() + size, buffer_.end(), buffer_.begin());
+                std::fill(buffer_.end() - size, buffer_.end(), 0x00);
+                base_ += size;
+            }
+
+            const int fd_;
+            std::vector<std::uint8_t> buffer_;
+            std::size_t base_ = 0;
+            bool failed_ = false;
+            std::uint8_t dummy_ = 0;
+        };
+
+        // Buffered input from a file descriptor of known size, read through fd_window_iterator.
+        // An access outside of the window reads the window again starting at the accessed offset.
+        class fd_input_window {
+        public:
+            using reference = const std::uint8_t&;
+            using pointer = const std::uint8_t*;
+
+            static constexpr std::size_t default_capacity = 1 << 20;
+
+            fd_input_window(int fd, std::size_t size, std::size_t capacity = default_capacity)
+                : fd_(fd), size_(size), buffer_(capacity) {
+            }
+
+            fd_input_window(const fd_input_window&) = delete;
+            fd_input_window& operator=(const fd_input_window&) = delete;
+
+            const std::uint8_t& at(std::size_t offset) {
+                if (offset - base_ < filled_) [[likely]] {
+                    return buffer_[offset - base_];
+                }
+                return refill(offset);
+            }
+
+            // the bytes [offset, offset + size) in one piece of the window, for bulk reads of marshalling,
+            // nullptr if they don't fit into the window or into the file
+            const std::uint8_t* contiguous(std::size_t offset, std::size_t size) {
+                if (size > buffer_.size() || offset + size > size_) {
+                    return nullptr;
+                }
+                if (offset < base_ || offset + size - base_ > filled_) {
+                    refill(offset);
+                }
+                return failed_ ? nullptr : buffer_.data() + (offset - base_);
+            }
+
+            std::size_t size() const {
+                return size_;
+            }
+
+            bool failed() const {
+                return failed_;
+            }
+
+        private:
+            const std::uint8_t& refill(std::size_t offset) {
+                // the read already failed and is reported, the rest of the bytes are not read
+                if (failed_) {
+                    return dummy_;
+                }
+                if (offset >= size_) {
+                    BOOST_LOG_TRIVIAL(error) << "Reading offset " << offset << " past the end of the file";
+                    failed_ = true;
+                    return dummy_;
+                }
+                base_ = offset;
+                filled_ = 0;
+                const std::size_t size = std::min(buffer_.size(), size_ - offset);
+                while (filled_ < size) {
+                    const ssize_t read = ::pread(fd_, buffer_.data() + filled_, size - filled_, base_ + filled_);
+                    if (read < 0 && errno == EINTR) {
+                        continue;
+                    }
+                    if (read <= 0) {
+                        BOOST_LOG_TRIVIAL(error) << "Error occurred during reading file descriptor " << fd_;
+                        failed_ = true;
+                        filled_ = 0;
+                        return dummy_;
+                    }
+                    filled_ += read;
+                }
+                return buffer_[0];
+            }
+
+            const int fd_;
+            const std::size_t size_;
+            std::vector<std::uint8_t> buffer_;
+            std::size_t base_ = 0;
+            std::size_t filled_ = 0;
+            bool failed_ = false;
+            const std::uint8_t dummy_ = 0;
+        };
+
+        // random access iterator over the bytes of fd_output_window or fd_input_window
+        template<typename Window>
+        class fd_window_iterator {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = std::uint8_t;
+            using difference_type = std::ptrdiff_t;
+            using pointer = typename Window::pointer;
+            using reference = typename Window::reference;
+
+            fd_window_iterator() = default;
+            fd_window_iterator(Window& window, std::size_t offset): window_(&window), offset_(offset) {}
+
+            reference operator*() const {
+                return window_->at(offset_);
+            }
+            reference operator[](difference_type n) const {
+                return window_->at(offset_ + n);
+            }
+
+            // the next size bytes in one piece of memory or nullptr, marshalling reads and writes runs of
+            // fixed-length elements through it, see nil::crypto3::marshalling::has_member_function_contiguous_bytes
+            pointer contiguous_bytes(std::size_t size) const {
+                return window_->contiguous(offset_, size);
+            }
+
+            fd_window_iterator& operator++() {
+                ++offset_;
+                return *this;
+            }
+            fd_window_iterator operator++(int) {
+                auto copy = *this;
+                ++offset_;
+                return copy;
+            }
+            fd_window_iterator& operator--() {
+                --offset_;
+                return *this;
+            }
+            fd_window_iterator operator--(int) {
+                auto copy = *this;
+                --offset_;
+                return copy;
+            }
+            fd_window_iterator& operator+=(difference_type n) {
+                offset_ += n;
+                return *this;
+            }
+            fd_window_iterator& operator-=(difference_type n) {
+                offset_ -= n;
+                return *this;
+            }
+            friend fd_window_iterator operator+(fd_window_iterator it, difference_type n) {
+                return it += n;
+            }
+            friend fd_window_iterator operator+(difference_type n, fd_window_iterator it) {
+                return it += n;
+            }
+            friend fd_window_iterator operator-(fd_window_iterator it, difference_type n) {
+                return it -= n;
+            }
+            friend difference_type operator-(const fd_window_iterator& a, const fd_window_iterator& b) {
+                return static_cast<difference_type>(a.offset_) - static_cast<difference_type>(b.offset_);
+            }
+            friend bool operator==(const fd_window_iterator& a, const fd_window_iterator& b) {
+                return a.offset_ == b.offset_;
+            }
+            friend auto operator<=>(const fd_window_iterator& a, const fd_window_iterator& b) {
+                return a.offset_ <=> b.offset_;
+            }
+
+        private:
+            Window* window_ = nullptr;
+            std::size_t offset_ = 0;
+        };
+
         std::optional<std::vector<std::uint8_t>> read_file_to_vector(const std::string& path) {
 
             auto file = open_file<std::ifstream>(path, std::ios_base::in | std::ios::binary | std::ios::ate);
@@ -1,6 +1,13 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <optional>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include <boost/filesystem.hpp>
 #include <boost/log/trivial.hpp>
@@ -16,19 +23,69 @@ namespace nil {
     namespace proof_producer {
         namespace detail {
 
+            // decodes from the file descriptor through a bounded window, without reading the whole input first
+            template<typename MarshallingType>
+            std::optional<MarshallingType> decode_marshalling_from_fd(int fd) {
+                struct stat file_stat;
+                if (::fstat(fd, &file_stat) != 0) {
+                    BOOST_LOG_TRIVIAL(error) << "Unable to get size of file descriptor " << fd;
+                    return std::nullopt;
+                }
+
+                fd_input_window window(fd, file_stat.st_size);
+                fd_window_iterator read_iter(window, 0);
+                MarshallingType marshalled_data;
+                auto status = marshalled_data.read(read_iter, window.size());
+                if (status != nil::crypto3::marshalling::status_type::success || window.failed()) {
+                    return std::nullopt;
+                }
+                return marshalled_data;
+            }
+
             template<typename MarshallingType>
             std::optional<MarshallingType> decode_marshalling_from_file(
                 const boost::filesystem::path& path,
                 bool hex = false
             ) {
-                const auto v = hex ? read_hex_file_to_vector(path.c_str()) : read_file_to_vector(path.c_str());
-                if (!v.has_value()) {
+                std::optional<MarshallingType> marshalled_data;
+                if (hex) {
+                    const auto v = read_hex_file_to_vector(path.c_str());
+                    if (!v.has_value()) {
+                        return std::nullopt;
+                    }
+                    marshalled_data.emplace();
+                    auto read_iter = v->begin();
+                    if (marshalled_data->read(read_iter, v->size()) != nil::crypto3::marshalling::status_type::success) {
+                        marshalled_data.reset();
+                    }
+                } else {
+                    const int fd = ::open(path.c_str(), O_RDONLY);
+                    if (fd < 0) {
+                        BOOST_LOG_TRIVIAL(error) << "Unable to open file: " << path;
+                        return std::nullopt;
+                    }
+                    marshalled_data = decode_marshalling_from_fd<MarshallingType>(fd);
+                    ::close(fd);
+                }
+
+                if (!marshalled_data) {
+                    BOOST_LOG_TRIVIAL(error) << "When reading a Marshalled structure from file "
+                        << path << ", decoding step failed.";
+                }
+                return marshalled_data;
+            }
+
+            // decodes straight from the mapped file, without reading it into a buffer first
+            template<typename MarshallingType>
+            std::optional<MarshallingType> decode_marshalling_from_mapped_file(const boost::filesystem::path& path) {
+                const auto file = mapped_file::open(path.string());
+                if (!file) {
                     return std::nullopt;
                 }
 
                 MarshallingType marshalled_data;
-                auto read_iter = v->begin();
-                auto status = marshalled_data.read(read_iter, v->size());
+                auto read_iter = file->data().data();
+                auto status = marshalled_data.read(read_iter, file->data().size());
                 if (status != nil::crypto3::marshalling::status_type::success) {
                     BOOST_LOG_TRIVIAL(error) << "When reading a Marshalled structure from file "
                         << path << ", decoding step failed.";
@@ -37,22 +94,49 @@ namespace nil {
                 return marshalled_data;
             }
 
+            // encodes to the file descriptor through a bounded window, without a buffer for the whole output
+            template<typename MarshallingType>
+            bool encode_marshalling_to_fd(int fd, const MarshallingType& data_for_marshalling) {
+                const std::size_t length = data_for_marshalling.length();
+                fd_output_window window(fd);
+                fd_window_iterator write_iter(window, 0);
+                nil::crypto3::marshalling::status_type status = data_for_marshalling.write(write_iter, length);
+                if (status != nil::crypto3::marshalling::status_type::success) {
+                    BOOST_LOG_TRIVIAL(error) << "Marshalled structure encoding failed";
+                    return false;
+                }
+                return window.flush(length);
+            }
+
             template<typename MarshallingType>
             bool encode_marshalling_to_file(
                 const boost::filesystem::path& path,
                 const MarshallingType& data_for_marshalling,
                 bool hex = false
             ) {
-                std::vector<std::uint8_t> v;
-                v.resize(data_for_marshalling.length(), 0x00);
-                auto write_iter = v.begin();
-                nil::crypto3::marshalling::status_type status = data_for_marshalling.write(write_iter, v.size());
-                if (status != nil::crypto3::marshalling::status_type::success) {
-                    BOOST_LOG_TRIVIAL(error) << "Marshalled structure encoding failed";
-                    return false;
+                if (hex) {
+                    std::vector<std::uint8_t> v;
+                    v.resize(data_for_marshalling.length(), 0x00);
+                    auto write_iter = v.begin();
+                    nil::crypto3::marshalling::status_type status = data_for_marshalling.write(write_iter, v.size());
+                    if (status != nil::crypto3::marshalling::status_type::success) {
+                        BOOST_LOG_TRIVIAL(error) << "Marshalled structure encoding failed";
+                        return false;
+                    }
+                    return write_vector_to_hex_file(v, path.c_str());
                 }
 
-                return hex ? write_vector_to_hex_file(v, path.c_str()) : write_vector_to_file(v, path.c_str());
+                const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+                if (fd < 0) {
+                    BOOST_LOG_TRIVIAL(error) << "Unable to open file: " << path;
+                    return false;
+                }
+                const bool written = encode_marshalling_to_fd(fd, data_for_marshalling);
+                if (::close(fd) != 0 || !written) {
+                    BOOST_LOG_TRIVIAL(error) << "Error occurred during writing file " << path;
+                    return false;
+                }
+                return true;
             }
 
         } // namespace details
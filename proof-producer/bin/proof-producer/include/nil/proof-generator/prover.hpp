@@ -42,7 +42,8 @@ namespace nil {
                 GENERATE_AGGREGATED_FRI_PROOF = 10,
                 GENERATE_CONSISTENCY_CHECKS_PROOF = 11,
                 MERGE_PROOFS = 12,
-                AGGREGATED_VERIFY = 13
+                AGGREGATED_VERIFY = 13,
+                DAEMON = 14
             };
 
             ProverStage prover_stage_from_string(const std::string& stage) {
@@ -60,7 +61,8 @@ namespace nil {
                     {"merge-proofs", ProverStage::MERGE_PROOFS},
                     {"aggregated-FRI", ProverStage::GENERATE_AGGREGATED_FRI_PROOF},
                     {"consistency-checks", ProverStage::GENERATE_CONSISTENCY_CHECKS_PROOF},
-                    {"aggregated-verify", ProverStage::AGGREGATED_VERIFY}
+                    {"aggregated-verify", ProverStage::AGGREGATED_VERIFY},
+                    {"daemon", ProverStage::DAEMON}
                 };
                 auto it = stage_map.find(stage);
                 if (it == stage_map.end()) {
@@ -19,6 +19,8 @@
 
 #include <optional>
 
+#include <sys/resource.h>
+
 #include <arg_parser.hpp>
 #include <nil/proof-generator/file_operations.hpp>
 #include <nil/proof-generator/prover.hpp>
@@ -38,6 +40,7 @@
 #include <nil/proof-generator/commands/aggregated_fri_proof_command.hpp>
 #include <nil/proof-generator/commands/gen_consistency_check_command.hpp>
 #include <nil/proof-generator/commands/verify_aggregated_command.hpp>
+#include <nil/proof-generator/commands/daemon_command.hpp>
 #include "nil/proof-generator/command_step.hpp"
 #include "nil/proof-generator/output_artifacts/output_artifacts.hpp"
 
@@ -86,7 +89,13 @@ CommandResult run_command(const ProverOptions& opts) {
     po::notify(vm);
 
     CommandType cmd(args);
-    return cmd.execute();
+    auto const result = cmd.execute();
+
+    struct rusage usage;
+    if (::getrusage(RUSAGE_SELF, &usage) == 0) {
+        BOOST_LOG_TRIVIAL(info) << "Peak resident set size: " << usage.ru_maxrss / 1024 << " MB";
+    }
+    return result;
 }
 
 
@@ -110,7 +119,8 @@ int run_prover(const nil::proof_producer::ProverOptions& prover_options) {
         {ProverStage::COMPUTE_COMBINED_Q, run_command<CombinedQGeneratorCommand, CurveType, HashType>},
         {ProverStage::GENERATE_AGGREGATED_FRI_PROOF, run_command<AggregatedFriProofCommand, CurveType, HashType>},
         {ProverStage::GENERATE_CONSISTENCY_CHECKS_PROOF, run_command<GenerateConsistencyCheckCommand, CurveType, HashType>},
-        {ProverStage::AGGREGATED_VERIFY, run_command<AggregatedFRIVerifyCommand, CurveType, HashType>}
+        {ProverStage::AGGREGATED_VERIFY, run_command<AggregatedFRIVerifyCommand, CurveType, HashType>},
+        {ProverStage::DAEMON, run_command<DaemonCommand, CurveType, HashType>}
     };
 
     auto prover_task = [&] {
@@ -0,0 +1,376 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//---------------------------------------------------------------------------//
+
+#ifndef PROOF_GENERATOR_MAPPED_ASSIGNMENT_TABLE_HPP
+#define PROOF_GENERATOR_MAPPED_ASSIGNMENT_TABLE_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <boost/log/trivial.hpp>
+
+#include <nil/actor/core/parallelization_utils.hpp>
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/table_description.hpp>
+
+namespace nil {
+    namespace proof_producer {
+
+        /**
+         * @brief Assignment table stored column by column in the in-memory representation of the field elements.
+         *
+         * Layout of the file, all the integers are in the host byte order:
+         *  - header, padded to header_size bytes;
+         *  - field_type::value_type::one() as it is laid out in memory. The reader compares it against its own one(),
+         *    so a file written for another field, representation or byte order is rejected instead of misread;
+         *  - starting from data_offset (a multiple of data_alignment) the witness, public input, constant and selector
+         *    columns. Every column holds rows_amount elements and starts column_stride bytes after the previous one.
+         *
+         * Because the columns are aligned and stored in the in-memory representation, the file can be mapped and its
+         * columns used in place, or copied into a plonk_table one column per thread without any decoding.
+         */
+        template<typename BlueprintField>
+        class mapped_assignment_table {
+        public:
+            using Column = nil::crypto3::zk::snark::plonk_column<BlueprintField>;
+            using AssignmentTable = nil::crypto3::zk::snark::plonk_table<BlueprintField, Column>;
+            using AssignmentTableDescription = nil::crypto3::zk::snark::plonk_table_description<BlueprintField>;
+            using value_type = typename BlueprintField::value_type;
+            using column_view = std::span<const value_type>;
+
+            static_assert(std::is_trivially_copyable_v<value_type>,
+                          "Field elements are stored in their in-memory representation");
+
+            constexpr static const std::array<char, 8> magic = {'N', 'I', 'L', 'T', 'A', 'B', 'L', 'E'};
+            constexpr static const std::uint32_t version = 1;
+
+            constexpr static const std::size_t header_size = 64;
+            constexpr static const std::size_t data_alignment = 4096;
+            constexpr static const std::size_t column_alignment = 64;
+
+            struct header_type {
+                std::array<char, 8> magic;
+                std::uint32_t version;
+                std::uint32_t element_size;
+                std::uint32_t witnesses_amount;
+                std::uint32_t public_inputs_amount;
+                std::uint32_t constants_amount;
+                std::uint32_t selectors_amount;
+                std::uint32_t usable_rows_amount;
+                std::uint32_t rows_amount;
+                std::uint64_t column_stride;
+                std::uint64_t data_offset;
+            };
+            static_assert(sizeof(header_type) <= header_size);
+
+            mapped_assignment_table(const mapped_assignment_table&) = delete;
+            mapped_assignment_table& operator=(const mapped_assignment_table&) = delete;
+
+            mapped_assignment_table(mapped_assignment_table&& other) noexcept
+                : data_(std::exchange(other.data_, nullptr))
+                , size_(std::exchange(other.size_, 0))
+                , header_(other.header_)
+                , desc_(other.desc_) {
+            }
+
+            mapped_assignment_table& operator=(mapped_assignment_table&& other) noexcept {
+                if (this != &other) {
+                    unmap();
+                    data_ = std::exchange(other.data_, nullptr);
+                    size_ = std::exchange(other.size_, 0);
+                    header_ = other.header_;
+                    desc_ = other.desc_;
+                }
+                return *this;
+            }
+
+            ~mapped_assignment_table() {
+                unmap();
+            }
+
+            /**
+             * @brief Rows amount of the written columns, the same padding as in the marshalled binary format.
+             */
+            static std::uint32_t padded_rows_amount(std::uint32_t usable_rows_amount) {
+                std::uint32_t rows_amount = 8;
+                while (rows_amount <= usable_rows_amount) {
+                    rows_amount *= 2;
+                }
+                return rows_amount;
+            }
+
+            /**
+             * @brief Write table into output stream. Columns shorter than rows amount are padded with zeroes.
+             */
+            static bool write(std::ostream& out, const AssignmentTable& table, const AssignmentTableDescription& desc) {
+                header_type header{};
+                header.magic = magic;
+                header.version = version;
+                header.element_size = sizeof(value_type);
+                header.witnesses_amount = table.witnesses_amount();
+                header.public_inputs_amount = table.public_inputs_amount();
+                header.constants_amount = table.constants_amount();
+                header.selectors_amount = table.selectors_amount();
+                header.usable_rows_amount = desc.usable_rows_amount;
+                header.rows_amount = padded_rows_amount(desc.usable_rows_amount);
+                header.column_stride = align_up(std::uint64_t(header.rows_amount) * sizeof(value_type), column_alignment);
+                header.data_offset = align_up(header_size + sizeof(value_type), data_alignment);
+
+                std::array<char, header_size> header_bytes{};
+                std::memcpy(header_bytes.data(), &header, sizeof(header));
+                out.write(header_bytes.data(), header_bytes.size());
+
+                const value_type one = value_type::one();
+                out.write(reinterpret_cast<const char*>(&one), sizeof(one));
+                write_padding(out, header.data_offset - header_size - sizeof(value_type));
+
+                const std::vector<value_type> zeroes(header.rows_amount, value_type::zero());
+                const auto write_column = [&](const Column& column) {
+                    const std::size_t stored = std::min<std::size_t>(column.size(), header.rows_amount);
+                    out.write(reinterpret_cast<const char*>(column.data()), stored * sizeof(value_type));
+                    out.write(reinterpret_cast<const char*>(zeroes.data()), (header.rows_amount - stored) * sizeof(value_type));
+                    write_padding(out, header.column_stride - std::size_t(header.rows_amount) * sizeof(value_type));
+                };
+
+                for (std::uint32_t i = 0; i < header.witnesses_amount; i++) {
+                    write_column(table.witness(i));
+                }
+                for (std::uint32_t i = 0; i < header.public_inputs_amount; i++) {
+                    write_column(table.public_input(i));
+                }
+                for (std::uint32_t i = 0; i < header.constants_amount; i++) {
+                    write_column(table.constant(i));
+                }
+                for (std::uint32_t i = 0; i < header.selectors_amount; i++) {
+                    write_column(table.selector(i));
+                }
+
+                return !out.fail();
+            }
+
+            /**
+             * @brief Check if the file starts with the magic of this format.
+             */
+            static bool is_mapped_file(const std::string& path) {
+                std::ifstream in(path, std::ios::binary | std::ios::in);
+                std::array<char, magic.size()> file_magic{};
+                in.read(file_magic.data(), file_magic.size());
+                return in.good() && file_magic == magic;
+            }
+
+            /**
+             * @brief Map the file into memory and validate its header. Pages are loaded on first access.
+             */
+            static std::optional<mapped_assignment_table> open(const std::string& path) {
+                int fd = ::open(path.c_str(), O_RDONLY);
+                if (fd < 0) {
+                    BOOST_LOG_TRIVIAL(error) << "Unable to open file: " << path;
+                    return std::nullopt;
+                }
+
+                struct stat file_stat;
+                if (::fstat(fd, &file_stat) != 0 || std::size_t(file_stat.st_size) < header_size) {
+                    BOOST_LOG_TRIVIAL(error) << path << ": file is too short for a mapped assignment table";
+                    ::close(fd);
+                    return std::nullopt;
+                }
+
+                const std::size_t size = file_stat.st_size;
+                void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+                ::close(fd);
+                if (data == MAP_FAILED) {
+                    BOOST_LOG_TRIVIAL(error) << "Unable to map file: " << path;
+                    return std::nullopt;
+                }
+
+                mapped_assignment_table result(static_cast<const std::uint8_t*>(data), size);
+                if (!result.validate(path)) {
+                    return std::nullopt;
+                }
+                ::madvise(data, size, MADV_SEQUENTIAL);
+                return result;
+            }
+
+            const AssignmentTableDescription& description() const {
+                return desc_;
+            }
+
+            column_view witness(std::uint32_t index) const {
+                BOOST_ASSERT(index < header_.witnesses_amount);
+                return column(index);
+            }
+
+            column_view public_input(std::uint32_t index) const {
+                BOOST_ASSERT(index < header_.public_inputs_amount);
+                return column(header_.witnesses_amount + index);
+            }
+
+            column_view constant(std::uint32_t index) const {
+                BOOST_ASSERT(index < header_.constants_amount);
+                return column(header_.witnesses_amount + header_.public_inputs_amount + index);
+            }
+
+            column_view selector(std::uint32_t index) const {
+                BOOST_ASSERT(index < header_.selectors_amount);
+                return column(header_.witnesses_amount + header_.public_inputs_amount + header_.constants_amount + index);
+            }
+
+            /**
+             * @brief Copy the mapped columns into a table, columns are copied in parallel.
+             *
+             * The copy can't be replaced by a view over the mapping. plonk_column is a std::vector, and the steps after
+             * the reader share the table as plonk_table<BlueprintField, plonk_column>: the preprocessors, the
+             * preprocessed data cache key and the table writers. The preprocessors copy every column once more into a
+             * polynomial_dfs, which is extended to the evaluation domain in place, so it owns its values in any case.
+             * Mapped pages are clean file pages, so the copy costs one table of anonymous memory and no decoding.
+             * The column views above are for the readers which don't need a plonk_table.
+             */
+            AssignmentTable make_table() const {
+                std::vector<Column> witnesses(header_.witnesses_amount);
+                std::vector<Column> public_inputs(header_.public_inputs_amount);
+                std::vector<Column> constants(header_.constants_amount);
+                std::vector<Column> selectors(header_.selectors_amount);
+
+                std::vector<Column*> columns;
+                columns.reserve(columns_amount());
+                for (auto* container : {&witnesses, &public_inputs, &constants, &selectors}) {
+                    for (auto& column : *container) {
+                        columns.push_back(&column);
+                    }
+                }
+
+                nil::crypto3::parallel_for(0, columns.size(), [this, &columns](std::size_t i) {
+                    const column_view mapped = column(i);
+                    columns[i]->assign(mapped.begin(), mapped.end());
+                }, nil::crypto3::ThreadPool::PoolLevel::HIGH);
+
+                using private_table = typename AssignmentTable::private_table_type;
+                using public_table = typename AssignmentTable::public_table_type;
+
+                return AssignmentTable(
+                    std::make_shared<private_table>(std::move(witnesses)),
+                    std::make_shared<public_table>(
+                        std::move(public_inputs),
+                        std::move(constants),
+                        std::move(selectors)
+                    )
+                );
+            }
+
+        private:
+            mapped_assignment_table(const std::uint8_t* data, std::size_t size)
+                : data_(data)
+                , size_(size)
+                , header_{}
+                , desc_(0, 0, 0, 0) {
+                std::memcpy(&header_, data_, sizeof(header_));
+            }
+
+            static std::uint64_t align_up(std::uint64_t value, std::uint64_t alignment) {
+                return (value + alignment - 1) / alignment * alignment;
+            }
+
+            static void write_padding(std::ostream& out, std::size_t amount) {
+                const std::array<char, data_alignment> zeroes{};
+                while (amount > 0) {
+                    const std::size_t chunk = std::min(amount, zeroes.size());
+                    out.write(zeroes.data(), chunk);
+                    amount -= chunk;
+                }
+            }
+
+            bool validate(const std::string& path) {
+                if (header_.magic != magic) {
+                    BOOST_LOG_TRIVIAL(error) << path << ": not a mapped assignment table";
+                    return false;
+                }
+                if (header_.version != version) {
+                    BOOST_LOG_TRIVIAL(error) << path << ": unsupported mapped assignment table version "
+                                             << header_.version << ", expected " << version;
+                    return false;
+                }
+
+                const value_type one = value_type::one();
+                if (header_.element_size != sizeof(value_type) || size_ < header_size + sizeof(value_type) ||
+                    std::memcmp(data_ + header_size, &one, sizeof(value_type)) != 0) {
+                    BOOST_LOG_TRIVIAL(error) << path << ": field element representation does not match the field";
+                    return false;
+                }
+
+                if (header_.data_offset % data_alignment != 0 || header_.column_stride % column_alignment != 0 ||
+                    header_.column_stride < std::uint64_t(header_.rows_amount) * sizeof(value_type) ||
+                    header_.usable_rows_amount >= header_.rows_amount ||
+                    size_ < header_.data_offset + header_.column_stride * columns_amount()) {
+                    BOOST_LOG_TRIVIAL(error) << path << ": corrupted mapped assignment table header";
+                    return false;
+                }
+
+                desc_ = AssignmentTableDescription(
+                    header_.witnesses_amount,
+                    header_.public_inputs_amount,
+                    header_.constants_amount,
+                    header_.selectors_amount,
+                    header_.usable_rows_amount,
+                    header_.rows_amount
+                );
+                return true;
+            }
+
+            std::size_t columns_amount() const {
+                return std::size_t(header_.witnesses_amount) + header_.public_inputs_amount +
+                       header_.constants_amount + header_.selectors_amount;
+            }
+
+            column_view column(std::size_t index) const {
+                return column_view(
+                    reinterpret_cast<const value_type*>(data_ + header_.data_offset + index * header_.column_stride),
+                    header_.rows_amount
+                );
+            }
+
+            void unmap() {
+                if (data_ != nullptr) {
+                    ::munmap(const_cast<std::uint8_t*>(data_), size_);
+                    data_ = nullptr;
+                    size_ = 0;
+                }
+            }
+
+            const std::uint8_t* data_;
+            std::size_t size_;
+            header_type header_;
+            AssignmentTableDescription desc_;
+        };
+
+    } // namespace proof_producer
+} // namespace nil
+
+#endif // PROOF_GENERATOR_MAPPED_ASSIGNMENT_TABLE_HPP
@@ -46,6 +46,10 @@ namespace nil {
             static const std::map<const circuits::Name, CircuitInitializer> circuit_selector;
 
         public:
+            static bool is_known_circuit(const std::string& circuit_name) {
+                return circuit_selector.contains(circuit_name);
+            }
+
             static std::optional<std::string> initialize_circuit(const std::string& circuit_name,
                 std::shared_ptr<Circuit>& circuit,
                 std::shared_ptr<AssignmentTable>& assignment_table,
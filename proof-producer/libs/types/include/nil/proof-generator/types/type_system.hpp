@@ -17,6 +17,9 @@
 #ifndef PROOF_GENERATOR_ASSIGNER_TYPE_SYSTEM_HPP
 #define PROOF_GENERATOR_ASSIGNER_TYPE_SYSTEM_HPP
 
+#include <cstddef>
+#include <string>
+
 #include <nil/marshalling/endianness.hpp>
 #include <nil/marshalling/field_type.hpp>
 #include <nil/marshalling/status_type.hpp>
@@ -102,6 +105,12 @@ namespace nil {
             std::size_t lambda{9};
             std::size_t grind{0};
         };
+
+        // on-disk cache of public preprocessing results, disabled when the directory is empty
+        struct PreprocessedDataCacheConfig {
+            std::string directory;
+            std::size_t max_size_mb{16384};
+        };
     }
 }
 
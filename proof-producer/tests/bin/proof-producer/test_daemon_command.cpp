@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+#include <boost/program_options.hpp>
+
+#include <nil/proof-generator/commands/daemon_command.hpp>
+
+
+class DaemonTests: public ::testing::Test {
+
+    public:
+        using CurveType = nil::crypto3::algebra::curves::pallas;
+        using HashType = nil::crypto3::hashes::keccak_1600<256>;
+
+        using Cache = nil::proof_producer::CircuitCache<CurveType, HashType>;
+        using Daemon = nil::proof_producer::DaemonCommand<CurveType, HashType>;
+
+        static nil::proof_producer::CircuitsLimits limits(std::size_t max_exp_rows) {
+            nil::proof_producer::CircuitsLimits circuit_limits;
+            circuit_limits.max_exp_rows = max_exp_rows;
+            return circuit_limits;
+        }
+
+        // answers of the daemon to the jobs, one per line
+        static std::vector<std::string> serve(Daemon& daemon, const std::string& jobs) {
+            std::istringstream in(jobs);
+            std::ostringstream out;
+            daemon.serve(in, out);
+
+            std::vector<std::string> answers;
+            std::istringstream lines(out.str());
+            for (std::string line; std::getline(lines, line);) {
+                answers.push_back(line);
+            }
+            return answers;
+        }
+
+        static Daemon make_daemon(std::size_t max_cached_circuits) {
+            boost::program_options::options_description desc;
+            Daemon::Args args(desc);
+            args.max_cached_circuits = max_cached_circuits;
+            return Daemon(args);
+        }
+
+        const nil::proof_producer::PlaceholderConfig config_{};
+};
+
+
+TEST_F(DaemonTests, CacheHitAndMiss) {
+    Cache cache(2);
+
+    auto& entry = cache.get("exp", limits(100), config_);
+    EXPECT_EQ(&cache.get("exp", limits(100), config_), &entry);
+    EXPECT_EQ(cache.size(), 1);
+
+    // the limits and the config are a part of the key
+    EXPECT_NE(&cache.get("exp", limits(200), config_), &entry);
+    EXPECT_EQ(cache.size(), 2);
+
+    auto config = config_;
+    config.lambda++;
+    cache.get("exp", limits(100), config);
+    EXPECT_TRUE(cache.contains("exp", limits(100), config));
+    EXPECT_EQ(cache.size(), 2);
+}
+
+TEST_F(DaemonTests, CacheEvictsLeastRecentlyUsed) {
+    Cache cache(2);
+
+    cache.get("exp", limits(100), config_);
+    cache.get("keccak", limits(100), config_);
+    cache.get("exp", limits(100), config_); // keccak is the least recently used now
+
+    cache.get("bytecode", limits(100), config_);
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_TRUE(cache.contains("exp", limits(100), config_));
+    EXPECT_FALSE(cache.contains("keccak", limits(100), config_));
+    EXPECT_TRUE(cache.contains("bytecode", limits(100), config_));
+
+    cache.erase("exp", limits(100), config_);
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_FALSE(cache.contains("exp", limits(100), config_));
+}
+
+TEST_F(DaemonTests, FailedJobs) {
+    auto daemon = make_daemon(1);
+    const std::string missing_trace = std::string(TEST_DATA_DIR) + "no/such/trace";
+
+    const auto answers = serve(daemon,
+        // the preset succeeds and stays cached, the assigner fails on the missing trace
+        "--circuit-name exp --trace " + missing_trace + "\n"
+        "stats\n"
+        // the unknown circuit is rejected before it can evict the cached one
+        "--circuit-name no_such_circuit --trace " + missing_trace + "\n"
+        "stats\n"
+        // malformed arguments
+        "--circuit-name\n"
+        "stats\n"
+    );
+
+    ASSERT_EQ(answers.size(), 6);
+    EXPECT_TRUE(answers[0].starts_with("error ")) << answers[0];
+    EXPECT_NE(answers[1].find("jobs=1 failed=1"), std::string::npos) << answers[1];
+    EXPECT_NE(answers[1].find("cached_circuits=1"), std::string::npos) << answers[1];
+
+    EXPECT_TRUE(answers[2].starts_with("error ")) << answers[2];
+    EXPECT_NE(answers[2].find("Unknown circuit name no_such_circuit"), std::string::npos) << answers[2];
+    EXPECT_NE(answers[3].find("jobs=2 failed=2"), std::string::npos) << answers[3];
+    EXPECT_NE(answers[3].find("cached_circuits=1"), std::string::npos) << answers[3];
+
+    EXPECT_TRUE(answers[4].starts_with("error ")) << answers[4];
+    EXPECT_NE(answers[5].find("jobs=3 failed=3"), std::string::npos) << answers[5];
+    EXPECT_NE(answers[5].find("cached_circuits=1"), std::string::npos) << answers[5];
+}
+
+TEST_F(DaemonTests, Shutdown) {
+    auto daemon = make_daemon(1);
+    std::istringstream in("stats\nshutdown\nstats\n");
+    std::ostringstream out;
+    EXPECT_TRUE(daemon.serve(in, out));
+    EXPECT_NE(out.str().find("jobs=0 failed=0"), std::string::npos) << out.str();
+    EXPECT_TRUE(out.str().ends_with("ok\n")) << out.str();
+}
@@ -0,0 +1,292 @@
+#include <gtest/gtest.h>
+
+#include <csignal>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <boost/filesystem.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
+
+#include <nil/marshalling/endianness.hpp>
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/status_type.hpp>
+
+#include <nil/proof-generator/file_operations.hpp>
+#include <nil/proof-generator/marshalling_utils.hpp>
+
+
+namespace {
+
+    using Endianness = nil::crypto3::marshalling::option::big_endian;
+    using TTypeBase = nil::crypto3::marshalling::field_type<Endianness>;
+    using FieldType = nil::crypto3::algebra::curves::pallas::base_field_type;
+    using FieldValue = typename FieldType::value_type;
+    using MarshalledVector = nil::crypto3::marshalling::types::field_element_vector<FieldValue, TTypeBase>;
+
+    using OutputIterator = nil::proof_producer::fd_window_iterator<nil::proof_producer::fd_output_window>;
+    using InputIterator = nil::proof_producer::fd_window_iterator<nil::proof_producer::fd_input_window>;
+
+    static_assert(nil::crypto3::marshalling::has_member_function_contiguous_bytes<OutputIterator>::value);
+    static_assert(nil::crypto3::marshalling::has_member_function_contiguous_bytes<InputIterator>::value);
+    static_assert(!nil::crypto3::marshalling::has_member_function_contiguous_bytes<std::uint8_t*>::value);
+
+    std::vector<std::uint8_t> byte_pattern(std::size_t size) {
+        std::vector<std::uint8_t> bytes(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            bytes[i] = static_cast<std::uint8_t>(i * 31 + 7);
+        }
+        return bytes;
+    }
+
+    std::vector<FieldValue> random_elements(std::size_t size) {
+        std::vector<FieldValue> values(size);
+        for (auto& value : values) {
+            value = nil::crypto3::algebra::random_element<FieldType>();
+        }
+        return values;
+    }
+
+    // the encoding of the old path, through a buffer for the whole output
+    std::vector<std::uint8_t> encode_to_vector(const MarshalledVector& marshalled) {
+        std::vector<std::uint8_t> bytes(marshalled.length(), 0x00);
+        auto write_iter = bytes.begin();
+        EXPECT_TRUE(marshalled.write(write_iter, bytes.size()) == nil::crypto3::marshalling::status_type::success);
+        return bytes;
+    }
+
+} // namespace
+
+
+class MarshallingFdTest: public ::testing::Test {
+    protected:
+        void SetUp() override {
+            path_ = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("fd-io-%%%%-%%%%");
+        }
+
+        void TearDown() override {
+            boost::filesystem::remove(path_);
+        }
+
+        int open_for_writing() const {
+            return ::open(path_.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        }
+
+        int open_for_reading() const {
+            return ::open(path_.c_str(), O_RDONLY);
+        }
+
+        std::vector<std::uint8_t> file_bytes() const {
+            const auto bytes = nil::proof_producer::read_file_to_vector(path_.string());
+            EXPECT_TRUE(bytes.has_value());
+            return bytes.value_or(std::vector<std::uint8_t>{});
+        }
+
+        boost::filesystem::path path_;
+};
+
+
+TEST_F(MarshallingFdTest, WindowRoundTripAcrossBoundaries) {
+    constexpr std::size_t capacity = 16;
+    const auto expected = byte_pattern(5 * capacity + 3);
+
+    const int out_fd = open_for_writing();
+    ASSERT_GE(out_fd, 0);
+    {
+        nil::proof_producer::fd_output_window window(out_fd, capacity);
+        OutputIterator iter(window, 0);
+        // writes through copies of the iterator ahead of it, then moves it, as marshalling does
+        for (std::size_t i = 0; i < expected.size(); i += 5) {
+            const std::size_t run = std::min<std::size_t>(5, expected.size() - i);
+            for (std::size_t k = 0; k < run; ++k) {
+                *(iter + k) = expected[i + k];
+            }
+            iter += run;
+        }
+        ASSERT_TRUE(window.flush(expected.size()));
+    }
+    ::close(out_fd);
+    EXPECT_EQ(file_bytes(), expected);
+
+    const int in_fd = open_for_reading();
+    ASSERT_GE(in_fd, 0);
+    nil::proof_producer::fd_input_window window(in_fd, expected.size(), capacity);
+    InputIterator begin(window, 0);
+    std::vector<std::uint8_t> read(begin, begin + expected.size());
+    EXPECT_EQ(read, expected);
+    // jumps back and forth over window boundaries
+    for (std::size_t offset : {70u, 3u, 47u, 16u, 15u, 82u, 0u}) {
+        EXPECT_EQ(begin[offset], expected[offset]) << "offset " << offset;
+    }
+    EXPECT_FALSE(window.failed());
+    ::close(in_fd);
+}
+
+TEST_F(MarshallingFdTest, ContiguousBytesAcrossBoundaries) {
+    constexpr std::size_t capacity = 16;
+    const auto expected = byte_pattern(4 * capacity);
+
+    const int out_fd = open_for_writing();
+    ASSERT_GE(out_fd, 0);
+    {
+        nil::proof_producer::fd_output_window window(out_fd, capacity);
+        OutputIterator iter(window, 0);
+        EXPECT_EQ(iter.contiguous_bytes(capacity + 1), nullptr);
+        // runs of 12 bytes never line up with the 16 byte window
+        for (std::size_t i = 0; i < expected.size(); i += 12) {
+            const std::size_t run = std::min<std::size_t>(12, expected.size() - i);
+            std::uint8_t* bytes = iter.contiguous_bytes(run);
+            ASSERT_NE(bytes, nullptr);
+            std::copy(expected.begin() + i, expected.begin() + i + run, bytes);
+            iter += run;
+        }
+        ASSERT_TRUE(window.flush(expected.size()));
+    }
+    ::close(out_fd);
+    EXPECT_EQ(file_bytes(), expected);
+
+    const int in_fd = open_for_reading();
+    ASSERT_GE(in_fd, 0);
+    nil::proof_producer::fd_input_window window(in_fd, expected.size(), capacity);
+    InputIterator iter(window, 0);
+    for (std::size_t i = 0; i + 12 <= expected.size(); i += 12) {
+        const std::uint8_t* bytes = (iter + i).contiguous_bytes(12);
+        ASSERT_NE(bytes, nullptr);
+        EXPECT_TRUE(std::equal(bytes, bytes + 12, expected.begin() + i)) << "offset " << i;
+    }
+    EXPECT_EQ((iter + (expected.size() - 4)).contiguous_bytes(5), nullptr);
+    EXPECT_EQ(iter.contiguous_bytes(capacity + 1), nullptr);
+    EXPECT_FALSE(window.failed());
+    ::close(in_fd);
+}
+
+TEST_F(MarshallingFdTest, FieldElementsLargerThanWindow) {
+    // 2 MiB of elements, twice the default window
+    const auto values = random_elements(1 << 16);
+    const auto marshalled = nil::crypto3::marshalling::types::fill_field_element_vector<FieldValue, Endianness>(values);
+    ASSERT_GT(marshalled.length(), 2 * nil::proof_producer::fd_output_window::default_capacity - 1);
+
+    ASSERT_TRUE(nil::proof_producer::detail::encode_marshalling_to_file(path_, marshalled));
+    EXPECT_EQ(file_bytes(), encode_to_vector(marshalled));
+
+    const auto decoded = nil::proof_producer::detail::decode_marshalling_from_file<MarshalledVector>(path_);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ((nil::crypto3::marshalling::types::make_field_element_vector<FieldValue, Endianness>(*decoded)), values);
+}
+
+TEST_F(MarshallingFdTest, FieldElementsAcrossSmallWindows) {
+    // 100 byte windows hold 3 elements of 32 bytes, the runs of elements don't line up with the windows
+    constexpr std::size_t capacity = 100;
+    const auto values = random_elements(50);
+    const auto marshalled = nil::crypto3::marshalling::types::fill_field_element_vector<FieldValue, Endianness>(values);
+    const std::size_t length = marshalled.length();
+
+    const int out_fd = open_for_writing();
+    ASSERT_GE(out_fd, 0);
+    {
+        nil::proof_producer::fd_output_window window(out_fd, capacity);
+        OutputIterator iter(window, 0);
+        ASSERT_TRUE(marshalled.write(iter, length) == nil::crypto3::marshalling::status_type::success);
+        ASSERT_TRUE(window.flush(length));
+    }
+    ::close(out_fd);
+    EXPECT_EQ(file_bytes(), encode_to_vector(marshalled));
+
+    const int in_fd = open_for_reading();
+    ASSERT_GE(in_fd, 0);
+    nil::proof_producer::fd_input_window window(in_fd, length, capacity);
+    InputIterator iter(window, 0);
+    MarshalledVector decoded;
+    ASSERT_TRUE(decoded.read(iter, length) == nil::crypto3::marshalling::status_type::success);
+    EXPECT_FALSE(window.failed());
+    EXPECT_EQ((nil::crypto3::marshalling::types::make_field_element_vector<FieldValue, Endianness>(decoded)), values);
+    ::close(in_fd);
+}
+
+TEST_F(MarshallingFdTest, ShortRead) {
+    const auto values = random_elements(1 << 10);
+    const auto marshalled = nil::crypto3::marshalling::types::fill_field_element_vector<FieldValue, Endianness>(values);
+    ASSERT_TRUE(nil::proof_producer::detail::encode_marshalling_to_file(path_, marshalled));
+
+    // the file ends in the middle of an element
+    const auto length = boost::filesystem::file_size(path_);
+    boost::filesystem::resize_file(path_, length - 7);
+    EXPECT_FALSE(nil::proof_producer::detail::decode_marshalling_from_file<MarshalledVector>(path_).has_value());
+
+    // the window expects more bytes than the file has
+    const int in_fd = open_for_reading();
+    ASSERT_GE(in_fd, 0);
+    nil::proof_producer::fd_input_window window(in_fd, length, 64);
+    InputIterator iter(window, 0);
+    std::uint8_t last = iter[length - 1];
+    (void)last;
+    EXPECT_TRUE(window.failed());
+    ::close(in_fd);
+}
+
+TEST_F(MarshallingFdTest, NoReadsAfterFailure) {
+    constexpr std::size_t capacity = 16;
+    const auto bytes = byte_pattern(4 * capacity);
+    const int out_fd = open_for_writing();
+    ASSERT_GE(out_fd, 0);
+    ASSERT_EQ(::write(out_fd, bytes.data(), bytes.size()), static_cast<ssize_t>(bytes.size()));
+    ::close(out_fd);
+
+    // the window expects twice the bytes of the file
+    const int in_fd = open_for_reading();
+    ASSERT_GE(in_fd, 0);
+    nil::proof_producer::fd_input_window window(in_fd, 2 * bytes.size(), capacity);
+    InputIterator iter(window, 0);
+    EXPECT_EQ(iter[capacity], bytes[capacity]);
+    std::uint8_t last = iter[bytes.size() + capacity];
+    (void)last;
+    ASSERT_TRUE(window.failed());
+
+    // the bytes in the file are not read once the window failed
+    ASSERT_NE(bytes[3 * capacity], 0);
+    EXPECT_EQ(iter[3 * capacity], 0);
+    EXPECT_EQ((iter + 3 * capacity).contiguous_bytes(4), nullptr);
+    EXPECT_TRUE(window.failed());
+    ::close(in_fd);
+}
+
+TEST_F(MarshallingFdTest, ShortWrite) {
+    const auto values = random_elements(1 << 16);
+    const auto marshalled = nil::crypto3::marshalling::types::fill_field_element_vector<FieldValue, Endianness>(values);
+
+    // the file size limit cuts the second write of the window short, then fails the next one
+    rlimit saved;
+    ASSERT_EQ(::getrlimit(RLIMIT_FSIZE, &saved), 0);
+    const auto saved_handler = std::signal(SIGXFSZ, SIG_IGN);
+    rlimit limited = saved;
+    limited.rlim_cur = nil::proof_producer::fd_output_window::default_capacity * 3 / 2;
+    ASSERT_EQ(::setrlimit(RLIMIT_FSIZE, &limited), 0);
+
+    const bool written = nil::proof_producer::detail::encode_marshalling_to_file(path_, marshalled);
+
+    ASSERT_EQ(::setrlimit(RLIMIT_FSIZE, &saved), 0);
+    std::signal(SIGXFSZ, saved_handler);
+
+    EXPECT_FALSE(written);
+    EXPECT_EQ(boost::filesystem::file_size(path_), limited.rlim_cur);
+}
+
+TEST_F(MarshallingFdTest, WriteFailure) {
+    const auto values = random_elements(16);
+    const auto marshalled = nil::crypto3::marshalling::types::fill_field_element_vector<FieldValue, Endianness>(values);
+
+    const int fd = ::open("/dev/full", O_WRONLY);
+    if (fd < 0) {
+        GTEST_SKIP() << "/dev/full is not available";
+    }
+    EXPECT_FALSE(nil::proof_producer::detail::encode_marshalling_to_fd(fd, marshalled));
+    ::close(fd);
+}
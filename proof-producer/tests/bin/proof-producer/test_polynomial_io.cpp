@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+
+#include <nil/proof-generator/commands/detail/io/polynomial_io.hpp>
+
+
+class PolynomialIOTests: public ::testing::Test {
+
+    public:
+        using CurveType = nil::crypto3::algebra::curves::pallas;
+        using HashType = nil::crypto3::hashes::keccak_1600<256>;
+
+        using PolynomialIO = nil::proof_producer::PolynomialIO<CurveType, HashType>;
+        using polynomial_type = typename PolynomialIO::polynomial_type;
+        using value_type = typename polynomial_type::value_type;
+        using field_type = typename value_type::field_type;
+
+        // two chunks of the parallel sum
+        static constexpr std::size_t rows = 1 << 15;
+
+        void SetUp() override {
+            directory_ = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("polynomial-io-%%%%-%%%%");
+            boost::filesystem::create_directories(directory_);
+        }
+
+        void TearDown() override {
+            boost::filesystem::remove_all(directory_);
+        }
+
+        // a random polynomial of the degree over the domain of the size
+        static polynomial_type random_polynomial(std::size_t degree, std::size_t size) {
+            std::vector<value_type> coefficients(degree + 1);
+            for (auto& coefficient : coefficients) {
+                coefficient = nil::crypto3::algebra::random_element<field_type>();
+            }
+            polynomial_type poly;
+            poly.from_coefficients(coefficients);
+            poly.resize(size);
+            return poly;
+        }
+
+        boost::filesystem::path save(const polynomial_type& poly) {
+            const auto path = directory_ / ("poly_" + std::to_string(files_++));
+            EXPECT_TRUE(PolynomialIO::save_poly_to_file(poly, path));
+            return path;
+        }
+
+        // the sum of the polynomials read one after another, as it was before the parallel sum
+        static polynomial_type serial_sum(const std::vector<boost::filesystem::path>& paths) {
+            polynomial_type sum;
+            for (const auto& path : paths) {
+                const auto poly = PolynomialIO::read_poly_from_file(path);
+                EXPECT_TRUE(poly.has_value()) << path;
+                sum += poly.value();
+            }
+            return sum;
+        }
+
+        boost::filesystem::path directory_;
+        std::size_t files_ = 0;
+};
+
+
+TEST_F(PolynomialIOTests, SumOfMixedSizes) {
+    const std::vector<boost::filesystem::path> paths = {
+        save(random_polynomial(rows / 2 - 1, rows)),
+        // a smaller domain and a constant are read whole
+        save(random_polynomial(100, 1 << 12)),
+        save(polynomial_type(0, 1, nil::crypto3::algebra::random_element<field_type>())),
+        save(random_polynomial(rows - 1, rows)),
+        // a constant over the whole domain
+        save(polynomial_type(0, rows, nil::crypto3::algebra::random_element<field_type>())),
+    };
+
+    const auto sum = PolynomialIO::read_poly_sum_from_files(paths);
+    ASSERT_TRUE(sum.has_value());
+    EXPECT_EQ(sum->size(), rows);
+    EXPECT_EQ(sum->degree(), rows - 1);
+    EXPECT_TRUE(*sum == serial_sum(paths));
+}
+
+TEST_F(PolynomialIOTests, SumDegreeIsTheLargestOne) {
+    const std::vector<boost::filesystem::path> paths = {
+        save(random_polynomial(10, rows)),
+        save(random_polynomial(rows / 4, rows)),
+        save(random_polynomial(7, 1 << 10)),
+    };
+
+    const auto sum = PolynomialIO::read_poly_sum_from_files(paths);
+    ASSERT_TRUE(sum.has_value());
+    EXPECT_EQ(sum->degree(), rows / 4);
+    EXPECT_TRUE(*sum == serial_sum(paths));
+}
+
+TEST_F(PolynomialIOTests, SerialFallbackOnly) {
+    // no polynomial is over the largest domain with a degree, so all of them are read whole
+    const std::vector<boost::filesystem::path> paths = {
+        save(polynomial_type(0, 1, nil::crypto3::algebra::random_element<field_type>())),
+        save(polynomial_type(0, 1 << 4, nil::crypto3::algebra::random_element<field_type>())),
+        save(polynomial_type(0, 1, nil::crypto3::algebra::random_element<field_type>())),
+    };
+
+    const auto sum = PolynomialIO::read_poly_sum_from_files(paths);
+    ASSERT_TRUE(sum.has_value());
+    EXPECT_EQ(sum->degree(), 0);
+    EXPECT_TRUE(*sum == serial_sum(paths));
+
+    const auto single_path = save(random_polynomial(5, 8));
+    const auto single = PolynomialIO::read_poly_sum_from_files({single_path});
+    ASSERT_TRUE(single.has_value());
+    EXPECT_TRUE(*single == serial_sum({single_path}));
+}
+
+TEST_F(PolynomialIOTests, MalformedFiles) {
+    const auto good = save(random_polynomial(rows - 1, rows));
+    const auto header_size = 2 * sizeof(std::uint64_t);
+
+    EXPECT_FALSE(PolynomialIO::read_poly_sum_from_files({good, directory_ / "no_such_file"}).has_value());
+
+    // shorter than the header
+    const auto short_header = save(random_polynomial(3, 4));
+    boost::filesystem::resize_file(short_header, header_size - 1);
+    EXPECT_FALSE(PolynomialIO::read_poly_sum_from_files({good, short_header}).has_value());
+
+    // the values don't match the size in the header
+    const auto truncated = save(random_polynomial(rows - 1, rows));
+    boost::filesystem::resize_file(truncated, boost::filesystem::file_size(truncated) - 1);
+    EXPECT_FALSE(PolynomialIO::read_poly_sum_from_files({good, truncated}).has_value());
+
+    const auto extended = save(random_polynomial(3, 4));
+    boost::filesystem::resize_file(extended, boost::filesystem::file_size(extended) + 32);
+    EXPECT_FALSE(PolynomialIO::read_poly_sum_from_files({good, extended}).has_value());
+
+    // the degree in the header is not less than the size, the degree is the first field of the header
+    const auto bad_degree = save(random_polynomial(3, 4));
+    {
+        boost::filesystem::fstream file(bad_degree, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(sizeof(std::uint64_t) - 1);
+        file.put(4);
+    }
+    EXPECT_FALSE(PolynomialIO::read_poly_sum_from_files({good, bad_degree}).has_value());
+
+    EXPECT_TRUE(PolynomialIO::read_poly_sum_from_files({good}).has_value());
+}
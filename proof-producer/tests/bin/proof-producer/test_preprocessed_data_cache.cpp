@@ -0,0 +1,250 @@
+#include <gtest/gtest.h>
+
+#include <ctime>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include <nil/proof-generator/commands/preset_command.hpp>
+#include <nil/proof-generator/commands/fill_assignment_command.hpp>
+#include <nil/proof-generator/commands/preprocess_command.hpp>
+#include <nil/proof-generator/commands/detail/preprocessed_data_cache.hpp>
+
+
+class PreprocessedDataCacheTests: public ::testing::Test {
+
+    public:
+        using CurveType = nil::crypto3::algebra::curves::pallas;
+        using HashType = nil::crypto3::hashes::keccak_1600<256>;
+
+        using Types = nil::proof_producer::TypeSystem<CurveType, HashType>;
+        using ConstraintSystem = typename Types::ConstraintSystem;
+        using AssignmentTable = typename Types::AssignmentTable;
+        using AssignmentPublicTable = typename Types::AssignmentPublicTable;
+        using TableDescription = typename Types::TableDescription;
+        using PublicPreprocessor = nil::proof_producer::PublicPreprocessStep<CurveType, HashType>;
+        using Cache = nil::proof_producer::PreprocessedDataCache<CurveType, HashType>;
+
+        // the exp circuit filled from a trace, as the prover gets it
+        class CircuitMaker: public nil::proof_producer::command_chain {
+
+        public:
+            CircuitMaker(const std::string& trace_base_path) {
+                using PresetStep = typename nil::proof_producer::PresetStep<CurveType, HashType>::Executor;
+                using Assigner   = typename nil::proof_producer::FillAssignmentStep<CurveType, HashType>::Executor;
+
+                nil::proof_producer::CircuitsLimits circuit_limits;
+                auto& circuit_maker = add_step<PresetStep>(nil::proof_producer::circuits::EXP, circuit_limits);
+                auto& assigner = add_step<Assigner>(circuit_maker, circuit_maker, nil::proof_producer::circuits::EXP,
+                    trace_base_path, nil::proof_producer::AssignerOptions(false, circuit_limits));
+
+                resources::subscribe_value<ConstraintSystem>(circuit_maker, circuit_);
+                resources::subscribe_value<AssignmentTable>(assigner, assignment_table_);
+                resources::subscribe_value<TableDescription>(assigner, table_description_);
+            }
+
+            std::shared_ptr<ConstraintSystem> circuit_;
+            std::shared_ptr<AssignmentTable> assignment_table_;
+            std::shared_ptr<TableDescription> table_description_;
+        };
+
+        static void SetUpTestSuite() {
+            maker_ = std::make_unique<CircuitMaker>(std::string(TEST_DATA_DIR) + "exp/exp");
+            ASSERT_TRUE(maker_->execute().succeeded());
+            ASSERT_NE(maker_->circuit_, nullptr);
+            ASSERT_NE(maker_->assignment_table_, nullptr);
+            ASSERT_NE(maker_->table_description_, nullptr);
+        }
+
+        static void TearDownTestSuite() {
+            maker_.reset();
+        }
+
+        void SetUp() override {
+            directory_ = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("preprocessed-cache-%%%%-%%%%");
+        }
+
+        void TearDown() override {
+            boost::filesystem::remove_all(directory_);
+        }
+
+        std::shared_ptr<AssignmentPublicTable> public_table() const {
+            return std::make_shared<AssignmentPublicTable>(*maker_->assignment_table_->public_table());
+        }
+
+        // the public table with one more in a cell of a public input, constant or selector column
+        std::shared_ptr<AssignmentPublicTable> changed_public_table(char kind, std::size_t row) const {
+            auto const& table = *maker_->assignment_table_->public_table();
+            auto public_inputs = table.public_inputs();
+            auto constants = table.constants();
+            auto selectors = table.selectors();
+            auto& columns = kind == 'p' ? public_inputs : kind == 'c' ? constants : selectors;
+            columns.at(0).at(row) += 1;
+            return std::make_shared<AssignmentPublicTable>(public_inputs, constants, selectors);
+        }
+
+        std::string make_key(const AssignmentPublicTable& public_table) const {
+            return Cache::make_key(*maker_->circuit_, *maker_->table_description_, public_table, config_);
+        }
+
+        typename Cache::Entry preprocess() const {
+            return PublicPreprocessor::preprocess(
+                typename PublicPreprocessor::CommitmentSchemeFac(config_),
+                *maker_->circuit_, public_table(), *maker_->table_description_);
+        }
+
+        Cache make_cache(std::size_t max_size_mb = 16384) const {
+            return Cache(nil::proof_producer::PreprocessedDataCacheConfig{directory_.string(), max_size_mb});
+        }
+
+        // the scheme as it is stored, its equality compares the FRI domains by pointer
+        static std::vector<std::uint8_t> marshal(const typename Types::LpcScheme& lpc_scheme) {
+            auto const filled = nil::crypto3::marshalling::types::fill_commitment_scheme<
+                typename Types::Endianness, typename Types::LpcScheme>(lpc_scheme);
+            std::vector<std::uint8_t> bytes(filled.length());
+            auto write_iter = bytes.begin();
+            EXPECT_TRUE(filled.write(write_iter, bytes.size()) == nil::crypto3::marshalling::status_type::success);
+            return bytes;
+        }
+
+        static std::uintmax_t directory_size(const boost::filesystem::path& path) {
+            std::uintmax_t size = 0;
+            for (auto const& file : boost::filesystem::directory_iterator(path)) {
+                size += boost::filesystem::file_size(file.path());
+            }
+            return size;
+        }
+
+        static std::unique_ptr<CircuitMaker> maker_;
+        const nil::proof_producer::PlaceholderConfig config_{};
+        boost::filesystem::path directory_;
+};
+
+std::unique_ptr<PreprocessedDataCacheTests::CircuitMaker> PreprocessedDataCacheTests::maker_;
+
+
+TEST_F(PreprocessedDataCacheTests, KeyIsStable) {
+    const auto key = make_key(*public_table());
+    EXPECT_EQ(key.size(), 64);
+    EXPECT_EQ(make_key(*public_table()), key);
+    EXPECT_EQ(make_key(*maker_->assignment_table_->public_table()), key);
+}
+
+TEST_F(PreprocessedDataCacheTests, KeyDependsOnEverythingPreprocessingDoes) {
+    const auto key = make_key(*public_table());
+
+    // every kind of public column, in the middle of a chunk and past the first chunk of the column
+    ASSERT_GT(maker_->assignment_table_->constants_amount(), 0);
+    ASSERT_GT(maker_->assignment_table_->selectors_amount(), 0);
+    const std::size_t last_row = maker_->table_description_->rows_amount - 1;
+    for (std::size_t row : {std::size_t(1), last_row}) {
+        EXPECT_NE(make_key(*changed_public_table('c', row)), key) << "constant row " << row;
+        EXPECT_NE(make_key(*changed_public_table('s', row)), key) << "selector row " << row;
+        if (maker_->assignment_table_->public_inputs_amount() > 0) {
+            EXPECT_NE(make_key(*changed_public_table('p', row)), key) << "public input row " << row;
+        }
+    }
+
+    auto config = config_;
+    config.lambda++;
+    EXPECT_NE(Cache::make_key(*maker_->circuit_, *maker_->table_description_, *public_table(), config), key);
+
+    auto description = *maker_->table_description_;
+    description.usable_rows_amount--;
+    EXPECT_NE(Cache::make_key(*maker_->circuit_, description, *public_table(), config_), key);
+}
+
+TEST_F(PreprocessedDataCacheTests, StoreAndLoad) {
+    const auto cache = make_cache();
+    const auto key = make_key(*public_table());
+    EXPECT_FALSE(cache.load(key).has_value());
+
+    const auto [public_data, lpc_scheme] = preprocess();
+    cache.store(key, *public_data, *lpc_scheme);
+
+    const auto loaded = cache.load(key);
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_TRUE(*loaded->first == *public_data);
+    EXPECT_EQ(marshal(*loaded->second), marshal(*lpc_scheme));
+
+    // a hit marks the entry as recently used
+    const auto entry_path = directory_ / key;
+    boost::filesystem::last_write_time(entry_path, std::time_t(1000));
+    ASSERT_TRUE(cache.load(key).has_value());
+    EXPECT_GT(boost::filesystem::last_write_time(entry_path), std::time_t(1000));
+}
+
+TEST_F(PreprocessedDataCacheTests, CorruptedEntryIsRemoved) {
+    const auto cache = make_cache();
+    const auto key = make_key(*public_table());
+    const auto [public_data, lpc_scheme] = preprocess();
+    cache.store(key, *public_data, *lpc_scheme);
+
+    const auto entry_path = directory_ / key;
+    for (auto const& file : boost::filesystem::directory_iterator(entry_path)) {
+        boost::filesystem::resize_file(file.path(), boost::filesystem::file_size(file.path()) / 2);
+    }
+    EXPECT_FALSE(cache.load(key).has_value());
+    EXPECT_FALSE(boost::filesystem::exists(entry_path));
+
+    // and is stored again on the next miss
+    cache.store(key, *public_data, *lpc_scheme);
+    EXPECT_TRUE(cache.load(key).has_value());
+}
+
+TEST_F(PreprocessedDataCacheTests, EvictsLeastRecentlyUsed) {
+    const auto key = make_key(*public_table());
+    const auto [public_data, lpc_scheme] = preprocess();
+    make_cache().store(key, *public_data, *lpc_scheme);
+    const std::uintmax_t entry_size = directory_size(directory_ / key);
+    boost::filesystem::remove_all(directory_ / key);
+
+    // three older entries of 1 MiB, the limit fits the new entry and two of them
+    constexpr std::uintmax_t MiB = 1 << 20;
+    for (auto const& [name, last_used] : {std::pair{"old", 1000}, std::pair{"middle", 2000}, std::pair{"new", 3000}}) {
+        const auto path = directory_ / name;
+        boost::filesystem::create_directories(path);
+        boost::filesystem::ofstream(path / "data").close();
+        boost::filesystem::resize_file(path / "data", MiB);
+        boost::filesystem::last_write_time(path, std::time_t(last_used));
+    }
+
+    make_cache((entry_size + MiB - 1) / MiB + 2).store(key, *public_data, *lpc_scheme);
+    EXPECT_FALSE(boost::filesystem::exists(directory_ / "old"));
+    EXPECT_TRUE(boost::filesystem::exists(directory_ / "middle"));
+    EXPECT_TRUE(boost::filesystem::exists(directory_ / "new"));
+    EXPECT_TRUE(boost::filesystem::exists(directory_ / key));
+
+    // the entry just stored is kept even if it does not fit the limit alone
+    boost::filesystem::remove_all(directory_ / key);
+    make_cache(0).store(key, *public_data, *lpc_scheme);
+    EXPECT_FALSE(boost::filesystem::exists(directory_ / "middle"));
+    EXPECT_FALSE(boost::filesystem::exists(directory_ / "new"));
+    EXPECT_TRUE(make_cache().load(key).has_value());
+}
+
+TEST_F(PreprocessedDataCacheTests, EvictionSkipsEntriesWhichCantBeMeasured) {
+    const auto key = make_key(*public_table());
+    const auto [public_data, lpc_scheme] = preprocess();
+    make_cache().store(key, *public_data, *lpc_scheme);
+    const std::uintmax_t entry_size = directory_size(directory_ / key);
+    boost::filesystem::remove_all(directory_ / key);
+
+    // the size of a directory inside an entry can't be queried, the rest of the entries still count
+    constexpr std::uintmax_t MiB = 1 << 20;
+    for (auto const& [name, last_used] : {std::pair{"old", 1000}, std::pair{"middle", 2000}, std::pair{"new", 3000}}) {
+        const auto path = directory_ / name;
+        boost::filesystem::create_directories(path / "subdirectory");
+        boost::filesystem::ofstream(path / "data").close();
+        boost::filesystem::resize_file(path / "data", MiB);
+        boost::filesystem::last_write_time(path, std::time_t(last_used));
+    }
+
+    make_cache((entry_size + MiB - 1) / MiB + 2).store(key, *public_data, *lpc_scheme);
+    EXPECT_FALSE(boost::filesystem::exists(directory_ / "old"));
+    EXPECT_TRUE(boost::filesystem::exists(directory_ / "middle"));
+    EXPECT_TRUE(boost::filesystem::exists(directory_ / "new"));
+    EXPECT_TRUE(boost::filesystem::exists(directory_ / key));
+}
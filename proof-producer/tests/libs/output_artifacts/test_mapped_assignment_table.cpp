@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <vector>
+#include <sstream>
+
+#include <boost/filesystem.hpp>
+
+#include <nil/marshalling/endianness.hpp>
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/status_type.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/marshalling/zk/types/plonk/assignment_table.hpp>
+
+#include <nil/proof-generator/output_artifacts/assignment_table_writer.hpp>
+#include <nil/proof-generator/output_artifacts/mapped_assignment_table.hpp>
+
+using Endianness = nil::crypto3::marshalling::option::big_endian;
+using TTypeBase = nil::crypto3::marshalling::field_type<Endianness>;
+
+using BlueprintField = typename nil::crypto3::algebra::curves::pallas::base_field_type;
+
+using Writer = nil::proof_producer::assignment_table_writer<Endianness, BlueprintField>;
+using MappedTable = nil::proof_producer::mapped_assignment_table<BlueprintField>;
+using AssignmentTable = Writer::AssignmentTable;
+using AssignmentTableDescription = Writer::AssignmentTableDescription;
+
+using MarshalledTable = nil::crypto3::marshalling::types::plonk_assignment_table<TTypeBase, AssignmentTable>;
+
+
+class MappedAssignmentTableTest: public ::testing::Test {
+    protected:
+        void SetUp() override {
+            table_file_path_ = std::string(TEST_DATA_DIR) + "assignment.tbl";
+            std::ifstream in(table_file_path_, std::ios::binary | std::ios::in | std::ios::ate);
+            ASSERT_TRUE(in.is_open());
+            const auto fsize = in.tellg();
+            in.seekg(0, std::ios::beg);
+            table_bytes_.resize(fsize);
+            in.read(reinterpret_cast<char*>(table_bytes_.data()), fsize);
+            ASSERT_FALSE(in.fail());
+
+            MarshalledTable marshalled_table;
+            auto read_iter = table_bytes_.begin();
+            auto const status = marshalled_table.read(read_iter, table_bytes_.size());
+            ASSERT_TRUE(status == nil::crypto3::marshalling::status_type::success);
+
+            auto [desc, table] = nil::crypto3::marshalling::types::make_assignment_table<Endianness, AssignmentTable>(marshalled_table);
+            table_ = std::move(table);
+            desc_ = std::move(desc);
+
+            mapped_file_path_ = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%.mtbl")).string();
+        }
+
+        void TearDown() override {
+            boost::filesystem::remove(mapped_file_path_);
+        }
+
+        void write_mapped_file() {
+            std::ofstream out(mapped_file_path_, std::ios::binary | std::ios::out);
+            ASSERT_TRUE(out.is_open());
+            ASSERT_TRUE(MappedTable::write(out, table_, desc_));
+        }
+
+        static void expect_same_column(const MappedTable::column_view& mapped, const MappedTable::Column& expected) {
+            ASSERT_EQ(mapped.size(), expected.size());
+            EXPECT_TRUE(std::equal(mapped.begin(), mapped.end(), expected.begin()));
+        }
+
+    protected:
+        std::string table_file_path_;
+        std::string mapped_file_path_;
+        std::vector<std::uint8_t> table_bytes_;
+        AssignmentTable table_;
+        AssignmentTableDescription desc_{0,0,0,0};
+};
+
+TEST_F(MappedAssignmentTableTest, DetectFormat)
+{
+    write_mapped_file();
+    EXPECT_TRUE(MappedTable::is_mapped_file(mapped_file_path_));
+    EXPECT_FALSE(MappedTable::is_mapped_file(table_file_path_));
+    EXPECT_FALSE(MappedTable::open(table_file_path_).has_value());
+}
+
+TEST_F(MappedAssignmentTableTest, ZeroCopyColumns)
+{
+    write_mapped_file();
+    auto mapped = MappedTable::open(mapped_file_path_);
+    ASSERT_TRUE(mapped.has_value());
+
+    const auto& desc = mapped->description();
+    EXPECT_EQ(desc.witness_columns, desc_.witness_columns);
+    EXPECT_EQ(desc.public_input_columns, desc_.public_input_columns);
+    EXPECT_EQ(desc.constant_columns, desc_.constant_columns);
+    EXPECT_EQ(desc.selector_columns, desc_.selector_columns);
+    EXPECT_EQ(desc.usable_rows_amount, desc_.usable_rows_amount);
+    EXPECT_EQ(desc.rows_amount, desc_.rows_amount);
+
+    for (std::uint32_t i = 0; i < table_.witnesses_amount(); i++) {
+        expect_same_column(mapped->witness(i), table_.witness(i));
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(mapped->witness(i).data()) % MappedTable::column_alignment, 0);
+    }
+    for (std::uint32_t i = 0; i < table_.public_inputs_amount(); i++) {
+        expect_same_column(mapped->public_input(i), table_.public_input(i));
+    }
+    for (std::uint32_t i = 0; i < table_.constants_amount(); i++) {
+        expect_same_column(mapped->constant(i), table_.constant(i));
+    }
+    for (std::uint32_t i = 0; i < table_.selectors_amount(); i++) {
+        expect_same_column(mapped->selector(i), table_.selector(i));
+    }
+}
+
+// Mapped table converted back to the marshalled format must give the original file.
+TEST_F(MappedAssignmentTableTest, RoundTripToMarshalledFormat)
+{
+    write_mapped_file();
+    auto mapped = MappedTable::open(mapped_file_path_);
+    ASSERT_TRUE(mapped.has_value());
+
+    const AssignmentTable table = mapped->make_table();
+    EXPECT_TRUE(table == table_);
+
+    std::stringstream out;
+    Writer::write_binary_assignment(out, table, mapped->description());
+    out.flush();
+
+    ASSERT_EQ(out.tellp(), table_bytes_.size());
+    ASSERT_TRUE(std::memcmp(out.rdbuf()->view().data(), table_bytes_.data(), table_bytes_.size()) == 0);
+}
+
+TEST_F(MappedAssignmentTableTest, RejectOtherField)
+{
+    write_mapped_file();
+    using OtherField = nil::crypto3::algebra::curves::pallas::scalar_field_type;
+    EXPECT_FALSE(nil::proof_producer::mapped_assignment_table<OtherField>::open(mapped_file_path_).has_value());
+}
+
+TEST_F(MappedAssignmentTableTest, RejectTruncatedFile)
+{
+    write_mapped_file();
+    boost::filesystem::resize_file(mapped_file_path_, boost::filesystem::file_size(mapped_file_path_) - 1);
+    EXPECT_FALSE(MappedTable::open(mapped_file_path_).has_value());
+}